@@ -236,7 +236,8 @@ int main(int argc, char* argv[])
     if (!commandLineDBPath.isNull())
     {
         // command line option set?
-        params = DbEngineParameters::parametersForSQLiteDefaultFile(commandLineDBPath);
+        params         = DbEngineParameters::parametersForSQLiteDefaultFile(commandLineDBPath);
+        params.walMode = DbEngineParameters::parametersFromConfig(config).walMode;
         ApplicationSettings::instance()->setDatabaseDirSetAtCmd(true);
         ApplicationSettings::instance()->setDbEngineParameters(params);
     }
@@ -117,6 +117,32 @@ TableViewColumn::ColumnFlags ColumnAudioVideoProperties::getColumnFlags() const
     return flags;
 }
 
+DatabaseFields::Set ColumnAudioVideoProperties::getRequiredDatabaseFields() const
+{
+    switch (subColumn)
+    {
+        case SubColumnAudioBitRate:
+            return DatabaseFields::Set(DatabaseFields::AudioBitRate);
+
+        case SubColumnAudioChannelType:
+            return DatabaseFields::Set(DatabaseFields::AudioChannelType);
+
+        case SubColumnAudioCodec:
+            return DatabaseFields::Set(DatabaseFields::AudioCodec);
+
+        case SubColumnDuration:
+            return DatabaseFields::Set(DatabaseFields::Duration);
+
+        case SubColumnFrameRate:
+            return DatabaseFields::Set(DatabaseFields::FrameRate);
+
+        case SubColumnVideoCodec:
+            return DatabaseFields::Set(DatabaseFields::VideoCodec);
+    }
+
+    return DatabaseFields::Set();
+}
+
 QVariant ColumnAudioVideoProperties::data(TableViewModel::Item* const item, const int role) const
 {
     if (role != Qt::DisplayRole)
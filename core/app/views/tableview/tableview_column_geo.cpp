@@ -122,6 +122,13 @@ TableViewColumn::ColumnFlags ColumnGeoProperties::getColumnFlags() const
 
     return flags;
 }
+
+DatabaseFields::Set ColumnGeoProperties::getRequiredDatabaseFields() const
+{
+    // The positions are always cached together in ItemInfo.
+    return DatabaseFields::Set(DatabaseFields::LatitudeNumber | DatabaseFields::LongitudeNumber | DatabaseFields::Altitude);
+}
+
 QVariant ColumnGeoProperties::data(TableViewModel::Item* const item, const int role) const
 {
     if ( (role != Qt::DisplayRole) &&
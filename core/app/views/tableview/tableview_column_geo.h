@@ -62,6 +62,7 @@ public:
 
     virtual QString getTitle() const;
     virtual ColumnFlags getColumnFlags() const;
+    virtual DatabaseFields::Set getRequiredDatabaseFields() const;
     virtual QVariant data(TableViewModel::Item* const item, const int role) const;
     virtual ColumnCompareResult compare(TableViewModel::Item* const itemA, TableViewModel::Item* const itemB) const;
     virtual TableViewColumnConfigurationWidget* getConfigurationWidget(QWidget* const parentWidget) const;
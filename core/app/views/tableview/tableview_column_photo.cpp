@@ -139,6 +139,44 @@ TableViewColumn::ColumnFlags ColumnPhotoProperties::getColumnFlags() const
     return flags;
 }
 
+DatabaseFields::Set ColumnPhotoProperties::getRequiredDatabaseFields() const
+{
+    switch (subColumn)
+    {
+        case SubColumnCameraMaker:
+            return DatabaseFields::Set(DatabaseFields::Make);
+
+        case SubColumnCameraModel:
+            return DatabaseFields::Set(DatabaseFields::Model);
+
+        case SubColumnLens:
+            return DatabaseFields::Set(DatabaseFields::Lens);
+
+        case SubColumnAperture:
+            return DatabaseFields::Set(DatabaseFields::Aperture);
+
+        case SubColumnFocal:
+            return DatabaseFields::Set(DatabaseFields::FocalLength | DatabaseFields::FocalLength35);
+
+        case SubColumnExposure:
+            return DatabaseFields::Set(DatabaseFields::ExposureTime);
+
+        case SubColumnSensitivity:
+            return DatabaseFields::Set(DatabaseFields::Sensitivity);
+
+        case SubColumnModeProgram:
+            return DatabaseFields::Set(DatabaseFields::ExposureMode | DatabaseFields::ExposureProgram);
+
+        case SubColumnFlash:
+            return DatabaseFields::Set(DatabaseFields::FlashMode);
+
+        case SubColumnWhiteBalance:
+            return DatabaseFields::Set(DatabaseFields::WhiteBalance);
+    }
+
+    return DatabaseFields::Set();
+}
+
 QVariant ColumnPhotoProperties::data(TableViewModel::Item* const item, const int role) const
 {
     if (role != Qt::DisplayRole)
@@ -42,6 +42,7 @@
 #include "itemfiltermodel.h"
 #include "itemfiltersettings.h"
 #include "iteminfo.h"
+#include "iteminfolist.h"
 #include "tableview_columnfactory.h"
 #include "tableview_selection_model_syncer.h"
 
@@ -371,6 +372,12 @@ void TableViewModel::addColumnAt(const TableViewColumnConfiguration& configurati
         d->columnObjects.insert(newColumnIndex, newColumn);
     }
 
+    if (s->isActive)
+    {
+        loadRequiredDatabaseFields(ItemInfoList(s->imageModel->imageInfos()),
+                                   QList<TableViewColumn*>() << newColumn);
+    }
+
     endInsertColumns();
 
     connect(newColumn, SIGNAL(signalDataChanged(qlonglong)),
@@ -494,6 +501,15 @@ void TableViewModel::slotSourceRowsInserted(const QModelIndex& parent, int start
         return;
     }
 
+    ItemInfoList infos;
+
+    for (int i = start ; i <= end ; ++i)
+    {
+        infos << s->imageModel->imageInfo(s->imageModel->index(i, 0, parent));
+    }
+
+    loadRequiredDatabaseFields(infos, d->columnObjects);
+
     for (int i = start ; i <= end ; ++i)
     {
         const QModelIndex sourceIndex = s->imageModel->index(i, 0, parent);
@@ -796,6 +812,8 @@ void TableViewModel::slotPopulateModel(const bool sendNotifications)
 
     const int sourceRowCount = s->imageModel->rowCount(QModelIndex());
 
+    loadRequiredDatabaseFields(ItemInfoList(s->imageModel->imageInfos()), d->columnObjects);
+
     for (int i = 0 ; i < sourceRowCount ; ++i)
     {
         const QModelIndex sourceModelIndex = s->imageModel->index(i, 0);
@@ -810,6 +828,37 @@ void TableViewModel::slotPopulateModel(const bool sendNotifications)
     }
 }
 
+void TableViewModel::loadRequiredDatabaseFields(const ItemInfoList& infos, const QList<TableViewColumn*>& columns) const
+{
+    // Read the fields needed by the filter and the columns for all items at once,
+    // instead of one database query per item and field. The values are cached in
+    // ItemInfo, and invalidated by the database changesets.
+
+    if (infos.isEmpty())
+    {
+        return;
+    }
+
+    DatabaseFields::Set requiredFields;
+
+    foreach (TableViewColumn* const column, columns)
+    {
+        requiredFields.setFields(column->getRequiredDatabaseFields());
+    }
+
+    if (d->imageFilterSettings.isFilteringByTags() || d->imageFilterSettings.isFilteringByText())
+    {
+        infos.loadTagIds();
+    }
+
+    if (d->imageFilterSettings.isFilteringByGeolocation())
+    {
+        requiredFields.setFields(DatabaseFields::Set(DatabaseFields::LatitudeNumber));
+    }
+
+    infos.loadDatabaseFields(requiredFields);
+}
+
 TableViewModel::Item* TableViewModel::createItemFromSourceIndex(const QModelIndex& imageModelIndex)
 {
     ASSERT_MODEL(imageModelIndex, s->imageModel);
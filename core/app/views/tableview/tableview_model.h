@@ -193,6 +193,7 @@ private:
 
     Item* createItemFromSourceIndex(const QModelIndex& imageFilterModelIndex);
     void addSourceModelIndex(const QModelIndex& imageModelIndex, const bool sendNotifications);
+    void loadRequiredDatabaseFields(const ItemInfoList& infos, const QList<TableViewColumn*>& columns) const;
 
 private:
 
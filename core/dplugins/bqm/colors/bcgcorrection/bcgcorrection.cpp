@@ -105,7 +105,7 @@ bool BCGCorrection::toolOperations()
     prm.contrast   = settings()[QLatin1String("Contrast")].toDouble();
     prm.gamma      = settings()[QLatin1String("Gamma")].toDouble();
 
-    BCGFilter bcg(&image(), nullptr, prm);
+    BCGFilter bcg(nullptr, nullptr, prm);
     applyFilter(&bcg);
 
     return (savefromDImg());
@@ -174,7 +174,7 @@ bool ChannelMixer::toolOperations()
     prm.blackGreenGain = settings()[QLatin1String("blackGreenGain")].toDouble();
     prm.blackBlueGain  = settings()[QLatin1String("blackBlueGain")].toDouble();
 
-    MixerFilter mixer(&image(), nullptr, prm);
+    MixerFilter mixer(nullptr, nullptr, prm);
     applyFilter(&mixer);
 
     return (savefromDImg());
@@ -109,7 +109,7 @@ bool ColorBalance::toolOperations()
     prm.green = settings()[QLatin1String("Green")].toDouble();
     prm.blue  = settings()[QLatin1String("Blue")].toDouble();
 
-    CBFilter cb(&image(), nullptr, prm);
+    CBFilter cb(nullptr, nullptr, prm);
     applyFilter(&cb);
 
     return (savefromDImg());
@@ -182,7 +182,7 @@ bool CurvesAdjust::toolOperations()
     prm.values[BlueChannel]       = settings()[QLatin1String("values[BlueChannel]")].value<QPolygon>();
     prm.values[AlphaChannel]      = settings()[QLatin1String("values[AlphaChannel]")].value<QPolygon>();
 
-    CurvesFilter curves(&image(), nullptr, prm);
+    CurvesFilter curves(nullptr, nullptr, prm);
     applyFilter(&curves);
 
     return (savefromDImg());
@@ -49,6 +49,8 @@ public:
 
     BatchTool* clone(QObject* const parent=nullptr) const { return new CurvesAdjust(parent); };
 
+    bool supportsPointFilterChain() const { return true; };
+
     void registerSettingsWidget();
 
 public Q_SLOTS:
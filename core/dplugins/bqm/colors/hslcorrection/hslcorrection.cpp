@@ -109,7 +109,7 @@ bool HSLCorrection::toolOperations()
     prm.lightness  = settings()[QLatin1String("Lightness")].toDouble();
     prm.vibrance   = settings()[QLatin1String("Vibrance")].toDouble();
 
-    HSLFilter hsl(&image(), nullptr, prm);
+    HSLFilter hsl(nullptr, nullptr, prm);
     applyFilter(&hsl);
 
     return (savefromDImg());
@@ -47,6 +47,8 @@ public:
 
     BatchTool* clone(QObject* const parent=nullptr) const { return new HSLCorrection(parent); };
 
+    bool supportsPointFilterChain() const { return true; };
+
     void registerSettingsWidget();
 
 private:
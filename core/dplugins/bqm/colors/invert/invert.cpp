@@ -55,7 +55,7 @@ bool Invert::toolOperations()
         return false;
     }
 
-    InvertFilter inv(&image(), nullptr);
+    InvertFilter inv(nullptr, nullptr);
     applyFilter(&inv);
 
     return (savefromDImg());
@@ -49,6 +49,8 @@ public:
 
     BatchTool* clone(QObject* const parent=nullptr) const { return new Invert(parent); };
 
+    bool supportsPointFilterChain() const { return true; };
+
 private:
 
     bool toolOperations();
@@ -129,7 +129,7 @@ bool WhiteBalance::toolOperations()
     prm.expositionMain = settings()[QLatin1String("expositionMain")].toDouble();
     prm.expositionFine = settings()[QLatin1String("expositionFine")].toDouble();
 
-    WBFilter wb(&image(), nullptr, prm);
+    WBFilter wb(nullptr, nullptr, prm);
     applyFilter(&wb);
 
     return (savefromDImg());
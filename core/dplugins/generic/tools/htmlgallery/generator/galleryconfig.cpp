@@ -167,6 +167,13 @@ GalleryConfig::GalleryConfig()
         = new KConfigSkeleton::ItemString(currentGroup(), QLatin1String("imageSelectionTitle"), m_imageSelectionTitle);
 
     addItem(itemimageSelectionTitle, QLatin1String("imageSelectionTitle"));
+
+    // -------------------
+
+    KConfigSkeleton::ItemBool* const itemincremental
+        = new KConfigSkeleton::ItemBool(currentGroup(), QLatin1String("incremental"), m_incremental, true);
+
+    addItem(itemincremental, QLatin1String("incremental"));
 }
 
 GalleryConfig::~GalleryConfig()
@@ -327,4 +334,15 @@ QString GalleryConfig::imageSelectionTitle() const
     return m_imageSelectionTitle;
 }
 
+void GalleryConfig::setIncremental(bool v)
+{
+    if (!isImmutable(QLatin1String("incremental")))
+        m_incremental = v;
+}
+
+bool GalleryConfig::incremental() const
+{
+    return m_incremental;
+}
+
 } // namespace DigikamGenericHtmlGalleryPlugin
@@ -119,6 +119,9 @@ public:
     void setImageSelectionTitle(const QString&);
     QString imageSelectionTitle() const;
 
+    void setIncremental(bool);
+    bool incremental() const;
+
 protected:
 
     QString    m_theme;
@@ -135,6 +138,7 @@ protected:
     QUrl       m_destUrl;
     int        m_openInBrowser;
     QString    m_imageSelectionTitle; // Gallery title to use for GalleryInfo::ImageGetOption::IMAGES selection.
+    bool       m_incremental;         // Only generate again the images changed since the previous export.
 };
 
 } // namespace DigikamGenericHtmlGalleryPlugin
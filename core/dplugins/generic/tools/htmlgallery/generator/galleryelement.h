@@ -67,6 +67,7 @@ public:
     QDateTime                    m_time;
 
     QString                      m_path;
+    QString                      m_baseFileName;      // Unique web name of the generated files, without extension.
 
     QString                      m_thumbnailFileName;
     QSize                        m_thumbnailSize;
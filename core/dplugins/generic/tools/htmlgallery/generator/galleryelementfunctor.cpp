@@ -28,9 +28,12 @@
 #include <QDir>
 #include <QFile>
 #include <QFileInfo>
+#include <QBuffer>
 #include <QImage>
 #include <QImageReader>
 #include <QLocale>
+#include <QStringList>
+#include <QCryptographicHash>
 
 // KDE includes
 
@@ -42,9 +45,14 @@
 #include "galleryinfo.h"
 #include "gallerygenerator.h"
 #include "galleryelement.h"
+#include "gallerymanifest.h"
 #include "metaengine_rotation.h"
 #include "drawdecoder.h"
 #include "drawinfo.h"
+#include "dimg.h"
+#include "loadsavethread.h"
+#include "previewloadthread.h"
+#include "thumbnailloadthread.h"
 
 using namespace Digikam;
 
@@ -83,9 +91,11 @@ static QImage generateThumbnail(const QImage& fullImage, int size, bool square)
 
 GalleryElementFunctor::GalleryElementFunctor(GalleryGenerator* const generator,
                                              GalleryInfo* const info,
+                                             GalleryManifest* const manifest,
                                              const QString& destDir)
     : m_generator(generator),
       m_info(info),
+      m_manifest(manifest),
       m_destDir(destDir)
 {
 }
@@ -96,73 +106,123 @@ GalleryElementFunctor::~GalleryElementFunctor()
 
 void GalleryElementFunctor::operator()(GalleryElement& element)
 {
-    // Load image
-    QString    path = element.m_path;
-    QImage     originalImage;
-    QString    imageFormat;
-    QByteArray imageData;
-
-    // Check if RAW file.
-    if (DRawDecoder::isRawFile(QUrl::fromLocalFile(path)))
+    if (!m_info->incremental())
     {
-        if (!DRawDecoder::loadRawPreview(originalImage, path))
+        if (!generateImages(element))
         {
-            emitWarning(i18n("Error loading RAW image '%1'", QDir::toNativeSeparators(path)));
             return;
         }
     }
     else
     {
-        QFile imageFile(path);
+        const QByteArray uniqueHash = DImg::getUniqueHashV2(element.m_path);
+        const QByteArray settings   = settingsHash(element);
 
-        if (!imageFile.open(QIODevice::ReadOnly))
+        if (!m_manifest->reuse(element, uniqueHash, settings))
         {
-            emitWarning(i18n("Could not read image '%1'", QDir::toNativeSeparators(path)));
-            return;
+            if (!generateImages(element))
+            {
+                return;
+            }
+
+            m_manifest->update(element, uniqueHash, settings);
         }
+    }
 
-        imageFormat = QLatin1String(QImageReader::imageFormat(&imageFile));
+    readMetadata(element);
+}
+
+bool GalleryElementFunctor::generateImages(GalleryElement& element)
+{
+    QString    path = element.m_path;
+    QImage     fullImage;
+    QSize      originalSize;
+    QString    imageFormat;
+    QByteArray imageData;
 
-        if (imageFormat.isEmpty())
+    // The original file is only read when it is copied in the gallery.
+    if (m_info->useOriginalImageAsFullImage() || m_info->copyOriginalImage())
+    {
+        if (!readOriginal(path, imageData, imageFormat, originalSize))
         {
-            emitWarning(i18n("Format of image '%1' is unknown", QDir::toNativeSeparators(path)));
-            imageFile.close();
-            return;
+            return false;
         }
+    }
 
-        imageData = imageFile.readAll();
-        imageFile.close();
+    // Load full image, with the reduced size preview loaders when it is resized.
+    if (!m_info->useOriginalImageAsFullImage())
+    {
+        DImg img;
+        bool rawPreview = false;
 
-        if (!originalImage.loadFromData(imageData))
+        if (m_info->fullResize())
         {
-            emitWarning(i18n("Error loading image '%1'", QDir::toNativeSeparators(path)));
-            return;
+            img = PreviewLoadThread::loadFastSynchronously(path, m_info->fullSize());
         }
-    }
+        else if (DRawDecoder::isRawFile(QUrl::fromLocalFile(path)))
+        {
+            // The embedded preview of a RAW file is used at its full size, as before.
 
-    // Process images
-    QImage fullImage = originalImage;
+            if (!DRawDecoder::loadRawPreview(fullImage, path))
+            {
+                emitWarning(i18n("Error loading RAW image '%1'", QDir::toNativeSeparators(path)));
+                return false;
+            }
+
+            rawPreview = true;
+        }
+        else
+        {
+            img = PreviewLoadThread::loadHighQualitySynchronously(path);
+        }
+
+        if (!rawPreview)
+        {
+            if (img.isNull())
+            {
+                emitWarning(i18n("Error loading image '%1'", QDir::toNativeSeparators(path)));
+                return false;
+            }
+
+            fullImage = img.copyQImage();
+        }
 
-    if (!m_info->useOriginalImageAsFullImage())
-    {
         if (m_info->fullResize())
         {
-            int size  = m_info->fullSize();
-            fullImage = fullImage.scaled(size, size, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+            int size = m_info->fullSize();
+
+            if ((fullImage.width() > size) || (fullImage.height() > size))
+            {
+                fullImage = fullImage.scaled(size, size, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+            }
         }
 
-        if (element.m_orientation != DMetadata::ORIENTATION_UNSPECIFIED )
+        // The preview loaders rotate the image from its Exif orientation, depending on the settings.
+        if ((rawPreview || !LoadSaveThread::wasExifRotated(img)) &&
+            (element.m_orientation != DMetadata::ORIENTATION_UNSPECIFIED))
         {
             QMatrix matrix = MetaEngineRotation::toMatrix(element.m_orientation);
             fullImage      = fullImage.transformed(matrix);
         }
+
+        if (!originalSize.isValid() && !rawPreview)
+        {
+            originalSize = img.originalSize();
+        }
+    }
+
+    QImage thumbnail = loadThumbnailSource(path, fullImage);
+
+    if (thumbnail.isNull())
+    {
+        emitWarning(i18n("Error loading image '%1'", QDir::toNativeSeparators(path)));
+        return false;
     }
 
-    QImage thumbnail     = generateThumbnail(fullImage, m_info->thumbnailSize(), m_info->thumbnailSquare());
+    thumbnail = generateThumbnail(thumbnail, m_info->thumbnailSize(), m_info->thumbnailSquare());
 
     // Save images
-    QString baseFileName = GalleryGenerator::webifyFileName(element.m_title);
-    baseFileName         = m_uniqueNameHelper.makeNameUnique(baseFileName);
+    QString baseFileName = element.m_baseFileName;
 
     // Save full
     QString fullFileName;
@@ -173,8 +233,10 @@ void GalleryElementFunctor::operator()(GalleryElement& element)
 
         if (!writeDataToFile(imageData, m_destDir + QLatin1Char('/') + fullFileName))
         {
-            return;
+            return false;
         }
+
+        element.m_fullSize = originalSize;
     }
     else
     {
@@ -186,12 +248,13 @@ void GalleryElementFunctor::operator()(GalleryElement& element)
             emitWarning(i18n("Could not save image '%1' to '%2'",
                              QDir::toNativeSeparators(path),
                              QDir::toNativeSeparators(destPath)));
-            return;
+            return false;
         }
+
+        element.m_fullSize = fullImage.size();
     }
 
     element.m_fullFileName = fullFileName;
-    element.m_fullSize     = fullImage.size();
 
     // Save original
     if (m_info->copyOriginalImage())
@@ -200,11 +263,11 @@ void GalleryElementFunctor::operator()(GalleryElement& element)
 
         if (!writeDataToFile(imageData, m_destDir + QLatin1Char('/') + originalFileName))
         {
-            return;
+            return false;
         }
 
         element.m_originalFileName = originalFileName;
-        element.m_originalSize = originalImage.size();
+        element.m_originalSize     = originalSize;
     }
 
     // Save thumbnail
@@ -217,13 +280,107 @@ void GalleryElementFunctor::operator()(GalleryElement& element)
         m_generator->logWarningRequested(i18n("Could not save thumbnail for image '%1' to '%2'",
                                             QDir::toNativeSeparators(path),
                                             QDir::toNativeSeparators(destPath)));
-        return;
+        return false;
     }
 
     element.m_thumbnailFileName = thumbnailFileName;
     element.m_thumbnailSize     = thumbnail.size();
     element.m_valid             = true;
 
+    return true;
+}
+
+bool GalleryElementFunctor::readOriginal(const QString& path, QByteArray& data, QString& format, QSize& size)
+{
+    QFile imageFile(path);
+
+    if (!imageFile.open(QIODevice::ReadOnly))
+    {
+        emitWarning(i18n("Could not read image '%1'", QDir::toNativeSeparators(path)));
+        return false;
+    }
+
+    data = imageFile.readAll();
+    imageFile.close();
+
+    // Check if RAW file.
+    if (DRawDecoder::isRawFile(QUrl::fromLocalFile(path)))
+    {
+        format = QFileInfo(path).suffix();
+        size   = DMetadata(path).getItemDimensions();
+
+        return true;
+    }
+
+    QBuffer buffer(&data);
+    QImageReader reader(&buffer);
+    format = QLatin1String(reader.format());
+
+    if (format.isEmpty())
+    {
+        emitWarning(i18n("Format of image '%1' is unknown", QDir::toNativeSeparators(path)));
+        return false;
+    }
+
+    size = reader.size();
+
+    return true;
+}
+
+QImage GalleryElementFunctor::loadThumbnailSource(const QString& path, const QImage& fullImage)
+{
+    const int  size     = m_info->thumbnailSize();
+    const bool square   = m_info->thumbnailSquare();
+
+    // A square thumbnail is cropped from an image covering the square.
+    const int  loadSize = square ? 2 * size : size;
+
+    if (loadSize <= ThumbnailLoadThread::maximumThumbnailSize())
+    {
+        QImage image = m_generator->loadThumbnail(path, loadSize);
+
+        if (!image.isNull())
+        {
+            const int side = square ? qMin(image.width(), image.height())
+                                    : qMax(image.width(), image.height());
+
+            if (side >= size)
+            {
+                return image;
+            }
+        }
+    }
+
+    if (!fullImage.isNull())
+    {
+        return fullImage;
+    }
+
+    return PreviewLoadThread::loadFastSynchronously(path, loadSize).copyQImage();
+}
+
+QByteArray GalleryElementFunctor::settingsHash(const GalleryElement& element) const
+{
+    QStringList settings;
+    settings << QString::number(m_info->useOriginalImageAsFullImage())
+             << QString::number(m_info->fullResize())
+             << QString::number(m_info->fullSize())
+             << m_info->fullFormatString()
+             << QString::number(m_info->fullQuality())
+             << QString::number(m_info->copyOriginalImage())
+             << QString::number(m_info->thumbnailSize())
+             << m_info->thumbnailFormatString()
+             << QString::number(m_info->thumbnailQuality())
+             << QString::number(m_info->thumbnailSquare())
+             << QString::number(element.m_orientation);
+
+    return QCryptographicHash::hash(settings.join(QLatin1Char(';')).toUtf8(), QCryptographicHash::Md5).toHex();
+}
+
+void GalleryElementFunctor::readMetadata(GalleryElement& element)
+{
+    QString path = element.m_path;
+
     // Read Exif Metadata
     QString unavailable(i18n("unavailable"));
     DMetadata meta;
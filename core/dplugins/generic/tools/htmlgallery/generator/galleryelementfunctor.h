@@ -24,9 +24,12 @@
 #ifndef DIGIKAM_GALLERY_ELEMENT_FUNCTOR_H
 #define DIGIKAM_GALLERY_ELEMENT_FUNCTOR_H
 
-// Local includes
+// Qt includes
 
-#include "gallerynamehelper.h"
+#include <QString>
+#include <QByteArray>
+#include <QImage>
+#include <QSize>
 
 namespace DigikamGenericHtmlGalleryPlugin
 {
@@ -34,11 +37,14 @@ namespace DigikamGenericHtmlGalleryPlugin
 class GalleryInfo;
 class GalleryGenerator;
 class GalleryElement;
+class GalleryManifest;
 
 /**
  * This functor generates images (full and thumbnail) for an url and returns an
  * GalleryElement initialized to fill the xml writer.
  * It is used as an argument to QtConcurrent::mapped().
+ * The images of an element unchanged since the previous export, as recorded in the
+ * manifest, are not generated again in incremental mode.
  */
 class GalleryElementFunctor
 {
@@ -49,14 +55,41 @@ public:
 public:
 
     explicit GalleryElementFunctor(GalleryGenerator* const generator,
-                                    GalleryInfo* const info,
-                                    const QString& destDir);
+                                   GalleryInfo* const info,
+                                   GalleryManifest* const manifest,
+                                   const QString& destDir);
     ~GalleryElementFunctor();
 
     void operator()(GalleryElement& element);
 
 private:
 
+    /**
+     * Generate the full image, the thumbnail and the copy of the original of the element.
+     */
+    bool generateImages(GalleryElement& element);
+
+    /**
+     * Read the original file, as copied in the gallery.
+     */
+    bool readOriginal(const QString& path, QByteArray& data, QString& format, QSize& size);
+
+    /**
+     * Return the image the thumbnail is made from: the thumbnail from the digiKam thumbnails
+     * database if it is large enough, or else the full image if it was loaded, or a reduced size preview.
+     */
+    QImage loadThumbnailSource(const QString& path, const QImage& fullImage);
+
+    /**
+     * Read the Exif information written in the XML file.
+     */
+    void readMetadata(GalleryElement& element);
+
+    /**
+     * Hash of the settings used to generate the files of the element.
+     */
+    QByteArray settingsHash(const GalleryElement& element) const;
+
     bool writeDataToFile(const QByteArray& data, const QString& destPath);
     void emitWarning(const QString& msg);
 
@@ -66,8 +99,8 @@ private:
 
     GalleryGenerator* m_generator;
     GalleryInfo*      m_info;
+    GalleryManifest*  m_manifest;
     QString           m_destDir;
-    GalleryNameHelper m_uniqueNameHelper;
 };
 
 } // namespace DigikamGenericHtmlGalleryPlugin
@@ -34,6 +34,8 @@
 #include <QUrl>
 #include <QList>
 #include <QTemporaryFile>
+#include <QMutex>
+#include <QMutexLocker>
 
 // KDE includes
 
@@ -53,10 +55,13 @@
 #include "galleryelement.h"
 #include "galleryelementfunctor.h"
 #include "galleryinfo.h"
+#include "gallerymanifest.h"
+#include "gallerynamehelper.h"
 #include "gallerytheme.h"
 #include "galleryxmlutils.h"
 #include "htmlwizard.h"
 #include "dfileoperations.h"
+#include "thumbnailloadthread.h"
 
 namespace DigikamGenericHtmlGalleryPlugin
 {
@@ -78,7 +83,8 @@ public:
         warnings(false),
         cancel(false),
         pview(nullptr),
-        pbar(nullptr)
+        pbar(nullptr),
+        thumbThread(nullptr)
     {
     }
 
@@ -94,6 +100,10 @@ public:
     DHistoryView*     pview;
     DProgressWdg*     pbar;
 
+    // The requests of thumbnails to the thread must not be interleaved, see ThumbnailImageCatcher.
+    ThumbnailLoadThread* thumbThread;
+    QMutex               thumbMutex;
+
 public:
 
     bool init()
@@ -245,6 +255,9 @@ public:
 
         QList<GalleryElement> imageElementList;
 
+        // The file names are given in the order of the list, they are the same at the next export.
+        GalleryNameHelper     uniqueNameHelper;
+
         foreach(const QUrl& url, imageList)
         {
             const QString path = remoteUrlHash.value(url, url.toLocalFile());
@@ -261,12 +274,23 @@ public:
 
             GalleryElement element = GalleryElement(inf);
             element.m_path         = remoteUrlHash.value(url, url.toLocalFile());
+            element.m_baseFileName = uniqueNameHelper.makeNameUnique(webifyFileName(element.m_title));
             imageElementList << element;
         }
 
         // Generate images
         logInfo(i18n("Generating files for \"%1\"", title));
-        GalleryElementFunctor functor(that, info, destDir);
+
+        // Without the incremental mode, the manifest is not read and an empty one is saved.
+
+        GalleryManifest manifest(destDir);
+
+        if (info->incremental())
+        {
+            manifest.load();
+        }
+
+        GalleryElementFunctor functor(that, info, &manifest, destDir);
         QFuture<void> future = QtConcurrent::map(imageElementList, functor);
         QFutureWatcher<void> watcher;
         watcher.setFuture(future);
@@ -284,10 +308,19 @@ public:
             {
                 future.cancel();
                 future.waitForFinished();
+                manifest.save(false);
                 return false;
             }
         }
 
+        logInfo(i18n("%1 images generated, %2 unchanged images skipped",
+                     manifest.updatedCount(), manifest.reusedCount()));
+
+        if (!manifest.save())
+        {
+            logWarning(i18n("Could not save the manifest of \"%1\"", title));
+        }
+
         // Generate xml
         foreach(const GalleryElement& element, imageElementList)
         {
@@ -558,9 +591,11 @@ GalleryGenerator::GalleryGenerator(GalleryInfo* const info)
     : QObject(),
       d(new Private)
 {
-    d->that     = this;
-    d->info     = info;
-    d->warnings = false;
+    d->that        = this;
+    d->info        = info;
+    d->warnings    = false;
+    d->thumbThread = new ThumbnailLoadThread;
+    d->thumbThread->setPixmapRequested(false);
 
     connect(this, SIGNAL(logWarningRequested(QString)),
             SLOT(logWarning(QString)), Qt::QueuedConnection);
@@ -568,6 +603,9 @@ GalleryGenerator::GalleryGenerator(GalleryInfo* const info)
 
 GalleryGenerator::~GalleryGenerator()
 {
+    d->thumbThread->stopAllTasks();
+    delete d->thumbThread;
+
     delete d;
 }
 
@@ -603,6 +641,21 @@ bool GalleryGenerator::warnings() const
     return d->warnings;
 }
 
+QImage GalleryGenerator::loadThumbnail(const QString& path, int size)
+{
+    ThumbnailImageCatcher catcher(d->thumbThread);
+
+    {
+        QMutexLocker lock(&d->thumbMutex);
+        d->thumbThread->find(ThumbnailIdentifier(path), size);
+        catcher.enqueue();
+    }
+
+    QList<QImage> images = catcher.waitForThumbnails();
+
+    return (images.isEmpty() ? QImage() : images.first());
+}
+
 void GalleryGenerator::logWarning(const QString& text)
 {
     d->logWarning(text);
@@ -27,6 +27,7 @@
 // Qt includes
 
 #include <QObject>
+#include <QImage>
 
 // Local includes
 
@@ -78,6 +79,14 @@ private Q_SLOTS:
     void logWarning(const QString&);
     void slotCancel();
 
+private:
+
+    /**
+     * Load synchronously the thumbnail of the file from the digiKam thumbnails database,
+     * or return a null image. It is called from the GalleryElementFunctor threads.
+     */
+    QImage loadThumbnail(const QString& path, int size);
+
 private:
 
     class Private;
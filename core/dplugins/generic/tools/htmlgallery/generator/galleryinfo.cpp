@@ -133,6 +133,8 @@ QDebug operator<<(QDebug dbg, const GalleryInfo& t)
                   << t.openInBrowser();
     dbg.nospace() << "GalleryInfo::ImageSelectionTitle: "
                   << t.imageSelectionTitle();
+    dbg.nospace() << "GalleryInfo::Incremental: "
+                  << t.incremental();
     return dbg.space();
 }
 
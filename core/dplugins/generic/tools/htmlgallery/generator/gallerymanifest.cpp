@@ -0,0 +1,353 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : manifest of the files generated for a gallery collection
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "gallerymanifest.h"
+
+// Qt includes
+
+#include <QFile>
+#include <QSaveFile>
+#include <QHash>
+#include <QSet>
+#include <QSize>
+#include <QStringList>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QXmlStreamReader>
+#include <QXmlStreamWriter>
+
+// Local includes
+
+#include "digikam_debug.h"
+#include "galleryelement.h"
+
+namespace DigikamGenericHtmlGalleryPlugin
+{
+
+namespace
+{
+
+const int manifestVersion = 1;
+
+/**
+ * The manifest is saved in the folder of the collection, with the generated files.
+ */
+const char* const manifestFileName = ".digikam-gallery-manifest.xml";
+
+} // namespace
+
+class Q_DECL_HIDDEN GalleryManifest::Private
+{
+public:
+
+    class Entry
+    {
+    public:
+
+        QStringList files() const
+        {
+            QStringList list;
+            list << fullFileName << thumbnailFileName;
+
+            if (!originalFileName.isEmpty())
+            {
+                list << originalFileName;
+            }
+
+            return list;
+        }
+
+    public:
+
+        QString    source;
+        QByteArray uniqueHash;
+        QByteArray settingsHash;
+
+        QString    fullFileName;
+        QSize      fullSize;
+        QString    thumbnailFileName;
+        QSize      thumbnailSize;
+        QString    originalFileName;
+        QSize      originalSize;
+    };
+
+public:
+
+    explicit Private()
+      : reusedCount(0),
+        updatedCount(0)
+    {
+    }
+
+    QString filePath(const QString& fileName) const
+    {
+        return (destDir + QLatin1Char('/') + fileName);
+    }
+
+    static QSize readSize(const QXmlStreamAttributes& attributes, const QString& name)
+    {
+        return QSize(attributes.value(name + QLatin1String("Width")).toInt(),
+                     attributes.value(name + QLatin1String("Height")).toInt());
+    }
+
+    static void writeSize(QXmlStreamWriter& writer, const QString& name, const QSize& size)
+    {
+        writer.writeAttribute(name + QLatin1String("Width"),  QString::number(size.width()));
+        writer.writeAttribute(name + QLatin1String("Height"), QString::number(size.height()));
+    }
+
+public:
+
+    QString               destDir;
+
+    /// The elements of the previous export and of this one, by base file name.
+    QHash<QString, Entry> previous;
+    QHash<QString, Entry> current;
+
+    /// The elements of the previous export generated again.
+    QSet<QString>         dropped;
+
+    int                   reusedCount;
+    int                   updatedCount;
+
+    QMutex                mutex;
+};
+
+GalleryManifest::GalleryManifest(const QString& destDir)
+    : d(new Private)
+{
+    d->destDir = destDir;
+}
+
+GalleryManifest::~GalleryManifest()
+{
+    delete d;
+}
+
+bool GalleryManifest::load()
+{
+    QFile file(d->filePath(QLatin1String(manifestFileName)));
+
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        return false;
+    }
+
+    QXmlStreamReader reader(&file);
+
+    if (!reader.readNextStartElement()               ||
+        (reader.name() != QLatin1String("manifest")) ||
+        (reader.attributes().value(QLatin1String("version")).toInt() != manifestVersion))
+    {
+        qCDebug(DIGIKAM_DPLUGIN_GENERIC_LOG) << "Ignoring the gallery manifest" << file.fileName();
+        return false;
+    }
+
+    while (reader.readNextStartElement())
+    {
+        if (reader.name() == QLatin1String("element"))
+        {
+            const QXmlStreamAttributes attributes = reader.attributes();
+            Private::Entry entry;
+
+            entry.source            = attributes.value(QLatin1String("source")).toString();
+            entry.uniqueHash        = attributes.value(QLatin1String("uniqueHash")).toLatin1();
+            entry.settingsHash      = attributes.value(QLatin1String("settingsHash")).toLatin1();
+            entry.fullFileName      = attributes.value(QLatin1String("full")).toString();
+            entry.fullSize          = Private::readSize(attributes, QLatin1String("full"));
+            entry.thumbnailFileName = attributes.value(QLatin1String("thumbnail")).toString();
+            entry.thumbnailSize     = Private::readSize(attributes, QLatin1String("thumbnail"));
+            entry.originalFileName  = attributes.value(QLatin1String("original")).toString();
+            entry.originalSize      = Private::readSize(attributes, QLatin1String("original"));
+
+            d->previous.insert(attributes.value(QLatin1String("name")).toString(), entry);
+        }
+
+        reader.skipCurrentElement();
+    }
+
+    if (reader.hasError())
+    {
+        qCDebug(DIGIKAM_DPLUGIN_GENERIC_LOG) << "Cannot read the gallery manifest" << file.fileName()
+                                             << ":" << reader.errorString();
+        d->previous.clear();
+
+        return false;
+    }
+
+    return true;
+}
+
+bool GalleryManifest::save(bool finished)
+{
+    if (finished)
+    {
+        // The files of the previous export which are not used by this one are removed,
+        // as the images removed from the collection, or generated in another format.
+
+        QSet<QString> files;
+
+        foreach (const Private::Entry& entry, d->current)
+        {
+            files += entry.files().toSet();
+        }
+
+        foreach (const Private::Entry& entry, d->previous)
+        {
+            foreach (const QString& fileName, entry.files())
+            {
+                if (!fileName.isEmpty() && !fileName.contains(QLatin1Char('/')) && !files.contains(fileName))
+                {
+                    QFile::remove(d->filePath(fileName));
+                }
+            }
+        }
+    }
+    else
+    {
+        // The files of the elements not processed are still valid for the next export.
+
+        for (QHash<QString, Private::Entry>::const_iterator it = d->previous.constBegin() ;
+             it != d->previous.constEnd() ; ++it)
+        {
+            if (!d->current.contains(it.key()) && !d->dropped.contains(it.key()))
+            {
+                d->current.insert(it.key(), it.value());
+            }
+        }
+    }
+
+    QSaveFile file(d->filePath(QLatin1String(manifestFileName)));
+
+    if (!file.open(QIODevice::WriteOnly))
+    {
+        return false;
+    }
+
+    QXmlStreamWriter writer(&file);
+    writer.setAutoFormatting(true);
+    writer.writeStartDocument();
+    writer.writeStartElement(QLatin1String("manifest"));
+    writer.writeAttribute(QLatin1String("version"), QString::number(manifestVersion));
+
+    for (QHash<QString, Private::Entry>::const_iterator it = d->current.constBegin() ;
+         it != d->current.constEnd() ; ++it)
+    {
+        writer.writeStartElement(QLatin1String("element"));
+        writer.writeAttribute(QLatin1String("name"),         it.key());
+        writer.writeAttribute(QLatin1String("source"),       it->source);
+        writer.writeAttribute(QLatin1String("uniqueHash"),   QString::fromLatin1(it->uniqueHash));
+        writer.writeAttribute(QLatin1String("settingsHash"), QString::fromLatin1(it->settingsHash));
+        writer.writeAttribute(QLatin1String("full"),         it->fullFileName);
+        Private::writeSize(writer, QLatin1String("full"), it->fullSize);
+        writer.writeAttribute(QLatin1String("thumbnail"),    it->thumbnailFileName);
+        Private::writeSize(writer, QLatin1String("thumbnail"), it->thumbnailSize);
+
+        if (!it->originalFileName.isEmpty())
+        {
+            writer.writeAttribute(QLatin1String("original"), it->originalFileName);
+            Private::writeSize(writer, QLatin1String("original"), it->originalSize);
+        }
+
+        writer.writeEndElement();
+    }
+
+    writer.writeEndElement();
+    writer.writeEndDocument();
+
+    return file.commit();
+}
+
+bool GalleryManifest::reuse(GalleryElement& element, const QByteArray& uniqueHash, const QByteArray& settingsHash)
+{
+    QMutexLocker lock(&d->mutex);
+
+    QHash<QString, Private::Entry>::const_iterator it = d->previous.constFind(element.m_baseFileName);
+
+    if (it == d->previous.constEnd())
+    {
+        return false;
+    }
+
+    if ((it->source       != element.m_path) ||
+        (it->uniqueHash   != uniqueHash)     ||
+        (it->settingsHash != settingsHash))
+    {
+        d->dropped << it.key();
+
+        return false;
+    }
+
+    foreach (const QString& fileName, it->files())
+    {
+        if (!QFile::exists(d->filePath(fileName)))
+        {
+            d->dropped << it.key();
+
+            return false;
+        }
+    }
+
+    element.m_fullFileName      = it->fullFileName;
+    element.m_fullSize          = it->fullSize;
+    element.m_thumbnailFileName = it->thumbnailFileName;
+    element.m_thumbnailSize     = it->thumbnailSize;
+    element.m_originalFileName  = it->originalFileName;
+    element.m_originalSize      = it->originalSize;
+    element.m_valid             = true;
+
+    d->current.insert(it.key(), it.value());
+    ++d->reusedCount;
+
+    return true;
+}
+
+void GalleryManifest::update(const GalleryElement& element, const QByteArray& uniqueHash, const QByteArray& settingsHash)
+{
+    Private::Entry entry;
+    entry.source            = element.m_path;
+    entry.uniqueHash        = uniqueHash;
+    entry.settingsHash      = settingsHash;
+    entry.fullFileName      = element.m_fullFileName;
+    entry.fullSize          = element.m_fullSize;
+    entry.thumbnailFileName = element.m_thumbnailFileName;
+    entry.thumbnailSize     = element.m_thumbnailSize;
+    entry.originalFileName  = element.m_originalFileName;
+    entry.originalSize      = element.m_originalSize;
+
+    QMutexLocker lock(&d->mutex);
+
+    d->current.insert(element.m_baseFileName, entry);
+    ++d->updatedCount;
+}
+
+int GalleryManifest::reusedCount() const
+{
+    return d->reusedCount;
+}
+
+int GalleryManifest::updatedCount() const
+{
+    return d->updatedCount;
+}
+
+} // namespace DigikamGenericHtmlGalleryPlugin
@@ -0,0 +1,89 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : manifest of the files generated for a gallery collection
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_GALLERY_MANIFEST_H
+#define DIGIKAM_GALLERY_MANIFEST_H
+
+// Qt includes
+
+#include <QString>
+#include <QByteArray>
+
+namespace DigikamGenericHtmlGalleryPlugin
+{
+
+class GalleryElement;
+
+/**
+ * The manifest records, for each element of a collection exported in a folder, the unique hash
+ * of the source image and the hash of the settings used to generate its files.
+ * It is saved in the folder, and allows the next export to skip the elements which have not changed.
+ * The methods used while the images are generated can be called from several threads.
+ */
+class GalleryManifest
+{
+public:
+
+    explicit GalleryManifest(const QString& destDir);
+    ~GalleryManifest();
+
+    /**
+     * Read the manifest of the previous export in the folder. Return false if there is none.
+     */
+    bool load();
+
+    /**
+     * Write the manifest of this export, and remove the files of the previous export
+     * which are not used anymore. If the export was canceled, finished is false: the
+     * elements not processed keep their entry of the previous export, and no file is removed.
+     */
+    bool save(bool finished = true);
+
+    /**
+     * If the element was generated by the previous export from the same source and with the
+     * same settings, and its files still exist, set the files of the element and return true.
+     * Else the entry of the previous export is dropped, as the files are generated again.
+     */
+    bool reuse(GalleryElement& element, const QByteArray& uniqueHash, const QByteArray& settingsHash);
+
+    /**
+     * Record the files generated for the element.
+     */
+    void update(const GalleryElement& element, const QByteArray& uniqueHash, const QByteArray& settingsHash);
+
+    int  reusedCount()  const;
+    int  updatedCount() const;
+
+private:
+
+    GalleryManifest(const GalleryManifest&);            // Disable
+    GalleryManifest& operator=(const GalleryManifest&); // Disable
+
+private:
+
+    class Private;
+    Private* const d;
+};
+
+} // namespace DigikamGenericHtmlGalleryPlugin
+
+#endif // DIGIKAM_GALLERY_MANIFEST_H
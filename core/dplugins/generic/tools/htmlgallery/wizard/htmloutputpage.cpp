@@ -32,6 +32,7 @@
 #include <QStyle>
 #include <QComboBox>
 #include <QLineEdit>
+#include <QCheckBox>
 #include <QGridLayout>
 
 // KDE includes
@@ -55,7 +56,8 @@ public:
       : destUrl(nullptr),
         openInBrowser(nullptr),
         titleLabel(nullptr),
-        imageSelectionTitle(nullptr)
+        imageSelectionTitle(nullptr),
+        incremental(nullptr)
     {
     }
 
@@ -63,6 +65,7 @@ public:
     QComboBox*     openInBrowser;
     QLabel*        titleLabel;
     QLineEdit*     imageSelectionTitle;
+    QCheckBox*     incremental;
 };
 
 HTMLOutputPage::HTMLOutputPage(QWizard* const dialog, const QString& title)
@@ -107,6 +110,14 @@ HTMLOutputPage::HTMLOutputPage(QWizard* const dialog, const QString& title)
 
     // --------------------
 
+    d->incremental = new QCheckBox(main);
+    d->incremental->setText(i18n("Only update the images changed since the previous export"));
+    d->incremental->setWhatsThis(i18n("If this option is enabled, the images of a gallery already exported "
+                                      "in the destination folder are generated again only if the original "
+                                      "file or the image settings have changed."));
+
+    // --------------------
+
     QGridLayout* const grid = new QGridLayout(main);
     grid->setSpacing(QApplication::style()->pixelMetric(QStyle::PM_DefaultLayoutSpacing));
     grid->addWidget(d->titleLabel,          0, 0, 1, 1);
@@ -115,7 +126,8 @@ HTMLOutputPage::HTMLOutputPage(QWizard* const dialog, const QString& title)
     grid->addWidget(d->destUrl,             1, 1, 1, 1);
     grid->addWidget(browserLabel,           2, 0, 1, 1);
     grid->addWidget(d->openInBrowser,       2, 1, 1, 1);
-    grid->setRowStretch(3, 10);
+    grid->addWidget(d->incremental,         3, 0, 1, 2);
+    grid->setRowStretch(4, 10);
 
     // --------------------
 
@@ -149,6 +161,7 @@ void HTMLOutputPage::initializePage()
     d->destUrl->setFileDlgPath(info->destUrl().toLocalFile());
     d->openInBrowser->setCurrentIndex(info->openInBrowser());
     d->imageSelectionTitle->setText(info->imageSelectionTitle());
+    d->incremental->setChecked(info->incremental());
 
     d->titleLabel->setVisible(info->m_getOption == GalleryInfo::IMAGES);
     d->imageSelectionTitle->setVisible(info->m_getOption == GalleryInfo::IMAGES);
@@ -172,6 +185,7 @@ bool HTMLOutputPage::validatePage()
     info->setDestUrl(QUrl::fromLocalFile(d->destUrl->fileDlgPath()));
     info->setOpenInBrowser(d->openInBrowser->currentIndex());
     info->setImageSelectionTitle(d->imageSelectionTitle->text());
+    info->setIncremental(d->incremental->isChecked());
 
     return true;
 }
@@ -0,0 +1,636 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : cache of the resized JPEG derivatives served by the media server
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "dlnaderivativecache.h"
+
+// C++ includes
+
+#include <algorithm>
+
+// Qt includes
+
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QDateTime>
+#include <QHash>
+#include <QList>
+#include <QImage>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QThread>
+#include <QThreadPool>
+#include <QFuture>
+#include <QtConcurrent>
+
+// Local includes
+
+#include "digikam_debug.h"
+#include "dimg.h"
+#include "previewloadthread.h"
+#include "thumbnailloadthread.h"
+
+namespace Digikam
+{
+
+namespace
+{
+
+/**
+ * The profiles, in the order of the Profile enum values.
+ */
+const struct
+{
+    const char* name;
+    const char* dlna;
+    int         width;
+    int         height;
+}
+profiles[] =
+{
+    { "tn",      "JPEG_TN",  160,  160  },
+    { "sm",      "JPEG_SM",  640,  480  },
+    { "med",     "JPEG_MED", 1024, 768  },
+    { "lrg",     "JPEG_LRG", 4096, 4096 },
+    { "preview", nullptr,    2048, 2048 }
+};
+
+const int profilesCount = sizeof(profiles) / sizeof(profiles[0]);
+
+/**
+ * When the cache is full, the derivatives are removed until its size is under this ratio of the maximum,
+ * not to remove one derivative at each insertion.
+ */
+const double evictionRatio = 0.9;
+
+/**
+ * A derivative which cannot be created is not tried again before this delay, in milliseconds.
+ */
+const qint64 failureDelay  = 10 * 60 * 1000;
+
+} // namespace
+
+class Q_DECL_HIDDEN DLNADerivativeCache::Private
+{
+public:
+
+    class Entry
+    {
+    public:
+
+        explicit Entry(qint64 fileSize = 0, qint64 use = 0)
+          : size(fileSize),
+            lastUse(use)
+        {
+        }
+
+        qint64 size;
+        qint64 lastUse;
+    };
+
+    class FileHash
+    {
+    public:
+
+        qint64    size;
+        QDateTime modified;
+        QString   hash;
+    };
+
+public:
+
+    explicit Private()
+      : cacheSize(0),
+        maxSize(0),
+        useCount(0),
+        thumbThread(nullptr)
+    {
+    }
+
+    /**
+     * Return the name of the derivative of the file in the cache, or a null string if the file does not exist.
+     */
+    QString key(const QString& filePath, Profile profile);
+
+    /**
+     * Return the path to the derivative if it is in the cache, and record its use. Call it with the mutex locked.
+     */
+    QString lookup(const QString& key);
+
+    /**
+     * Return true if the creation of the derivative failed recently. Call it with the mutex locked.
+     */
+    bool    hasFailed(const QString& key);
+
+    /**
+     * Start the generation of the derivative in the pool, if it is not running yet. Call it with the mutex locked.
+     */
+    QFuture<QString> start(const QString& filePath, Profile profile, const QString& key);
+
+    /**
+     * Run in the pool: create the derivative and store it in the cache.
+     */
+    QString generate(const QString& filePath, int profile, const QString& key);
+
+    /**
+     * Run in the pool: hash the file and queue the creation of the derivative if it is not in the cache.
+     */
+    void    prefetch(const QString& filePath, int profile);
+
+    QImage  loadImage(const QString& filePath, Profile profile);
+    void    insert(const QString& key, qint64 size);
+    void    evict();
+
+public:
+
+    QString                          cacheDir;
+    qint64                           cacheSize;
+    qint64                           maxSize;
+
+    /// Incremented at each use of a derivative, to find the least recently used ones.
+    qint64                           useCount;
+
+    QMutex                           mutex;
+    QHash<QString, Entry>            entries;
+    QHash<QString, QFuture<QString> > running;
+    QHash<QString, FileHash>         hashes;
+
+    /// The time of the failures, in milliseconds since the epoch.
+    QHash<QString, qint64>           failed;
+
+    /// The derivatives being served, which are not removed by the eviction.
+    QHash<QString, int>              pinned;
+
+    QThreadPool                      pool;
+
+    /// The requests of thumbnails to the thread must not be interleaved, see ThumbnailImageCatcher.
+    ThumbnailLoadThread*             thumbThread;
+    QMutex                           thumbMutex;
+};
+
+QString DLNADerivativeCache::Private::key(const QString& filePath, Profile profile)
+{
+    QFileInfo info(filePath);
+
+    if (!info.isFile())
+    {
+        return QString();
+    }
+
+    const QString suffix = QLatin1Char('-') + profileName(profile) + QLatin1String(".jpg");
+
+    {
+        QMutexLocker lock(&mutex);
+
+        QHash<QString, FileHash>::const_iterator it = hashes.constFind(filePath);
+
+        if ((it != hashes.constEnd()) && (it->size == info.size()) && (it->modified == info.lastModified()))
+        {
+            return (it->hash + suffix);
+        }
+    }
+
+    // Read the file out of the lock, it is the slow part.
+
+    FileHash fileHash;
+    fileHash.size     = info.size();
+    fileHash.modified = info.lastModified();
+    fileHash.hash     = QString::fromLatin1(DImg::getUniqueHashV2(filePath));
+
+    if (fileHash.hash.isEmpty())
+    {
+        return QString();
+    }
+
+    QMutexLocker lock(&mutex);
+    hashes.insert(filePath, fileHash);
+
+    return (fileHash.hash + suffix);
+}
+
+QString DLNADerivativeCache::Private::lookup(const QString& key)
+{
+    QHash<QString, Entry>::iterator it = entries.find(key);
+
+    if (it == entries.end())
+    {
+        return QString();
+    }
+
+    const QString path = cacheDir + QLatin1Char('/') + key;
+
+    if (!QFile::exists(path))
+    {
+        // Removed from outside, as when the cache directory is cleaned up.
+        cacheSize -= it->size;
+        entries.erase(it);
+
+        return QString();
+    }
+
+    it->lastUse = ++useCount;
+
+    return path;
+}
+
+bool DLNADerivativeCache::Private::hasFailed(const QString& key)
+{
+    QHash<QString, qint64>::iterator it = failed.find(key);
+
+    if (it == failed.end())
+    {
+        return false;
+    }
+
+    // The failure can come from a transient error, as a full disk, or an image which could not be read yet.
+
+    if (QDateTime::currentMSecsSinceEpoch() - it.value() < failureDelay)
+    {
+        return true;
+    }
+
+    failed.erase(it);
+
+    return false;
+}
+
+QFuture<QString> DLNADerivativeCache::Private::start(const QString& filePath, Profile profile, const QString& key)
+{
+    QHash<QString, QFuture<QString> >::const_iterator it = running.constFind(key);
+
+    if (it != running.constEnd())
+    {
+        return it.value();
+    }
+
+    QFuture<QString> future = QtConcurrent::run(&pool, this, &Private::generate, filePath, (int)profile, key);
+    running.insert(key, future);
+
+    return future;
+}
+
+QString DLNADerivativeCache::Private::generate(const QString& filePath, int profile, const QString& key)
+{
+    QImage image = loadImage(filePath, (Profile)profile);
+    QString path;
+
+    if (!image.isNull())
+    {
+        const QSize box(profiles[profile].width, profiles[profile].height);
+
+        if ((image.width() > box.width()) || (image.height() > box.height()))
+        {
+            image = image.scaled(box, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+        }
+
+        // The file appears in the cache only when complete, as it can be served at the same time.
+
+        const QString tempPath = cacheDir + QLatin1Char('/') + key + QLatin1String(".digikamtempfile.tmp");
+        path                   = cacheDir + QLatin1Char('/') + key;
+
+        if (image.convertToFormat(QImage::Format_RGB32).save(tempPath, "JPG", 85))
+        {
+            QFile::remove(path);
+
+            if (!QFile::rename(tempPath, path))
+            {
+                QFile::remove(tempPath);
+                path.clear();
+            }
+        }
+        else
+        {
+            QFile::remove(tempPath);
+            path.clear();
+        }
+    }
+
+    QMutexLocker lock(&mutex);
+    running.remove(key);
+
+    if (path.isNull())
+    {
+        qCDebug(DIGIKAM_MEDIASRV_LOG) << "Cannot create the" << profileName((Profile)profile)
+                                      << "derivative of" << filePath;
+        failed.insert(key, QDateTime::currentMSecsSinceEpoch());
+
+        return QString();
+    }
+
+    failed.remove(key);
+    insert(key, QFileInfo(path).size());
+
+    return path;
+}
+
+void DLNADerivativeCache::Private::prefetch(const QString& filePath, int profile)
+{
+    const QString filekey = key(filePath, (Profile)profile);
+
+    if (filekey.isNull())
+    {
+        return;
+    }
+
+    QMutexLocker lock(&mutex);
+
+    if (!entries.contains(filekey) && !hasFailed(filekey))
+    {
+        start(filePath, (Profile)profile, filekey);
+    }
+}
+
+QImage DLNADerivativeCache::Private::loadImage(const QString& filePath, Profile profile)
+{
+    if (profile == Thumbnail)
+    {
+        ThumbnailImageCatcher catcher(thumbThread);
+        catcher.setActive(true);
+
+        {
+            QMutexLocker lock(&thumbMutex);
+            thumbThread->find(ThumbnailIdentifier(filePath), profiles[Thumbnail].width);
+            catcher.enqueue();
+        }
+
+        QList<QImage> images = catcher.waitForThumbnails();
+        catcher.setActive(false);
+
+        return (images.isEmpty() ? QImage() : images.first());
+    }
+
+    const int size = qMax(profiles[profile].width, profiles[profile].height);
+    DImg img;
+
+    if (profile == Large)
+    {
+        img = PreviewLoadThread::loadFastButLargeSynchronously(filePath, size);
+    }
+    else
+    {
+        img = PreviewLoadThread::loadFastSynchronously(filePath, size);
+    }
+
+    return img.copyQImage();
+}
+
+void DLNADerivativeCache::Private::insert(const QString& key, qint64 size)
+{
+    cacheSize         -= entries.value(key).size;
+    entries.insert(key, Entry(size, ++useCount));
+    cacheSize         += size;
+
+    if (cacheSize > maxSize)
+    {
+        evict();
+    }
+}
+
+void DLNADerivativeCache::Private::evict()
+{
+    QList<QPair<qint64, QString> > uses;
+
+    for (QHash<QString, Entry>::const_iterator it = entries.constBegin() ; it != entries.constEnd() ; ++it)
+    {
+        // The derivatives being served are kept, their files would disappear before they are opened.
+
+        if (!pinned.contains(it.key()))
+        {
+            uses << qMakePair(it->lastUse, it.key());
+        }
+    }
+
+    std::sort(uses.begin(), uses.end());
+
+    const qint64 target = (qint64)(maxSize * evictionRatio);
+
+    for (int i = 0 ; (i < uses.size()) && (cacheSize > target) ; ++i)
+    {
+        const QString& key = uses.at(i).second;
+
+        // A derivative which cannot be removed, as a file open on Windows, is kept for the next eviction.
+
+        if (QFile::remove(cacheDir + QLatin1Char('/') + key))
+        {
+            cacheSize -= entries.take(key).size;
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------------------
+
+DLNADerivativeCache::DLNADerivativeCache(const QString& cacheDir, qint64 maxSize)
+    : d(new Private)
+{
+    d->cacheDir = cacheDir;
+    d->maxSize  = maxSize;
+    d->pool.setMaxThreadCount(qMax(1, QThread::idealThreadCount()));
+
+    d->thumbThread = new ThumbnailLoadThread;
+    d->thumbThread->setPixmapRequested(false);
+    d->thumbThread->setThumbnailSize(profiles[Thumbnail].width);
+
+    QDir dir;
+    dir.mkpath(d->cacheDir);
+    dir.setPath(d->cacheDir);
+
+    // Reuse the derivatives of the previous sessions, the oldest ones are the first to be removed.
+
+    const QFileInfoList files = dir.entryInfoList(QStringList() << QLatin1String("*.jpg"),
+                                                  QDir::Files, QDir::Time | QDir::Reversed);
+
+    foreach (const QFileInfo& info, files)
+    {
+        d->entries.insert(info.fileName(), Private::Entry(info.size(), ++d->useCount));
+        d->cacheSize += info.size();
+    }
+
+    foreach (const QString& temp, dir.entryList(QStringList() << QLatin1String("*.digikamtempfile.tmp"), QDir::Files))
+    {
+        dir.remove(temp);
+    }
+
+    if (d->cacheSize > d->maxSize)
+    {
+        d->evict();
+    }
+
+    qCDebug(DIGIKAM_MEDIASRV_LOG) << "Derivatives cache" << d->cacheDir << "uses"
+                                  << d->cacheSize / 1024 << "KB in" << d->entries.count() << "files";
+}
+
+DLNADerivativeCache::~DLNADerivativeCache()
+{
+    d->pool.clear();
+    d->pool.waitForDone();
+
+    d->thumbThread->stopAllTasks();
+    delete d->thumbThread;
+
+    delete d;
+}
+
+QString DLNADerivativeCache::derivative(const QString& filePath, Profile profile)
+{
+    const QString key = d->key(filePath, profile);
+
+    if (key.isNull())
+    {
+        return QString();
+    }
+
+    QFuture<QString> future;
+
+    {
+        QMutexLocker lock(&d->mutex);
+
+        const QString path = d->lookup(key);
+
+        if (!path.isNull())
+        {
+            d->pinned[key]++;
+
+            return path;
+        }
+
+        if (d->hasFailed(key))
+        {
+            return QString();
+        }
+
+        future = d->start(filePath, profile, key);
+    }
+
+    if (future.result().isNull())
+    {
+        return QString();
+    }
+
+    // Look up the new derivative again to pin it, it may have been removed in the meantime.
+
+    QMutexLocker lock(&d->mutex);
+
+    const QString path = d->lookup(key);
+
+    if (!path.isNull())
+    {
+        d->pinned[key]++;
+    }
+
+    return path;
+}
+
+QString DLNADerivativeCache::cachedDerivative(const QString& filePath, Profile profile)
+{
+    const QString key = d->key(filePath, profile);
+
+    if (key.isNull())
+    {
+        return QString();
+    }
+
+    QMutexLocker lock(&d->mutex);
+
+    const QString path = d->lookup(key);
+
+    if (!path.isNull())
+    {
+        d->pinned[key]++;
+    }
+
+    return path;
+}
+
+void DLNADerivativeCache::release(const QString& derivativePath)
+{
+    const QString key = QFileInfo(derivativePath).fileName();
+
+    QMutexLocker lock(&d->mutex);
+
+    QHash<QString, int>::iterator it = d->pinned.find(key);
+
+    if (it == d->pinned.end())
+    {
+        return;
+    }
+
+    if (--it.value() == 0)
+    {
+        d->pinned.erase(it);
+
+        if (d->cacheSize > d->maxSize)
+        {
+            d->evict();
+        }
+    }
+}
+
+void DLNADerivativeCache::prefetch(const QString& filePath, Profile profile)
+{
+    // Even the hash of the file is computed in the pool, not to delay the answer to the client.
+
+    QtConcurrent::run(&d->pool, d, &Private::prefetch, filePath, (int)profile);
+}
+
+qint64 DLNADerivativeCache::cacheSize() const
+{
+    QMutexLocker lock(&d->mutex);
+
+    return d->cacheSize;
+}
+
+qint64 DLNADerivativeCache::maxSize() const
+{
+    return d->maxSize;
+}
+
+QSize DLNADerivativeCache::profileSize(Profile profile)
+{
+    return QSize(profiles[profile].width, profiles[profile].height);
+}
+
+QString DLNADerivativeCache::dlnaProfileName(Profile profile)
+{
+    return QLatin1String(profiles[profile].dlna);
+}
+
+QString DLNADerivativeCache::profileName(Profile profile)
+{
+    return QLatin1String(profiles[profile].name);
+}
+
+bool DLNADerivativeCache::profileFromName(const QString& name, Profile& profile)
+{
+    for (int i = 0 ; i < profilesCount ; ++i)
+    {
+        if (name == QLatin1String(profiles[i].name))
+        {
+            profile = (Profile)i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+} // namespace Digikam
@@ -0,0 +1,126 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : cache of the resized JPEG derivatives served by the media server
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_DLNA_DERIVATIVE_CACHE_H
+#define DIGIKAM_DLNA_DERIVATIVE_CACHE_H
+
+// Qt includes
+
+#include <QString>
+#include <QSize>
+
+namespace Digikam
+{
+
+/**
+ * The media server offers the images as JPEG derivatives sized for the DLNA image profiles,
+ * which are lighter to transfer and to decode for the renderers, and readable for them
+ * whatever the format of the original file, as RAW.
+ *
+ * The derivatives are generated by a pool of threads, with ThumbnailLoadThread for the
+ * thumbnails and PreviewLoadThread for the other sizes, and kept in an on-disk cache
+ * bounded in size, where the least recently used derivatives are removed first.
+ * They are stored by unique hash of the original file, a file modified or moved is not
+ * generated again while its derivatives are in the cache.
+ */
+class DLNADerivativeCache
+{
+public:
+
+    enum Profile
+    {
+        Thumbnail = 0,  ///< DLNA JPEG_TN, up to 160x160
+        Small,          ///< DLNA JPEG_SM, up to 640x480
+        Medium,         ///< DLNA JPEG_MED, up to 1024x768
+        Large,          ///< DLNA JPEG_LRG, up to 4096x4096
+        Preview         ///< The main resource of the images, up to 2048x2048
+    };
+
+public:
+
+    /**
+     * Create a cache in cacheDir, which is created if needed. The derivatives already in the
+     * directory are used. If maxSize is exceeded, the least recently used derivatives are removed.
+     */
+    explicit DLNADerivativeCache(const QString& cacheDir, qint64 maxSize = 512 * 1024 * 1024);
+    ~DLNADerivativeCache();
+
+    /**
+     * Return the path to the derivative of the image file for the profile, generating it if
+     * necessary, or a null string if the file is not an image which can be loaded.
+     * The derivative returned is not removed from the cache until release() is called.
+     */
+    QString derivative(const QString& filePath, Profile profile);
+
+    /**
+     * Same as above, but only return the derivative if it is already in the cache.
+     */
+    QString cachedDerivative(const QString& filePath, Profile profile);
+
+    /**
+     * Allow the removal of a derivative returned by the methods above, once it is served.
+     */
+    void release(const QString& derivativePath);
+
+    /**
+     * Queue the generation of the derivative if it is not in the cache, without waiting for it,
+     * as done for the thumbnails of the items browsed by a client. The file is read in the pool.
+     */
+    void prefetch(const QString& filePath, Profile profile);
+
+    qint64 cacheSize() const;
+    qint64 maxSize()   const;
+
+public:
+
+    /**
+     * The size of the box where the derivatives of the profile fit.
+     */
+    static QSize      profileSize(Profile profile);
+
+    /**
+     * The name of the DLNA profile, as used in the DLNA.ORG_PN protocol info field,
+     * or a null string for the Preview profile which is not a DLNA one.
+     */
+    static QString    dlnaProfileName(Profile profile);
+
+    /**
+     * The name of the profile used in the URL of the derivatives, with the "profile" query field.
+     */
+    static QString    profileName(Profile profile);
+    static bool       profileFromName(const QString& name, Profile& profile);
+
+private:
+
+    DLNADerivativeCache(const DLNADerivativeCache&);            // Disable
+    DLNADerivativeCache& operator=(const DLNADerivativeCache&); // Disable
+
+private:
+
+    class Private;
+    Private* const d;
+};
+
+} // namespace Digikam
+
+#endif // DIGIKAM_DLNA_DERIVATIVE_CACHE_H
@@ -42,16 +42,13 @@
 #include <QUrl>
 #include <QList>
 #include <QMap>
-#include <QImage>
-#include <QByteArray>
-#include <QBuffer>
+#include <QStandardPaths>
 
 // Local includes
 
 #include "digikam_debug.h"
-#include "previewloadthread.h"
-#include "dimg.h"
 #include "drawdecoder.h"
+#include "dlnaderivativecache.h"
 
 NPT_SET_LOCAL_LOGGER("digiKam.media.server.delegate")
 
@@ -64,10 +61,58 @@ public:
 
     explicit Private()
       : filterUnknownOut(false),
-        useCache(false)
+        useCache(false),
+        cache(nullptr)
     {
     }
 
+    /**
+     * Return the path to the local file of a filepath built with the container path, or a null string.
+     */
+    static NPT_String localFile(const NPT_String& filepath)
+    {
+        int index = filepath.Find("/?file:");
+
+        return ((index == -1) ? NPT_String() : filepath.SubString(index + 7));
+    }
+
+    /**
+     * Add to the image item the resources of its JPEG derivatives at uri, from the largest to the smallest,
+     * and the thumbnail as album art.
+     */
+    void addDerivativeResources(PLT_MediaObject* const object, const NPT_String& uri)
+    {
+        const DLNADerivativeCache::Profile dlnaProfiles[] =
+        {
+            DLNADerivativeCache::Large,
+            DLNADerivativeCache::Medium,
+            DLNADerivativeCache::Small,
+            DLNADerivativeCache::Thumbnail
+        };
+
+        for (size_t i = 0 ; i < sizeof(dlnaProfiles) / sizeof(dlnaProfiles[0]) ; ++i)
+        {
+            const DLNADerivativeCache::Profile profile = dlnaProfiles[i];
+            const NPT_String name = DLNADerivativeCache::profileName(profile).toLatin1().constData();
+            const NPT_String pn   = DLNADerivativeCache::dlnaProfileName(profile).toLatin1().constData();
+
+            PLT_MediaItemResource resource;
+            resource.m_ProtocolInfo = PLT_ProtocolInfo("http-get", "*", "image/jpeg",
+                                                       "DLNA.ORG_PN=" + pn + ";DLNA.ORG_OP=01;DLNA.ORG_CI=1;"
+                                                       "DLNA.ORG_FLAGS=00D00000000000000000000000000000");
+            resource.m_Uri          = uri + "?profile=" + name;
+            object->m_Resources.Add(resource);
+
+            if (profile == DLNADerivativeCache::Thumbnail)
+            {
+                PLT_AlbumArtInfo art;
+                art.uri          = resource.m_Uri;
+                art.dlna_profile = pn;
+                object->m_ExtraInfo.album_arts.Add(art);
+            }
+        }
+    }
+
     NPT_String                                                          urlRoot;
     NPT_String                                                          fileRoot;
     bool                                                                filterUnknownOut;
@@ -76,6 +121,8 @@ public:
     MediaServerMap                                                      map;
 
     PLT_MediaCache<NPT_Reference<NPT_List<NPT_String> >, NPT_TimeStamp> dirCache;
+
+    DLNADerivativeCache*                                                cache;
 };
 
 DLNAMediaServerDelegate::DLNAMediaServerDelegate(const char* url_root,
@@ -84,10 +131,13 @@ DLNAMediaServerDelegate::DLNAMediaServerDelegate(const char* url_root,
 {
       d->urlRoot  = url_root;
       d->useCache = use_cache;
+      d->cache    = new DLNADerivativeCache(QStandardPaths::writableLocation(QStandardPaths::CacheLocation) +
+                                            QLatin1String("/mediaserver"));
 }
 
 DLNAMediaServerDelegate::~DLNAMediaServerDelegate()
 {
+    delete d->cache;
     delete d;
 }
 
@@ -314,6 +364,14 @@ NPT_Result DLNAMediaServerDelegate::OnBrowseDirectChildren(PLT_ActionReference&
 
                 didl += tmp;
                 ++num_returned;
+
+                // Renderers request the thumbnails of the items shown just after browsing.
+
+                if (!filepath.EndsWith("/"))
+                {
+                    d->cache->prefetch(QString::fromUtf8(Private::localFile(filepath).GetChars()),
+                                       DLNADerivativeCache::Thumbnail);
+                }
             }
 
             ++cur_index;
@@ -407,7 +465,7 @@ PLT_MediaObject* DLNAMediaServerDelegate::BuildFromFilePath(const NPT_String&
 
         // format the resource URI
 
-        NPT_String url  = filepath.SubString(filepath.Find("/?file:") + 7);
+        NPT_String url  = Private::localFile(filepath);
 
         qCDebug(DIGIKAM_MEDIASRV_LOG) << "BuildFromFilePath() :: Item URI:\""
                                       << url.GetChars() << "\"";
@@ -438,6 +496,11 @@ PLT_MediaObject* DLNAMediaServerDelegate::BuildFromFilePath(const NPT_String&
 
         object->m_ObjectClass.type = PLT_MediaItem::GetUPnPClass(filepath, &context);
 
+        // The images are also offered as JPEG derivatives with the DLNA image profiles sizes.
+
+        const bool isImage         = object->m_ObjectClass.type.StartsWith("object.item.imageItem") ||
+                                     DRawDecoder::isRawFile(QUrl::fromLocalFile(QString::fromUtf8(url.GetChars())));
+
         // add as many resources as we have interfaces
 
         NPT_HttpUrl base_uri("127.0.0.1",
@@ -449,6 +512,12 @@ PLT_MediaObject* DLNAMediaServerDelegate::BuildFromFilePath(const NPT_String&
         {
             resource.m_Uri = BuildResourceUri(base_uri, ip->ToString(), url);
             object->m_Resources.Add(resource);
+
+            if (isImage)
+            {
+                d->addDerivativeResources(object, resource.m_Uri);
+            }
+
             ++ip;
 
             // if we only want the one resource reachable by client
@@ -722,99 +791,53 @@ NPT_Result DLNAMediaServerDelegate::ServeFile(const NPT_HttpRequest&        requ
                                               NPT_HttpResponse&             response,
                                               const NPT_String&             file_path)
 {
-    // Try to stream image file as transcoded preview.
-    // This will serve image in reduced size, including all know image formats
-    // supported by digiKam core, as JPEG, PNG, TIFF, and RAW files for ex.
-
-    DImg dimg = PreviewLoadThread::loadFastSynchronously(QString::fromUtf8(file_path.GetChars()), 2048);
+    // prevent hackers from accessing files outside of our root
 
-    if (dimg.isNull())
+    if ((file_path.Find("/..") >= 0) || (file_path.Find("\\..") >= 0))
     {
-        // Not a supported image format. Try to stream file as well, without transcoding.
-        // TODO : support video file as transcoded video stream using QtAV (if possible).
-
-        qCDebug(DIGIKAM_MEDIASRV_LOG) << file_path.GetChars() << "not recognized as an image to stream as preview.";
-
-        NPT_CHECK_WARNING(PLT_HttpServer::ServeFile(request, context, response, file_path));
-        return NPT_SUCCESS;
+        return NPT_ERROR_NO_SUCH_ITEM;
     }
 
-    // This code is basically the same than PLT_HttpServer::ServeFile() excepted the
-    // image trancoding pass served as byte stream.
-
-    NPT_InputStreamReference stream;
-    NPT_File                 file(file_path);
-    NPT_FileInfo             file_info;
+    // Serve image file as a JPEG derivative from the cache, generated when first requested.
+    // This will serve image in reduced size, including all know image formats
+    // supported by digiKam core, as JPEG, PNG, TIFF, and RAW files for ex.
+    // The main resource of the images is the preview, the others are the DLNA profiles.
 
-    // prevent hackers from accessing files outside of our root
+    DLNADerivativeCache::Profile profile = DLNADerivativeCache::Preview;
+    NPT_HttpUrlQuery             query(request.GetUrl().GetQuery());
+    const char*                  name    = query.GetField("profile");
 
-    if ((file_path.Find("/..") >= 0)  ||
-        (file_path.Find("\\..") >= 0) ||
-        NPT_FAILED(NPT_File::GetInfo(file_path, &file_info)))
+    if (name && !DLNADerivativeCache::profileFromName(QString::fromLatin1(name), profile))
     {
         return NPT_ERROR_NO_SUCH_ITEM;
     }
 
-    // check for range requests
-
-    const NPT_String* range_spec = request.GetHeaders().GetHeaderValue(NPT_HTTP_HEADER_RANGE);
+    const QString derivative = d->cache->derivative(QString::fromUtf8(file_path.GetChars()), profile);
 
-    // handle potential 304 only if range header not set
-
-    NPT_DateTime  date;
-    NPT_TimeStamp timestamp;
-
-    if (NPT_SUCCEEDED(PLT_UPnPMessageHelper::GetIfModifiedSince((NPT_HttpMessage&)request, date)) &&
-        !range_spec)
+    if (derivative.isNull())
     {
-        date.ToTimeStamp(timestamp);
-
-        NPT_LOG_INFO_5("File %s timestamps: request=%d (%s) vs file=%d (%s)", 
-                       (const char*)request.GetUrl().GetPath(),
-                       (NPT_UInt32)timestamp.ToSeconds(),
-                       (const char*)date.ToString(),
-                       (NPT_UInt32)file_info.m_ModificationTime,
-                       (const char*)NPT_DateTime(file_info.m_ModificationTime).ToString());
-
-        if (timestamp >= file_info.m_ModificationTime)
+        if (name)
         {
-            // it's a match
-
-            NPT_LOG_FINE_1("Returning 304 for %s", request.GetUrl().GetPath().GetChars());
-            response.SetStatus(304, "Not Modified", NPT_HTTP_PROTOCOL_1_1);
-            return NPT_SUCCESS;
+            return NPT_ERROR_NO_SUCH_ITEM;
         }
-    }
-
-    // Trancoding image as preview.
 
-    QImage preview = dimg.copyQImage();
-    QByteArray ba;
-    QBuffer    buffer(&ba);
-    buffer.open(QIODevice::WriteOnly);
-    preview.save(&buffer, "JPG");
-    buffer.close();
+        // Not a supported image format. Try to stream file as well, without transcoding.
+        // TODO : support video file as transcoded video stream using QtAV (if possible).
 
-    stream         = new NPT_MemoryStream(ba.data(), (NPT_Size)ba.size());
+        qCDebug(DIGIKAM_MEDIASRV_LOG) << file_path.GetChars() << "not recognized as an image to stream as preview.";
 
-    if (stream.IsNull())
-    {
-        return NPT_ERROR_NO_SUCH_ITEM;
+        NPT_CHECK_WARNING(PLT_HttpServer::ServeFile(request, context, response, file_path));
+        return NPT_SUCCESS;
     }
 
-    // set Last-Modified and Cache-Control headers
-
-    if (file_info.m_ModificationTime)
-    {
-        NPT_DateTime last_modified = NPT_DateTime(file_info.m_ModificationTime);
-        response.GetHeaders().SetHeader("Last-Modified", last_modified.ToString(NPT_DateTime::FORMAT_RFC_1123), true);
-        response.GetHeaders().SetHeader("Cache-Control", "max-age=0,must-revalidate", true);
-    }
+    // The derivative file is served as the original one, with the range requests and the 304 responses.
+    // The file is open once ServeFile() returns, it can then be removed from the cache.
 
-    PLT_HttpRequestContext tmp_context(request, context);
+    NPT_Result result = PLT_HttpServer::ServeFile(request, context, response,
+                                                  NPT_String(derivative.toUtf8().constData()));
+    d->cache->release(derivative);
 
-    NPT_CHECK_WARNING(PLT_HttpServer::ServeStream(request, context, response, stream,
-                      "image/jpeg"));
+    NPT_CHECK_WARNING(result);
 
     return NPT_SUCCESS;
 }
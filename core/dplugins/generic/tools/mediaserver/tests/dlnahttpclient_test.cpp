@@ -0,0 +1,159 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : local HTTP client measuring the latency and the size
+ *               of the images served by DMediaServer
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+// Qt includes
+
+#include <QString>
+#include <QStringList>
+#include <QApplication>
+#include <QStandardPaths>
+#include <QDir>
+#include <QFileInfo>
+#include <QUrl>
+#include <QMap>
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QEventLoop>
+#include <QNetworkAccessManager>
+#include <QNetworkRequest>
+#include <QNetworkReply>
+
+// Local includes
+
+#include "dmediaserver.h"
+
+using namespace Digikam;
+
+/**
+ * Request all the profiles of each file to a local media server, a first time when the derivatives
+ * are generated, and a second time when they are served from the cache. The derivatives of the
+ * previous runs are removed at startup.
+ *
+ * Usage: dlnahttpclienttest [--port <port>] <image files>
+ */
+int main(int argc, char* argv[])
+{
+    QApplication app(argc, argv);
+    QStringList  args = app.arguments();
+    int          port = 8200;
+
+    args.removeFirst();
+
+    if ((args.count() >= 2) && (args.first() == QLatin1String("--port")))
+    {
+        args.removeFirst();
+        port = args.takeFirst().toInt();
+    }
+
+    if (args.isEmpty())
+    {
+        qDebug() << "Usage: dlnahttpclienttest [--port <port>] <image files>";
+        return -1;
+    }
+
+    QList<QUrl> list;
+
+    foreach (const QString& arg, args)
+    {
+        list.append(QUrl::fromLocalFile(QFileInfo(arg).absoluteFilePath()));
+    }
+
+    QDir(QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + QLatin1String("/mediaserver")).removeRecursively();
+
+    MediaServerMap map;
+    map.insert(QLatin1String("Test Collection"), list);
+
+    DMediaServer server;
+
+    if (!server.init(port))
+    {
+        qDebug() << "Failed to start the Media Server on port" << port;
+        return -1;
+    }
+
+    server.addAlbumsOnServer(map);
+
+    const QStringList profiles = QStringList() << QLatin1String("tn")
+                                               << QLatin1String("sm")
+                                               << QLatin1String("med")
+                                               << QLatin1String("lrg")
+                                               << QLatin1String("preview");
+
+    QNetworkAccessManager manager;
+
+    for (int pass = 0 ; pass < 2 ; ++pass)
+    {
+        qint64 totalTime  = 0;
+        qint64 totalBytes = 0;
+
+        qDebug() << ((pass == 0) ? "Cold cache:" : "Warm cache:");
+
+        foreach (const QUrl& file, list)
+        {
+            foreach (const QString& profile, profiles)
+            {
+                // Same URL as the resources of the items, see DLNAMediaServerDelegate::BuildSafeResourceUri().
+
+                QUrl url;
+                url.setScheme(QLatin1String("http"));
+                url.setHost(QLatin1String("127.0.0.1"));
+                url.setPort(port);
+                url.setPath(QLatin1String("/%25/") +
+                            QString::fromLatin1(QUrl::toPercentEncoding(file.toLocalFile(), "/")),
+                            QUrl::StrictMode);
+                url.setQuery(QLatin1String("profile=") + profile);
+
+                QElapsedTimer timer;
+                timer.start();
+
+                QNetworkReply* const reply = manager.get(QNetworkRequest(url));
+                QEventLoop loop;
+                QObject::connect(reply, SIGNAL(finished()),
+                                 &loop, SLOT(quit()));
+                loop.exec();
+
+                const qint64 bytes   = reply->readAll().size();
+                const qint64 elapsed = timer.elapsed();
+
+                if (reply->error() != QNetworkReply::NoError)
+                {
+                    qDebug() << file.fileName() << profile << "failed:" << reply->errorString();
+                }
+                else
+                {
+                    qDebug() << file.fileName() << profile << elapsed << "ms" << bytes << "bytes";
+
+                    totalTime  += elapsed;
+                    totalBytes += bytes;
+                }
+
+                reply->deleteLater();
+            }
+        }
+
+        qDebug() << "Total:" << totalTime << "ms" << totalBytes << "bytes";
+    }
+
+    return 0;
+}
@@ -26,20 +26,14 @@
 
 // Qt includes
 
-#include <QMap>
-#include <QImage>
-#include <QMatrix>
-#include <QPainter>
-#include <QThread>
-#include <QMutex>
-#include <QFileInfo>
+#include <QStringList>
 
 // Local includes
 
 #include "dimg.h"
 #include "iccsettings.h"
 #include "digikam_debug.h"
-#include "previewloadthread.h"
+#include "previewpreloader.h"
 #include "iccsettingscontainer.h"
 #include "presentationcontainer.h"
 
@@ -48,79 +42,6 @@ using namespace Digikam;
 namespace DigikamGenericPresentationPlugin
 {
 
-typedef QMap<QUrl, QImage> LoadedImages;
-
-class Q_DECL_HIDDEN LoadThread : public QThread
-{
-
-public:
-
-    LoadThread(LoadedImages* const loadedImages, QMutex* const imageLock, const QUrl& path,
-               int width, int height)
-    {
-        m_path         = path;
-        m_swidth       = width;
-        m_sheight      = height;
-        m_imageLock    = imageLock;
-        m_loadedImages = loadedImages;
-    }
-
-    ~LoadThread()
-    {
-    }
-
-protected:
-
-    void run()
-    {
-        QImage newImage;
-
-        ICCSettingsContainer settings = IccSettings::instance()->settings();
-
-        if (settings.enableCM && settings.useManagedPreviews)
-        {
-            IccProfile profile(settings.monitorProfile);
-
-            newImage = PreviewLoadThread::loadHighQualitySynchronously(m_path.toLocalFile(),
-                                                                       PreviewSettings::RawPreviewAutomatic,
-                                                                       profile).copyQImage();
-        }
-        else
-        {
-            newImage = PreviewLoadThread::loadHighQualitySynchronously(m_path.toLocalFile()).copyQImage();
-        }
-
-        m_imageLock->lock();
-
-        if (newImage.isNull())
-        {
-            m_loadedImages->insert(m_path, newImage);
-        }
-        else
-        {
-            m_loadedImages->insert(m_path, newImage.scaled(m_swidth,
-                                                           m_sheight,
-                                                           Qt::KeepAspectRatio,
-                                                           Qt::SmoothTransformation));
-        }
-
-        m_imageLock->unlock();
-    }
-
-private:
-
-    QMutex*       m_imageLock;
-    LoadedImages* m_loadedImages;
-    QUrl          m_path;
-    QString       m_filename;
-    int           m_swidth;
-    int           m_sheight;
-};
-
-typedef QMap<QUrl, LoadThread*> LoadingThreads;
-
-// -----------------------------------------------------------------------------------------
-
 class Q_DECL_HIDDEN PresentationLoader::Private
 {
 
@@ -128,178 +49,98 @@ public:
 
     explicit Private()
     {
-        sharedData     = nullptr;
-        loadingThreads = nullptr;
-        loadedImages   = nullptr;
-        imageLock      = nullptr;
-        threadLock     = nullptr;
-        cacheSize      = 0;
-        currIndex      = 0;
-        swidth         = 0;
-        sheight        = 0;
+        sharedData  = nullptr;
+        preloader   = nullptr;
+        currIndex   = 0;
+        swidth      = 0;
+        sheight     = 0;
+        loadedIndex = -1;
     }
 
     PresentationContainer* sharedData;
-    LoadingThreads*        loadingThreads;
-    LoadedImages*          loadedImages;
-
-    QMutex*                imageLock;
-    QMutex*                threadLock;
+    PreviewPreloader*      preloader;
 
-    uint                   cacheSize;
     int                    currIndex;
     int                    swidth;
     int                    sheight;
+
+    /// The current image, scaled to the screen.
+    int                    loadedIndex;
+    QImage                 loadedImage;
 };
 
 PresentationLoader::PresentationLoader(PresentationContainer* const sharedData, int width, int height,
                                        int beginAtIndex)
     : d(new Private)
 {
-    d->sharedData     = sharedData;
-    d->currIndex      = beginAtIndex;
-    d->cacheSize      = d->sharedData->enableCache ? d->sharedData->cacheSize : 1;
-    d->swidth         = width;
-    d->sheight        = height;
-    d->loadingThreads = new LoadingThreads();
-    d->loadedImages   = new LoadedImages();
-    d->imageLock      = new QMutex();
-    d->threadLock     = new QMutex();
+    d->sharedData = sharedData;
+    d->currIndex  = beginAtIndex;
+    d->swidth     = width;
+    d->sheight    = height;
+    d->preloader  = new PreviewPreloader;
 
-    QUrl filePath;
-
-    for (uint i = 0; i < uint(d->cacheSize / 2) && i < uint(d->sharedData->urlList.count()); ++i)
-    {
-        filePath                    = d->sharedData->urlList[i];
-        LoadThread* const newThread = new LoadThread(d->loadedImages, d->imageLock,
-                                                     filePath, d->swidth, d->sheight);
-        d->threadLock->lock();
-        d->loadingThreads->insert(filePath, newThread);
-        newThread->start();
-        d->threadLock->unlock();
-    }
+    QStringList files;
 
-    for (uint i = 0; i < (d->cacheSize % 2 == 0 ? (d->cacheSize % 2) : uint(d->cacheSize / 2) + 1); ++i)
+    foreach (const QUrl& url, d->sharedData->urlList)
     {
-        int toLoad                  = (d->currIndex - i) % d->sharedData->urlList.count();
-        filePath                    = d->sharedData->urlList[toLoad];
-        LoadThread* const newThread = new LoadThread(d->loadedImages, d->imageLock,
-                                                     filePath, d->swidth, d->sheight);
-        d->threadLock->lock();
-        d->loadingThreads->insert(filePath, newThread);
-        newThread->start();
-        d->threadLock->unlock();
+        files << url.toLocalFile();
     }
-}
 
-PresentationLoader::~PresentationLoader()
-{
-    d->threadLock->lock();
-    LoadingThreads::Iterator it;
+    IccProfile profile;
+    ICCSettingsContainer settings = IccSettings::instance()->settings();
 
-    for (it = d->loadingThreads->begin(); it != d->loadingThreads->end(); ++it)
+    if (settings.enableCM && settings.useManagedPreviews)
     {
-        // better check for a valid pointer here
-        if (it.value())
-            it.value()->wait();
-
-        delete it.value();
+        profile = IccProfile(settings.monitorProfile);
     }
 
-    d->loadingThreads->clear();
+    // The images are loaded at the size of the screen, with the reduced size loaders,
+    // and the count of images preloaded follows the loading time and the delay.
+    // The cache size of the presentation is the maximum count of images preloaded.
 
-    d->threadLock->unlock();
+    d->preloader->setFiles(files, d->sharedData->loop);
+    d->preloader->setPreviewSettings(PreviewSettings::fastPreview(), qMax(d->swidth, d->sheight), profile);
+    d->preloader->setInterval(d->sharedData->delay);
+    d->preloader->setMaximumLookAhead(d->sharedData->enableCache ? (int)d->sharedData->cacheSize : 1);
+    d->preloader->setCurrentIndex(d->currIndex);
+}
 
-    delete d->loadedImages;
-    delete d->loadingThreads;
-    delete d->imageLock;
-    delete d->threadLock;
+PresentationLoader::~PresentationLoader()
+{
+    delete d->preloader;
     delete d;
 }
 
 void PresentationLoader::next()
 {
-    int victim   = (d->currIndex - (d->cacheSize % 2 == 0 ? (d->cacheSize / 2) - 1
-                                                          :  int(d->cacheSize / 2))) % d->sharedData->urlList.count();
-
-    int newBorn  = (d->currIndex + int(d->cacheSize / 2) + 1) % d->sharedData->urlList.count();
     d->currIndex = (d->currIndex + 1) % d->sharedData->urlList.count();
-
-    if (victim == newBorn)
-        return;
-
-    d->threadLock->lock();
-
-    LoadThread* const oldThread = d->loadingThreads->value(d->sharedData->urlList[victim]);
-
-    if (oldThread)
-        oldThread->wait();
-
-    delete oldThread;
-
-    d->loadingThreads->remove(d->sharedData->urlList[victim]);
-    d->imageLock->lock();
-    d->loadedImages->remove(d->sharedData->urlList[victim]);
-    d->imageLock->unlock();
-    d->threadLock->unlock();
-
-    QUrl filePath               = d->sharedData->urlList[newBorn];
-    LoadThread* const newThread = new LoadThread(d->loadedImages, d->imageLock, filePath, d->swidth, d->sheight);
-
-    d->threadLock->lock();
-
-    d->loadingThreads->insert(filePath, newThread);
-    newThread->start();
-
-    d->threadLock->unlock();
+    d->preloader->setCurrentIndex(d->currIndex);
 }
 
 void PresentationLoader::prev()
 {
-    int victim   = (d->currIndex + int(d->currIndex / 2)) % d->sharedData->urlList.count();
-    int newBorn  = (d->currIndex - ((d->cacheSize & 2) == 0 ? (d->cacheSize / 2)
-                                                            : int(d->cacheSize / 2) + 1)) % d->sharedData->urlList.count();
-
     d->currIndex = d->currIndex > 0 ? d->currIndex - 1 : d->sharedData->urlList.count() - 1;
-
-    if (victim == newBorn)
-        return;
-
-    d->threadLock->lock();
-    d->imageLock->lock();
-
-    LoadThread* const oldThread = d->loadingThreads->value(d->sharedData->urlList[victim]);
-
-    if (oldThread)
-        oldThread->wait();
-
-    delete oldThread;
-
-    d->loadingThreads->remove(d->sharedData->urlList[victim]);
-    d->loadedImages->remove(d->sharedData->urlList[victim]);
-
-    d->imageLock->unlock();
-    d->threadLock->unlock();
-
-    QUrl filePath               = d->sharedData->urlList[newBorn];
-    LoadThread* const newThread = new LoadThread(d->loadedImages, d->imageLock, filePath, d->swidth, d->sheight);
-
-    d->threadLock->lock();
-
-    d->loadingThreads->insert(filePath, newThread);
-    newThread->start();
-
-    d->threadLock->unlock();
+    d->preloader->setCurrentIndex(d->currIndex);
 }
 
 QImage PresentationLoader::getCurrent() const
 {
-    checkIsIn(d->currIndex);
-    d->imageLock->lock();
-    QImage returned = (*d->loadedImages)[d->sharedData->urlList[d->currIndex]];
-    d->imageLock->unlock();
+    if (d->loadedIndex != d->currIndex)
+    {
+        // Taken from the cache when it was preloaded.
+
+        QImage image = d->preloader->load(d->sharedData->urlList[d->currIndex].toLocalFile()).copyQImage();
+
+        if (!image.isNull())
+        {
+            image = image.scaled(d->swidth, d->sheight, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+        }
+
+        d->loadedImage = image;
+        d->loadedIndex = d->currIndex;
+    }
 
-    return returned;
+    return d->loadedImage;
 }
 
 QString PresentationLoader::currFileName() const
@@ -312,27 +153,4 @@ QUrl PresentationLoader::currPath() const
     return d->sharedData->urlList[d->currIndex];
 }
 
-void PresentationLoader::checkIsIn(int index) const
-{
-    d->threadLock->lock();
-
-    if (d->loadingThreads->contains(d->sharedData->urlList[index]))
-    {
-        if ((*d->loadingThreads)[d->sharedData->urlList[index]]->isRunning())
-            (*d->loadingThreads)[d->sharedData->urlList[index]]->wait();
-
-        d->threadLock->unlock();
-    }
-    else
-    {
-        QUrl filePath               = d->sharedData->urlList[index];
-        LoadThread* const newThread = new LoadThread(d->loadedImages, d->imageLock, filePath, d->swidth, d->sheight);
-
-        d->loadingThreads->insert(d->sharedData->urlList[index], newThread);
-        newThread->start();
-        (*d->loadingThreads)[d->sharedData->urlList[index]]->wait();
-        d->threadLock->unlock();
-    }
-}
-
 } // namespace DigikamGenericPresentationPlugin
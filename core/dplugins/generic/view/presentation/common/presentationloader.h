@@ -54,10 +54,6 @@ public:
     QString currFileName() const;
     QUrl    currPath()     const;
 
-private:
-
-    void checkIsIn(int index) const;
-
 private:
 
     PresentationLoader(const PresentationLoader&); // Disable
@@ -30,6 +30,7 @@
 
 #include <QMatrix>
 #include <QFileInfo>
+#include <QStringList>
 
 // Local includes
 
@@ -37,7 +38,7 @@
 #include "iccsettings.h"
 #include "digikam_debug.h"
 #include "presentationkb.h"
-#include "previewloadthread.h"
+#include "previewpreloader.h"
 #include "iccsettingscontainer.h"
 #include "presentationcontainer.h"
 
@@ -62,6 +63,7 @@ public:
         haveImages    = false;
         quitRequested = false;
         textureAspect = 0.0;
+        preloader     = nullptr;
     }
 
     PresentationContainer* sharedData;
@@ -82,7 +84,8 @@ public:
     float                  textureAspect;
     QImage                 texture;
 
-    IccProfile             iccProfile;
+    /// Lives in the main thread, where the images are requested.
+    PreviewPreloader*      preloader;
 };
 
 KBImageLoader::KBImageLoader(PresentationContainer* const sharedData, int width, int height)
@@ -93,16 +96,33 @@ KBImageLoader::KBImageLoader(PresentationContainer* const sharedData, int width,
     d->width      = width;
     d->height     = height;
 
+    IccProfile profile;
     ICCSettingsContainer settings = IccSettings::instance()->settings();
 
     if (settings.enableCM && settings.useManagedPreviews)
     {
-        d->iccProfile = IccProfile(settings.monitorProfile);
+        profile = IccProfile(settings.monitorProfile);
     }
+
+    QStringList files;
+
+    foreach (const QUrl& url, d->sharedData->urlList)
+    {
+        files << url.toLocalFile();
+    }
+
+    // The images are loaded at the size of the screen, with the reduced size loaders.
+
+    d->preloader = new PreviewPreloader;
+    d->preloader->setFiles(files, d->sharedData->loop);
+    d->preloader->setPreviewSettings(PreviewSettings::fastPreview(), qMax(width, height), profile);
+    d->preloader->setInterval(d->sharedData->delay);
+    d->preloader->setMaximumLookAhead(d->sharedData->enableCache ? (int)d->sharedData->cacheSize : 1);
 }
 
 KBImageLoader::~KBImageLoader()
 {
+    delete d->preloader;
     delete d;
 }
 
@@ -122,6 +142,17 @@ void KBImageLoader::requestNewImage()
     {
         d->needImage = true;
         d->imageRequest.wakeOne();
+
+        // Preload the images after the one which will be loaded now. The files which cannot
+        // be loaded are removed from the list, so the preloader finds the file by its path.
+
+        const int count = d->sharedData->urlList.count();
+        const int index = (d->sharedData->loop && (count > 0)) ? (d->fileIndex % count) : d->fileIndex;
+
+        if (index < count)
+        {
+            d->preloader->setCurrentFile(d->sharedData->urlList[index].toLocalFile());
+        }
     }
 }
 
@@ -200,9 +231,7 @@ void KBImageLoader::run()
 bool KBImageLoader::loadImage()
 {
     QString path  = d->sharedData->urlList[d->fileIndex].toLocalFile();
-    QImage  image = PreviewLoadThread::loadHighQualitySynchronously(path,
-                                                                    PreviewSettings::RawPreviewAutomatic,
-                                                                    d->iccProfile).copyQImage();
+    QImage  image = d->preloader->load(path).copyQImage();
 
     if (image.isNull())
     {
@@ -222,8 +251,18 @@ bool KBImageLoader::loadImage()
 
 void KBImageLoader::invalidateCurrentImageName()
 {
-    d->sharedData->urlList.removeAll(d->sharedData->urlList[d->fileIndex]);
+    // The list is read by requestNewImage() in the main thread.
+
+    QMutexLocker locker(&d->condLock);
+
+    const QUrl url = d->sharedData->urlList[d->fileIndex];
+    d->sharedData->urlList.removeAll(url);
     d->fileIndex++;
+
+    // The preloader lives in the main thread.
+
+    QMetaObject::invokeMethod(d->preloader, "removeFile", Qt::QueuedConnection,
+                              Q_ARG(QString, url.toLocalFile()));
 }
 
 bool KBImageLoader::grabImage()
@@ -94,7 +94,7 @@ AlbumManager::AlbumManager()
     d->albumItemCountTimer->setSingleShot(true);
 
     connect(d->albumItemCountTimer, SIGNAL(timeout()),
-            this, SLOT(getAlbumItemsCount()));
+            this, SLOT(updateChangedAlbumsCount()));
 
     // more expensive
     d->tagItemCountTimer = new QTimer(this);
@@ -102,7 +102,7 @@ AlbumManager::AlbumManager()
     d->tagItemCountTimer->setSingleShot(true);
 
     connect(d->tagItemCountTimer, SIGNAL(timeout()),
-            this, SLOT(getTagItemsCount()));
+            this, SLOT(updateChangedTagsCount()));
 }
 
 AlbumManager::~AlbumManager()
@@ -143,6 +143,24 @@ void AlbumManager::cleanUp()
         d->personListJob->cancel();
         d->personListJob = nullptr;
     }
+
+    if (d->albumCountJob)
+    {
+        d->albumCountJob->cancel();
+        d->albumCountJob = nullptr;
+    }
+
+    if (d->tagCountJob)
+    {
+        d->tagCountJob->cancel();
+        d->tagCountJob = nullptr;
+    }
+
+    if (d->dateCountJob)
+    {
+        d->dateCountJob->cancel();
+        d->dateCountJob = nullptr;
+    }
 }
 
 void AlbumManager::startScan()
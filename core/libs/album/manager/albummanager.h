@@ -255,9 +255,17 @@ private Q_SLOTS:
 
     void slotAlbumsJobResult();
     void slotAlbumsJobData(const QMap<int, int>& albumsStatMap);
+    void slotAlbumsCountJobResult();
+    void slotAlbumsCountJobData(const QMap<int, int>& albumsStatMap);
     void slotAlbumChange(const AlbumChangeset& changeset);
     void getAlbumItemsCount();
 
+    /**
+     * Only count again the items of the albums changed since the last count,
+     * and merge them with the known counts.
+     */
+    void updateChangedAlbumsCount();
+
 Q_SIGNALS:
 
     /** Emitted when an album is about to be added to the given parent (0 if album is root)
@@ -340,6 +348,8 @@ private Q_SLOTS:
 
     void slotDatesJobResult();
     void slotDatesJobData(const QMap<QDateTime, int>& datesStatMap);
+    void slotDatesCountJobResult();
+    void slotDatesCountJobData(const QMap<QDateTime, int>& datesStatMap);
 
    /**
      * Scan dates from the database and updates the DAlbums.
@@ -347,6 +357,12 @@ private Q_SLOTS:
     void scanDAlbumsScheduled();
     void scanDAlbums();
 
+    /**
+     * Only count again the items of the months of the items added to or removed
+     * from the collection since the last count, and merge them with the known counts.
+     */
+    void updateChangedDAlbums();
+
 Q_SIGNALS:
 
     void signalDAlbumsDirty(const QMap<YearMonth, int>&);
@@ -681,12 +697,20 @@ private Q_SLOTS:
 
     void slotTagsJobResult();
     void slotTagsJobData(const QMap<int, int>& tagsStatMap);
+    void slotTagsCountJobResult();
+    void slotTagsCountJobData(const QMap<int, int>& tagsStatMap);
     void slotTagChange(const TagChangeset& changeset);
     void slotImageTagChange(const ImageTagChangeset& changeset);
 
     void getTagItemsCount();
     void tagItemsCount();
 
+    /**
+     * Only count again the items of the tags changed since the last count,
+     * and merge them with the known counts. Face counts are computed again.
+     */
+    void updateChangedTagsCount();
+
 Q_SIGNALS:
 
     void signalTAlbumsDirty(const QMap<int, int>&);
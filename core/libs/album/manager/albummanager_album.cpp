@@ -206,6 +206,8 @@ void AlbumManager::invalidateGuardedPointers(Album* album)
 void AlbumManager::getAlbumItemsCount()
 {
     d->albumItemCountTimer->stop();
+    d->pAlbumsToCount.clear();
+    d->countAllPAlbums = false;
 
     if (!ApplicationSettings::instance()->getShowFolderTreeViewItemsCount())
     {
@@ -218,6 +220,14 @@ void AlbumManager::getAlbumItemsCount()
         d->albumListJob = nullptr;
     }
 
+    // The full count includes the changes counted by a partial job.
+
+    if (d->albumCountJob)
+    {
+        d->albumCountJob->cancel();
+        d->albumCountJob = nullptr;
+    }
+
     AlbumsDBJobInfo jInfo;
     jInfo.setFoldersJob();
     d->albumListJob = DBJobsManager::instance()->startAlbumsJobThread(jInfo);
@@ -229,6 +239,76 @@ void AlbumManager::getAlbumItemsCount()
             this, SLOT(slotAlbumsJobData(QMap<int,int>)));
 }
 
+void AlbumManager::updateChangedAlbumsCount()
+{
+    // Merge the counts in the order of the changes: wait for the previous ones.
+
+    if (d->albumCountJob)
+    {
+        d->albumItemCountTimer->start();
+        return;
+    }
+
+    // A running job will not see the last changes, start it again.
+
+    if (d->countAllPAlbums || d->pAlbumsCount.isEmpty() || d->albumListJob)
+    {
+        getAlbumItemsCount();
+        return;
+    }
+
+    d->albumItemCountTimer->stop();
+
+    if (d->pAlbumsToCount.isEmpty() || !ApplicationSettings::instance()->getShowFolderTreeViewItemsCount())
+    {
+        d->pAlbumsToCount.clear();
+        return;
+    }
+
+    AlbumsDBJobInfo jInfo;
+    jInfo.setFoldersJob();
+    jInfo.setAlbumsIds(d->pAlbumsToCount.toList());
+    d->pAlbumsToCount.clear();
+
+    d->albumCountJob = DBJobsManager::instance()->startAlbumsJobThread(jInfo);
+
+    connect(d->albumCountJob, SIGNAL(finished()),
+            this, SLOT(slotAlbumsCountJobResult()));
+
+    connect(d->albumCountJob, SIGNAL(foldersData(QMap<int,int>)),
+            this, SLOT(slotAlbumsCountJobData(QMap<int,int>)));
+}
+
+void AlbumManager::slotAlbumsCountJobResult()
+{
+    if (!d->albumCountJob)
+    {
+        return;
+    }
+
+    if (d->albumCountJob->hasErrors())
+    {
+        qCWarning(DIGIKAM_GENERAL_LOG) << "Failed to count album items";
+    }
+
+    d->albumCountJob = nullptr;
+}
+
+void AlbumManager::slotAlbumsCountJobData(const QMap<int, int>& albumsStatMap)
+{
+    if (albumsStatMap.isEmpty() || (sender() != d->albumCountJob))
+    {
+        return;
+    }
+
+    for (QMap<int, int>::const_iterator it = albumsStatMap.constBegin() ; it != albumsStatMap.constEnd() ; ++it)
+    {
+        d->pAlbumsCount[it.key()] = it.value();
+    }
+
+    emit signalPAlbumsDirty(d->pAlbumsCount);
+}
+
 void AlbumManager::slotAlbumChange(const AlbumChangeset& changeset)
 {
     if (d->changingDB || !d->rootPAlbum)
@@ -201,11 +201,38 @@ void AlbumManager::slotCollectionImageChange(const CollectionImageChangeset& cha
                 d->scanDAlbumsTimer->start();
             }
 
+            if (changeset.albums().isEmpty())
+            {
+                d->countAllPAlbums = true;
+            }
+            else
+            {
+                d->pAlbumsToCount += changeset.albums().toSet();
+            }
+
+            // The tags and the dates of deleted items are not in the database anymore.
+
+            if (changeset.ids().isEmpty() || (changeset.operation() == CollectionImageChangeset::Deleted))
+            {
+                d->countAllTAlbums = true;
+                d->countAllDAlbums = true;
+            }
+            else
+            {
+                d->tItemsToCount += changeset.ids().toSet();
+                d->dItemsToCount += changeset.ids().toSet();
+            }
+
             if (!d->albumItemCountTimer->isActive())
             {
                 d->albumItemCountTimer->start();
             }
 
+            if (!d->tagItemCountTimer->isActive())
+            {
+                d->tagItemCountTimer->start();
+            }
+
             break;
 
         default:
@@ -31,6 +31,8 @@ namespace Digikam
 void AlbumManager::scanDAlbums()
 {
     d->scanDAlbumsTimer->stop();
+    d->dItemsToCount.clear();
+    d->countAllDAlbums = false;
 
     if (d->dateListJob)
     {
@@ -38,6 +40,14 @@ void AlbumManager::scanDAlbums()
         d->dateListJob = nullptr;
     }
 
+    // The full scan includes the changes counted by a partial job.
+
+    if (d->dateCountJob)
+    {
+        d->dateCountJob->cancel();
+        d->dateCountJob = nullptr;
+    }
+
     DatesDBJobInfo jInfo;
     jInfo.setFoldersJob();
     d->dateListJob = DBJobsManager::instance()->startDatesJobThread(jInfo);
@@ -49,6 +59,29 @@ void AlbumManager::scanDAlbums()
             this, SLOT(slotDatesJobData(QMap<QDateTime,int>)));
 }
 
+void AlbumManager::updateChangedDAlbums()
+{
+    d->scanDAlbumsTimer->stop();
+
+    if (d->dItemsToCount.isEmpty())
+    {
+        return;
+    }
+
+    DatesDBJobInfo jInfo;
+    jInfo.setFoldersJob();
+    jInfo.setItemsIds(d->dItemsToCount.toList());
+    d->dItemsToCount.clear();
+
+    d->dateCountJob = DBJobsManager::instance()->startDatesJobThread(jInfo);
+
+    connect(d->dateCountJob, SIGNAL(finished()),
+            this, SLOT(slotDatesCountJobResult()));
+
+    connect(d->dateCountJob, SIGNAL(foldersData(QMap<QDateTime,int>)),
+            this, SLOT(slotDatesCountJobData(QMap<QDateTime,int>)));
+}
+
 AlbumList AlbumManager::allDAlbums() const
 {
     AlbumList list;
@@ -107,6 +140,71 @@ void AlbumManager::slotDatesJobResult()
     emit signalAllDAlbumsLoaded();
 }
 
+void AlbumManager::slotDatesCountJobResult()
+{
+    if (!d->dateCountJob)
+    {
+        return;
+    }
+
+    if (d->dateCountJob->hasErrors())
+    {
+        qCWarning(DIGIKAM_GENERAL_LOG) << "Failed to count date items";
+    }
+
+    d->dateCountJob = nullptr;
+}
+
+void AlbumManager::slotDatesCountJobData(const QMap<QDateTime, int>& datesStatMap)
+{
+    if (datesStatMap.isEmpty() || (sender() != d->dateCountJob))
+    {
+        return;
+    }
+
+    // The months found in the map were counted again as a whole: replace their dates.
+
+    QSet<QDate> months;
+
+    for (QMap<QDateTime, int>::const_iterator it = datesStatMap.constBegin() ;
+         it != datesStatMap.constEnd() ; ++it)
+    {
+        months << QDate(it.key().date().year(), it.key().date().month(), 1);
+    }
+
+    QMap<QDateTime, int> datesCount = d->datesCount;
+
+    for (QMap<QDateTime, int>::iterator it = datesCount.begin() ; it != datesCount.end() ; )
+    {
+        if (months.contains(QDate(it.key().date().year(), it.key().date().month(), 1)))
+        {
+            it = datesCount.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    for (QMap<QDateTime, int>::const_iterator it = datesStatMap.constBegin() ;
+         it != datesStatMap.constEnd() ; ++it)
+    {
+        if (it.value() > 0)
+        {
+            datesCount.insert(it.key(), it.value());
+        }
+    }
+
+    if (datesCount.isEmpty())
+    {
+        // No dated item is left, let the full scan remove the albums.
+        scanDAlbums();
+        return;
+    }
+
+    slotDatesJobData(datesCount);
+}
+
 void AlbumManager::slotDatesJobData(const QMap<QDateTime, int>& datesStatMap)
 {
     if (datesStatMap.isEmpty() || !d->rootDAlbum)
@@ -114,6 +212,8 @@ void AlbumManager::slotDatesJobData(const QMap<QDateTime, int>& datesStatMap)
         return;
     }
 
+    d->datesCount = datesStatMap;
+
     // insert all the DAlbums into a qmap for quick access
     QMap<QDate, DAlbum*> mAlbumMap;
     QMap<int, DAlbum*>   yAlbumMap;
@@ -259,13 +359,19 @@ void AlbumManager::slotDatesJobData(const QMap<QDateTime, int>& datesStatMap)
 void AlbumManager::scanDAlbumsScheduled()
 {
     // Avoid a cycle of killing a job which takes longer than the timer interval
-    if (d->dateListJob)
+    if (d->dateListJob || d->dateCountJob)
     {
         d->scanDAlbumsTimer->start();
         return;
     }
 
-    scanDAlbums();
+    if (d->countAllDAlbums || d->datesCount.isEmpty())
+    {
+        scanDAlbums();
+        return;
+    }
+
+    updateChangedDAlbums();
 }
 
 } // namespace Digikam
@@ -70,6 +70,9 @@ AlbumManager::Private::Private()
       dateListJob(nullptr),
       tagListJob(nullptr),
       personListJob(nullptr),
+      albumCountJob(nullptr),
+      tagCountJob(nullptr),
+      dateCountJob(nullptr),
       albumWatch(nullptr),
       rootPAlbum(nullptr),
       rootTAlbum(nullptr),
@@ -83,7 +86,10 @@ AlbumManager::Private::Private()
       scanDAlbumsTimer(nullptr),
       updatePAlbumsTimer(nullptr),
       albumItemCountTimer(nullptr),
-      tagItemCountTimer(nullptr)
+      tagItemCountTimer(nullptr),
+      countAllPAlbums(false),
+      countAllTAlbums(false),
+      countAllDAlbums(false)
 {
 }
 
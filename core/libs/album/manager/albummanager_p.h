@@ -160,6 +160,11 @@ public:
     TagsDBJobsThread*           tagListJob;
     TagsDBJobsThread*           personListJob;
 
+    /// Count the items of the albums, tags and dates changed since the last count.
+    AlbumsDBJobsThread*         albumCountJob;
+    TagsDBJobsThread*           tagCountJob;
+    DatesDBJobsThread*          dateCountJob;
+
 
     AlbumWatch*                 albumWatch;
 
@@ -190,9 +195,27 @@ public:
     QTimer*                     tagItemCountTimer;
     QSet<int>                   changedPAlbums;
 
+    /**
+     * Albums and tags whose item count changed since the last count update.
+     * If the changesets do not tell which ones, all counts are computed again.
+     */
+    QSet<int>                   pAlbumsToCount;
+    QSet<int>                   tAlbumsToCount;
+    bool                        countAllPAlbums;
+    bool                        countAllTAlbums;
+    bool                        countAllDAlbums;
+
+    /**
+     * Items added to or removed from the collection since the last count update.
+     * The counts of their tags and of their months are computed again.
+     */
+    QSet<qlonglong>             tItemsToCount;
+    QSet<qlonglong>             dItemsToCount;
+
     QMap<int, int>              pAlbumsCount;
     QMap<int, int>              tAlbumsCount;
     QMap<YearMonth, int>        dAlbumsCount;
+    QMap<QDateTime, int>        datesCount;
     QMap<int, int>              fAlbumsCount;
 
 public:
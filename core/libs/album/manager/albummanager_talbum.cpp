@@ -184,12 +184,24 @@ void AlbumManager::getTagItemsCount()
 
 void AlbumManager::tagItemsCount()
 {
+    d->tAlbumsToCount.clear();
+    d->tItemsToCount.clear();
+    d->countAllTAlbums = false;
+
     if (d->tagListJob)
     {
         d->tagListJob->cancel();
         d->tagListJob = nullptr;
     }
 
+    // The full count includes the changes counted by a partial job.
+
+    if (d->tagCountJob)
+    {
+        d->tagCountJob->cancel();
+        d->tagCountJob = nullptr;
+    }
+
     TagsDBJobInfo jInfo;
     jInfo.setFoldersJob();
 
@@ -202,6 +214,82 @@ void AlbumManager::tagItemsCount()
             this, SLOT(slotTagsJobData(QMap<int,int>)));
 }
 
+void AlbumManager::updateChangedTagsCount()
+{
+    // Merge the counts in the order of the changes: wait for the previous ones.
+
+    if (d->tagCountJob)
+    {
+        d->tagItemCountTimer->start();
+        return;
+    }
+
+    // A running job will not see the last changes, start it again.
+
+    if (d->countAllTAlbums || d->tAlbumsCount.isEmpty() || d->tagListJob)
+    {
+        getTagItemsCount();
+        return;
+    }
+
+    d->tagItemCountTimer->stop();
+
+    if ((d->tAlbumsToCount.isEmpty() && d->tItemsToCount.isEmpty()) ||
+        !ApplicationSettings::instance()->getShowFolderTreeViewItemsCount())
+    {
+        d->tAlbumsToCount.clear();
+        d->tItemsToCount.clear();
+        return;
+    }
+
+    TagsDBJobInfo jInfo;
+    jInfo.setFoldersJob();
+    jInfo.setTagsIds(d->tAlbumsToCount.toList());
+    jInfo.setItemsIds(d->tItemsToCount.toList());
+    d->tAlbumsToCount.clear();
+    d->tItemsToCount.clear();
+
+    d->tagCountJob = DBJobsManager::instance()->startTagsJobThread(jInfo);
+
+    connect(d->tagCountJob, SIGNAL(finished()),
+            this, SLOT(slotTagsCountJobResult()));
+
+    connect(d->tagCountJob, SIGNAL(foldersData(QMap<int,int>)),
+            this, SLOT(slotTagsCountJobData(QMap<int,int>)));
+
+    personItemsCount();
+}
+
+void AlbumManager::slotTagsCountJobResult()
+{
+    if (!d->tagCountJob)
+    {
+        return;
+    }
+
+    if (d->tagCountJob->hasErrors())
+    {
+        qCWarning(DIGIKAM_GENERAL_LOG) << "Failed to count tag items";
+    }
+
+    d->tagCountJob = nullptr;
+}
+
+void AlbumManager::slotTagsCountJobData(const QMap<int, int>& tagsStatMap)
+{
+    if (tagsStatMap.isEmpty() || (sender() != d->tagCountJob))
+    {
+        return;
+    }
+
+    for (QMap<int, int>::const_iterator it = tagsStatMap.constBegin() ; it != tagsStatMap.constEnd() ; ++it)
+    {
+        d->tAlbumsCount[it.key()] = it.value();
+    }
+
+    emit signalTAlbumsDirty(d->tAlbumsCount);
+}
+
 AlbumList AlbumManager::allTAlbums() const
 {
     AlbumList list;
@@ -974,6 +1062,15 @@ void AlbumManager::slotImageTagChange(const ImageTagChangeset& changeset)
         // updated. This adoption should fix the problem.
         case ImageTagChangeset::PropertiesChanged:
 
+            if (changeset.tags().isEmpty())
+            {
+                d->countAllTAlbums = true;
+            }
+            else
+            {
+                d->tAlbumsToCount += changeset.tags().toSet();
+            }
+
             if (!d->tagItemCountTimer->isActive())
             {
                 d->tagItemCountTimer->start();
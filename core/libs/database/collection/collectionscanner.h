@@ -45,6 +45,8 @@ class QFileInfo;
 namespace Digikam
 {
 
+class DMetadata;
+
 class DIGIKAM_DATABASE_EXPORT CollectionScanner : public QObject
 {
     Q_OBJECT
@@ -166,6 +168,12 @@ public:
      */
     qlonglong scanFile(const QString& filePath, FileScanMode mode = ModifiedScan);
 
+    /**
+     * Same procedure as above, but the metadata of the file was already parsed by the caller,
+     * as the import tool does when it writes the file. It will not be parsed again.
+     */
+    qlonglong scanFile(const QString& filePath, const DMetadata& metadata, FileScanMode mode = ModifiedScan);
+
     /**
      * Same procedure as above, but albumRoot and album is provided.
      * If you already have this info it need not be retrieved.
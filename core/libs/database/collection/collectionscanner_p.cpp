@@ -66,6 +66,18 @@ bool NewlyAppearedFile::operator==(const NewlyAppearedFile& other) const
 
 // --------------------------------------------------------------------
 
+ScanSynchronizationRelaxer::ScanSynchronizationRelaxer()
+{
+    CoreDbAccess().backend()->setRelaxedSynchronization(true);
+}
+
+ScanSynchronizationRelaxer::~ScanSynchronizationRelaxer()
+{
+    CoreDbAccess().backend()->setRelaxedSynchronization(false);
+}
+
+// --------------------------------------------------------------------
+
 bool CollectionScannerHintContainerImplementation::hasAnyNormalHint(qlonglong id)
 {
     QReadLocker locker(&lock);
@@ -217,7 +229,8 @@ CollectionScanner::Private::Private()
       updatingHashHint(false),
       recordHistoryIds(false),
       deferredFileScanning(false),
-      observer(nullptr)
+      observer(nullptr),
+      preloadedMetadata(nullptr)
 {
 }
 
@@ -252,6 +265,14 @@ bool CollectionScanner::Private::checkDeferred(const QFileInfo& info)
     return false;
 }
 
+void CollectionScanner::Private::usePreloadedMetadata(ItemScanner& scanner, const QFileInfo& info)
+{
+    if (preloadedMetadata && (QDir::cleanPath(info.absoluteFilePath()) == preloadedFilePath))
+    {
+        scanner.setMetadata(*preloadedMetadata);
+    }
+}
+
 void CollectionScanner::Private::finishScanner(ItemScanner& scanner)
 {
     // Perform the actual write operation to the database
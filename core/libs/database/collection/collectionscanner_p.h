@@ -61,6 +61,7 @@
 #include "itemcopyright.h"
 #include "iteminfo.h"
 #include "itemscanner.h"
+#include "dprofiler.h"
 #include "metaenginesettings.h"
 #include "tagscache.h"
 #include "thumbsdbaccess.h"
@@ -91,6 +92,25 @@ public:
 
 // --------------------------------------------------------------------
 
+/**
+ * Relaxes the synchronization of the database connection of the scanning thread
+ * for the lifetime of the object, see BdEngineBackend::setRelaxedSynchronization().
+ */
+class Q_DECL_HIDDEN ScanSynchronizationRelaxer
+{
+
+public:
+
+    ScanSynchronizationRelaxer();
+    ~ScanSynchronizationRelaxer();
+
+private:
+
+    Q_DISABLE_COPY(ScanSynchronizationRelaxer)
+};
+
+// --------------------------------------------------------------------
+
 inline uint qHash(const NewlyAppearedFile& file)
 {
     return ::qHash(file.albumId) ^ ::qHash(file.fileName);
@@ -147,6 +167,11 @@ public:
 
     void finishScanner(ItemScanner& scanner);
 
+    /**
+     * Pass the metadata given to scanFile() to the scanner of this file.
+     */
+    void usePreloadedMetadata(ItemScanner& scanner, const QFileInfo& info);
+
 public:
 
     QSet<QString>                                 nameFilters;
@@ -173,6 +198,9 @@ public:
     QSet<QString>                                 deferredAlbumPaths;
 
     CollectionScannerObserver*                    observer;
+
+    const DMetadata*                              preloadedMetadata;
+    QString                                       preloadedFilePath;
 };
 
 } // namespace Digikam
@@ -30,11 +30,15 @@ namespace Digikam
 
 void CollectionScanner::completeScan()
 {
+    DIGIKAM_PROFILE_SCOPE("scan", "CollectionScanner::completeScan");
+
     QTime time;
     time.start();
 
     emit startCompleteScan();
 
+    ScanSynchronizationRelaxer relaxer;
+
     // lock database
     CoreDbTransaction transaction;
 
@@ -110,6 +114,8 @@ void CollectionScanner::finishCompleteScan(const QStringList& albumPaths)
 {
     emit startCompleteScan();
 
+    ScanSynchronizationRelaxer relaxer;
+
     {
         CoreDbTransaction transaction;
 
@@ -225,6 +231,8 @@ void CollectionScanner::partialScan(const QString& filePath)
 
 void CollectionScanner::partialScan(const QString& albumRoot, const QString& album)
 {
+    DIGIKAM_PROFILE_SCOPE("scan", "CollectionScanner::partialScan");
+
     if (albumRoot.isNull() || album.isEmpty())
     {
         // If you want to scan the album root, pass "/"
@@ -242,6 +250,8 @@ void CollectionScanner::partialScan(const QString& albumRoot, const QString& alb
     }
 */
 
+    ScanSynchronizationRelaxer relaxer;
+
     mainEntryPoint(false);
     d->resetRemovedItemsTime();
 
@@ -324,6 +334,19 @@ qlonglong CollectionScanner::scanFile(const QString& filePath, FileScanMode mode
     return scanFile(albumRoot, album, info.fileName(), mode);
 }
 
+qlonglong CollectionScanner::scanFile(const QString& filePath, const DMetadata& metadata, FileScanMode mode)
+{
+    d->preloadedMetadata = &metadata;
+    d->preloadedFilePath = QDir::cleanPath(QFileInfo(filePath).absoluteFilePath());
+
+    qlonglong imageId    = scanFile(filePath, mode);
+
+    d->preloadedMetadata = nullptr;
+    d->preloadedFilePath.clear();
+
+    return imageId;
+}
+
 qlonglong CollectionScanner::scanFile(const QString& albumRoot, const QString& album,
                                       const QString& fileName, FileScanMode mode)
 {
@@ -564,6 +587,8 @@ void CollectionScanner::scanAlbum(const CollectionLocation& location, const QStr
     // + Adds files if they do not yet exist in the db.
     // + Marks stale files as removed
 
+    DIGIKAM_PROFILE_SCOPE("scan", "CollectionScanner::scanAlbum");
+
     QDir dir(location.albumRootPath() + album);
 
     if (!dir.exists() || !dir.isReadable())
@@ -825,8 +850,11 @@ qlonglong CollectionScanner::scanNewFile(const QFileInfo& info, int albumId)
         return -1;
     }
 
+    DIGIKAM_PROFILE_SCOPE("scan", "CollectionScanner::scanNewFile");
+
     ItemScanner scanner(info);
     scanner.setCategory(category(info));
+    d->usePreloadedMetadata(scanner, info);
 
     // Check copy/move hints for single items
     qlonglong srcId = 0;
@@ -877,6 +905,7 @@ qlonglong CollectionScanner::scanNewFileFullScan(const QFileInfo& info, int albu
 
     ItemScanner scanner(info);
     scanner.setCategory(category(info));
+    d->usePreloadedMetadata(scanner, info);
     scanner.newFileFullScan(albumId);
     d->finishScanner(scanner);
 
@@ -890,8 +919,11 @@ void CollectionScanner::scanModifiedFile(const QFileInfo& info, const ItemScanIn
         return;
     }
 
+    DIGIKAM_PROFILE_SCOPE("scan", "CollectionScanner::scanModifiedFile");
+
     ItemScanner scanner(info, scanInfo);
     scanner.setCategory(category(info));
+    d->usePreloadedMetadata(scanner, info);
     scanner.fileModified();
     d->finishScanner(scanner);
 }
@@ -902,10 +934,20 @@ void CollectionScanner::scanFileUpdateHashReuseThumbnail(const QFileInfo& info,
     QString oldHash   = scanInfo.uniqueHash;
     qlonglong oldSize = scanInfo.fileSize;
 
-    // same code as scanModifiedFile
     ItemScanner scanner(info, scanInfo);
     scanner.setCategory(category(info));
-    scanner.fileModified();
+
+    if (fileWasEdited)
+    {
+        // digiKam wrote the metadata of the database to the file: do not read them again.
+        scanner.fileMetadataEdited();
+    }
+    else
+    {
+        // same code as scanModifiedFile
+        d->usePreloadedMetadata(scanner, info);
+        scanner.fileModified();
+    }
 
     QString newHash   = scanner.itemScanInfo().uniqueHash;
     qlonglong newSize = scanner.itemScanInfo().fileSize;
@@ -942,8 +984,11 @@ void CollectionScanner::rescanFile(const QFileInfo& info, const ItemScanInfo& sc
         return;
     }
 
+    DIGIKAM_PROFILE_SCOPE("scan", "CollectionScanner::rescanFile");
+
     ItemScanner scanner(info, scanInfo);
     scanner.setCategory(category(info));
+    d->usePreloadedMetadata(scanner, info);
     scanner.rescan();
     d->finishScanner(scanner);
 }
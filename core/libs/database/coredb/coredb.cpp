@@ -45,6 +45,8 @@ extern "C"
 #include <QFileInfo>
 #include <QDir>
 #include <QVariant>
+#include <QHash>
+#include <QSet>
 
 // KDE includes
 
@@ -87,8 +89,119 @@ public:
 
     QString constructRelatedImagesSQL(bool fromOrTo, DatabaseRelation::Type type, bool boolean);
     QList<qlonglong> execRelatedImagesQuery(DbEngineSqlQuery& query, qlonglong id, DatabaseRelation::Type type);
+
+    /**
+     * Read the given fields of the rows of table for all imageIds, with one query per chunk of ids.
+     * The values of each item are returned in the order of imageIds, or an empty list if there is no row.
+     */
+    QVector<QVariantList> execItemsFieldsQuery(const QString& table, const QStringList& fieldNames,
+                                               const QList<qlonglong>& imageIds);
+
+    /**
+     * Run select, a query returning an id and a count per row, completed with the IN list of ids,
+     * with one query per chunk of ids. All ids are in the returned map, with a 0 count if there is no row.
+     */
+    QMap<int, int> execCountsQuery(const QString& select, const QList<int>& ids);
+
+public:
+
+    /// Keep the number of bound values of a query below the limit of SQLite.
+    static const int idsChunkSize = 500;
 };
 
+QVector<QVariantList> CoreDB::Private::execItemsFieldsQuery(const QString& table, const QStringList& fieldNames,
+                                                             const QList<qlonglong>& imageIds)
+{
+    QVector<QVariantList> results(imageIds.size());
+
+    if (imageIds.isEmpty() || fieldNames.isEmpty())
+    {
+        return results;
+    }
+
+    QMultiHash<qlonglong, int> indexes;
+    indexes.reserve(imageIds.size());
+
+    for (int i = 0 ; i < imageIds.size() ; ++i)
+    {
+        indexes.insert(imageIds.at(i), i);
+    }
+
+    const int chunkSize = idsChunkSize;
+    const int columns   = fieldNames.size() + 1;
+    const QString select(QString::fromUtf8("SELECT imageid, %1 FROM %2 WHERE imageid IN (")
+                         .arg(fieldNames.join(QString::fromUtf8(", ")))
+                         .arg(table));
+
+    for (int begin = 0 ; begin < imageIds.size() ; begin += chunkSize)
+    {
+        const int end = qMin(begin + chunkSize, imageIds.size());
+        QString query = select;
+        CoreDB::addBoundValuePlaceholders(query, end - begin);
+        query        += QString::fromUtf8(");");
+
+        QVariantList boundValues;
+
+        for (int i = begin ; i < end ; ++i)
+        {
+            boundValues << imageIds.at(i);
+        }
+
+        QVariantList values;
+        db->execSql(query, boundValues, &values);
+
+        for (int row = 0 ; (row + columns) <= values.size() ; row += columns)
+        {
+            const QVariantList fields = values.mid(row + 1, columns - 1);
+
+            foreach (int index, indexes.values(values.at(row).toLongLong()))
+            {
+                results[index] = fields;
+            }
+        }
+    }
+
+    return results;
+}
+
+QMap<int, int> CoreDB::Private::execCountsQuery(const QString& select, const QList<int>& ids)
+{
+    QMap<int, int> countsMap;
+
+    foreach (int id, ids)
+    {
+        countsMap.insert(id, 0);
+    }
+
+    for (int begin = 0 ; begin < ids.size() ; begin += idsChunkSize)
+    {
+        const int end = qMin(begin + idsChunkSize, ids.size());
+        QString query = select;
+        CoreDB::addBoundValuePlaceholders(query, end - begin);
+        query        += QString::fromUtf8(") GROUP BY 1;");
+
+        QVariantList boundValues;
+
+        for (int i = begin ; i < end ; ++i)
+        {
+            boundValues << ids.at(i);
+        }
+
+        QVariantList values;
+        db->execSql(query, boundValues, &values);
+
+        for (QVariantList::const_iterator it = values.constBegin() ; it != values.constEnd() ; )
+        {
+            int id = (*it).toInt();
+            ++it;
+            countsMap[id] = (*it).toInt();
+            ++it;
+        }
+    }
+
+    return countsMap;
+}
+
 const QString CoreDB::Private::configGroupName(QLatin1String("CoreDB Settings"));
 const QString CoreDB::Private::configRecentlyUsedTags(QLatin1String("Recently Used Tags"));
 
@@ -1665,6 +1778,17 @@ QVariantList CoreDB::getImageMetadata(qlonglong imageID, DatabaseFields::ImageMe
     return values;
 }
 
+QVector<QVariantList> CoreDB::getItemsImageMetadata(const QList<qlonglong>& imageIds,
+                                                    DatabaseFields::ImageMetadata fields) const
+{
+    if (fields == DatabaseFields::ImageMetadataNone)
+    {
+        return QVector<QVariantList>(imageIds.size());
+    }
+
+    return d->execItemsFieldsQuery(QString::fromUtf8("ImageMetadata"), imageMetadataFieldList(fields), imageIds);
+}
+
 QVariantList CoreDB::getVideoMetadata(qlonglong imageID, DatabaseFields::VideoMetadata fields) const
 {
     QVariantList values;
@@ -1706,6 +1830,40 @@ QVariantList CoreDB::getVideoMetadata(qlonglong imageID, DatabaseFields::VideoMe
     return values;
 }
 
+QVector<QVariantList> CoreDB::getItemsVideoMetadata(const QList<qlonglong>& imageIds,
+                                                    DatabaseFields::VideoMetadata fields) const
+{
+    if (fields == DatabaseFields::VideoMetadataNone)
+    {
+        return QVector<QVariantList>(imageIds.size());
+    }
+
+    QStringList fieldNames        = videoMetadataFieldList(fields);
+    QVector<QVariantList> results = d->execItemsFieldsQuery(QString::fromUtf8("VideoMetadata"), fieldNames, imageIds);
+
+    // For some reason REAL values may come as QString QVariants. Convert here, as in getVideoMetadata().
+    for (int row = 0 ; row < results.size() ; ++row)
+    {
+        QVariantList& values = results[row];
+
+        for (int i = 0 ; i < values.size() ; ++i)
+        {
+            if (values.at(i).type() == QVariant::String             &&
+                (fieldNames.at(i) == QLatin1String("aperture")      ||
+                 fieldNames.at(i) == QLatin1String("focalLength")   ||
+                 fieldNames.at(i) == QLatin1String("focalLength35") ||
+                 fieldNames.at(i) == QLatin1String("exposureTime")  ||
+                 fieldNames.at(i) == QLatin1String("subjectDistance"))
+               )
+            {
+                values[i] = values.at(i).toDouble();
+            }
+        }
+    }
+
+    return results;
+}
+
 QVariantList CoreDB::getItemPosition(qlonglong imageID, DatabaseFields::ItemPositions fields) const
 {
     QVariantList values;
@@ -1752,6 +1910,43 @@ QVariantList CoreDB::getItemPosition(qlonglong imageID, DatabaseFields::ItemPosi
     return values;
 }
 
+QVector<QVariantList> CoreDB::getItemsPositions(const QList<qlonglong>& imageIds,
+                                                DatabaseFields::ItemPositions fields) const
+{
+    if (fields == DatabaseFields::ItemPositionsNone)
+    {
+        return QVector<QVariantList>(imageIds.size());
+    }
+
+    QStringList fieldNames        = imagePositionsFieldList(fields);
+    QVector<QVariantList> results = d->execItemsFieldsQuery(QString::fromUtf8("ImagePositions"), fieldNames, imageIds);
+
+    // For some reason REAL values may come as QString QVariants. Convert here, as in getItemPosition().
+    for (int row = 0 ; row < results.size() ; ++row)
+    {
+        QVariantList& values = results[row];
+
+        for (int i = 0 ; i < values.size() ; ++i)
+        {
+            if (values.at(i).type() == QVariant::String &&
+                (fieldNames.at(i) == QLatin1String("latitudeNumber")  ||
+                 fieldNames.at(i) == QLatin1String("longitudeNumber") ||
+                 fieldNames.at(i) == QLatin1String("altitude")        ||
+                 fieldNames.at(i) == QLatin1String("orientation")     ||
+                 fieldNames.at(i) == QLatin1String("tilt")            ||
+                 fieldNames.at(i) == QLatin1String("roll")            ||
+                 fieldNames.at(i) == QLatin1String("accuracy"))
+               )
+            {
+                if (!values.at(i).isNull())
+                    values[i] = values.at(i).toDouble();
+            }
+        }
+    }
+
+    return results;
+}
+
 QVariantList CoreDB::getItemPositions(QList<qlonglong> imageIDs, DatabaseFields::ItemPositions fields) const
 {
     QVariantList values;
@@ -3397,36 +3592,93 @@ QList<QDateTime> CoreDB::getAllCreationDates() const
 QMap<QDateTime, int> CoreDB::getAllCreationDatesAndNumberOfImages() const
 {
     QList<QVariant> values;
-    d->db->execSql(QString::fromUtf8("SELECT creationDate FROM ImageInformation "
+    d->db->execSql(QString::fromUtf8("SELECT creationDate, COUNT(*) FROM ImageInformation "
                                      "INNER JOIN Images ON Images.id=ImageInformation.imageid "
-                                     " WHERE Images.status=1;"),
+                                     " WHERE Images.status=1 "
+                                     "  GROUP BY creationDate;"),
                    &values);
 
     QMap<QDateTime, int> datesStatMap;
 
-    foreach (const QVariant& value, values)
+    for (QList<QVariant>::const_iterator it = values.constBegin() ; it != values.constEnd() ; )
     {
-        if (!value.isNull())
+        QVariant value = *it;
+        ++it;
+        int count      = (*it).toInt();
+        ++it;
+
+        if (value.isNull())
         {
-            QDateTime dateTime = value.toDateTime();
+            continue;
+        }
 
-            if (!dateTime.isValid())
-            {
-                continue;
-            }
+        QDateTime dateTime = value.toDateTime();
 
-            QMap<QDateTime, int>::iterator it2 = datesStatMap.find(dateTime);
+        if (!dateTime.isValid())
+        {
+            continue;
+        }
 
-            if (it2 == datesStatMap.end())
-            {
-                datesStatMap.insert(dateTime, 1);
-            }
-            else
+        // Different strings in database can give the same date, add the counts.
+        datesStatMap[dateTime] += count;
+    }
+
+    return datesStatMap;
+}
+
+QMap<QDateTime, int> CoreDB::getCreationDatesAndNumberOfImages(const QList<qlonglong>& imageIds) const
+{
+    QMap<QDateTime, int> datesStatMap;
+
+    // The months of the items, counted again as a whole.
+
+    QSet<QDate> months;
+
+    foreach (const QVariantList& fields, d->execItemsFieldsQuery(QString::fromUtf8("ImageInformation"),
+                                                                  QStringList() << QString::fromUtf8("creationDate"),
+                                                                  imageIds))
+    {
+        if (fields.isEmpty())
+        {
+            continue;
+        }
+
+        QDateTime dateTime = fields.first().toDateTime();
+
+        if (dateTime.isValid())
+        {
+            months << QDate(dateTime.date().year(), dateTime.date().month(), 1);
+        }
+    }
+
+    DbEngineSqlQuery query = d->db->prepareQuery(QString::fromUtf8("SELECT creationDate, COUNT(*) FROM ImageInformation "
+                                                                   "INNER JOIN Images ON Images.id=ImageInformation.imageid "
+                                                                   " WHERE Images.status=1 "
+                                                                   "   AND ImageInformation.creationDate >= ? "
+                                                                   "   AND ImageInformation.creationDate < ? "
+                                                                   "  GROUP BY creationDate;"));
+
+    foreach (const QDate& month, months)
+    {
+        QVariantList values;
+        d->db->execSql(query, QDateTime(month), QDateTime(month.addMonths(1)), &values);
+
+        datesStatMap.insert(QDateTime(month), 0);
+
+        for (QList<QVariant>::const_iterator it = values.constBegin() ; it != values.constEnd() ; )
+        {
+            QDateTime dateTime = (*it).toDateTime();
+            ++it;
+            int count          = (*it).toInt();
+            ++it;
+
+            if (dateTime.isValid())
             {
-                it2.value()++;
+                datesStatMap[dateTime] += count;
             }
         }
     }
+
     return datesStatMap;
 }
 
@@ -3447,29 +3699,29 @@ QMap<int, int> CoreDB::getNumberOfImagesInAlbums() const
         albumsStatMap.insert(albumID, 0);
     }
 
-    d->db->execSql(QString::fromUtf8("SELECT album FROM Images WHERE Images.status=1;"),
+    d->db->execSql(QString::fromUtf8("SELECT album, COUNT(*) FROM Images "
+                                     " WHERE Images.status=1 "
+                                     "  GROUP BY album;"),
                    &values);
 
     for (QList<QVariant>::const_iterator it = values.constBegin() ; it != values.constEnd() ; )
     {
         albumID = (*it).toInt();
         ++it;
-
-        QMap<int, int>::iterator it2 = albumsStatMap.find(albumID);
-
-        if (it2 == albumsStatMap.end())
-        {
-            albumsStatMap.insert(albumID, 1);
-        }
-        else
-        {
-            it2.value()++;
-        }
+        albumsStatMap[albumID] = (*it).toInt();
+        ++it;
     }
 
     return albumsStatMap;
 }
 
+QMap<int, int> CoreDB::getNumberOfImagesInAlbums(const QList<int>& albumIds) const
+{
+    return d->execCountsQuery(QString::fromUtf8("SELECT album, COUNT(*) FROM Images "
+                                                " WHERE Images.status=1 AND album IN ("),
+                              albumIds);
+}
+
 QMap<int, int> CoreDB::getNumberOfImagesInTags() const
 {
     QList<QVariant> values, allTagIDs;
@@ -3486,31 +3738,31 @@ QMap<int, int> CoreDB::getNumberOfImagesInTags() const
         tagsStatMap.insert(tagID, 0);
     }
 
-    d->db->execSql(QString::fromUtf8("SELECT tagid FROM ImageTags "
+    d->db->execSql(QString::fromUtf8("SELECT tagid, COUNT(*) FROM ImageTags "
                                      "LEFT JOIN Images ON Images.id=ImageTags.imageid "
-                                     " WHERE Images.status=1;"),
+                                     " WHERE Images.status=1 "
+                                     "  GROUP BY tagid;"),
                    &values);
 
     for (QList<QVariant>::const_iterator it = values.constBegin() ; it != values.constEnd() ; )
     {
         tagID = (*it).toInt();
         ++it;
-
-        QMap<int, int>::iterator it2 = tagsStatMap.find(tagID);
-
-        if (it2 == tagsStatMap.end())
-        {
-            tagsStatMap.insert(tagID, 1);
-        }
-        else
-        {
-            it2.value()++;
-        }
+        tagsStatMap[tagID] = (*it).toInt();
+        ++it;
     }
 
     return tagsStatMap;
 }
 
+QMap<int, int> CoreDB::getNumberOfImagesInTags(const QList<int>& tagIds) const
+{
+    return d->execCountsQuery(QString::fromUtf8("SELECT tagid, COUNT(*) FROM ImageTags "
+                                                "LEFT JOIN Images ON Images.id=ImageTags.imageid "
+                                                " WHERE Images.status=1 AND ImageTags.tagid IN ("),
+                              tagIds);
+}
+
 QMap<int, int> CoreDB::getNumberOfImagesInTagProperties(const QString& property) const
 {
     QList<QVariant> values;
@@ -5041,6 +5293,11 @@ void CoreDB::vacuum()
     d->db->execDBAction(d->db->getDBAction(QString::fromUtf8("vacuumCoreDB")));
 }
 
+void CoreDB::optimize()
+{
+    d->db->execDBAction(d->db->getDBAction(QString::fromUtf8("optimizeCoreDB")));
+}
+
 void CoreDB::readSettings()
 {
     KSharedConfig::Ptr config = KSharedConfig::openConfig();
@@ -367,6 +367,12 @@ public:
      */
     QMap<int, int> getNumberOfImagesInAlbums() const;
 
+    /**
+     * Same as above, restricted to the given albums.
+     * All albums of the list are in the returned map, with a 0 count if empty.
+     */
+    QMap<int, int> getNumberOfImagesInAlbums(const QList<int>& albumIds) const;
+
     // ----------- Operations on TAlbums -----------
 
     /**
@@ -714,6 +720,13 @@ public:
      */
     QMap<QDateTime, int> getAllCreationDatesAndNumberOfImages() const;
 
+    /**
+     * Same as above, restricted to the months of the creation dates of the given items.
+     * All these months are in the returned map: a month without items has an entry
+     * with a 0 count on its first day.
+     */
+    QMap<QDateTime, int> getCreationDatesAndNumberOfImages(const QList<qlonglong>& imageIds) const;
+
     // ----------- Item properties -----------
 
     /**
@@ -875,6 +888,14 @@ public:
     QVariantList getImageMetadata(qlonglong imageID,
                                   DatabaseFields::ImageMetadata metadataFields = DatabaseFields::ImageMetadataAll) const;
 
+    /**
+     * For a list of items, return the image metadata of each item, in the same order.
+     * The list of an item is empty if it has no image metadata.
+     * Amounts to calling getImageMetadata for each id in imageIds, but is optimized.
+     */
+    QVector<QVariantList> getItemsImageMetadata(const QList<qlonglong>& imageIds,
+                                                DatabaseFields::ImageMetadata metadataFields = DatabaseFields::ImageMetadataAll) const;
+
     /**
      * Add (or replace) the VideoMetadata of the specified item.
      * If there is already an entry, it will be discarded.
@@ -906,6 +927,14 @@ public:
     QVariantList getVideoMetadata(qlonglong imageID,
                                   DatabaseFields::VideoMetadata metadataFields = DatabaseFields::VideoMetadataAll) const;
 
+    /**
+     * For a list of items, return the video metadata of each item, in the same order.
+     * The list of an item is empty if it has no video metadata.
+     * Amounts to calling getVideoMetadata for each id in imageIds, but is optimized.
+     */
+    QVector<QVariantList> getItemsVideoMetadata(const QList<qlonglong>& imageIds,
+                                                DatabaseFields::VideoMetadata metadataFields = DatabaseFields::VideoMetadataAll) const;
+
     /**
      * Add (or replace) the ItemPosition of the specified item.
      * If there is already an entry, it will be discarded.
@@ -942,6 +971,14 @@ public:
 
     QVariantList getItemPositions(QList<qlonglong> imageIDs, DatabaseFields::ItemPositions fields) const;
 
+    /**
+     * For a list of items, return the position of each item, in the same order.
+     * The list of an item is empty if it has no position.
+     * Amounts to calling getItemPosition for each id in imageIds, but is optimized.
+     */
+    QVector<QVariantList> getItemsPositions(const QList<qlonglong>& imageIds,
+                                            DatabaseFields::ItemPositions positionFields = DatabaseFields::ItemPositionsAll) const;
+
     /**
      * Remove the entry in ItemPositions for the given image
      */
@@ -1267,6 +1304,12 @@ public:
      */
     QMap<int, int> getNumberOfImagesInTags() const;
 
+    /**
+     * Same as above, restricted to the given tags.
+     * All tags of the list are in the returned map, with a 0 count if unused.
+     */
+    QMap<int, int> getNumberOfImagesInTags(const QList<int>& tagIds) const;
+
     /**
      * Returns a QMap<int,int> of tag id -> count of items
      * with the given tag property
@@ -1367,6 +1410,11 @@ public:
      */
     void vacuum();
 
+    /**
+     * Refreshes the statistics used by the query planner.
+     */
+    void optimize();
+
     // ----------- Static helper methods for constructing SQL queries -----------
 
     static QStringList imagesFieldList(DatabaseFields::Images fields);
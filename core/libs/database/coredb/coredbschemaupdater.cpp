@@ -56,7 +56,7 @@ namespace Digikam
 
 int CoreDbSchemaUpdater::schemaVersion()
 {
-    return 10;
+    return 11;
 }
 
 int CoreDbSchemaUpdater::filterSettingsVersion()
@@ -690,6 +690,9 @@ bool CoreDbSchemaUpdater::updateToVersion(int targetVersion)
         case 10:
             // Digikam for database version 9 can work with version 10, remove ImageHaarMatrix table and add manualOrder column.
             return performUpdateToVersion(QLatin1String("UpdateSchemaFromV9ToV10"), 10, 5);
+        case 11:
+            // Digikam for database version 10 can work with version 11, add compound indexes to list albums and tags.
+            return performUpdateToVersion(QLatin1String("UpdateSchemaFromV10ToV11"), 11, 5);
         default:
             qCDebug(DIGIKAM_COREDB_LOG) << "Core database: unsupported update to version" << targetVersion;
             return false;
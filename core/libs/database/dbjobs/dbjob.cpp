@@ -23,6 +23,10 @@
 
 #include "dbjob.h"
 
+// Qt includes
+
+#include <QSet>
+
 // Local includes
 
 #include "coredbaccess.h"
@@ -62,7 +66,17 @@ void AlbumsJob::run()
 {
     if (m_jobInfo.isFoldersJob())
     {
-        QMap<int, int> albumNumberMap = CoreDbAccess().db()->getNumberOfImagesInAlbums();
+        QMap<int, int> albumNumberMap;
+
+        if (m_jobInfo.albumsIds().isEmpty())
+        {
+            albumNumberMap = CoreDbAccess().db()->getNumberOfImagesInAlbums();
+        }
+        else
+        {
+            albumNumberMap = CoreDbAccess().db()->getNumberOfImagesInAlbums(m_jobInfo.albumsIds());
+        }
+
         emit foldersData(albumNumberMap);
     }
     else
@@ -96,7 +110,17 @@ void DatesJob::run()
 {
     if (m_jobInfo.isFoldersJob())
     {
-        QMap<QDateTime, int> dateNumberMap = CoreDbAccess().db()->getAllCreationDatesAndNumberOfImages();
+        QMap<QDateTime, int> dateNumberMap;
+
+        if (m_jobInfo.itemsIds().isEmpty())
+        {
+            dateNumberMap = CoreDbAccess().db()->getAllCreationDatesAndNumberOfImages();
+        }
+        else
+        {
+            dateNumberMap = CoreDbAccess().db()->getCreationDatesAndNumberOfImages(m_jobInfo.itemsIds());
+        }
+
         emit foldersData(dateNumberMap);
     }
     else
@@ -177,7 +201,26 @@ void TagsJob::run()
 {
     if (m_jobInfo.isFoldersJob())
     {
-        QMap<int, int> tagNumberMap = CoreDbAccess().db()->getNumberOfImagesInTags();
+        QMap<int, int> tagNumberMap;
+
+        if (m_jobInfo.tagsIds().isEmpty() && m_jobInfo.itemsIds().isEmpty())
+        {
+            tagNumberMap = CoreDbAccess().db()->getNumberOfImagesInTags();
+        }
+        else
+        {
+            QSet<int> tagsIds = m_jobInfo.tagsIds().toSet();
+
+            // The items added to or removed from the collection change the counts of their tags.
+
+            foreach (const QList<int>& itemTagsIds, CoreDbAccess().db()->getItemsTagIDs(m_jobInfo.itemsIds()))
+            {
+                tagsIds += itemTagsIds.toSet();
+            }
+
+            tagNumberMap = CoreDbAccess().db()->getNumberOfImagesInTags(tagsIds.toList());
+        }
+
         //qCDebug(DIGIKAM_DBJOB_LOG) << tagNumberMap;
         emit foldersData(tagNumberMap);
     }
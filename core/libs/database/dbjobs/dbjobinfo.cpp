@@ -91,6 +91,16 @@ QString AlbumsDBJobInfo::album()
     return m_album;
 }
 
+void AlbumsDBJobInfo::setAlbumsIds(const QList<int>& albumsIds)
+{
+    m_albumsIds = albumsIds;
+}
+
+QList<int> AlbumsDBJobInfo::albumsIds() const
+{
+    return m_albumsIds;
+}
+
 // ---------------------------------------------
 
 TagsDBJobInfo::TagsDBJobInfo()
@@ -129,6 +139,16 @@ QList<int> TagsDBJobInfo::tagsIds() const
     return m_tagsIds;
 }
 
+void TagsDBJobInfo::setItemsIds(const QList<qlonglong>& itemsIds)
+{
+    m_itemsIds = itemsIds;
+}
+
+QList<qlonglong> TagsDBJobInfo::itemsIds() const
+{
+    return m_itemsIds;
+}
+
 // ---------------------------------------------
 
 GPSDBJobInfo::GPSDBJobInfo()
@@ -337,4 +357,14 @@ QDate DatesDBJobInfo::endDate() const
     return m_endDate;
 }
 
+void DatesDBJobInfo::setItemsIds(const QList<qlonglong>& itemsIds)
+{
+    m_itemsIds = itemsIds;
+}
+
+QList<qlonglong> DatesDBJobInfo::itemsIds() const
+{
+    return m_itemsIds;
+}
+
 } // namespace Digikam
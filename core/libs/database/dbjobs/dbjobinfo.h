@@ -74,10 +74,15 @@ public:
     void setAlbum(const QString& album);
     QString album();
 
+    /// With a folders job, only count the items of these albums.
+    void setAlbumsIds(const QList<int>& albumsIds);
+    QList<int> albumsIds() const;
+
 private:
 
-    int     m_albumRootId;
-    QString m_album;
+    int        m_albumRootId;
+    QString    m_album;
+    QList<int> m_albumsIds;
 };
 
 // ---------------------------------------------
@@ -94,14 +99,20 @@ public:
     void setSpecialTag(const QString& tag);
     QString specialTag() const;
 
+    /// With a folders job, only count the items of these tags.
     void setTagsIds(const QList<int>& tagsIds);
     QList<int> tagsIds() const;
 
+    /// With a folders job, also count the items of the tags assigned to these items.
+    void setItemsIds(const QList<qlonglong>& itemsIds);
+    QList<qlonglong> itemsIds() const;
+
 private:
 
-    bool       m_faceFolders;
-    QString    m_specialTag;
-    QList<int> m_tagsIds;
+    bool             m_faceFolders;
+    QString          m_specialTag;
+    QList<int>       m_tagsIds;
+    QList<qlonglong> m_itemsIds;
 };
 
 // ---------------------------------------------
@@ -203,10 +214,15 @@ public:
     void setEndDate(const QDate& date);
     QDate endDate() const;
 
+    /// With a folders job, only count the items of the months of these items.
+    void setItemsIds(const QList<qlonglong>& itemsIds);
+    QList<qlonglong> itemsIds() const;
+
 private:
 
-    QDate m_startDate;
-    QDate m_endDate;
+    QDate            m_startDate;
+    QDate            m_endDate;
+    QList<qlonglong> m_itemsIds;
 };
 
 } // namespace Digikam
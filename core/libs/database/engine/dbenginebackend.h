@@ -436,6 +436,13 @@ public:
      */
     bool isInTransaction() const;
 
+    /**
+     * With SQLite in write-ahead log mode, relax the synchronization of the connection
+     * of the current thread to NORMAL, or restore it to FULL. Used during the collection
+     * scans which write many rows. Does nothing with other databases and journal modes.
+     */
+    void setRelaxedSynchronization(bool relaxed);
+
     /**
      * Returns a list with the names of tables in the database.
      */
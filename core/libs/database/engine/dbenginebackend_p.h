@@ -73,6 +73,7 @@ public:
     void         setDatabaseErrorForThread(const QSqlError& lastError);
 
     QSqlDatabase createDatabaseConnection();
+    void         applySQLitePragmas(QSqlDatabase& db);
     void closeDatabaseForThread();
     bool incrementTransactionCount();
     bool decrementTransactionCount();
@@ -51,6 +51,7 @@ static const char* configInternalDatabaseServer             = "Internal Database
 static const char* configInternalDatabaseServerPath         = "Internal Database Server Path";
 static const char* configInternalDatabaseServerMysqlServCmd = "Internal Database Server Mysql Server Command";
 static const char* configInternalDatabaseServerMysqlInitCmd = "Internal Database Server Mysql Init Command";
+static const char* configDatabaseWALMode                    = "Database WAL Mode";
 static const char* configDatabaseType                       = "Database Type";
 static const char* configDatabaseName                       = "Database Name";              // For Sqlite the DB file path, for Mysql the DB name
 static const char* configDatabaseNameThumbnails             = "Database Name Thumbnails";   // For Sqlite the DB file path, for Mysql the DB name
@@ -83,7 +84,8 @@ QString DbEngineParameters::internalServerPrivatePath()
 
 DbEngineParameters::DbEngineParameters()
     : port(-1),
-      internalServer(false)
+      internalServer(false),
+      walMode(false)
 {
 }
 
@@ -115,14 +117,16 @@ DbEngineParameters::DbEngineParameters(const QString& _type,
       databaseNameSimilarity(_databaseNameSimilarity),
       internalServerDBPath(_internalServerDBPath),
       internalServerMysqlServCmd(_internalServerMysqlServCmd),
-      internalServerMysqlInitCmd(_internalServerMysqlInitCmd)
+      internalServerMysqlInitCmd(_internalServerMysqlInitCmd),
+      walMode(false)
 {
 }
 
 // Note no need to 
 DbEngineParameters::DbEngineParameters(const QUrl& url)
     : port(-1),
-      internalServer(false)
+      internalServer(false),
+      walMode(false)
 {
     databaseType           = QUrlQuery(url).queryItemValue(QLatin1String("databaseType"));
     databaseNameCore       = QUrlQuery(url).queryItemValue(QLatin1String("databaseNameCore"));
@@ -165,6 +169,7 @@ DbEngineParameters::DbEngineParameters(const QUrl& url)
 
     userName       = QUrlQuery(url).queryItemValue(QLatin1String("userName"));
     password       = QUrlQuery(url).queryItemValue(QLatin1String("password"));
+    walMode        = (QUrlQuery(url).queryItemValue(QLatin1String("walMode")) == QLatin1String("true"));
 }
 
 void DbEngineParameters::insertInUrl(QUrl& url) const
@@ -211,6 +216,11 @@ void DbEngineParameters::insertInUrl(QUrl& url) const
         q.addQueryItem(QLatin1String("password"), password);
     }
 
+    if (walMode)
+    {
+        q.addQueryItem(QLatin1String("walMode"), QLatin1String("true"));
+    }
+
     url.setQuery(q);
 }
 
@@ -232,6 +242,7 @@ void DbEngineParameters::removeFromUrl(QUrl& url)
     q.removeQueryItem(QLatin1String("internalServerMysqlInitCmd"));
     q.removeQueryItem(QLatin1String("userName"));
     q.removeQueryItem(QLatin1String("password"));
+    q.removeQueryItem(QLatin1String("walMode"));
 
     url.setQuery(q);
 }
@@ -251,7 +262,8 @@ bool DbEngineParameters::operator==(const DbEngineParameters& other) const
            internalServerMysqlServCmd == other.internalServerMysqlServCmd &&
            internalServerMysqlInitCmd == other.internalServerMysqlInitCmd &&
            userName                   == other.userName                   &&
-           password                   == other.password);
+           password                   == other.password                   &&
+           walMode                    == other.walMode);
 }
 
 bool DbEngineParameters::operator!=(const DbEngineParameters& other) const
@@ -361,6 +373,7 @@ void DbEngineParameters::readFromConfig(KSharedConfig::Ptr config, const QString
     userName                   = group.readEntry(configDatabaseUsername,                   QString());
     password                   = group.readEntry(configDatabasePassword,                   QString());
     connectOptions             = group.readEntry(configDatabaseConnectOptions,             QString());
+    walMode                    = group.readEntry(configDatabaseWALMode,                    false);
 #if defined(HAVE_MYSQLSUPPORT) && defined(HAVE_INTERNALMYSQL)
     internalServer             = group.readEntry(configInternalDatabaseServer,             false);
     internalServerDBPath       = group.readEntry(configInternalDatabaseServerPath,         internalServerPrivatePath());
@@ -541,7 +554,10 @@ void DbEngineParameters::legacyAndDefaultChecks(const QString& suggestedPath, KS
 
         if (!databaseFilePath.isEmpty())
         {
-            *this = parametersForSQLite(coreDatabaseFileSQLite(databaseFilePath));
+            // Keep the journal setting already read from the config.
+            const bool wal = walMode;
+            *this          = parametersForSQLite(coreDatabaseFileSQLite(databaseFilePath));
+            walMode        = wal;
         }
 
         // Be aware that schema updating from version <= 0.9 requires reading the "Album Path", so do not remove it here
@@ -591,6 +607,7 @@ void DbEngineParameters::writeToConfig(KSharedConfig::Ptr config, const QString&
     group.writeEntry(configDatabaseUsername,                   userName);
     group.writeEntry(configDatabasePassword,                   password);
     group.writeEntry(configDatabaseConnectOptions,             connectOptions);
+    group.writeEntry(configDatabaseWALMode,                    walMode);
     group.writeEntry(configInternalDatabaseServer,             internalServer);
     group.writeEntry(configInternalDatabaseServerPath,         internalServerDBPath);
     group.writeEntry(configInternalDatabaseServerMysqlServCmd, internalServerMysqlServCmd);
@@ -802,6 +819,7 @@ QDebug operator<<(QDebug dbg, const DbEngineParameters& p)
     dbg.nospace() << "   Internal Server Path:     " << p.internalServerDBPath                              << endl;
     dbg.nospace() << "   Internal Server Serv Cmd: " << p.internalServerMysqlServCmd                        << endl;
     dbg.nospace() << "   Internal Server Init Cmd: " << p.internalServerMysqlInitCmd                        << endl;
+    dbg.nospace() << "   WAL Mode:                 " << p.walMode                                           << endl;
     dbg.nospace() << "   Username:                 " << p.userName                                          << endl;
     dbg.nospace() << "   Password:                 " << QString().fill(QLatin1Char('X'), p.password.size()) << endl;
 
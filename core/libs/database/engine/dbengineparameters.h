@@ -210,6 +210,13 @@ public:
     /// Settings stored in config file and used only with internal server at runtime to start server instance or init database tables.
     QString internalServerMysqlServCmd;
     QString internalServerMysqlInitCmd;
+
+    /**
+     * SQLite only: open the database files with the write-ahead log journal, memory mapped I/O
+     * and relaxed synchronization. Readers are not blocked anymore by writers, as while scanning
+     * collections and storing thumbnails.
+     */
+    bool    walMode;
 };
 
 DIGIKAM_EXPORT QDebug operator<<(QDebug dbg, const DbEngineParameters& t);
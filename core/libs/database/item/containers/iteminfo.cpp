@@ -1192,6 +1192,66 @@ ItemPosition ItemInfo::imagePosition() const
     return pos;
 }
 
+void ItemInfoList::loadPositions() const
+{
+    ItemInfoList infoList;
+
+    foreach (const ItemInfo& info, *this)
+    {
+        if (info.m_data && !info.m_data->positionsCached)
+        {
+            infoList << info;
+        }
+    }
+
+    if (infoList.isEmpty())
+    {
+        return;
+    }
+
+    // Same values as read by ItemPosition in imagePosition()
+
+    const DatabaseFields::ItemPositions fields = DatabaseFields::LatitudeNumber  |
+                                                 DatabaseFields::LongitudeNumber |
+                                                 DatabaseFields::Altitude;
+
+    QVector<QVariantList> allPositions = CoreDbAccess().db()->getItemsPositions(infoList.toImageIdList(), fields);
+
+    ItemInfoWriteLocker lock;
+
+    for (int i = 0 ; i < infoList.size() ; ++i)
+    {
+        const ItemInfo& info          = infoList.at(i);
+        const QVariantList& positions = allPositions.at(i);
+
+        if (!info.m_data)
+        {
+            continue;
+        }
+
+        ItemInfoData* const data = info.m_data.constCastData();
+
+        if (positions.size() == 3)
+        {
+            data->latitude       = positions.at(0).toDouble();
+            data->longitude      = positions.at(1).toDouble();
+            data->altitude       = positions.at(2).toDouble();
+            data->hasCoordinates = !positions.at(0).isNull() && !positions.at(1).isNull();
+            data->hasAltitude    = !positions.at(2).isNull();
+        }
+        else
+        {
+            data->latitude       = 0;
+            data->longitude      = 0;
+            data->altitude       = 0;
+            data->hasCoordinates = false;
+            data->hasAltitude    = false;
+        }
+
+        data->positionsCached = true;
+    }
+}
+
 double ItemInfo::longitudeNumber() const
 {
     if (!m_data)
@@ -2023,6 +2083,110 @@ ItemInfo::DatabaseFieldsHashRaw ItemInfo::getDatabaseFieldsRaw(const DatabaseFie
     return cachedHash;
 }
 
+void ItemInfoList::loadDatabaseFields(const DatabaseFields::Set& requestedSet) const
+{
+    const DatabaseFields::ImageMetadata requestedImageMetadata = requestedSet.getImageMetadata();
+    const DatabaseFields::VideoMetadata requestedVideoMetadata = requestedSet.getVideoMetadata();
+    ItemInfoList imageInfoList, videoInfoList;
+
+    {
+        ItemInfoReadLocker lock;
+
+        foreach (const ItemInfo& info, *this)
+        {
+            if (!info.m_data)
+            {
+                continue;
+            }
+
+            const DatabaseFields::ImageMetadataMinSizeType cachedImageMetadata = info.m_data->imageMetadataCached;
+            const DatabaseFields::VideoMetadataMinSizeType cachedVideoMetadata = info.m_data->videoMetadataCached;
+
+            if (info.m_data->hasImageMetadata && (requestedImageMetadata & ~cachedImageMetadata))
+            {
+                imageInfoList << info;
+            }
+
+            if (info.m_data->hasVideoMetadata && (requestedVideoMetadata & ~cachedVideoMetadata))
+            {
+                videoInfoList << info;
+            }
+        }
+    }
+
+    // All requested fields are read again for items which have some of them cached,
+    // it is cheaper than one query per item.
+
+    if (!imageInfoList.isEmpty())
+    {
+        QVector<QVariantList> allValues = CoreDbAccess().db()->getItemsImageMetadata(imageInfoList.toImageIdList(),
+                                                                                      requestedImageMetadata);
+
+        ItemInfoWriteLocker lock;
+
+        for (int i = 0 ; i < imageInfoList.size() ; ++i)
+        {
+            ItemInfoData* const data        = imageInfoList.at(i).m_data.constCastData();
+            const QVariantList& fieldValues = allValues.at(i);
+
+            if (fieldValues.isEmpty())
+            {
+                data->hasImageMetadata    = false;
+                data->databaseFieldsHashRaw.removeAllFields(DatabaseFields::ImageMetadataAll);
+                data->imageMetadataCached = DatabaseFields::ImageMetadataNone;
+                continue;
+            }
+
+            int fieldsIndex = 0;
+
+            for (DatabaseFields::ImageMetadataIteratorSetOnly it(requestedImageMetadata) ; !it.atEnd() ; ++it)
+            {
+                data->databaseFieldsHashRaw.insertField(*it, fieldValues.at(fieldsIndex));
+                ++fieldsIndex;
+            }
+
+            data->imageMetadataCached |= requestedImageMetadata;
+        }
+    }
+
+    if (!videoInfoList.isEmpty())
+    {
+        QVector<QVariantList> allValues = CoreDbAccess().db()->getItemsVideoMetadata(videoInfoList.toImageIdList(),
+                                                                                      requestedVideoMetadata);
+
+        ItemInfoWriteLocker lock;
+
+        for (int i = 0 ; i < videoInfoList.size() ; ++i)
+        {
+            ItemInfoData* const data        = videoInfoList.at(i).m_data.constCastData();
+            const QVariantList& fieldValues = allValues.at(i);
+
+            if (fieldValues.isEmpty())
+            {
+                data->hasVideoMetadata    = false;
+                data->databaseFieldsHashRaw.removeAllFields(DatabaseFields::VideoMetadataAll);
+                data->videoMetadataCached = DatabaseFields::VideoMetadataNone;
+                continue;
+            }
+
+            int fieldsIndex = 0;
+
+            for (DatabaseFields::VideoMetadataIteratorSetOnly it(requestedVideoMetadata) ; !it.atEnd() ; ++it)
+            {
+                data->databaseFieldsHashRaw.insertField(*it, fieldValues.at(fieldsIndex));
+                ++fieldsIndex;
+            }
+
+            data->videoMetadataCached |= requestedVideoMetadata;
+        }
+    }
+
+    if (requestedSet.hasFieldsFromItemPositions())
+    {
+        loadPositions();
+    }
+}
+
 QVariant ItemInfo::getDatabaseFieldRaw(const DatabaseFields::Set& requestedField) const
 {
     DatabaseFieldsHashRaw rawHash = getDatabaseFieldsRaw(requestedField);
@@ -56,6 +56,14 @@ public:
 
     void loadGroupImageIds() const;
     void loadTagIds()        const;
+    void loadPositions()     const;
+
+    /**
+     * Load the image and video metadata fields of requestedSet for all items of the list,
+     * and the positions if requestedSet contains position fields, with a few queries.
+     * The values are cached in the items, as if read with ItemInfo::getDatabaseFieldsRaw().
+     */
+    void loadDatabaseFields(const DatabaseFields::Set& requestedSet) const;
 
     bool static namefileLessThan(const ItemInfo& d1, const ItemInfo& d2);
 
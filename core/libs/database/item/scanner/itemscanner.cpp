@@ -72,6 +72,13 @@ const ItemScanInfo& ItemScanner::itemScanInfo() const
     return d->scanInfo;
 }
 
+void ItemScanner::setMetadata(const DMetadata& metadata)
+{
+    d->metadata = metadata;
+    d->metadata.setFilePath(d->fileInfo.filePath());
+    d->hasPreloadedMetadata = true;
+}
+
 bool ItemScanner::lessThanForIdentity(const ItemScanInfo& a, const ItemScanInfo& b)
 {
     if (a.status != b.status)
@@ -123,19 +130,71 @@ void ItemScanner::loadFromDisk()
         return;
     }
 
+    DIGIKAM_PROFILE_SCOPE("scan", "ItemScanner::loadFromDisk");
+
     d->loadedFromDisk = true;
     d->metadata.registerMetadataSettings();
-    d->hasMetadata    = d->metadata.load(d->fileInfo.filePath());
 
-    if (d->scanInfo.category == DatabaseItem::Image)
+    // Map a local image only once, its content is shared by Exiv2 and the unique hash.
+    // The header of the image is still read by the DImg loaders from the file path.
+
+    ItemScannerFileProbe probe;
+
+    const bool probed = (d->scanInfo.category == DatabaseItem::Image) && probe.open(d->fileInfo.filePath());
+
+    DIGIKAM_PROFILE_COUNTER("scan", "ItemScanner::mappedFiles", probed ? 1 : 0);
+
     {
-        d->hasImage = d->img.loadItemInfo(d->fileInfo.filePath(), false, false, false, false);
+        DIGIKAM_PROFILE_SCOPE("scan", "ItemScanner::loadMetadata");
+
+        if (d->hasPreloadedMetadata)
+        {
+            d->hasMetadata = !d->metadata.isEmpty();
+        }
+        else if (probed)
+        {
+            d->hasMetadata = d->metadata.load(d->fileInfo.filePath(), probe.data());
+        }
+        else
+        {
+            d->hasMetadata = d->metadata.load(d->fileInfo.filePath());
+        }
     }
-    else
+
     {
-        d->hasImage = false;
+        DIGIKAM_PROFILE_SCOPE("scan", "ItemScanner::loadHeader");
+
+        if (d->scanInfo.category == DatabaseItem::Image)
+        {
+            d->hasImage = d->img.loadItemInfo(d->fileInfo.filePath(), false, false, false, false);
+        }
+        else
+        {
+            d->hasImage = false;
+        }
     }
 
+    d->scanInfo.itemName         = d->fileInfo.fileName();
+    d->scanInfo.fileSize         = d->fileInfo.size();
+    d->scanInfo.modificationDate = fileModificationDate();
+
+    {
+        DIGIKAM_PROFILE_SCOPE("scan", "ItemScanner::uniqueHash");
+
+        // category is set by setCategory
+        // NOTE: call uniqueHash after loading the image above, else it will fail
+        d->scanInfo.uniqueHash   = uniqueHash(probe.data());
+    }
+
+   // faster than loading twice from disk
+    if (d->hasMetadata)
+    {
+        d->img.setMetadata(d->metadata.data());
+    }
+}
+
+QDateTime ItemScanner::fileModificationDate() const
+{
     MetaEngineSettingsContainer settings = MetaEngineSettings::instance()->settings();
     QDateTime modificationDate           = d->fileInfo.lastModified();
 
@@ -150,18 +209,7 @@ void ItemScanner::loadFromDisk()
         }
     }
 
-    d->scanInfo.itemName         = d->fileInfo.fileName();
-    d->scanInfo.fileSize         = d->fileInfo.size();
-    d->scanInfo.modificationDate = modificationDate;
-    // category is set by setCategory
-    // NOTE: call uniqueHash after loading the image above, else it will fail
-    d->scanInfo.uniqueHash       = uniqueHash();
-
-   // faster than loading twice from disk
-    if (d->hasMetadata)
-    {
-        d->img.setMetadata(d->metadata.data());
-    }
+    return modificationDate;
 }
 
 QString ItemScanner::formatToString(const QString& format)
@@ -88,6 +88,14 @@ public:
      */
     const ItemScanInfo& itemScanInfo() const;
 
+    /**
+     * Use metadata already parsed from the file, for example by the import tool which has
+     * just written it, instead of parsing it again in loadFromDisk().
+     * The metadata must reflect the current content of the file.
+     * Call it before any of the main entry points.
+     */
+    void setMetadata(const DMetadata& metadata);
+
     /**
      * Loads data from disk (metadata, image file properties).
      * This method is called from any of the main entry points above.
@@ -195,6 +203,13 @@ public:
      */
     void fileModified();
 
+    /**
+     * Call this when the file was only modified by digiKam writing the metadata
+     * stored in the database to the file. The metadata are not read again:
+     * only the filesystem properties and the unique hash are updated.
+     */
+    void fileMetadataEdited();
+
     /**
      * Returns File-metadata container with user-presentable information.
      * These methods provide the reverse service: Not writing into the db, but reading from the db.
@@ -351,7 +366,17 @@ protected:
     void commitImageHistory();
     void scanImageHistoryIfModified();
 
-    QString uniqueHash() const;
+    /**
+     * Compute the unique hash of the file. If the file content is already
+     * available as fileData, the hash is computed from it if possible.
+     */
+    QString uniqueHash(const QByteArray& fileData = QByteArray()) const;
+
+    /**
+     * The modification date of the file, or of its sidecar if it is more recent
+     * and sidecars are read.
+     */
+    QDateTime fileModificationDate() const;
 
     //@}
 
@@ -34,6 +34,8 @@ qlonglong ItemScanner::id() const
 
 void ItemScanner::commit()
 {
+    DIGIKAM_PROFILE_SCOPE("scan", "ItemScanner::commit");
+
     qCDebug(DIGIKAM_DATABASE_LOG) << "Scanning took" << d->time.restart() << "ms";
 
     switch (d->commit.operation)
@@ -185,6 +185,8 @@ void ItemScanner::commitUpdateImage()
 
 void ItemScanner::scanFile(ScanMode mode)
 {
+    DIGIKAM_PROFILE_SCOPE("scan", "ItemScanner::scanFile");
+
     d->scanMode = mode;
 
     if (d->scanMode == ModifiedScan)
@@ -293,4 +295,21 @@ void ItemScanner::fileModified()
     scanFile(ModifiedScan);
 }
 
+void ItemScanner::fileMetadataEdited()
+{
+    if (!CoreDbAccess().db()->isUniqueHashV2())
+    {
+        // The legacy unique hash is computed from the loaded image.
+        fileModified();
+        return;
+    }
+
+    d->scanInfo.itemName         = d->fileInfo.fileName();
+    d->scanInfo.fileSize         = d->fileInfo.size();
+    d->scanInfo.modificationDate = fileModificationDate();
+    d->scanInfo.uniqueHash       = QString::fromUtf8(DImg::getUniqueHashV2(d->fileInfo.filePath()));
+
+    prepareUpdateImage();
+}
+
 } // namespace Digikam
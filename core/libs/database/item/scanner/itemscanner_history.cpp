@@ -412,13 +412,18 @@ bool ItemScanner::hasHistoryToResolve() const
     return d->hasHistoryToResolve;
 }
 
-QString ItemScanner::uniqueHash() const
+QString ItemScanner::uniqueHash(const QByteArray& fileData) const
 {
     // the QByteArray is an ASCII hex string
     if (d->scanInfo.category == DatabaseItem::Image)
     {
         if (CoreDbAccess().db()->isUniqueHashV2())
+        {
+            if (!fileData.isNull())
+                return QString::fromUtf8(d->img.getUniqueHashV2FromData(fileData));
+
             return QString::fromUtf8(d->img.getUniqueHashV2());
+        }
         else
             return QString::fromUtf8(d->img.getUniqueHash());
     }
@@ -45,6 +45,91 @@ ItemScannerCommit::ItemScannerCommit()
 
 // ---------------------------------------------------------------------------------------
 
+ItemScannerFileProbe::ItemScannerFileProbe()
+    : m_map(nullptr),
+      m_size(0)
+{
+}
+
+ItemScannerFileProbe::~ItemScannerFileProbe()
+{
+    close();
+}
+
+bool ItemScannerFileProbe::open(const QString& filePath)
+{
+    close();
+
+    // Only local files are mapped: a mapping is paged in on demand, but a read from a network
+    // share or a removable volume would transfer the whole file, and an access to the mapping
+    // raises SIGBUS if the volume goes away. These files are read from their path as usual.
+
+    CollectionLocation location = CollectionManager::instance()->locationForPath(filePath);
+
+    if (location.type() != CollectionLocation::TypeVolumeHardWired)
+    {
+        return false;
+    }
+
+    m_file.setFileName(filePath);
+
+    if (!m_file.open(QIODevice::ReadOnly))
+    {
+        return false;
+    }
+
+    m_size = m_file.size();
+
+    if ((m_size > 0) && (m_size <= maxDataSize()))
+    {
+        m_map = m_file.map(0, m_size);
+    }
+
+    if (!m_map)
+    {
+        close();
+        return false;
+    }
+
+    return true;
+}
+
+void ItemScannerFileProbe::close()
+{
+    if (m_map)
+    {
+        m_file.unmap(m_map);
+        m_map = nullptr;
+    }
+
+    if (m_file.isOpen())
+    {
+        m_file.close();
+    }
+
+    m_size = 0;
+}
+
+qint64 ItemScannerFileProbe::maxDataSize()
+{
+    // Larger files, such as RAW files or panoramas, are read from their path: Exiv2 and
+    // the unique hash only read some parts of them.
+
+    return (64 * 1024 * 1024);
+}
+
+QByteArray ItemScannerFileProbe::data() const
+{
+    if (!m_map)
+    {
+        return QByteArray();
+    }
+
+    return QByteArray::fromRawData(reinterpret_cast<const char*>(m_map), (int)m_size);
+}
+
+// ---------------------------------------------------------------------------------------
+
 LessThanByProximityToSubject::LessThanByProximityToSubject(const ItemInfo& subject)
     : subject(subject)
 {
@@ -119,6 +204,7 @@ bool LessThanByProximityToSubject::operator()(const ItemInfo& a, const ItemInfo&
 ItemScanner::Private::Private()
     : hasImage(false),
       hasMetadata(false),
+      hasPreloadedMetadata(false),
       loadedFromDisk(false),
       scanMode(ModifiedScan),
       hasHistoryToResolve(false)
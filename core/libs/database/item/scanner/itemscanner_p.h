@@ -31,6 +31,8 @@
 
 #include <QImageReader>
 #include <QTime>
+#include <QFile>
+#include <QByteArray>
 
 // KDE includes
 
@@ -52,6 +54,7 @@
 #include "itemextendedproperties.h"
 #include "itemhistorygraph.h"
 #include "metaenginesettings.h"
+#include "dprofiler.h"
 #include "tagregion.h"
 #include "tagscache.h"
 #include "iostream"
@@ -131,6 +134,44 @@ public:
 
 // ---------------------------------------------------------------------------
 
+/**
+ * Map a file once and give its whole content in memory, to share it between the
+ * metadata parser and the unique hash computation. Only the parts really read are
+ * transferred from the disk.
+ * Only files on hard-wired local volumes are mapped. Files on network shares and
+ * removable volumes, and files larger than maxDataSize(), are not probed at all and
+ * must be read from their path as usual: the parsers only read the parts they need.
+ */
+class Q_DECL_HIDDEN ItemScannerFileProbe
+{
+public:
+
+    explicit ItemScannerFileProbe();
+    ~ItemScannerFileProbe();
+
+    /**
+     * Return false if the file is not on a local volume, cannot be mapped, is empty
+     * or too large. The file must then be read from its path as usual.
+     */
+    bool open(const QString& filePath);
+    void close();
+
+    static qint64 maxDataSize();
+
+    /**
+     * The content of the file, without copy. Only valid until close() is called.
+     */
+    QByteArray data() const;
+
+private:
+
+    QFile      m_file;
+    uchar*     m_map;
+    qint64     m_size;
+};
+
+// ---------------------------------------------------------------------------
+
 class Q_DECL_HIDDEN ItemScanner::Private
 {
 public:
@@ -141,6 +182,7 @@ public:
 
     bool                   hasImage;
     bool                   hasMetadata;
+    bool                   hasPreloadedMetadata;
     bool                   loadedFromDisk;
 
     QFileInfo              fileInfo;
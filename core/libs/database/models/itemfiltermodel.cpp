@@ -421,18 +421,20 @@ void ItemFilterModel::setItemFilterSettings(const ItemFilterSettings& settings)
     {
         QMutexLocker lock(&d->mutex);
         d->version++;
-        d->filter              = settings;
-        d->filterCopy          = settings;
-        d->versionFilterCopy   = d->versionFilter;
-        d->groupFilterCopy     = d->groupFilter;
+        d->filter               = settings;
+        d->filterCopy           = settings;
+        d->versionFilterCopy    = d->versionFilter;
+        d->groupFilterCopy      = d->groupFilter;
 
-        d->needPrepareComments = settings.isFilteringByText();
-        d->needPrepareTags     = settings.isFilteringByTags();
-        d->needPrepareGroups   = true;
-        d->needPrepare         = d->needPrepareComments || d->needPrepareTags || d->needPrepareGroups;
+        d->needPrepareComments  = settings.isFilteringByText();
+        d->needPrepareTags      = settings.isFilteringByTags();
+        d->needPrepareGroups    = true;
+        d->needPreparePositions = settings.isFilteringByGeolocation();
+        d->needPrepare          = d->needPrepareComments || d->needPrepareTags ||
+                                  d->needPrepareGroups   || d->needPreparePositions;
 
-        d->hasOneMatch         = false;
-        d->hasOneMatchForText  = false;
+        d->hasOneMatch          = false;
+        d->hasOneMatchForText   = false;
     }
 
     d->filterResults.clear();
@@ -648,15 +650,16 @@ void ItemFilterModelPreparer::process(ItemFilterModelTodoPackage package)
     }
 
     // get thread-local copy
-    bool needPrepareTags, needPrepareComments, needPrepareGroups;
+    bool needPrepareTags, needPrepareComments, needPrepareGroups, needPreparePositions;
     QList<ItemFilterModelPrepareHook*> prepareHooks;
 
     {
         QMutexLocker lock(&d->mutex);
-        needPrepareTags     = d->needPrepareTags;
-        needPrepareComments = d->needPrepareComments;
-        needPrepareGroups   = d->needPrepareGroups;
-        prepareHooks        = d->prepareHooks;
+        needPrepareTags      = d->needPrepareTags;
+        needPrepareComments  = d->needPrepareComments;
+        needPrepareGroups    = d->needPrepareGroups;
+        needPreparePositions = d->needPreparePositions;
+        prepareHooks         = d->prepareHooks;
     }
 
     //TODO: Make efficient!!
@@ -679,7 +682,7 @@ void ItemFilterModelPreparer::process(ItemFilterModelTodoPackage package)
     // reimplement ItemInfoList to ItemInfoVector (internally with templates?)
     ItemInfoList infoList;
 
-    if (needPrepareTags || needPrepareGroups)
+    if (needPrepareTags || needPrepareGroups || needPreparePositions)
     {
         infoList = ItemInfoList(package.infos.toList());
     }
@@ -694,6 +697,11 @@ void ItemFilterModelPreparer::process(ItemFilterModelTodoPackage package)
         infoList.loadGroupImageIds();
     }
 
+    if (needPreparePositions)
+    {
+        infoList.loadPositions();
+    }
+
     foreach (ItemFilterModelPrepareHook* const hook, prepareHooks)
     {
         hook->prepare(package.infos);
@@ -47,6 +47,7 @@ ItemFilterModel::ItemFilterModelPrivate::ItemFilterModelPrivate()
     needPrepareComments   = false;
     needPrepareTags       = false;
     needPrepareGroups     = false;
+    needPreparePositions  = false;
     preparer              = nullptr;
     filterer              = nullptr;
     hasOneMatch           = false;
@@ -117,6 +117,7 @@ public:
     bool                                needPrepareComments;
     bool                                needPrepareTags;
     bool                                needPrepareGroups;
+    bool                                needPreparePositions;
 
     QMutex                              mutex;
     ItemFilterSettings                 filterCopy;
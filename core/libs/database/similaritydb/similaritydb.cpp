@@ -521,6 +521,11 @@ void SimilarityDb::vacuum()
     d->db->execDBAction(d->db->getDBAction(QString::fromUtf8("vacuumSimilarityDB")));
 }
 
+void SimilarityDb::optimize()
+{
+    d->db->execDBAction(d->db->getDBAction(QString::fromUtf8("optimizeSimilarityDB")));
+}
+
 // ----------- Private methods ----------
 
 QPair<qlonglong, qlonglong> SimilarityDb::orderIds(qlonglong id1, qlonglong id2)
@@ -217,6 +217,11 @@ public:
      */
     void vacuum();
 
+    /**
+     * This method refreshes the statistics used by the query planner.
+     */
+    void optimize();
+
 private:
 
     /**
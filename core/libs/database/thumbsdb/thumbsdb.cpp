@@ -391,4 +391,9 @@ void ThumbsDb::vacuum()
     d->db->execDBAction(d->db->getDBAction(QString::fromUtf8("vacuumThumbnailsDB")));
 }
 
+void ThumbsDb::optimize()
+{
+    d->db->execDBAction(d->db->getDBAction(QString::fromUtf8("optimizeThumbnailsDB")));
+}
+
 } // namespace Digikam
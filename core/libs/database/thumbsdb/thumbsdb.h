@@ -136,6 +136,11 @@ public:
      */
     void vacuum();
 
+    /**
+     * Refreshes the statistics used by the query planner.
+     */
+    void optimize();
+
 private:
 
     explicit ThumbsDb(ThumbsDbBackend* const backend);
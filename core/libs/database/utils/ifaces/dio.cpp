@@ -29,6 +29,8 @@
 // Qt includes
 
 #include <QFileInfo>
+#include <QDateTime>
+#include <QLocale>
 
 // Local includes
 
@@ -37,6 +39,7 @@
 #include "albummanager.h"
 #include "coredb.h"
 #include "coredbaccess.h"
+#include "coredbtransaction.h"
 #include "album.h"
 #include "dmetadata.h"
 #include "metaenginesettings.h"
@@ -406,6 +409,8 @@ void DIO::slotResult()
                              DigikamApp::instance()->windowTitle());
     }
 
+    updateProcessedItems(data);
+
     if (m_processingCount)
     {
         --m_processingCount;
@@ -428,12 +433,19 @@ void DIO::slotOneProccessed(const QUrl& url)
 
     if (operation == IOJobData::MoveImage)
     {
-        ItemInfo info = data->findItemInfo(url);
+        // The database entries are moved in batches, see updateProcessedItems().
+
+        const int batchSize = 50;
+        ItemInfo info       = data->findItemInfo(url);
 
         if (!info.isNull() && data->destAlbum())
         {
-            CoreDbAccess().db()->moveItem(info.albumId(), info.name(),
-                                          data->destAlbum()->id(), info.name());
+            data->addProcessedItem(info);
+
+            if (data->processedItemsCount() >= batchSize)
+            {
+                updateProcessedItems(data);
+            }
         }
     }
     else if (operation == IOJobData::Delete)
@@ -540,8 +552,8 @@ void DIO::slotOneProccessed(const QUrl& url)
     }
 
     if (operation == IOJobData::CopyImage || operation == IOJobData::CopyAlbum ||
-        operation == IOJobData::CopyFiles || operation == IOJobData::MoveImage ||
-        operation == IOJobData::MoveAlbum || operation == IOJobData::MoveFiles)
+        operation == IOJobData::CopyFiles || operation == IOJobData::MoveAlbum ||
+        operation == IOJobData::MoveFiles)
     {
         QString scanPath = data->destUrl().toLocalFile();
         ScanController::instance()->scheduleCollectionScanRelaxed(scanPath);
@@ -552,7 +564,42 @@ void DIO::slotOneProccessed(const QUrl& url)
     if (item)
     {
         item->advance(1);
+
+        const qint64 bytes = data->bytesCounter()->load();
+        const qint64 msecs = data->jobTime().msecsTo(QDateTime::currentDateTime());
+
+        if (bytes > 0 && msecs > 0)
+        {
+            const double rate = (double)bytes * 1000.0 / msecs / (1024.0 * 1024.0);
+            item->setStatus(i18n("%1 MB/s", QLocale().toString(rate, 'f', 1)));
+        }
+    }
+}
+
+void DIO::updateProcessedItems(IOJobData* const data)
+{
+    if (!data->processedItemsCount() || !data->destAlbum())
+    {
+        return;
     }
+
+    // The moved items are updated in one transaction. The destination is scanned
+    // after the update, else the scanner would add the moved files as new items.
+
+    const int dstAlbumId = data->destAlbum()->id();
+
+    {
+        CoreDbAccess access;
+        CoreDbTransaction transaction(&access);
+
+        foreach (const ItemInfo& info, data->takeProcessedItems())
+        {
+            access.db()->moveItem(info.albumId(), info.name(),
+                                  dstAlbumId, info.name());
+        }
+    }
+
+    ScanController::instance()->scheduleCollectionScanRelaxed(data->destUrl().toLocalFile());
 }
 
 QString DIO::getItemString(IOJobData* const data) const
@@ -113,6 +113,7 @@ private:
     QString getItemString(IOJobData* const data)         const;
     ProgressItem* getProgressItem(IOJobData* const data) const;
     void addAlbumChildrenToList(QList<int>& list, Album* const album);
+    void updateProcessedItems(IOJobData* const data);
 
 private Q_SLOTS:
 
@@ -106,6 +106,12 @@ void ScanController::finishFileMetadataWrite(const ItemInfo& info, bool changed)
                                                     fi.lastModified(),
                                                     fi.size()));
 
+    if (!changed && (fi.lastModified() == info.modDateTime()) && (fi.size() == info.fileSize()))
+    {
+        // The file was not written, as its metadata were already up to date: no need to scan it again.
+        return;
+    }
+
     scanFileDirectlyNormal(info);
 }
 
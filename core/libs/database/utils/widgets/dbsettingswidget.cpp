@@ -27,6 +27,7 @@
 // Qt includes
 
 #include <QApplication>
+#include <QCheckBox>
 #include <QComboBox>
 #include <QDir>
 #include <QFileInfo>
@@ -93,6 +94,7 @@ public:
         password               = nullptr;
         hostPort               = nullptr;
         dbPathEdit             = nullptr;
+        walMode                = nullptr;
         dbBinariesWidget       = nullptr;
         tab                    = nullptr;
         dbDetailsBox           = nullptr;
@@ -124,6 +126,8 @@ public:
 
     DFileSelector*     dbPathEdit;
 
+    QCheckBox*         walMode;
+
     DBinarySearch*     dbBinariesWidget;
 
     MysqlInitBinary    mysqlInitBin;
@@ -217,6 +221,12 @@ void DatabaseSettingsWidget::setupMainArea()
     d->dbPathEdit  = new DFileSelector(dbConfigBox);
     d->dbPathEdit->setFileDlgMode(QFileDialog::Directory);
 
+    d->walMode     = new QCheckBox(i18n("Use write-ahead log journal"), dbConfigBox);
+    d->walMode->setToolTip(i18n("<p>With this option, the SQLite databases are opened with a write-ahead log. "
+                                "Browsing the collections is not blocked anymore while items are scanned or "
+                                "thumbnails are stored, and writing to the databases is faster.</p>"
+                                "<p>The databases files must be hosted on a local file system.</p>"));
+
     // --------------------------------------------------------
 
     d->mysqlCmdBox = new DVBox(dbConfigBox);
@@ -431,6 +441,7 @@ void DatabaseSettingsWidget::setupMainArea()
     vlay->addWidget(new DLineWidget(Qt::Horizontal));
     vlay->addWidget(d->dbPathLabel);
     vlay->addWidget(d->dbPathEdit);
+    vlay->addWidget(d->walMode);
     vlay->addWidget(d->mysqlCmdBox);
     vlay->addWidget(d->tab);
     vlay->setContentsMargins(spacing, spacing, spacing, spacing);
@@ -532,6 +543,7 @@ void DatabaseSettingsWidget::setDatabaseInputFields(int index)
         {
             d->dbPathLabel->setVisible(true);
             d->dbPathEdit->setVisible(true);
+            d->walMode->setVisible(true);
             d->mysqlCmdBox->setVisible(false);
             d->tab->setVisible(false);
 
@@ -544,6 +556,7 @@ void DatabaseSettingsWidget::setDatabaseInputFields(int index)
         {
             d->dbPathLabel->setVisible(true);
             d->dbPathEdit->setVisible(true);
+            d->walMode->setVisible(false);
             d->mysqlCmdBox->setVisible(true);
             d->tab->setVisible(false);
 
@@ -556,6 +569,7 @@ void DatabaseSettingsWidget::setDatabaseInputFields(int index)
         {
             d->dbPathLabel->setVisible(false);
             d->dbPathEdit->setVisible(false);
+            d->walMode->setVisible(false);
             d->mysqlCmdBox->setVisible(false);
             d->tab->setVisible(true);
 
@@ -748,6 +762,7 @@ void DatabaseSettingsWidget::setParametersFromSettings(const ApplicationSettings
     {
         d->dbPathEdit->setFileDlgPath(d->orgPrms.getCoreDatabaseNameOrDir());
         d->dbType->setCurrentIndex(d->dbTypeMap[SQlite]);
+        d->walMode->setChecked(d->orgPrms.walMode);
         slotResetMysqlServerDBNames();
 
         if (settings->getDatabaseDirSetAtCmd() && !migration)
@@ -797,7 +812,8 @@ DbEngineParameters DatabaseSettingsWidget::getDbEngineParameters() const
     switch(databaseType())
     {
         case SQlite:
-            prm = DbEngineParameters::parametersForSQLiteDefaultFile(databasePath());
+            prm         = DbEngineParameters::parametersForSQLiteDefaultFile(databasePath());
+            prm.walMode = d->walMode->isChecked();
             break;
 
         case MysqlInternal:
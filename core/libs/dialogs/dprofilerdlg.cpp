@@ -0,0 +1,252 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-18
+ * Description : profiling summary dialog
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "dprofilerdlg.h"
+
+// Qt includes
+
+#include <QApplication>
+#include <QClipboard>
+#include <QDir>
+#include <QGridLayout>
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QLabel>
+#include <QMimeData>
+#include <QPushButton>
+#include <QTreeWidget>
+#include <QTimer>
+
+// KDE includes
+
+#include <klocalizedstring.h>
+
+// Local includes
+
+#include "dprofiler.h"
+#include "dfiledialog.h"
+
+namespace Digikam
+{
+
+class Q_DECL_HIDDEN DProfilerDlg::Private
+{
+public:
+
+    explicit Private()
+      : recordBtn(nullptr),
+        status(nullptr),
+        timer(nullptr)
+    {
+    }
+
+    QPushButton* recordBtn;
+    QLabel*      status;
+    QTimer*      timer;
+};
+
+DProfilerDlg::DProfilerDlg(QWidget* const parent)
+    : InfoDlg(parent),
+      d(new Private)
+{
+    setWindowTitle(i18n("Profiling"));
+
+    listView()->setColumnCount(6);
+    listView()->setHeaderLabels(QStringList() << i18n("Stage")
+                                              << i18n("Count")
+                                              << i18n("Total (ms)")
+                                              << i18n("Mean (ms)")
+                                              << i18n("Min (ms)")
+                                              << i18n("Max (ms)"));
+    listView()->header()->setSectionResizeMode(QHeaderView::ResizeToContents);
+    listView()->header()->setSectionResizeMode(0, QHeaderView::Stretch);
+
+    // --------------------------------------------------------
+
+    QWidget* const box         = new QWidget(mainWidget());
+    QHBoxLayout* const hlay    = new QHBoxLayout(box);
+
+    d->recordBtn               = new QPushButton(box);
+    d->recordBtn->setCheckable(true);
+    d->recordBtn->setChecked(DProfiler::isEnabled());
+    d->recordBtn->setText(DProfiler::isEnabled() ? i18n("Stop") : i18n("Record"));
+
+    QPushButton* const reset   = new QPushButton(i18n("Reset"), box);
+    QPushButton* const exportB = new QPushButton(i18n("Export Trace..."), box);
+    exportB->setToolTip(i18n("Export the recorded events to a Chrome trace file, "
+                             "which can be opened with chrome://tracing or Perfetto."));
+
+    d->status                  = new QLabel(box);
+
+    hlay->addWidget(d->recordBtn);
+    hlay->addWidget(reset);
+    hlay->addWidget(exportB);
+    hlay->addWidget(d->status, 10);
+    hlay->setContentsMargins(QMargins());
+
+    QGridLayout* const grid    = dynamic_cast<QGridLayout*>(mainWidget()->layout());
+    grid->addWidget(box, 1, 0, 1, -1);
+
+    // --------------------------------------------------------
+
+    d->timer = new QTimer(this);
+    d->timer->setInterval(1000);
+
+    connect(d->timer, SIGNAL(timeout()),
+            this, SLOT(slotRefresh()));
+
+    connect(d->recordBtn, SIGNAL(toggled(bool)),
+            this, SLOT(slotRecord(bool)));
+
+    connect(reset, SIGNAL(clicked()),
+            this, SLOT(slotReset()));
+
+    connect(exportB, SIGNAL(clicked()),
+            this, SLOT(slotExport()));
+
+    if (DProfiler::isEnabled())
+    {
+        d->timer->start();
+    }
+
+    slotRefresh();
+    resize(700, 500);
+}
+
+DProfilerDlg::~DProfilerDlg()
+{
+    delete d;
+}
+
+void DProfilerDlg::slotRecord(bool record)
+{
+    DProfiler::instance()->setEnabled(record);
+    d->recordBtn->setText(record ? i18n("Stop") : i18n("Record"));
+
+    if (record)
+    {
+        d->timer->start();
+    }
+    else
+    {
+        d->timer->stop();
+    }
+
+    slotRefresh();
+}
+
+void DProfilerDlg::slotRefresh()
+{
+    listView()->clear();
+
+    foreach (const DProfiler::Summary& item, DProfiler::instance()->summary())
+    {
+        QStringList columns;
+        columns << QString::fromUtf8(item.category + ": " + item.name)
+                << QString::number(item.count);
+
+        if (item.counter)
+        {
+            // Counter values are shown as is.
+
+            columns << QString::number(item.total)
+                    << QString::number((double)item.total / item.count, 'f', 1)
+                    << QString::number(item.min)
+                    << QString::number(item.max);
+        }
+        else
+        {
+            columns << QString::number(item.total / 1000.0,              'f', 1)
+                    << QString::number(item.total / 1000.0 / item.count, 'f', 3)
+                    << QString::number(item.min   / 1000.0,              'f', 3)
+                    << QString::number(item.max   / 1000.0,              'f', 3);
+        }
+
+        QTreeWidgetItem* const ti = new QTreeWidgetItem(listView(), columns);
+
+        for (int i = 1 ; i < columns.count() ; ++i)
+        {
+            ti->setTextAlignment(i, Qt::AlignRight | Qt::AlignVCenter);
+        }
+    }
+
+    const qint64 dropped = DProfiler::instance()->droppedCount();
+    QString status       = i18np("%1 event recorded", "%1 events recorded",
+                                 DProfiler::instance()->eventsCount());
+
+    if (dropped)
+    {
+        status += QLatin1String(" - ") + i18np("%1 dropped", "%1 dropped", dropped);
+    }
+
+    d->status->setText(status);
+}
+
+void DProfilerDlg::slotReset()
+{
+    DProfiler::instance()->reset();
+    slotRefresh();
+}
+
+void DProfilerDlg::slotExport()
+{
+    QString path = DFileDialog::getSaveFileName(this, i18n("Export Profiling Trace"),
+                                                QDir::homePath() + QLatin1String("/digikam-trace.json"),
+                                                i18n("Chrome Trace (*.json)"));
+
+    if (path.isEmpty())
+    {
+        return;
+    }
+
+    if (!DProfiler::instance()->exportChromeTrace(path))
+    {
+        d->status->setText(i18n("Cannot export the trace to %1", QDir::toNativeSeparators(path)));
+    }
+}
+
+void DProfilerDlg::slotCopy2ClipBoard()
+{
+    QString textInfo;
+    QTreeWidgetItemIterator it(listView());
+
+    while (*it)
+    {
+        QStringList columns;
+
+        for (int i = 0 ; i < listView()->columnCount() ; ++i)
+        {
+            columns << (*it)->text(i);
+        }
+
+        textInfo.append(columns.join(QLatin1Char('\t')));
+        textInfo.append(QLatin1Char('\n'));
+        ++it;
+    }
+
+    QMimeData* const mimeData = new QMimeData();
+    mimeData->setText(textInfo);
+    QApplication::clipboard()->setMimeData(mimeData, QClipboard::Clipboard);
+}
+
+} // namespace Digikam
@@ -0,0 +1,64 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-18
+ * Description : profiling summary dialog
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_DPROFILER_DLG_H
+#define DIGIKAM_DPROFILER_DLG_H
+
+// Local includes
+
+#include "infodlg.h"
+#include "digikam_export.h"
+
+namespace Digikam
+{
+
+/**
+ * Show the time spent in each processing stage recorded by DProfiler,
+ * and allow to start, stop and export the recording.
+ */
+class DIGIKAM_EXPORT DProfilerDlg : public InfoDlg
+{
+    Q_OBJECT
+
+public:
+
+    explicit DProfilerDlg(QWidget* const parent);
+    ~DProfilerDlg();
+
+private Q_SLOTS:
+
+    void slotRecord(bool record);
+    void slotRefresh();
+    void slotReset();
+    void slotExport();
+    void slotCopy2ClipBoard() override;
+
+private:
+
+    class Private;
+    Private* const d;
+};
+
+} // namespace Digikam
+
+#endif // DIGIKAM_DPROFILER_DLG_H
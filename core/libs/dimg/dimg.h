@@ -635,6 +635,11 @@ public:
     QByteArray getUniqueHashV2() const;
     static QByteArray getUniqueHashV2(const QString& filePath);
 
+    /** Same as getUniqueHashV2(), computed from the whole file content already read
+     *  or mapped in memory, as fileData. The file is not opened again.
+     */
+    QByteArray getUniqueHashV2FromData(const QByteArray& fileData) const;
+
     /** This method creates a new 256-bit UUID meant to be globally unique.
      *  The UUID will be returned as a 64-byte hexadecimal string.
      *  At least 128bits of the UUID will be created by the platform random number
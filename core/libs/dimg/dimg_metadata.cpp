@@ -91,6 +91,16 @@ QByteArray DImg::getUniqueHashV2(const QString& filePath)
     return DImgLoader::uniqueHashV2(filePath);
 }
 
+QByteArray DImg::getUniqueHashV2FromData(const QByteArray& fileData) const
+{
+    if (m_priv->attributes.contains(QLatin1String("uniqueHashV2")))
+    {
+        return m_priv->attributes[QLatin1String("uniqueHashV2")].toByteArray();
+    }
+
+    return DImgLoader::uniqueHashV2FromData(fileData, this);
+}
+
 QByteArray DImg::createImageUniqueId() const
 {
     NonDeterministicRandomData randomData(16);
@@ -65,6 +65,22 @@ void AutoExpoFilter::filterImage()
     WBFilter::filterImage();
 }
 
+bool AutoExpoFilter::supportsTiledProcessing() const
+{
+    return (m_refImage.isNull() || (m_orgImage.sixteenBit() == m_refImage.sixteenBit()));
+}
+
+void AutoExpoFilter::prepareTiledProcessing()
+{
+    if (m_refImage.isNull())
+    {
+        m_refImage = m_orgImage;
+    }
+
+    autoExposureAdjustement(&m_refImage, m_settings.black, m_settings.expositionMain);
+    WBFilter::prepareTiledProcessing();
+}
+
 FilterAction AutoExpoFilter::filterAction()
 {
     return DefaultFilterAction<AutoExpoFilter>();
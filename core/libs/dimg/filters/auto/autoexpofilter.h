@@ -78,6 +78,9 @@ private:
 
     void filterImage() override;
 
+    bool supportsTiledProcessing() const override;
+    void prepareTiledProcessing()        override;
+
 private:
 
     DImg m_refImage;
@@ -28,23 +28,30 @@
 #include <cstdio>
 #include <cmath>
 
+// Qt includes
+
+#include <QScopedPointer>
+
 // Local includes
 
 #include "dimg.h"
 #include "digikam_debug.h"
+#include "imagehistogram.h"
 
 namespace Digikam
 {
 
 NormalizeFilter::NormalizeFilter(QObject* const parent)
-    : DImgThreadedFilter(parent)
+    : DImgThreadedFilter(parent),
+      m_histogram(nullptr)
 {
     initFilter();
 }
 
 NormalizeFilter::NormalizeFilter(DImg* const orgImage, const DImg* const refImage, QObject* const parent)
     : DImgThreadedFilter(orgImage, parent, QLatin1String("NormalizeFilter")),
-      m_refImage(*refImage)
+      m_refImage(*refImage),
+      m_histogram(nullptr)
 {
     initFilter();
 }
@@ -54,6 +61,22 @@ NormalizeFilter::~NormalizeFilter()
     cancelFilter();
 }
 
+void NormalizeFilter::cancelFilter()
+{
+    // The histogram is computed in this thread, but it is not a slave filter.
+
+    {
+        QMutexLocker lock(&m_histogramMutex);
+
+        if (m_histogram)
+        {
+            m_histogram->stopCalculation();
+        }
+    }
+
+    DImgThreadedFilter::cancelFilter();
+}
+
 void NormalizeFilter::filterImage()
 {
     if (m_refImage.isNull())
@@ -90,96 +113,40 @@ void NormalizeFilter::normalizeImage()
 
     // Find min. and max. values.
 
-    param.min    = segments - 1;
-    param.max    = 0;
-    uint refSize = m_refImage.width() * m_refImage.height();
-
-    if (!sixteenBit)        // 8 bits image.
-    {
-        uchar  red, green, blue;
-        uchar* ptr = m_refImage.bits();
-
-        for (uint i = 0 ; runningFlag() && (i < refSize) ; ++i)
-        {
-            blue  = ptr[0];
-            green = ptr[1];
-            red   = ptr[2];
+    param.min = segments - 1;
+    param.max = 0;
 
-            if (red < param.min)
-            {
-                param.min = red;
-            }
-
-            if (red > param.max)
-            {
-                param.max = red;
-            }
-
-            if (green < param.min)
-            {
-                param.min = green;
-            }
+    QScopedPointer<ImageHistogram> histogram(new ImageHistogram(m_refImage));
 
-            if (green > param.max)
-            {
-                param.max = green;
-            }
-
-            if (blue < param.min)
-            {
-                param.min = blue;
-            }
+    {
+        QMutexLocker lock(&m_histogramMutex);
+        m_histogram = histogram.data();
+    }
 
-            if (blue > param.max)
-            {
-                param.max = blue;
-            }
+    if (runningFlag())
+    {
+        histogram->calculate();
+    }
 
-            ptr += 4;
-        }
+    {
+        QMutexLocker lock(&m_histogramMutex);
+        m_histogram = nullptr;
     }
-    else                    // 16 bits image.
+
+    if (!runningFlag() || !histogram->isValid())
     {
-        unsigned short  red, green, blue;
-        unsigned short* ptr = reinterpret_cast<unsigned short*>(m_refImage.bits());
+        delete [] param.lut;
+        return;
+    }
 
-        for (uint i = 0 ; runningFlag() && (i < refSize) ; ++i)
+    for (int i = 0 ; i < segments ; ++i)
+    {
+        if ((histogram->getValue(RedChannel,   i) > 0.0) ||
+            (histogram->getValue(GreenChannel, i) > 0.0) ||
+            (histogram->getValue(BlueChannel,  i) > 0.0))
         {
-            blue  = ptr[0];
-            green = ptr[1];
-            red   = ptr[2];
-
-            if (red < param.min)
-            {
-                param.min = red;
-            }
-
-            if (red > param.max)
-            {
-                param.max = red;
-            }
-
-            if (green < param.min)
-            {
-                param.min = green;
-            }
-
-            if (green > param.max)
-            {
-                param.max = green;
-            }
-
-            if (blue < param.min)
-            {
-                param.min = blue;
-            }
-
-            if (blue > param.max)
-            {
-                param.max = blue;
-            }
-
-            ptr += 4;
+            param.min = qMin(param.min, (double)i);
+            param.max = i;
         }
     }
 
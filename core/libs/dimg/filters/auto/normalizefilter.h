@@ -24,6 +24,10 @@
 #ifndef DIGIKAM_NORMALIZE_FILTER_H
 #define DIGIKAM_NORMALIZE_FILTER_H
 
+// Qt includes
+
+#include <QMutex>
+
 // Local includes
 
 #include "digikam_export.h"
@@ -34,6 +38,7 @@ namespace Digikam
 {
 
 class DImg;
+class ImageHistogram;
 
 class DIGIKAM_EXPORT NormalizeFilter : public DImgThreadedFilter
 {
@@ -73,6 +78,11 @@ public:
 
     void                    readParameters(const FilterAction& action) override;
 
+    /**
+     * Stop the histogram scan of the reference image too.
+     */
+    void                    cancelFilter() override;
+
 private:
 
     void filterImage() override;
@@ -87,7 +97,11 @@ private:
         double          max;
     };
 
-    DImg m_refImage;
+    DImg            m_refImage;
+
+    /// The histogram of the reference image while it is scanned, to stop it on cancel.
+    ImageHistogram* m_histogram;
+    QMutex          m_histogramMutex;
 };
 
 } // namespace Digikam
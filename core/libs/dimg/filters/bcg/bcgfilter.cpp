@@ -148,6 +148,23 @@ void BCGFilter::filterImage()
     m_destImage = m_orgImage;
 }
 
+bool BCGFilter::supportsTiledProcessing() const
+{
+    return true;
+}
+
+void BCGFilter::prepareTiledProcessing()
+{
+    setGamma(d->settings.gamma);
+    setBrightness(d->settings.brightness);
+    setContrast(d->settings.contrast);
+}
+
+void BCGFilter::filterTile(uchar* const srcBits, uchar* const, uint width, uint height, bool sixteenBit)
+{
+    applyBCG(srcBits, width, height, sixteenBit);
+}
+
 void BCGFilter::setGamma(double val)
 {
     val = (val < 0.01) ? 0.01 : val;
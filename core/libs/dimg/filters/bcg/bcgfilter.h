@@ -82,6 +82,11 @@ private:
 
     void filterImage() override;
 
+    bool supportsTiledProcessing() const override;
+    void prepareTiledProcessing()        override;
+    void filterTile(uchar* const srcBits, uchar* const destBits,
+                    uint width, uint height, bool sixteenBit) override;
+
     void reset();
     void setGamma(double val);
     void setBrightness(double val);
@@ -38,14 +38,22 @@ namespace Digikam
 {
 
 MixerFilter::MixerFilter(QObject* const parent)
-    : DImgThreadedFilter(parent)
+    : DImgThreadedFilter(parent),
+      m_rnorm(1.0),
+      m_gnorm(1.0),
+      m_bnorm(1.0),
+      m_mnorm(1.0)
 {
     initFilter();
 }
 
 MixerFilter::MixerFilter(DImg* const orgImage, QObject* const parent, const MixerContainer& settings)
     : DImgThreadedFilter(orgImage, parent, QLatin1String("MixerFilter")),
-      m_settings(settings)
+      m_settings(settings),
+      m_rnorm(1.0),
+      m_gnorm(1.0),
+      m_bnorm(1.0),
+      m_mnorm(1.0)
 {
     initFilter();
 }
@@ -59,33 +67,56 @@ void MixerFilter::filterImage()
 {
     m_destImage.putImageData(m_orgImage.bits());
 
-    uchar* bits     = m_destImage.bits();
-    uint width      = m_destImage.width();
-    uint height     = m_destImage.height();
-    bool sixteenBit = m_destImage.sixteenBit();
+    prepareMixer();
+    mixChannels(m_destImage.bits(), m_destImage.width(), m_destImage.height(), m_destImage.sixteenBit());
+}
 
-    uint size       = width * height;
-    int  progress;
+bool MixerFilter::supportsTiledProcessing() const
+{
+    return true;
+}
 
-    uint i;
-    double   rnorm  = 1;    // red channel normalizer use in RGB mode.
-    double   mnorm  = 1;    // monochrome normalizer used in Monochrome mode.
+void MixerFilter::prepareTiledProcessing()
+{
+    prepareMixer();
+}
+
+void MixerFilter::filterTile(uchar* const srcBits, uchar* const, uint width, uint height, bool sixteenBit)
+{
+    mixChannels(srcBits, width, height, sixteenBit);
+}
+
+void MixerFilter::prepareMixer()
+{
+    m_rnorm = 1.0;    // red channel normalizer use in RGB mode.
+    m_mnorm = 1.0;    // monochrome normalizer used in Monochrome mode.
 
     if (m_settings.bMonochrome)
     {
-        mnorm = CalculateNorm(m_settings.blackRedGain, m_settings.blackGreenGain,
-                              m_settings.blackBlueGain, m_settings.bPreserveLum);
+        m_mnorm = CalculateNorm(m_settings.blackRedGain, m_settings.blackGreenGain,
+                                m_settings.blackBlueGain, m_settings.bPreserveLum);
     }
     else
     {
-        rnorm = CalculateNorm(m_settings.redRedGain, m_settings.redGreenGain,
-                              m_settings.redBlueGain, m_settings.bPreserveLum);
+        m_rnorm = CalculateNorm(m_settings.redRedGain, m_settings.redGreenGain,
+                                m_settings.redBlueGain, m_settings.bPreserveLum);
     }
 
-    double gnorm = CalculateNorm(m_settings.greenRedGain, m_settings.greenGreenGain,
-                                 m_settings.greenBlueGain, m_settings.bPreserveLum);
-    double bnorm = CalculateNorm(m_settings.blueRedGain, m_settings.blueGreenGain,
-                                 m_settings.blueBlueGain, m_settings.bPreserveLum);
+    m_gnorm = CalculateNorm(m_settings.greenRedGain, m_settings.greenGreenGain,
+                            m_settings.greenBlueGain, m_settings.bPreserveLum);
+    m_bnorm = CalculateNorm(m_settings.blueRedGain, m_settings.blueGreenGain,
+                            m_settings.blueBlueGain, m_settings.bPreserveLum);
+}
+
+void MixerFilter::mixChannels(uchar* const bits, uint width, uint height, bool sixteenBit)
+{
+    const uint   size  = width * height;
+    const double rnorm = m_rnorm;
+    const double gnorm = m_gnorm;
+    const double bnorm = m_bnorm;
+    const double mnorm = m_mnorm;
+    int          progress;
+    uint         i;
 
     if (!sixteenBit)        // 8 bits image.
     {
@@ -130,6 +130,14 @@ private:
 
     void filterImage() override;
 
+    bool supportsTiledProcessing() const override;
+    void prepareTiledProcessing()        override;
+    void filterTile(uchar* const srcBits, uchar* const destBits,
+                    uint width, uint height, bool sixteenBit) override;
+
+    void prepareMixer();
+    void mixChannels(uchar* const bits, uint width, uint height, bool sixteenBit);
+
     inline double CalculateNorm(double RedGain, double GreenGain, double BlueGain, bool bPreserveLum);
 
     inline unsigned short MixPixel(double RedGain, double GreenGain, double BlueGain,
@@ -139,6 +147,12 @@ private:
 private:
 
     MixerContainer m_settings;
+
+    /// The normalizers of the channels, computed from the settings before the pixels are mixed.
+    double         m_rnorm;
+    double         m_gnorm;
+    double         m_bnorm;
+    double         m_mnorm;
 };
 
 } // namespace Digikam
@@ -99,6 +99,30 @@ void CurvesFilter::filterImage()
     postProgress(100);
 }
 
+bool CurvesFilter::supportsTiledProcessing() const
+{
+    return true;
+}
+
+void CurvesFilter::prepareTiledProcessing()
+{
+    m_tileCurves.reset(new ImageCurves(m_settings));
+
+    if (m_orgImage.sixteenBit() != m_settings.sixteenBit)
+    {
+        ImageCurves depthCurve(m_orgImage.sixteenBit());
+        depthCurve.fillFromOtherCurves(m_tileCurves.data());
+        *m_tileCurves = depthCurve;
+    }
+
+    m_tileCurves->curvesLutSetup(AlphaChannel);
+}
+
+void CurvesFilter::filterTile(uchar* const srcBits, uchar* const destBits, uint width, uint height, bool)
+{
+    m_tileCurves->curvesLutProcess(srcBits, destBits, width, height);
+}
+
 FilterAction CurvesFilter::filterAction()
 {
     DefaultFilterAction<CurvesFilter> action(m_settings.isStoredLosslessly());
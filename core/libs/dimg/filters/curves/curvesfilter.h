@@ -28,6 +28,7 @@
 // Qt includes
 
 #include <QPolygon>
+#include <QScopedPointer>
 
 // Local includes
 
@@ -90,9 +91,15 @@ private:
 
     void filterImage() override;
 
+    bool supportsTiledProcessing() const override;
+    void prepareTiledProcessing()        override;
+    void filterTile(uchar* const srcBits, uchar* const destBits,
+                    uint width, uint height, bool sixteenBit) override;
+
 private:
 
-    CurvesContainer m_settings;
+    CurvesContainer             m_settings;
+    QScopedPointer<ImageCurves> m_tileCurves;
 };
 
 } // namespace Digikam
@@ -24,15 +24,22 @@
 
 #include "dimgthreadedfilter.h"
 
+// C++ includes
+
+#include <cstring>
+
 // Qt includes
 
 #include <QObject>
 #include <QDateTime>
 #include <QThreadPool>
+#include <QScopedArrayPointer>
+#include <QtConcurrent>    // krazy:exclude=includes
 
 // Local includes
 
 #include "digikam_debug.h"
+#include "dprofiler.h"
 
 namespace Digikam
 {
@@ -42,8 +49,11 @@ DImgThreadedFilter::DImgThreadedFilter(QObject* const parent, const QString& nam
 {
     setOriginalImage(DImg());
     setFilterName(name);
-    m_version      = 1;
-    m_wasCancelled = false;
+    m_version         = 1;
+    m_wasCancelled    = false;
+    m_tiledProcessing = false;
+    m_tilesInProgress.store(0);
+    m_tileRows        = 0;
 
     initMaster();
 }
@@ -53,10 +63,13 @@ DImgThreadedFilter::DImgThreadedFilter(DImg* const orgImage, QObject* const pare
     : DynamicThread(parent)
 {
     // remove meta data
-    setOriginalImage(orgImage->copyImageData());
+    setOriginalImage(orgImage ? orgImage->copyImageData() : DImg());
     setFilterName(name);
-    m_version      = 1;
-    m_wasCancelled = false;
+    m_version         = 1;
+    m_wasCancelled    = false;
+    m_tiledProcessing = false;
+    m_tilesInProgress.store(0);
+    m_tileRows        = 0;
 
     initMaster();
 }
@@ -67,9 +80,12 @@ DImgThreadedFilter::DImgThreadedFilter(DImgThreadedFilter* const master, const D
 {
     setFilterName(name);
     setOriginalImage(orgImage);
-    m_destImage    = destImage;
-    m_version      = 1;
-    m_wasCancelled = false;
+    m_destImage       = destImage;
+    m_version         = 1;
+    m_wasCancelled    = false;
+    m_tiledProcessing = false;
+    m_tilesInProgress.store(0);
+    m_tileRows        = 0;
 
     initSlave(master, progressBegin, progressEnd);
 }
@@ -163,6 +179,12 @@ void DImgThreadedFilter::prepareDestImage()
 {
     m_destImage.reset();
 
+    if (m_tiledProcessing && supportsTiledProcessing() && (tileOverlap() == 0))
+    {
+        // Computed in place, see setTiledProcessing().
+        return;
+    }
+
     if (!m_orgImage.isNull())
     {
         m_destImage = DImg(m_orgImage.width(), m_orgImage.height(),
@@ -193,8 +215,19 @@ void DImgThreadedFilter::startFilterDirectly()
 
         try
         {
+            DIGIKAM_PROFILE_SCOPE("filter", m_name);
+
             QDateTime now = QDateTime::currentDateTime();
-            filterImage();
+
+            if (m_tiledProcessing && supportsTiledProcessing())
+            {
+                filterImageTiled();
+            }
+            else
+            {
+                filterImage();
+            }
+
             //qCDebug(DIGIKAM_DIMG_LOG) << m_name << ":: excecution time : " << now.msecsTo(QDateTime::currentDateTime()) << " ms";
         }
         catch (std::bad_alloc& ex)
@@ -241,6 +274,12 @@ void DImgThreadedFilter::cancelFilter()
 
 void DImgThreadedFilter::postProgress(int progr)
 {
+    if (m_tilesInProgress.load())
+    {
+        // Progress from filterTile() running in concurrent bands is not relevant, see filterImageTiled().
+        return;
+    }
+
     if (m_master)
     {
         progr = modulateProgress(progr);
@@ -289,4 +328,139 @@ QList<int> DImgThreadedFilter::multithreadedSteps(int stop, int start) const
     return vals;
 }
 
+void DImgThreadedFilter::setTiledProcessing(bool enable, int tileRows)
+{
+    m_tiledProcessing = enable;
+    m_tileRows        = tileRows;
+
+    if (m_tiledProcessing && supportsTiledProcessing() && (tileOverlap() == 0))
+    {
+        // Point-wise filters are computed in place, the target image prepared by initFilter() is not used.
+        m_destImage.reset();
+    }
+}
+
+bool DImgThreadedFilter::isTiledProcessing() const
+{
+    return m_tiledProcessing;
+}
+
+int DImgThreadedFilter::tiledProcessingBudget()
+{
+    return (16 * 1024 * 1024);
+}
+
+bool DImgThreadedFilter::supportsTiledProcessing() const
+{
+    return false;
+}
+
+int DImgThreadedFilter::tileOverlap() const
+{
+    return 0;
+}
+
+void DImgThreadedFilter::filterTile(uchar* const, uchar* const, uint, uint, bool)
+{
+}
+
+void DImgThreadedFilter::filterImageTiled()
+{
+    const int    height    = (int)m_orgImage.height();
+    const int    overlap   = qMax(0, tileOverlap());
+    const size_t lineBytes = (size_t)m_orgImage.width() * m_orgImage.bytesDepth();
+    int          rows      = m_tileRows;
+
+    if (rows <= 0)
+    {
+        rows = qMax(1, (int)(tiledProcessingBudget() / qMax((size_t)1, lineBytes)));
+    }
+
+    prepareTiledProcessing();
+
+    if (overlap == 0)
+    {
+        // Point-wise filter: the bands are processed in place on original data.
+        m_destImage = m_orgImage;
+    }
+    else if (m_destImage.isNull()                             ||
+             (m_destImage.width()      != m_orgImage.width())  ||
+             (m_destImage.height()     != m_orgImage.height()) ||
+             (m_destImage.sixteenBit() != m_orgImage.sixteenBit()))
+    {
+        prepareDestImage();
+    }
+
+    QList<int> vals;
+
+    for (int y = 0 ; y < height ; y += rows)
+    {
+        vals << y;
+    }
+
+    vals << height;
+
+    // Only run as many bands as CPU cores at the same time to bound the memory used by the temporary buffers.
+
+    const int nbCore = qMax(1, QThreadPool::globalInstance()->maxThreadCount());
+    const int nbBand = vals.count() - 1;
+    QList <QFuture<void> > tasks;
+
+    for (int j = 0 ; runningFlag() && (j < nbBand) ; ++j)
+    {
+        m_tilesInProgress.store(1);
+
+        tasks.append(QtConcurrent::run(this,
+                                       &DImgThreadedFilter::filterBand,
+                                       vals[j],
+                                       vals[j+1],
+                                       overlap
+                                      ));
+
+        if ((tasks.count() == nbCore) || (j == nbBand - 1))
+        {
+            foreach(QFuture<void> t, tasks)
+                t.waitForFinished();
+
+            tasks.clear();
+            m_tilesInProgress.store(0);
+            postProgress((int)(((double)(j + 1) * 100.0) / nbBand));
+        }
+    }
+
+    foreach(QFuture<void> t, tasks)
+        t.waitForFinished();
+
+    m_tilesInProgress.store(0);
+}
+
+void DImgThreadedFilter::filterBand(int start, int stop, int overlap)
+{
+    const uint   width      = m_orgImage.width();
+    const bool   sixteenBit = m_orgImage.sixteenBit();
+    const size_t lineBytes  = (size_t)width * m_orgImage.bytesDepth();
+
+    if (overlap == 0)
+    {
+        uchar* const bits = m_orgImage.scanLine(start);
+        filterTile(bits, bits, width, stop - start, sixteenBit);
+
+        return;
+    }
+
+    // Extend the band with the neighbourhood rows available around it,
+    // and only keep the rows of the band itself in target image.
+
+    const int top    = qMax(0, start - overlap);
+    const int bottom = qMin((int)m_orgImage.height(), stop + overlap);
+
+    QScopedArrayPointer<uchar> band(new uchar[(size_t)(bottom - top) * lineBytes]);
+
+    filterTile(m_orgImage.scanLine(top), band.data(), width, bottom - top, sixteenBit);
+
+    memcpy(m_destImage.scanLine(start),
+           band.data() + (size_t)(start - top) * lineBytes,
+           (size_t)(stop - start) * lineBytes);
+}
+
 } // namespace Digikam
@@ -25,6 +25,10 @@
 #ifndef DIGIKAM_DIMG_THREADED_FILTER_H
 #define DIGIKAM_DIMG_THREADED_FILTER_H
 
+// Qt includes
+
+#include <QAtomicInt>
+
 // KDE includes
 
 #include <klocalizedstring.h>
@@ -41,10 +45,15 @@ class QObject;
 namespace Digikam
 {
 
+class PointFilterChain;
+
 class DIGIKAM_EXPORT DImgThreadedFilter : public DynamicThread
 {
     Q_OBJECT
 
+    /// Runs the tiled processing methods of the chained filters on the bands of its single pass.
+    friend class PointFilterChain;
+
 public:
 
     /** Constructs a filter without argument.
@@ -55,7 +64,8 @@ public:
     explicit DImgThreadedFilter(QObject* const parent=nullptr, const QString& name = QString());
 
     /** Constructs a filter with all arguments (ready to use).
-     *  The given original image will be copied.
+     *  The given original image will be copied. If it is null, call setupFilter() later,
+     *  as when the filter is only configured to be added to a PointFilterChain.
      *  You need to call startFilter() to start the threaded computation.
      *  To run filter without to use multithreading, call startFilterDirectly().
      */
@@ -98,6 +108,21 @@ public:
      */
     QList<int> multithreadedSteps(int stop, int start=0) const;
 
+    /** Enable or disable the tiled execution mode. When enabled and supported by the filter
+     *  (see supportsTiledProcessing()), the image is processed as bands of full rows instead of
+     *  as a whole, several bands being computed in parallel. Point-wise filters are then applied
+     *  in place on the original data and no second full size output image is allocated,
+     *  also by a later setupFilter(). tileRows is the height of a band. If 0, a height is
+     *  computed from the image width to keep each band around tiledProcessingBudget() bytes.
+     *  This mode is off by default.
+     */
+    void setTiledProcessing(bool enable, int tileRows = 0);
+    bool isTiledProcessing() const;
+
+    /** Return the memory size in bytes used by default for one band in tiled execution mode.
+     */
+    static int tiledProcessingBudget();
+
     /** Start the threaded computation.
      */
     virtual void startFilter();
@@ -177,6 +202,34 @@ protected:
      */
     virtual void filterImage() = 0;
 
+    /** Return true if the filter implements filterTile(). Default implementation returns false,
+     *  and the filter is always processed with filterImage().
+     */
+    virtual bool supportsTiledProcessing() const;
+
+    /** Return the neighbourhood radius in pixels that the filter needs around each output pixel.
+     *  Each band passed to filterTile() will include this amount of extra rows above and below
+     *  the band to compute, when available. Point-wise filters return 0 (default).
+     */
+    virtual int tileOverlap() const;
+
+    /** Called once in tiled execution mode before the bands are processed. Use it to prepare
+     *  lookup tables or to compute statistics on the whole original image. Override in subclass.
+     */
+    virtual void prepareTiledProcessing() {};
+
+    /** Process one band of rows in tiled execution mode. srcBits and destBits point to the first
+     *  row of the band (overlap rows included) in the original and target data. If tileOverlap()
+     *  is 0, srcBits and destBits are the same buffer. This method is called concurrently from
+     *  several threads and must not change the filter state. Override in subclass.
+     */
+    virtual void filterTile(uchar* const srcBits, uchar* const destBits, uint width, uint height, bool sixteenBit);
+
+    /** Process the image band by band using filterTile(). Called by startFilterDirectly() when
+     *  tiled execution mode is enabled and supported by the filter.
+     */
+    void filterImageTiled();
+
     /** Clean up filter data if necessary, called by stopComputation() method.
         Override in subclass.
      */
@@ -225,6 +278,10 @@ protected:
     void initMaster();
     virtual void prepareDestImage();
 
+    /** Process one band of rows [start, stop[ in tiled execution mode.
+     */
+    void filterBand(int start, int stop, int overlap);
+
     /**
      * Convenience class to spare the few repeating lines of code
      */
@@ -268,6 +325,14 @@ protected:
 
     bool                m_wasCancelled;
 
+    /** Tiled execution mode settings.
+     */
+    bool                m_tiledProcessing;
+
+    /// Read by the threads of the bands in postProgress().
+    QAtomicInt          m_tilesInProgress;
+    int                 m_tileRows;
+
     /** The progress span that a slave filter uses in the parent filter's progress.
      */
     int                 m_progressBegin;
@@ -39,6 +39,7 @@
 #include "dimgbuiltinfilter.h"
 #include "dimgfiltermanager.h"
 #include "filteraction.h"
+#include "pointfilterchain.h"
 
 namespace Digikam
 {
@@ -184,8 +185,10 @@ void FilterActionFilter::filterImage()
 
     DImg img = m_orgImage;
 
-    foreach(const FilterAction& action, d->actions)
+    for (int i = 0 ; i < d->actions.size() ; ++i)
     {
+        const FilterAction& action = d->actions.at(i);
+
         qCDebug(DIGIKAM_DIMG_LOG) << "Replaying action" << action.identifier();
 
         if (action.isNull())
@@ -193,6 +196,18 @@ void FilterActionFilter::filterImage()
             continue;
         }
 
+        // Adjacent filters mapping each color channel independently are applied together in one pass.
+
+        int chained = chainPointFilters(img, i);
+
+        if (chained > 0)
+        {
+            i        += chained - 1;
+            progress += progressIncrement * chained;
+            postProgress((int)progress);
+            continue;
+        }
+
         if (DImgBuiltinFilter::isSupported(action.identifier()))
         {
             DImgBuiltinFilter filter(action);
@@ -262,4 +277,39 @@ void FilterActionFilter::filterImage()
     m_destImage = img;
 }
 
+int FilterActionFilter::chainPointFilters(DImg& img, int index)
+{
+    int last = index;
+
+    while ((last < d->actions.size()) && PointFilterChain::isSupported(d->actions.at(last).identifier()))
+    {
+        ++last;
+    }
+
+    if ((last - index) < 2)
+    {
+        return 0;
+    }
+
+    // The chain works in place, do not change the data of original image.
+    img.detach();
+
+    PointFilterChain chain;
+
+    for (int i = index ; i < last ; ++i)
+    {
+        if (!chain.addFilterAction(d->actions.at(i), img))
+        {
+            // Errors are reported when the action is replayed alone.
+            break;
+        }
+    }
+
+    d->appliedActions << chain.filterActions();
+    int chained = chain.count();
+    chain.apply(img);
+
+    return chained;
+}
+
 } // namespace Digikam
@@ -126,6 +126,15 @@ protected:
 
     virtual void filterImage() override;
 
+private:
+
+    /**
+     * Apply in one pass the point filters found in the action list from index, see PointFilterChain.
+     * Returns the number of actions applied, or 0 if less than two actions can be chained, or if the
+     * action at index cannot be chained.
+     */
+    int chainPointFilters(DImg& img, int index);
+
 private:
 
     class Private;
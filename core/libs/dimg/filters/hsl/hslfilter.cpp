@@ -94,6 +94,23 @@ void HSLFilter::filterImage()
     m_destImage = m_orgImage;
 }
 
+bool HSLFilter::supportsTiledProcessing() const
+{
+    return true;
+}
+
+void HSLFilter::prepareTiledProcessing()
+{
+    setHue(d->settings.hue);
+    setSaturation(d->settings.saturation);
+    setLightness(d->settings.lightness);
+}
+
+void HSLFilter::filterTile(uchar* const srcBits, uchar* const, uint width, uint height, bool sixteenBit)
+{
+    applyHSL(srcBits, width, height, sixteenBit);
+}
+
 void HSLFilter::reset()
 {
     // initialize to linear mapping
@@ -237,8 +254,17 @@ void HSLFilter::applyHSL(DImg& image)
         return;
     }
 
-    bool   sixteenBit     = image.sixteenBit();
-    uint   numberOfPixels = image.numPixels();
+    applyHSL(image.bits(), image.width(), image.height(), image.sixteenBit());
+}
+
+void HSLFilter::applyHSL(uchar* const bits, uint width, uint height, bool sixteenBit)
+{
+    if (!bits)
+    {
+        return;
+    }
+
+    uint   numberOfPixels = width * height;
     int    progress;
     int    hue, sat, lig;
     double vib = d->settings.vibrance;
@@ -246,7 +272,7 @@ void HSLFilter::applyHSL(DImg& image)
 
     if (sixteenBit)                   // 16 bits image.
     {
-        unsigned short* data = reinterpret_cast<unsigned short*>(image.bits());
+        unsigned short* data = reinterpret_cast<unsigned short*>(bits);
 
         for (uint i = 0; runningFlag() && (i < numberOfPixels); ++i)
         {
@@ -274,7 +300,7 @@ void HSLFilter::applyHSL(DImg& image)
     }
     else                                      // 8 bits image.
     {
-        uchar* data = image.bits();
+        uchar* data = bits;
 
         for (uint i = 0; runningFlag() && (i < numberOfPixels); ++i)
         {
@@ -104,11 +104,18 @@ private:
 
     void filterImage() override;
 
+    bool supportsTiledProcessing() const override;
+    void prepareTiledProcessing()        override;
+    void filterTile(uchar* const srcBits, uchar* const destBits,
+                    uint width, uint height, bool sixteenBit) override;
+
+
     void reset();
     void setHue(double val);
     void setSaturation(double val);
     void setLightness(double val);
     void applyHSL(DImg& image);
+    void applyHSL(uchar* const bits, uint width, uint height, bool sixteenBit);
     int  vibranceBias(double sat, double hue, double vib, bool sixteenbit);
 
 private:
@@ -45,12 +45,22 @@ ImageQualityParser::~ImageQualityParser()
 
 void ImageQualityParser::readImage() const
 {
-    DColor col;
     int j = 0;
 
     d->img8 = d->image;
     d->img8.convertToEightBit();                        // Convert to 8 bits color depth.
 
+    // Gray levels plane computed once in a single pass over pixels, and shared by blur and compression detectors.
+
+    const uchar* ptr = d->img8.bits();
+    d->graySums.resize(d->img8.numPixels());
+
+    for (int i = 0 ; d->running && (i < d->graySums.size()) ; ++i)
+    {
+        d->graySums[i] = ptr[0] + ptr[1] + ptr[2];
+        ptr           += 4;
+    }
+
     // grayscale image creation for noise detector
 
     d->src_gray = Mat(d->img8.numPixels(), 1, CV_8UC1); // Create a matrix containing the pixel values of grayscaled image
@@ -59,8 +69,7 @@ void ImageQualityParser::readImage() const
     {
         for (uint y = 0 ; d->running && (y < d->img8.height()) ; ++y)
         {
-            col                         = d->img8.getPixelColor(x, y);
-            d->src_gray.at<uchar>(x, y) = (col.red() + col.green() + col.blue()) / 3;
+            d->src_gray.at<uchar>(x, y) = d->graySum(x, y) / 3;
         }
     }
 
@@ -73,17 +82,32 @@ void ImageQualityParser::readImage() const
             d->fimg[c] = new float[d->neimage.numPixels()];
         }
 
-        j = 0;
+        // Pixels are read in memory order, blue, green, red, alpha.
+
+        const uint count = d->neimage.numPixels();
 
-        for (uint y = 0 ; d->running && (y < d->neimage.height()) ; ++y)
+        if (d->neimage.sixteenBit())
+        {
+            const unsigned short* ptr16 = reinterpret_cast<const unsigned short*>(d->neimage.bits());
+
+            for (j = 0 ; d->running && (j < (int)count) ; ++j)
+            {
+                d->fimg[0][j] = ptr16[2];
+                d->fimg[1][j] = ptr16[1];
+                d->fimg[2][j] = ptr16[0];
+                ptr16        += 4;
+            }
+        }
+        else
         {
-            for (uint x = 0 ; d->running && (x < d->neimage.width()) ; ++x)
+            const uchar* ptr8 = d->neimage.bits();
+
+            for (j = 0 ; d->running && (j < (int)count) ; ++j)
             {
-                col           = d->neimage.getPixelColor(x, y);
-                d->fimg[0][j] = col.red();
-                d->fimg[1][j] = col.green();
-                d->fimg[2][j] = col.blue();
-                ++j;
+                d->fimg[0][j] = ptr8[2];
+                d->fimg[1][j] = ptr8[1];
+                d->fimg[2][j] = ptr8[0];
+                ptr8         += 4;
             }
         }
     }
@@ -105,43 +129,74 @@ void ImageQualityParser::startAnalyse()
     double underLevel       = 0.0;
     double overLevel        = 0.0;
 
+    // The detectors run concurrently. They only read the gray levels prepared by readImage(),
+    // and keep their working data local, except the noise detector which is the only user of
+    // the fimg buffers: it converts them in place and releases them.
+
+    QFuture<double> blurFuture;
+    QFuture<short>  blur2Future;
+    QFuture<double> noiseFuture;
+    QFuture<int>    compressionFuture;
+    bool            blurStarted        = false;
+    bool            noiseStarted       = false;
+    bool            compressionStarted = false;
+
     // If blur option is selected in settings, run the blur detection algorithms
     if (d->running && d->imq.detectBlur)
+    {
+        blurFuture  = QtConcurrent::run(this, &ImageQualityParser::blurDetector);
+        blur2Future = QtConcurrent::run(this, &ImageQualityParser::blurDetector2);
+        blurStarted = true;
+    }
+
+    if (d->running && d->imq.detectNoise)
+    {
+        noiseFuture  = QtConcurrent::run(this, &ImageQualityParser::noiseDetector);
+        noiseStarted = true;
+    }
+
+    if (d->running && d->imq.detectCompression)
+    {
+        compressionFuture  = QtConcurrent::run(this, &ImageQualityParser::compressionDetector);
+        compressionStarted = true;
+    }
+
+    if (d->running && d->imq.detectExposure)
+    {
+        // Returns percents of over-exposure in the image
+        exposureAmount(underLevel, overLevel);
+        qCDebug(DIGIKAM_DIMG_LOG) << "Under-exposure percents in image is: " << underLevel;
+        qCDebug(DIGIKAM_DIMG_LOG) << "Over-exposure percents in image is:  " << overLevel;
+    }
+
+    if (blurStarted)
     {
         // Returns blur value between 0 and 1.
         // If NaN is returned just assign NoPickLabel
-        blur  = blurDetector();
+        blur  = blurFuture.result();
         qCDebug(DIGIKAM_DIMG_LOG) << "Amount of Blur present in image is:" << blur;
 
         // Returns blur value between 1 and 32767.
         // If 1 is returned just assign NoPickLabel
-        blur2 = blurDetector2();
+        blur2 = blur2Future.result();
         qCDebug(DIGIKAM_DIMG_LOG) << "Amount of Blur present in image [using LoG Filter] is:" << blur2;
     }
 
-    if (d->running && d->imq.detectNoise)
+    if (noiseStarted)
     {
         // Some images give very low noise value. Assign NoPickLabel in that case.
         // Returns noise value between 0 and 1.
-        noise = noiseDetector();
+        noise = noiseFuture.result();
         qCDebug(DIGIKAM_DIMG_LOG) << "Amount of Noise present in image is:" << noise;
     }
 
-    if (d->running && d->imq.detectCompression)
+    if (compressionStarted)
     {
         // Returns number of blocks in the image.
-        compressionLevel = compressionDetector();
+        compressionLevel = compressionFuture.result();
         qCDebug(DIGIKAM_DIMG_LOG) << "Amount of compression artifacts present in image is:" << compressionLevel;
     }
 
-    if (d->running && d->imq.detectExposure)
-    {
-        // Returns percents of over-exposure in the image
-        exposureAmount(underLevel, overLevel);
-        qCDebug(DIGIKAM_DIMG_LOG) << "Under-exposure percents in image is: " << underLevel;
-        qCDebug(DIGIKAM_DIMG_LOG) << "Over-exposure percents in image is:  " << overLevel;
-    }
-
 #ifdef TRACE
 
     QFile filems("imgqsortresult.txt");
@@ -58,12 +58,6 @@ private:
      */
     void readImage() const;
 
-    /**
-     * @function cannyThreshold
-     * @brief Trackbar callback - Canny thresholds input with a ratio 1:3
-     */
-    void   cannyThreshold(int, void*) const;
-
     double blurDetector()             const;
     short  blurDetector2()            const;
     double noiseDetector()            const;
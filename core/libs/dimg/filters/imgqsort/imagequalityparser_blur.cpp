@@ -30,29 +30,28 @@
 namespace Digikam
 {
 
-void ImageQualityParser::cannyThreshold(int, void*) const
+double ImageQualityParser::blurDetector() const
 {
+    // This detector runs concurrently with the other ones, so its state is kept local to the call.
+
+    const double lowThreshold = 0.4;
+    const int    ratio        = 3;
+    double       maxval       = 0.0;
+    Mat          detected_edges;                       // Matrix containing only edges in the image
+
     // Reduce noise with a kernel 3x3.
-    blur(d->src_gray, d->detected_edges, Size(3, 3));
+    blur(d->src_gray, detected_edges, Size(3, 3));
 
-    // Canny detector.
-    Canny(d->detected_edges,
-          d->detected_edges,
-          d->lowThreshold,
-          d->lowThreshold * d->ratio,
+    // Canny detector, with the thresholds in a ratio 1:3.
+    Canny(detected_edges,
+          detected_edges,
+          lowThreshold,
+          lowThreshold * ratio,
           d->kernel_size);
-}
 
-double ImageQualityParser::blurDetector() const
-{
-    d->lowThreshold   = 0.4;
-    d->ratio          = 3;
-    double maxval     = 0.0;
-    cannyThreshold(0, nullptr);
-
-    double average    = mean(d->detected_edges)[0];
-    int* const maxIdx = new int[sizeof(d->detected_edges)];
-    minMaxIdx(d->detected_edges, nullptr, &maxval, nullptr, maxIdx);
+    double average    = mean(detected_edges)[0];
+    int* const maxIdx = new int[sizeof(detected_edges)];
+    minMaxIdx(detected_edges, nullptr, &maxval, nullptr, maxIdx);
 
     double blurresult = average / maxval;
 
@@ -39,7 +39,6 @@ int ImageQualityParser::compressionDetector() const
     QList<float> average_bottom;
     QList<float> average_middle;
     QList<float> average_top;
-    DColor col;
 
     // Go through 8 blocks at a time horizontally
     // iterating through columns.
@@ -54,8 +53,7 @@ int ImageQualityParser::compressionDetector() const
 
             for (int k = j ; k < block_size ; ++k)
             {
-                col  = d->img8.getPixelColor(i, j);
-                sum += (col.red() + col.green() + col.blue()) / 3.0;
+                sum += d->graySum(i, j) / 3.0;
             }
 
             average_top.push_back(sum / 8.0);
@@ -69,8 +67,7 @@ int ImageQualityParser::compressionDetector() const
 
             for (uint k = j ; k < block_size ; ++k)
             {
-                col  = d->img8.getPixelColor(i + 1, j);
-                sum += (col.red() + col.green() + col.blue()) / 3.0;
+                sum += d->graySum(i + 1, j) / 3.0;
             }
 
             average_middle.push_back(sum / 8.0);
@@ -86,8 +83,7 @@ int ImageQualityParser::compressionDetector() const
 
             for (uint k = j ; k < block_size ; ++k)
             {
-                col  = d->img8.getPixelColor(i + 2, j);
-                sum += (col.red() + col.green() + col.blue()) / 3.0;
+                sum += d->graySum(i + 2, j) / 3.0;
             }
 
             average_bottom.push_back(sum / 8.0);
@@ -123,8 +119,7 @@ int ImageQualityParser::compressionDetector() const
 
             for (int k = i ; k < block_size ; ++k)
             {
-                col  = d->img8.getPixelColor(i, j);
-                sum += (col.red() + col.green() + col.blue()) / 3.0;
+                sum += d->graySum(i, j) / 3.0;
             }
 
             average_top.push_back(sum / 8.0);
@@ -138,8 +133,7 @@ int ImageQualityParser::compressionDetector() const
 
             for (uint k = i ; k < block_size ; ++k)
             {
-                col  = d->img8.getPixelColor(i, j + 1);
-                sum += (col.red() + col.green() + col.blue()) / 3.0;
+                sum += d->graySum(i, j + 1) / 3.0;
             }
 
             average_middle.push_back(sum / 8.0);
@@ -155,8 +149,7 @@ int ImageQualityParser::compressionDetector() const
 
             for (uint k = i ; k < block_size ; ++k)
             {
-                col  = d->img8.getPixelColor(i, j + 2);
-                sum += (col.red() + col.green() + col.blue()) / 3.0;
+                sum += d->graySum(i, j + 2) / 3.0;
             }
 
             average_bottom.push_back(sum / 8.0);
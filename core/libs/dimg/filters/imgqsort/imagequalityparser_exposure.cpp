@@ -45,15 +45,22 @@ void ImageQualityParser::exposureAmount(double& under, double& over) const
 
     QImage mask = d->image.pureColorMask(&expo);
 
-    for (int x = 0 ; d->running && (x < mask.width()) ; ++x)
+    // The mask is an ARGB32 image, which is parsed by scan lines.
+
+    const QRgb white = QColor(Qt::white).rgba();
+    const QRgb black = QColor(Qt::black).rgba();
+
+    for (int y = 0 ; d->running && (y < mask.height()) ; ++y)
     {
-        for (int y = 0 ; d->running && (y < mask.height()) ; ++y)
+        const QRgb* const line = reinterpret_cast<const QRgb*>(mask.constScanLine(y));
+
+        for (int x = 0 ; x < mask.width() ; ++x)
         {
-            if (mask.pixelColor(x, y) == Qt::white)
+            if (line[x] == white)
             {
                 ++overCount;
             }
-            else if (mask.pixelColor(x, y) == Qt::black)
+            else if (line[x] == black)
             {
                 ++underCount;
             }
@@ -291,6 +291,7 @@ double ImageQualityParser::noiseDetector() const
         for (uint i = 0 ; i < 3 ; ++i)
         {
             delete [] d->fimg[i];
+            d->fimg[i] = nullptr;
         }
     }
 
@@ -38,6 +38,8 @@
 #include <QTextStream>
 #include <QFile>
 #include <QImage>
+#include <QVector>
+#include <QtConcurrent>    // krazy:exclude=includes
 
 // Local includes
 
@@ -72,8 +74,6 @@ public:
         // Setting the default values
 
         edgeThresh        = 1;
-        lowThreshold      = 0.4;
-        ratio             = 3;
         kernel_size       = 3;
         blurrejected      = 0.0;
         blur              = 0.0;
@@ -84,22 +84,40 @@ public:
         running           = true;
     }
 
-    float*                fimg[3];
+    ~Private()
+    {
+        for (int c = 0 ; c < 3 ; ++c)
+        {
+            delete [] fimg[c];
+        }
+    }
+
+    /** Return the sum of red, green and blue values of img8 pixel at (x, y),
+     *  or 0 outside the image, as DImg::getPixelColor() returns a null color there.
+     */
+    inline int graySum(uint x, uint y) const
+    {
+        if ((x >= img8.width()) || (y >= img8.height()))
+        {
+            return 0;
+        }
+
+        return graySums[y * img8.width() + x];
+    }
+
+    float*                fimg[3];           // Noise detector buffers, converted in place and released by the detector
     const uint            clusterCount;
     const uint            size;              // Size of squared original image.
 
     Mat                   src_gray;          // Matrix of the grayscaled source image
-    Mat                   detected_edges;    // Matrix containing only edges in the image
 
     int                   edgeThresh;        // threshold above which we say that edges are present at a point
-    int                   ratio;             // lower:upper threshold for canny edge detector algorithm
     int                   kernel_size;       // kernel size for the Sobel operations to be performed internally by the edge detector
 
-    double                lowThreshold;
-
     DImg                  image;             // original image
     DImg                  neimage;           // noise estimation image[for color]
     DImg                  img8;              // compression detector image on 8 bits
+    QVector<ushort>       graySums;          // Sums of red, green and blue values of img8 pixels, shared by detectors
 
     ImageQualityContainer imq;
 
@@ -35,6 +35,10 @@
 #include <cmath>
 #include <cstdlib>
 
+// Qt includes
+
+#include <QtConcurrent>    // krazy:exclude=includes
+
 // Local includes
 
 #include "dimg.h"
@@ -43,7 +47,11 @@ namespace Digikam
 {
 
 AntiVignettingFilter::AntiVignettingFilter(QObject* const parent)
-    : DImgThreadedFilter(parent)
+    : DImgThreadedFilter(parent),
+      m_xctr(0),
+      m_yctr(0),
+      m_rowsDone(0),
+      m_progress(0)
 {
     initFilter();
 }
@@ -51,7 +59,11 @@ AntiVignettingFilter::AntiVignettingFilter(QObject* const parent)
 AntiVignettingFilter::AntiVignettingFilter(DImg* const orgImage, QObject* const parent,
                                            const AntiVignettingContainer& settings)
     : DImgThreadedFilter(orgImage, parent, QLatin1String("AntiVignettingFilter")),
-      m_settings(settings)
+      m_settings(settings),
+      m_xctr(0),
+      m_yctr(0),
+      m_rowsDone(0),
+      m_progress(0)
 {
     initFilter();
 }
@@ -65,15 +77,7 @@ AntiVignettingFilter::~AntiVignettingFilter()
 
 void AntiVignettingFilter::filterImage()
 {
-    int    progress;
-    int    col, row, xd, td, yd, p;
-    int    xsize, ysize, /*diagonal,*/ erad, irad, xctr, yctr;
-
-    uchar* NewBits            = m_destImage.bits();
-    uchar* data               = m_orgImage.bits();
-
-    unsigned short* NewBits16 = reinterpret_cast<unsigned short*>(m_destImage.bits());
-    unsigned short* data16    = reinterpret_cast<unsigned short*>(m_orgImage.bits());
+    int    xsize, ysize, /*diagonal,*/ erad, irad, xdMax, ydMax, tdMax;
 
     int Width                 = m_orgImage.width();
     int Height                = m_orgImage.height();
@@ -95,43 +99,98 @@ void AntiVignettingFilter::filterImage()
 
     diagonal = qRound(hypothenuse(xsize, ysize)) +  1;
 */
-    xctr     = qRound(Width  / 2.0 + m_settings.xshift);
-    yctr     = qRound(Height / 2.0 + m_settings.yshift);
+    m_xctr   = qRound(Width  / 2.0 + m_settings.xshift);
+    m_yctr   = qRound(Height / 2.0 + m_settings.yshift);
 
+    // The attenuation only depends on the rounded distance to the center:
+    // compute it once for all distances found in the image.
 
-    for (row = 0 ; runningFlag() && (row < Width) ; ++row)
+    ydMax    = qMax(abs(m_xctr), abs(m_xctr - (Width  - 1)));
+    xdMax    = qMax(abs(m_yctr), abs(m_yctr - (Height - 1)));
+    tdMax    = qRound(hypothenuse(xdMax, ydMax));
+
+    m_attenuations.resize(tdMax + 1);
+
+    for (int td = 0 ; td <= tdMax ; ++td)
     {
-        yd = abs(xctr - row);
+        m_attenuations[td] = real_attenuation(irad, erad, td);
+    }
+
+    m_rowsDone = 0;
+    m_progress = 0;
+
+    QList<int> vals = multithreadedSteps(Height);
+    QList <QFuture<void> > tasks;
 
-        for (col = 0 ; runningFlag() && (col < Height) ; ++col)
+    for (int j = 0 ; runningFlag() && (j < vals.count()-1) ; ++j)
+    {
+        tasks.append(QtConcurrent::run(this,
+                                       &AntiVignettingFilter::antiVignettingMultithreaded,
+                                       vals[j],
+                                       vals[j+1]
+                                      ));
+    }
+
+    foreach(QFuture<void> t, tasks)
+        t.waitForFinished();
+}
+
+void AntiVignettingFilter::antiVignettingMultithreaded(uint start, uint stop)
+{
+    int    progress;
+    int    xd, yd, p;
+    double att;
+
+    uchar* NewBits            = m_destImage.bits();
+    uchar* data               = m_orgImage.bits();
+
+    unsigned short* NewBits16 = reinterpret_cast<unsigned short*>(m_destImage.bits());
+    unsigned short* data16    = reinterpret_cast<unsigned short*>(m_orgImage.bits());
+
+    const double* const atts  = m_attenuations.constData();
+    int Width                 = m_orgImage.width();
+    int Height                = m_orgImage.height();
+    bool sixteenBit           = m_orgImage.sixteenBit();
+
+    // Process the image by rows to read and write the pixels sequentially.
+
+    for (int col = start ; runningFlag() && (col < (int)stop) ; ++col)
+    {
+        xd = abs(m_yctr - col);
+        p  = col * Width * 4;
+
+        for (int row = 0 ; row < Width ; ++row, p += 4)
         {
-            p  = (col * Width + row) * 4;
-            xd = abs(yctr - col);
-            td = qRound(hypothenuse(xd, yd));
+            yd  = abs(m_xctr - row);
+            att = atts[qRound(hypothenuse(xd, yd))];
 
-            if (!m_orgImage.sixteenBit())       // 8 bits image
+            if (!sixteenBit)       // 8 bits image
             {
-                NewBits[ p ] = clamp8bits(data[ p ] * real_attenuation(irad, erad, td));
-                NewBits[p + 1] = clamp8bits(data[p + 1] * real_attenuation(irad, erad, td));
-                NewBits[p + 2] = clamp8bits(data[p + 2] * real_attenuation(irad, erad, td));
+                NewBits[ p ]   = clamp8bits(data[ p ] * att);
+                NewBits[p + 1] = clamp8bits(data[p + 1] * att);
+                NewBits[p + 2] = clamp8bits(data[p + 2] * att);
                 NewBits[p + 3] = data[p + 3];
             }
-            else                                // 16 bits image.
+            else                   // 16 bits image.
             {
-                NewBits16[ p ] = clamp16bits(data16[ p ] * real_attenuation(irad, erad, td));
-                NewBits16[p + 1] = clamp16bits(data16[p + 1] * real_attenuation(irad, erad, td));
-                NewBits16[p + 2] = clamp16bits(data16[p + 2] * real_attenuation(irad, erad, td));
+                NewBits16[ p ]   = clamp16bits(data16[ p ] * att);
+                NewBits16[p + 1] = clamp16bits(data16[p + 1] * att);
+                NewBits16[p + 2] = clamp16bits(data16[p + 2] * att);
                 NewBits16[p + 3] = data16[p + 3];
             }
         }
 
         // Update the progress bar in dialog.
-        progress = (int)(((double)row * 100.0) / Width);
+        m_lock.lock();
+        progress = (int)(((double)(++m_rowsDone) * 100.0) / Height);
 
-        if (progress % 5 == 0)
+        if ((progress % 5 == 0) && (progress > m_progress))
         {
+            m_progress = progress;
             postProgress(progress);
         }
+
+        m_lock.unlock();
     }
 }
 
@@ -25,6 +25,11 @@
 #ifndef DIGIKAM_ANTI_VIGNETTING_FILTER_H
 #define DIGIKAM_ANTI_VIGNETTING_FILTER_H
 
+// Qt includes
+
+#include <QMutex>
+#include <QVector>
+
 // Local includes
 
 #include "dimgthreadedfilter.h"
@@ -111,6 +116,7 @@ public:
 private:
 
     void           filterImage() override;
+    void           antiVignettingMultithreaded(uint start, uint stop);
 
     double         hypothenuse(double x, double y);
     uchar          clamp8bits(double x);
@@ -121,6 +127,15 @@ private:
 private:
 
     AntiVignettingContainer m_settings;
+
+    /// Attenuation for each integer distance to the center, shared by all bands of rows.
+    QVector<double>         m_attenuations;
+    int                     m_xctr;
+    int                     m_yctr;
+
+    int                     m_rowsDone;
+    int                     m_progress;
+    QMutex                  m_lock;
 };
 
 } // namespace Digikam
@@ -30,6 +30,10 @@
 #include <cmath>
 #include <cstdlib>
 
+// Qt includes
+
+#include <QtConcurrent>    // krazy:exclude=includes
+
 // Local includes
 
 #include "dimg.h"
@@ -47,6 +51,10 @@ LensDistortionFilter::LensDistortionFilter(QObject* const parent)
     m_brighten = 0.0;
     m_centre_x = 0;
     m_centre_y = 0;
+    m_rowsDone = 0;
+    m_progress = 0;
+
+    setFilterVersion(CurrentVersion());
 
     initFilter();
 }
@@ -62,6 +70,10 @@ LensDistortionFilter::LensDistortionFilter(DImg* const orgImage, QObject* const
     m_brighten = brighten;
     m_centre_x = center_x;
     m_centre_y = center_y;
+    m_rowsDone = 0;
+    m_progress = 0;
+
+    setFilterVersion(CurrentVersion());
 
     initFilter();
 }
@@ -73,15 +85,45 @@ LensDistortionFilter::~LensDistortionFilter()
 
 void LensDistortionFilter::filterImage()
 {
-    int    Width      = m_orgImage.width();
-    int    Height     = m_orgImage.height();
-    int    bytesDepth = m_orgImage.bytesDepth();
-    uchar* data       = m_destImage.bits();
-
     // initial copy
 
     m_destImage.bitBltImage(&m_orgImage, 0, 0);
 
+    m_rowsDone = 0;
+    m_progress = 0;
+
+    if (m_version == 1)
+    {
+        // Version 1 feeds the brightening factor from pixel to pixel: rows depend on each other.
+
+        lensDistortionMultithreaded(0, m_orgImage.height());
+        return;
+    }
+
+    // Rows are independent, process them by bands in parallel.
+
+    QList<int> vals = multithreadedSteps(m_orgImage.height());
+    QList <QFuture<void> > tasks;
+
+    for (int j = 0 ; runningFlag() && (j < vals.count()-1) ; ++j)
+    {
+        tasks.append(QtConcurrent::run(this,
+                                       &LensDistortionFilter::lensDistortionMultithreaded,
+                                       vals[j],
+                                       vals[j+1]
+                                      ));
+    }
+
+    foreach(QFuture<void> t, tasks)
+        t.waitForFinished();
+}
+
+void LensDistortionFilter::lensDistortionMultithreaded(uint start, uint stop)
+{
+    int    Width      = m_orgImage.width();
+    int    Height     = m_orgImage.height();
+    int    bytesDepth = m_orgImage.bytesDepth();
+
     // initialize coefficients
 
     double normallise_radius_sq = 4.0 / (Width * Width + Height * Height);
@@ -91,6 +133,9 @@ void LensDistortionFilter::filterImage()
     double mult_qd              = m_edge / 200.0;
     double rescale              = pow(2.0, - m_rescale / 100.0);
     double brighten             = - m_brighten / 10.0;
+    double factor               = brighten;
+
+    // The cubic interpolation caches source rows, so each band uses its own accessor.
     PixelAccess* pa             = new PixelAccess(&m_orgImage);
 
     /*
@@ -99,31 +144,28 @@ void LensDistortionFilter::filterImage()
      * NB: d <= image.bpp
      */
 
-    // We are working on the full image.
+    // We are working on the band of rows [start, stop[.
     int    dstWidth  = Width;
-    int    dstHeight = Height;
-    uchar* dst       = (uchar*)data;
-    int    step      = 1, progress;
+    uchar* dst       = m_destImage.scanLine(start);
+    int    progress;
 
-    int    iLimit, jLimit;
-    double srcX, srcY, mag;
+    double srcX, srcY, mag, off_y, off_y_sq;
 
-    iLimit = dstWidth  * step;
-    jLimit = dstHeight * step;
-
-    for (int dstJ = 0 ; runningFlag() && (dstJ < jLimit) ; dstJ += step)
+    for (int dstJ = start ; runningFlag() && (dstJ < (int)stop) ; ++dstJ)
     {
-        for (int dstI = 0 ; runningFlag() && (dstI < iLimit) ; dstI += step)
+        // The vertical offset does not change along the row.
+        off_y    = dstJ - center_y;
+        off_y_sq = off_y * off_y;
+
+        for (int dstI = 0 ; runningFlag() && (dstI < dstWidth) ; ++dstI)
         {
             // Get source Coordinates.
             double radius_sq;
             double off_x;
-            double off_y;
             double radius_mult;
 
             off_x       = dstI - center_x;
-            off_y       = dstJ - center_y;
-            radius_sq   = (off_x * off_x) + (off_y * off_y);
+            radius_sq   = (off_x * off_x) + off_y_sq;
 
             radius_sq  *= normallise_radius_sq;
 
@@ -134,19 +176,31 @@ void LensDistortionFilter::filterImage()
             srcX        = center_x + radius_mult * off_x;
             srcY        = center_y + radius_mult * off_y;
 
-            brighten = 1.0 + mag * brighten;
-            pa->pixelAccessGetCubic(srcX, srcY, brighten, dst);
+            if (m_version == 1)
+            {
+                factor = 1.0 + mag * factor;
+            }
+            else
+            {
+                factor = 1.0 + mag * brighten;
+            }
+
+            pa->pixelAccessGetCubic(srcX, srcY, factor, dst);
             dst += bytesDepth;
         }
 
         // Update progress bar in dialog.
 
-        progress = (int)(((double)dstJ * 100.0) / jLimit);
+        m_lock.lock();
+        progress = (int)(((double)(++m_rowsDone) * 100.0) / Height);
 
-        if (progress % 5 == 0)
+        if ((progress % 5 == 0) && (progress > m_progress))
         {
+            m_progress = progress;
             postProgress(progress);
         }
+
+        m_lock.unlock();
     }
 
     delete pa;
@@ -154,7 +208,7 @@ void LensDistortionFilter::filterImage()
 
 FilterAction LensDistortionFilter::filterAction()
 {
-    FilterAction action(FilterIdentifier(), CurrentVersion());
+    FilterAction action(FilterIdentifier(), filterVersion());
     action.setDisplayableName(DisplayableName());
 
     action.addParameter(QLatin1String("brighten"), m_brighten);
@@ -175,6 +229,8 @@ void LensDistortionFilter::readParameters(const Digikam::FilterAction& action)
     m_edge     = action.parameter(QLatin1String("edge")).toDouble();
     m_main     = action.parameter(QLatin1String("main")).toDouble();
     m_rescale  = action.parameter(QLatin1String("rescale")).toDouble();
+
+    setFilterVersion(action.version());
 }
 
 } // namespace Digikam
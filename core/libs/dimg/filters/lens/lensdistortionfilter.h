@@ -26,6 +26,10 @@
 #ifndef DIGIKAM_LENS_DISTORTION_FILTER_H
 #define DIGIKAM_LENS_DISTORTION_FILTER_H
 
+// Qt includes
+
+#include <QMutex>
+
 // Local includes
 
 #include "dimgthreadedfilter.h"
@@ -58,12 +62,12 @@ public:
 
     static QList<int>       SupportedVersions()
     {
-        return QList<int>() << 1;
+        return QList<int>() << 1 << 2;
     }
 
     static int              CurrentVersion()
     {
-        return 1;
+        return 2;
     }
 
     virtual QString         filterIdentifier() const override
@@ -71,12 +75,19 @@ public:
         return FilterIdentifier();
     }
 
+    /// Version 1 fed the brightening factor back from the previous pixel.
+    virtual QList<int>      supportedVersions() const override
+    {
+        return SupportedVersions();
+    }
+
     virtual FilterAction    filterAction() override;
     void                    readParameters(const FilterAction& action) override;
 
 private:
 
     void filterImage() override;
+    void lensDistortionMultithreaded(uint start, uint stop);
 
 private:
 
@@ -87,6 +98,10 @@ private:
     double m_edge;
     double m_rescale;
     double m_brighten;
+
+    int    m_rowsDone;
+    int    m_progress;
+    QMutex m_lock;
 };
 
 } // namespace Digikam
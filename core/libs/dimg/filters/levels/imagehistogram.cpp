@@ -32,6 +32,9 @@
 // Qt includes
 
 #include <QObject>
+#include <QVector>
+#include <QThreadPool>
+#include <QtConcurrent>    // krazy:exclude=includes
 
 // Local includes
 
@@ -68,6 +71,17 @@ public:
         valid         = false;
     }
 
+public:
+
+    /** Number of counters per histogram segment in a partial histogram (value, red, green, blue, alpha).*/
+    static const uint     channels           = 5;
+
+    /** Number of pixels processed between two checks of cancellation.*/
+    static const uint     pixelsPerCheck     = 65536;
+
+    /** Minimum number of pixels to process by one thread.*/
+    static const uint     minPixelsPerThread = 262144;
+
 public:
     /** The histogram data.*/
     struct double_packet* histogram;
@@ -172,9 +186,6 @@ void ImageHistogram::calculate()
         return;
     }
 
-    uint i;
-    int  max;
-
     emit calculationStarted();
 
     if (!d->histogram)
@@ -191,75 +202,109 @@ void ImageHistogram::calculate()
 
     memset(d->histogram, 0, d->histoSegments * sizeof(struct Private::double_packet));
 
-    if (isSixteenBit())         // 16 bits image.
-    {
-        unsigned short blue, green, red, alpha;
-        unsigned short* const data = reinterpret_cast<unsigned short*>(d->img.bits());
+    // Each thread counts a range of pixels in its own partial histogram, merged at end.
 
-        // count here instead of inside the loop, because d is not optimized because it's not defined in the header
-        const uint count = d->img.width() * d->img.height() * 4;
+    const uint count  = d->img.width() * d->img.height();
+    const uint nbCore = qBound(1, QThreadPool::globalInstance()->maxThreadCount(),
+                               (int)qMax(1U, count / Private::minPixelsPerThread));
+    const uint step   = count / nbCore;
 
-        for (i = 0 ; runningFlag() && (i < count) ; i += 4)
-        {
-            blue  = data[i    ];
-            green = data[i + 1];
-            red   = data[i + 2];
-            alpha = data[i + 3];
+    QVector<QVector<uint> > partials(nbCore);
+    QList <QFuture<void> >  tasks;
 
-            d->histogram[blue].blue++;
-            d->histogram[green].green++;
-            d->histogram[red].red++;
-            d->histogram[alpha].alpha++;
+    for (uint j = 0 ; j < nbCore ; ++j)
+    {
+        partials[j].fill(0, d->histoSegments * Private::channels);
+
+        tasks.append(QtConcurrent::run(this,
+                                       &ImageHistogram::calculateMultithreaded,
+                                       j * step,
+                                       (j == nbCore - 1) ? count : (j + 1) * step,
+                                       partials[j].data()
+                                      ));
+    }
 
-            max = (blue > green) ? blue : green;
+    foreach(QFuture<void> t, tasks)
+        t.waitForFinished();
 
-            if (red > max)
-            {
-                d->histogram[red].value++;
-            }
-            else
-            {
-                d->histogram[max].value++;
-            }
+    for (uint j = 0 ; runningFlag() && (j < nbCore) ; ++j)
+    {
+        const uint* partial = partials[j].constData();
+
+        for (int i = 0 ; i < d->histoSegments ; ++i)
+        {
+            d->histogram[i].value += partial[0];
+            d->histogram[i].red   += partial[1];
+            d->histogram[i].green += partial[2];
+            d->histogram[i].blue  += partial[3];
+            d->histogram[i].alpha += partial[4];
+            partial               += Private::channels;
         }
     }
-    else                                  // 8 bits images.
+
+    if (runningFlag())
     {
-        uchar blue, green, red, alpha;
-        const uchar* const data = d->img.bits();
+        d->valid = true;
+        emit calculationFinished(true);
+    }
+}
 
-        // count here instead of inside the loop, because d is not optimized because it's not defined in the header
-        const uint count = d->img.width() * d->img.height() * 4;
+void ImageHistogram::calculateMultithreaded(uint start, uint stop, uint* const histo)
+{
+    // The histogram of each channel is interlaced in the same way as Private::double_packet,
+    // so that all counters updated for one pixel are close in memory.
 
-        for (i = 0 ; runningFlag() && (i < count) ; i += 4)
-        {
-            blue  = data[i    ];
-            green = data[i + 1];
-            red   = data[i + 2];
-            alpha = data[i + 3];
+    const uint channels = Private::channels;
 
-            d->histogram[blue].blue++;
-            d->histogram[green].green++;
-            d->histogram[red].red++;
-            d->histogram[alpha].alpha++;
+    if (isSixteenBit())         // 16 bits image.
+    {
+        const unsigned short* data = reinterpret_cast<const unsigned short*>(d->img.bits()) + start * 4;
 
-            max = (blue > green) ? blue : green;
+        for (uint i = start ; runningFlag() && (i < stop) ; i += Private::pixelsPerCheck)
+        {
+            const uint end = qMin(stop, i + Private::pixelsPerCheck);
 
-            if (red > max)
-            {
-                d->histogram[red].value++;
-            }
-            else
+            for (uint j = i ; j < end ; ++j)
             {
-                d->histogram[max].value++;
+                const uint blue  = data[0];
+                const uint green = data[1];
+                const uint red   = data[2];
+                const uint alpha = data[3];
+
+                histo[blue  * channels + 3]++;
+                histo[green * channels + 2]++;
+                histo[red   * channels + 1]++;
+                histo[alpha * channels + 4]++;
+                histo[qMax(qMax(blue, green), red) * channels]++;
+
+                data += 4;
             }
         }
     }
-
-    if (runningFlag())
+    else                        // 8 bits images.
     {
-        d->valid = true;
-        emit calculationFinished(true);
+        const uchar* data = d->img.bits() + start * 4;
+
+        for (uint i = start ; runningFlag() && (i < stop) ; i += Private::pixelsPerCheck)
+        {
+            const uint end = qMin(stop, i + Private::pixelsPerCheck);
+
+            for (uint j = i ; j < end ; ++j)
+            {
+                const uint blue  = data[0];
+                const uint green = data[1];
+                const uint red   = data[2];
+                const uint alpha = data[3];
+
+                histo[blue  * channels + 3]++;
+                histo[green * channels + 2]++;
+                histo[red   * channels + 1]++;
+                histo[alpha * channels + 4]++;
+                histo[qMax(qMax(blue, green), red) * channels]++;
+
+                data += 4;
+            }
+        }
     }
 }
 
@@ -90,6 +90,10 @@ protected:
 
     virtual void run() override;
 
+private:
+
+    void calculateMultithreaded(uint start, uint stop, uint* const histo);
+
 private:
 
     class Private;
@@ -100,6 +100,33 @@ void LevelsFilter::filterImage()
     postProgress(90);
 }
 
+bool LevelsFilter::supportsTiledProcessing() const
+{
+    return true;
+}
+
+void LevelsFilter::prepareTiledProcessing()
+{
+    m_tileLevels.reset(new ImageLevels(m_orgImage.sixteenBit()));
+
+    for (int i = 0 ; i < 5 ; ++i)
+    {
+        m_tileLevels->setLevelLowInputValue(i,   m_settings.lInput[i]);
+        m_tileLevels->setLevelHighInputValue(i,  m_settings.hInput[i]);
+        m_tileLevels->setLevelLowOutputValue(i,  m_settings.lOutput[i]);
+        m_tileLevels->setLevelHighOutputValue(i, m_settings.hOutput[i]);
+        m_tileLevels->setLevelGammaValue(i,      m_settings.gamma[i]);
+    }
+
+    m_tileLevels->levelsCalculateTransfers();
+    m_tileLevels->levelsLutSetup(AlphaChannel);
+}
+
+void LevelsFilter::filterTile(uchar* const srcBits, uchar* const destBits, uint width, uint height, bool)
+{
+    m_tileLevels->levelsLutProcess(srcBits, destBits, width, height);
+}
+
 FilterAction LevelsFilter::filterAction()
 {
     FilterAction action(FilterIdentifier(), CurrentVersion());
@@ -25,6 +25,10 @@
 #ifndef DIGIKAM_LEVELS_FILTER_H
 #define DIGIKAM_LEVELS_FILTER_H
 
+// Qt includes
+
+#include <QScopedPointer>
+
 // Local includes
 
 #include "digikam_export.h"
@@ -35,6 +39,7 @@ namespace Digikam
 {
 
 class DImg;
+class ImageLevels;
 
 class DIGIKAM_EXPORT LevelsContainer
 {
@@ -118,9 +123,15 @@ private:
 
     void filterImage() override;
 
+    bool supportsTiledProcessing() const override;
+    void prepareTiledProcessing()        override;
+    void filterTile(uchar* const srcBits, uchar* const destBits,
+                    uint width, uint height, bool sixteenBit) override;
+
 private:
 
-    LevelsContainer m_settings;
+    LevelsContainer             m_settings;
+    QScopedPointer<ImageLevels> m_tileLevels;
 };
 
 } // namespace Digikam
@@ -0,0 +1,455 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-18
+ * Description : fused chain of per-channel point filters
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+
+#include "pointfilterchain.h"
+
+// Qt includes
+
+#include <QScopedPointer>
+#include <QThreadPool>
+#include <QtConcurrent>    // krazy:exclude=includes
+
+// Local includes
+
+#include "digikam_debug.h"
+#include "digikam_globals.h"
+#include "dimg.h"
+#include "dimgthreadedfilter.h"
+#include "dimgfiltermanager.h"
+#include "bcgfilter.h"
+#include "cbfilter.h"
+#include "curvesfilter.h"
+#include "hslfilter.h"
+#include "invertfilter.h"
+#include "levelsfilter.h"
+#include "mixerfilter.h"
+#include "wbfilter.h"
+
+namespace Digikam
+{
+
+class Q_DECL_HIDDEN PointFilterChain::Private
+{
+public:
+
+    /**
+     * A step of the chain: the lookup tables of adjacent per-channel filters,
+     * or a kernel filter mixing the channels of each pixel.
+     */
+    class Stage
+    {
+    public:
+
+        explicit Stage()
+          : kernel(nullptr)
+        {
+        }
+
+    public:
+
+        /** The lookup tables, one channel of this image per color channel. Null for a kernel.
+         */
+        DImg                ramp;
+
+        DImgThreadedFilter* kernel;
+    };
+
+public:
+
+    explicit Private()
+      : sixteenBit(false)
+    {
+    }
+
+    ~Private()
+    {
+        clearStages();
+    }
+
+    static bool isLookupFilter(const QString& filterIdentifier)
+    {
+        return ((filterIdentifier == BCGFilter::FilterIdentifier())    ||
+                (filterIdentifier == CBFilter::FilterIdentifier())     ||
+                (filterIdentifier == CurvesFilter::FilterIdentifier()) ||
+                (filterIdentifier == InvertFilter::FilterIdentifier()) ||
+                (filterIdentifier == LevelsFilter::FilterIdentifier()));
+    }
+
+    static bool isKernelFilter(const QString& filterIdentifier)
+    {
+        return ((filterIdentifier == HSLFilter::FilterIdentifier())    ||
+                (filterIdentifier == MixerFilter::FilterIdentifier())  ||
+                (filterIdentifier == WBFilter::FilterIdentifier()));
+    }
+
+    /**
+     * Return true if the filter is prepared from the content of the image it processes.
+     */
+    static bool needsImageContent(const QString& filterIdentifier)
+    {
+        // The white balance scales its multipliers down from the maxima of the channels.
+        return (filterIdentifier == WBFilter::FilterIdentifier());
+    }
+
+    static DImgThreadedFilter* createFilter(const FilterAction& action)
+    {
+        DImgThreadedFilter* const filter = DImgFilterManager::instance()->createFilter(action.identifier(),
+                                                                                      action.version());
+
+        if (!filter)
+        {
+            return nullptr;
+        }
+
+        filter->readParameters(action);
+
+        if (!filter->parametersSuccessfullyRead())
+        {
+            delete filter;
+            return nullptr;
+        }
+
+        return filter;
+    }
+
+    /**
+     * Return an identity ramp: pixel at position v holds v on all channels.
+     */
+    static DImg identityRamp(bool sixteen)
+    {
+        const int segments = sixteen ? NUM_SEGMENTS_16BIT : NUM_SEGMENTS_8BIT;
+        DImg ramp(segments, 1, sixteen, true);
+
+        if (sixteen)
+        {
+            unsigned short* ptr = reinterpret_cast<unsigned short*>(ramp.bits());
+
+            for (int v = 0 ; v < segments ; ++v)
+            {
+                ptr[0] = v;
+                ptr[1] = v;
+                ptr[2] = v;
+                ptr[3] = v;
+                ptr   += 4;
+            }
+        }
+        else
+        {
+            uchar* ptr = ramp.bits();
+
+            for (int v = 0 ; v < segments ; ++v)
+            {
+                ptr[0] = v;
+                ptr[1] = v;
+                ptr[2] = v;
+                ptr[3] = v;
+                ptr   += 4;
+            }
+        }
+
+        return ramp;
+    }
+
+    static void applyLookupTables(const DImg& ramp, uchar* const bits, uint count, bool sixteen)
+    {
+        if (sixteen)
+        {
+            const unsigned short* const lut = reinterpret_cast<const unsigned short*>(ramp.bits());
+            unsigned short* ptr             = reinterpret_cast<unsigned short*>(bits);
+
+            for (uint i = 0 ; i < count ; ++i)
+            {
+                ptr[0] = lut[ptr[0] * 4    ];
+                ptr[1] = lut[ptr[1] * 4 + 1];
+                ptr[2] = lut[ptr[2] * 4 + 2];
+                ptr[3] = lut[ptr[3] * 4 + 3];
+                ptr   += 4;
+            }
+        }
+        else
+        {
+            const uchar* const lut = ramp.bits();
+            uchar* ptr             = bits;
+
+            for (uint i = 0 ; i < count ; ++i)
+            {
+                ptr[0] = lut[ptr[0] * 4    ];
+                ptr[1] = lut[ptr[1] * 4 + 1];
+                ptr[2] = lut[ptr[2] * 4 + 2];
+                ptr[3] = lut[ptr[3] * 4 + 3];
+                ptr   += 4;
+            }
+        }
+    }
+
+    void clearStages()
+    {
+        foreach (const Stage& stage, stages)
+        {
+            delete stage.kernel;
+        }
+
+        stages.clear();
+        pendingActions.clear();
+    }
+
+public:
+
+    /** Size of the bands of rows processed by apply(), to keep each band in the cache
+     *  while it goes through all the stages.
+     */
+    static const size_t bandBytes = 1024 * 1024;
+
+public:
+
+    /** The color depth the stages are prepared for.
+     */
+    bool                sixteenBit;
+
+    QList<Stage>        stages;
+
+    /** The actions of all the filters chained, and of the ones not applied to the image yet.
+     */
+    QList<FilterAction> actions;
+    QList<FilterAction> pendingActions;
+};
+
+PointFilterChain::PointFilterChain()
+    : d(new Private)
+{
+}
+
+PointFilterChain::~PointFilterChain()
+{
+    delete d;
+}
+
+bool PointFilterChain::isSupported(const QString& filterIdentifier)
+{
+    return (Private::isLookupFilter(filterIdentifier) || Private::isKernelFilter(filterIdentifier));
+}
+
+bool PointFilterChain::addFilter(DImgThreadedFilter* const filter, DImg& image)
+{
+    if (!filter || image.isNull() || !isSupported(filter->filterIdentifier()))
+    {
+        return false;
+    }
+
+    if (!d->stages.isEmpty() && (d->sixteenBit != image.sixteenBit()))
+    {
+        rebuildStages(image);
+    }
+
+    const FilterAction action = filter->filterAction();
+
+    if (Private::isLookupFilter(action.identifier()))
+    {
+        // As the filter maps each channel independently, running it on the ramp
+        // composes its lookup table with the ones of the filters chained before.
+
+        DImg ramp = (d->stages.isEmpty() || d->stages.last().kernel) ? Private::identityRamp(image.sixteenBit())
+                                                                      : d->stages.last().ramp.copy();
+
+        filter->setupFilter(ramp);
+        filter->startFilterDirectly();
+
+        DImg result = filter->getTargetImage();
+
+        if (result.isNull()                        ||
+            (result.width()      != ramp.width())  ||
+            (result.sixteenBit() != ramp.sixteenBit()))
+        {
+            qCWarning(DIGIKAM_DIMG_LOG) << "Cannot chain filter" << action.identifier();
+            return false;
+        }
+
+        if (d->stages.isEmpty() || d->stages.last().kernel)
+        {
+            d->stages << Private::Stage();
+        }
+
+        d->stages.last().ramp = result;
+    }
+    else
+    {
+        // The chain runs its own instance of the kernel, the filter given can be destroyed after this call.
+
+        QScopedPointer<DImgThreadedFilter> kernel(Private::createFilter(action));
+
+        if (!kernel || !kernel->supportsTiledProcessing() || (kernel->tileOverlap() != 0))
+        {
+            qCWarning(DIGIKAM_DIMG_LOG) << "Cannot chain filter" << action.identifier();
+            return false;
+        }
+
+        if (Private::needsImageContent(action.identifier()) && !d->stages.isEmpty())
+        {
+            applyStages(image);
+        }
+
+        // Progress of the bands processed concurrently is not relevant.
+
+        kernel->m_tilesInProgress.store(1);
+        kernel->setOriginalImage(image);
+        kernel->prepareTiledProcessing();
+        kernel->setOriginalImage(DImg());
+
+        Private::Stage stage;
+        stage.kernel = kernel.take();
+        d->stages << stage;
+    }
+
+    d->sixteenBit      = image.sixteenBit();
+    d->actions        << action;
+    d->pendingActions << action;
+
+    return true;
+}
+
+bool PointFilterChain::addFilterAction(const FilterAction& action, DImg& image)
+{
+    if (action.isNull() || !isSupported(action.identifier()))
+    {
+        return false;
+    }
+
+    QScopedPointer<DImgThreadedFilter> filter(Private::createFilter(action));
+
+    if (!filter)
+    {
+        return false;
+    }
+
+    return addFilter(filter.data(), image);
+}
+
+QList<FilterAction> PointFilterChain::filterActions() const
+{
+    return d->actions;
+}
+
+bool PointFilterChain::isEmpty() const
+{
+    return d->actions.isEmpty();
+}
+
+int PointFilterChain::count() const
+{
+    return d->actions.count();
+}
+
+void PointFilterChain::clear()
+{
+    d->clearStages();
+    d->actions.clear();
+}
+
+void PointFilterChain::apply(DImg& image)
+{
+    if (d->stages.isEmpty())
+    {
+        clear();
+        return;
+    }
+
+    if (image.isNull())
+    {
+        qCWarning(DIGIKAM_DIMG_LOG) << "Cannot apply" << d->pendingActions.count() << "chained filters to a null image";
+        clear();
+        return;
+    }
+
+    if (image.sixteenBit() != d->sixteenBit)
+    {
+        rebuildStages(image);
+    }
+
+    applyStages(image);
+    clear();
+}
+
+void PointFilterChain::applyStages(DImg& image)
+{
+    const uint   width     = image.width();
+    const uint   height    = image.height();
+    const bool   sixteen   = image.sixteenBit();
+    const size_t lineBytes = (size_t)width * image.bytesDepth();
+    const uint   rows      = qMax((size_t)1, Private::bandBytes / qMax((size_t)1, lineBytes));
+
+    QList <QFuture<void> > tasks;
+
+    for (uint y = 0 ; y < height ; y += rows)
+    {
+        tasks.append(QtConcurrent::run(this,
+                                       &PointFilterChain::applyBand,
+                                       image.scanLine(y),
+                                       width,
+                                       qMin(rows, height - y),
+                                       sixteen
+                                      ));
+    }
+
+    foreach(QFuture<void> t, tasks)
+        t.waitForFinished();
+
+    qCDebug(DIGIKAM_DIMG_LOG) << "Applied" << d->pendingActions.count() << "chained point filters in"
+                              << d->stages.count() << "stages in one pass";
+
+    d->clearStages();
+}
+
+void PointFilterChain::rebuildStages(DImg& image)
+{
+    qCDebug(DIGIKAM_DIMG_LOG) << "Prepare the chained filters again for a" << image.bytesDepth() << "bytes depth";
+
+    const QList<FilterAction> pending = d->pendingActions;
+    d->clearStages();
+    d->actions = d->actions.mid(0, d->actions.count() - pending.count());
+
+    foreach (const FilterAction& action, pending)
+    {
+        if (!addFilterAction(action, image))
+        {
+            qCWarning(DIGIKAM_DIMG_LOG) << "Cannot chain filter" << action.identifier() << "again";
+        }
+    }
+}
+
+void PointFilterChain::applyBand(uchar* const bits, uint width, uint rows, bool sixteenBit)
+{
+    foreach (const Private::Stage& stage, d->stages)
+    {
+        if (stage.kernel)
+        {
+            stage.kernel->filterTile(bits, bits, width, rows, sixteenBit);
+        }
+        else
+        {
+            Private::applyLookupTables(stage.ramp, bits, width * rows, sixteenBit);
+        }
+    }
+}
+
+} // namespace Digikam
@@ -0,0 +1,127 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-18
+ * Description : fused chain of per-channel point filters
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+
+#ifndef DIGIKAM_POINT_FILTER_CHAIN_H
+#define DIGIKAM_POINT_FILTER_CHAIN_H
+
+// Qt includes
+
+#include <QList>
+#include <QString>
+
+// Local includes
+
+#include "digikam_export.h"
+#include "filteraction.h"
+
+namespace Digikam
+{
+
+class DImg;
+class DImgThreadedFilter;
+
+/**
+ * A chain of filters which compute each pixel from the pixel alone, applied to the image in a single pass.
+ *
+ * The filters which map each color channel independently of the others (brightness/contrast/gamma,
+ * curves, levels, color balance, invert) are not run on the image. Each one is run instead on a ramp
+ * image holding all possible values of a channel, which gives the lookup table of the filter. The lookup
+ * tables of adjacent filters are composed this way.
+ *
+ * The filters which mix the channels of a pixel (hue/saturation/lightness, white balance, channel mixer)
+ * are kept as kernels, run with their tiled processing methods.
+ *
+ * apply() processes the image by bands of rows, in parallel. Each band goes through all the lookup tables
+ * and kernels of the chain while it is in the cache. The result is identical to running the filters one
+ * after another.
+ */
+class DIGIKAM_EXPORT PointFilterChain
+{
+public:
+
+    explicit PointFilterChain();
+    ~PointFilterChain();
+
+    /**
+     * Return true if the filter identified by filterIdentifier computes each pixel from the pixel alone,
+     * and can be added to a chain.
+     */
+    static bool isSupported(const QString& filterIdentifier);
+
+    /**
+     * Add a filter at end of chain. The filter must be configured with its parameters, its original image
+     * is not used and can be null. image is the image which the chain is applied to by apply(), as it is
+     * before the pending filters of the chain. The filters which are prepared from the content of the
+     * image they process, as the white balance with its channels maxima, are prepared on the image after
+     * the pending filters are applied to it. Return false if the filter is not supported.
+     */
+    bool addFilter(DImgThreadedFilter* const filter, DImg& image);
+
+    /**
+     * Same as addFilter(), with a filter created from a FilterAction.
+     */
+    bool addFilterAction(const FilterAction& action, DImg& image);
+
+    /**
+     * Return the filter actions of all filters chained, as regenerated by the filters.
+     */
+    QList<FilterAction> filterActions() const;
+
+    bool isEmpty() const;
+    int  count()   const;
+    void clear();
+
+    /**
+     * Apply all chained filters on image in a single pass, and clear the chain.
+     * If the color depth of image changed since the filters were added, the lookup tables and
+     * the kernels are prepared again for the new depth. Nothing is done if the chain is empty.
+     */
+    void apply(DImg& image);
+
+private:
+
+    PointFilterChain(const PointFilterChain&);            // Disable
+    PointFilterChain& operator=(const PointFilterChain&); // Disable
+
+    /**
+     * Apply the pending lookup tables and kernels to image, and remove them from the chain.
+     */
+    void applyStages(DImg& image);
+
+    /**
+     * Prepare the lookup tables and the kernels of the pending filters again, for the color depth of image.
+     */
+    void rebuildStages(DImg& image);
+
+    void applyBand(uchar* const bits, uint width, uint rows, bool sixteenBit);
+
+private:
+
+    class Private;
+    Private* const d;
+};
+
+} // namespace Digikam
+
+#endif // DIGIKAM_POINT_FILTER_CHAIN_H
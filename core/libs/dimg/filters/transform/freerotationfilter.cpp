@@ -30,6 +30,11 @@
 #include <cmath>
 #include <cstdlib>
 
+// Qt includes
+
+#include <QtConcurrent>    // krazy:exclude=includes
+#include <QMutex>
+
 // Local includes
 
 #include "dimg.h"
@@ -44,10 +49,30 @@ class Q_DECL_HIDDEN FreeRotationFilter::Private
 public:
 
     explicit Private()
+      : lfSin(0.0),
+        lfCos(0.0),
+        nhdx(0),
+        nhdy(0),
+        nhsx(0),
+        nhsy(0),
+        rowsDone(0),
+        progress(0)
     {
     }
 
     FreeRotationContainer settings;
+
+    // Rotation parameters shared by the bands of rows processed in parallel.
+    double                lfSin;
+    double                lfCos;
+    int                   nhdx;
+    int                   nhdy;
+    int                   nhsx;
+    int                   nhsy;
+
+    int                   rowsDone;
+    int                   progress;
+    QMutex                lock;
 };
 
 FreeRotationFilter::FreeRotationFilter(QObject* const parent)
@@ -130,18 +155,13 @@ double FreeRotationFilter::calculateAngle(const QPoint& p1, const QPoint& p2)
 
 void FreeRotationFilter::filterImage()
 {
-    int          progress;
-   int w, h, nw, nh, j, i = 0;
     int          nNewHeight, nNewWidth;
     int          nhdx, nhdy, nhsx, nhsy;
-    double       lfSin, lfCos, lfx, lfy;
+    double       lfSin, lfCos;
 
     int nWidth  = m_orgImage.width();
     int nHeight = m_orgImage.height();
 
-    uchar* pBits            = m_orgImage.bits();
-    unsigned short* pBits16 = reinterpret_cast<unsigned short*>(m_orgImage.bits());
-
     // first of all, we need to calculate the sin and cos of the given angle
 
     lfSin = sin(d->settings.angle * -DEG2RAD);
@@ -182,70 +202,32 @@ void FreeRotationFilter::filterImage()
 
     m_destImage.fill(DColor(d->settings.backgroundColor.rgb(), sixteenBit));
 
-    uchar* pResBits            = m_destImage.bits();
-    unsigned short* pResBits16 = reinterpret_cast<unsigned short*>(m_destImage.bits());
+    d->lfSin      = lfSin;
+    d->lfCos      = lfCos;
+    d->nhdx       = nhdx;
+    d->nhdy       = nhdy;
+    d->nhsx       = nhsx;
+    d->nhsy       = nhsy;
+    d->rowsDone   = 0;
+    d->progress   = 0;
 
-    PixelsAliasFilter alias;
+    // main loop, processed by bands of rows in parallel
 
-    // main loop
+    QList<int> vals = multithreadedSteps(nNewHeight);
+    QList <QFuture<void> > tasks;
 
-    for (h = 0; runningFlag() && (h < nNewHeight); ++h)
+    for (int k = 0 ; runningFlag() && (k < vals.count()-1) ; ++k)
     {
-        nh = h - nhdy;
-
-        for (w = 0; runningFlag() && (w < nNewWidth); ++w)
-        {
-            nw = w - nhdx;
-
-            i = setPosition(nNewWidth, w, h);
-
-            lfx = (double)nw * lfCos - (double)nh * lfSin + nhsx;
-            lfy = (double)nw * lfSin + (double)nh * lfCos + nhsy;
-
-            if (isInside(nWidth, nHeight, (int)lfx, (int)lfy))
-            {
-                if (d->settings.antiAlias)
-                {
-                    if (!sixteenBit)
-                        alias.pixelAntiAliasing(pBits, nWidth, nHeight, lfx, lfy,
-                                                &pResBits[i + 3], &pResBits[i + 2],
-                                                &pResBits[i + 1], &pResBits[i]);
-                    else
-                        alias.pixelAntiAliasing16(pBits16, nWidth, nHeight, lfx, lfy,
-                                                  &pResBits16[i + 3], &pResBits16[i + 2],
-                                                  &pResBits16[i + 1], &pResBits16[i]);
-                }
-                else
-                {
-                    j = setPosition(nWidth, (int)lfx, (int)lfy);
-
-                    for (int p = 0 ; p < 4 ; ++p)
-                    {
-                        if (!sixteenBit)
-                        {
-                            pResBits[i] = pBits[j];
-                        }
-                        else
-                        {
-                            pResBits16[i] = pBits16[j];
-                        }
-
-                        ++i;
-                        ++j;
-                    }
-                }
-            }
-        }
-
-        // Update the progress bar in dialog.
-        progress = (int)(((double) h * 100.0) / nNewHeight);
-
-        if (progress % 5 == 0)
-        {
-            postProgress(progress);
-        }
+        tasks.append(QtConcurrent::run(this,
+                                       &FreeRotationFilter::rotateMultithreaded,
+                                       vals[k],
+                                       vals[k+1]
+                                      ));
     }
 
+    foreach(QFuture<void> t, tasks)
+        t.waitForFinished();
+
     // Compute the rotated destination image size using original image dimensions.
     int    W, H;
     double absAngle = fabs(d->settings.angle);
@@ -377,6 +359,90 @@ void FreeRotationFilter::filterImage()
     }
 }
 
+void FreeRotationFilter::rotateMultithreaded(uint start, uint stop)
+{
+    int    i, j, nw, nh;
+    int    progress;
+    double lfx, lfy, lfhSin, lfhCos;
+
+    int nWidth                 = m_orgImage.width();
+    int nHeight                = m_orgImage.height();
+    int nNewWidth              = m_destImage.width();
+    bool sixteenBit            = m_orgImage.sixteenBit();
+
+    uchar* pBits               = m_orgImage.bits();
+    unsigned short* pBits16    = reinterpret_cast<unsigned short*>(m_orgImage.bits());
+    uchar* pResBits            = m_destImage.bits();
+    unsigned short* pResBits16 = reinterpret_cast<unsigned short*>(m_destImage.bits());
+
+    PixelsAliasFilter alias;
+
+    for (uint h = start ; runningFlag() && (h < stop) ; ++h)
+    {
+        nh     = h - d->nhdy;
+
+        // The row terms of the source coordinates do not change along the row.
+        lfhSin = (double)nh * d->lfSin;
+        lfhCos = (double)nh * d->lfCos;
+
+        for (int w = 0 ; runningFlag() && (w < nNewWidth) ; ++w)
+        {
+            nw = w - d->nhdx;
+
+            i = setPosition(nNewWidth, w, h);
+
+            lfx = (double)nw * d->lfCos - lfhSin + d->nhsx;
+            lfy = (double)nw * d->lfSin + lfhCos + d->nhsy;
+
+            if (isInside(nWidth, nHeight, (int)lfx, (int)lfy))
+            {
+                if (d->settings.antiAlias)
+                {
+                    if (!sixteenBit)
+                        alias.pixelAntiAliasing(pBits, nWidth, nHeight, lfx, lfy,
+                                                &pResBits[i + 3], &pResBits[i + 2],
+                                                &pResBits[i + 1], &pResBits[i]);
+                    else
+                        alias.pixelAntiAliasing16(pBits16, nWidth, nHeight, lfx, lfy,
+                                                  &pResBits16[i + 3], &pResBits16[i + 2],
+                                                  &pResBits16[i + 1], &pResBits16[i]);
+                }
+                else
+                {
+                    j = setPosition(nWidth, (int)lfx, (int)lfy);
+
+                    for (int p = 0 ; p < 4 ; ++p)
+                    {
+                        if (!sixteenBit)
+                        {
+                            pResBits[i] = pBits[j];
+                        }
+                        else
+                        {
+                            pResBits16[i] = pBits16[j];
+                        }
+
+                        ++i;
+                        ++j;
+                    }
+                }
+            }
+        }
+
+        // Update the progress bar in dialog.
+        d->lock.lock();
+        progress = (int)(((double)(++d->rowsDone) * 100.0) / m_destImage.height());
+
+        if ((progress % 5 == 0) && (progress > d->progress))
+        {
+            d->progress = progress;
+            postProgress(progress);
+        }
+
+        d->lock.unlock();
+    }
+}
+
 int FreeRotationFilter::setPosition(int Width, int X, int Y)
 {
     return (Y * Width * 4 + 4 * X);
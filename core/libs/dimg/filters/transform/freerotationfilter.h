@@ -128,6 +128,8 @@ public:
 private:
 
     void        filterImage() override;
+    void        rotateMultithreaded(uint start, uint stop);
+
     inline int  setPosition (int Width, int X, int Y);
     inline bool isInside (int Width, int Height, int X, int Y);
 
@@ -32,6 +32,11 @@
 #include <cmath>
 #include <cstdlib>
 
+// Qt includes
+
+#include <QtConcurrent>    // krazy:exclude=includes
+#include <QMutex>
+
 // Local includes
 
 #include "digikam_globals.h"
@@ -53,6 +58,12 @@ public:
         hAngle          = 0;
         vAngle          = 0;
         backgroundColor = Qt::black;
+        dx              = 0.0;
+        dy              = 0.0;
+        horzFactor      = 0.0;
+        vertFactor      = 0.0;
+        rowsDone        = 0;
+        progress        = 0;
     }
 
     bool   antiAlias;
@@ -66,6 +77,16 @@ public:
     QColor backgroundColor;
 
     QSize  newSize;
+
+    // Shear parameters shared by the bands of rows processed in parallel.
+    double dx;
+    double dy;
+    double horzFactor;
+    double vertFactor;
+
+    int    rowsDone;
+    int    progress;
+    QMutex lock;
 };
 
 ShearFilter::ShearFilter(QObject* const parent)
@@ -102,18 +123,14 @@ QSize ShearFilter::getNewSize() const
 
 void ShearFilter::filterImage()
 {
-    int          progress;
-   int x, y, p = 0, pt;
     int          new_width, new_height;
-    double       nx, ny, dx, dy;
+    double       dx, dy;
     double       horz_factor, vert_factor;
     double       horz_add, vert_add;
     double       horz_beta_angle, vert_beta_angle;
 
-    int nWidth              = m_orgImage.width();
-    int nHeight             = m_orgImage.height();
-    uchar* pBits            = m_orgImage.bits();
-    unsigned short* pBits16 = reinterpret_cast<unsigned short*>(m_orgImage.bits());
+    int nWidth  = m_orgImage.width();
+    int nHeight = m_orgImage.height();
 
     // get beta ( complementary ) angle for horizontal and vertical angles
     horz_beta_angle = (((d->hAngle < 0.0) ? 180.0 : 90.0) - d->hAngle) * DEG2RAD;
@@ -167,18 +184,68 @@ void ShearFilter::filterImage()
     m_destImage     = DImg(new_width, new_height, sixteenBit, m_orgImage.hasAlpha());
     m_destImage.fill(DColor(d->backgroundColor.rgb(), sixteenBit));
 
+    d->dx         = dx;
+    d->dy         = dy;
+    d->horzFactor = horz_factor;
+    d->vertFactor = vert_factor;
+    d->rowsDone   = 0;
+    d->progress   = 0;
+
+    // main loop, processed by bands of rows in parallel
+
+    QList<int> vals = multithreadedSteps(new_height);
+    QList <QFuture<void> > tasks;
+
+    for (int j = 0 ; runningFlag() && (j < vals.count()-1) ; ++j)
+    {
+        tasks.append(QtConcurrent::run(this,
+                                       &ShearFilter::shearMultithreaded,
+                                       vals[j],
+                                       vals[j+1]
+                                      ));
+    }
+
+    foreach(QFuture<void> t, tasks)
+        t.waitForFinished();
+
+    // To compute the rotated destination image size using original image dimensions.
+    int W = (int)(fabs(d->orgH * ((d->hAngle < 0.0) ? sin(horz_beta_angle) : cos(horz_beta_angle)))) + d->orgW;
+    int H = (int)(fabs(d->orgW * ((d->vAngle < 0.0) ? sin(vert_beta_angle) : cos(vert_beta_angle)))) + d->orgH;
+
+    d->newSize.setWidth(W);
+    d->newSize.setHeight(H);
+}
+
+void ShearFilter::shearMultithreaded(uint start, uint stop)
+{
+    int    p, pt, progress;
+    double nx, ny, nxRow, nyRow;
+
+    int nWidth                 = m_orgImage.width();
+    int nHeight                = m_orgImage.height();
+    int new_width              = m_destImage.width();
+    bool sixteenBit            = m_orgImage.sixteenBit();
+
+    uchar* pBits               = m_orgImage.bits();
+    unsigned short* pBits16    = reinterpret_cast<unsigned short*>(m_orgImage.bits());
     uchar* pResBits            = m_destImage.bits();
     unsigned short* pResBits16 = reinterpret_cast<unsigned short*>(m_destImage.bits());
 
     PixelsAliasFilter alias;
 
-    for (y = 0; y < new_height; ++y)
+    for (uint y = start ; runningFlag() && (y < stop) ; ++y)
     {
-        for (x = 0; x < new_width; ++x, p += 4)
+        p     = setPosition(new_width, 0, y);
+
+        // The row terms of the new positions do not change along the row.
+        nxRow = y * d->horzFactor;
+        nyRow = y + d->dy;
+
+        for (int x = 0 ; x < new_width ; ++x, p += 4)
         {
             // get new positions
-            nx = x + dx + y * horz_factor;
-            ny = y + dy + x * vert_factor;
+            nx = x + d->dx + nxRow;
+            ny = nyRow + x * d->vertFactor;
 
             // if is inside the source image
             if (isInside(nWidth, nHeight, lround(nx), lround(ny)))
@@ -214,20 +281,17 @@ void ShearFilter::filterImage()
         }
 
         // Update the progress bar in dialog.
-        progress = (int)(((double)y * 100.0) / new_height);
+        d->lock.lock();
+        progress = (int)(((double)(++d->rowsDone) * 100.0) / m_destImage.height());
 
-        if (progress % 5 == 0)
+        if ((progress % 5 == 0) && (progress > d->progress))
         {
+            d->progress = progress;
             postProgress(progress);
         }
-    }
-
-    // To compute the rotated destination image size using original image dimensions.
-    int W = (int)(fabs(d->orgH * ((d->hAngle < 0.0) ? sin(horz_beta_angle) : cos(horz_beta_angle)))) + d->orgW;
-    int H = (int)(fabs(d->orgW * ((d->vAngle < 0.0) ? sin(vert_beta_angle) : cos(vert_beta_angle)))) + d->orgH;
 
-    d->newSize.setWidth(W);
-    d->newSize.setHeight(H);
+        d->lock.unlock();
+    }
 }
 
 FilterAction ShearFilter::filterAction()
@@ -82,6 +82,7 @@ public:
 private:
 
     void filterImage() override;
+    void shearMultithreaded(uint start, uint stop);
 
     inline int setPosition (int Width, int X, int Y)
     {
@@ -110,6 +110,30 @@ WBFilter::~WBFilter()
 }
 
 void WBFilter::filterImage()
+{
+    prepareWhiteBalance();
+
+    // Apply White balance adjustments.
+    adjustWhiteBalance(m_orgImage.bits(), m_orgImage.width(), m_orgImage.height(), m_orgImage.sixteenBit());
+    m_destImage = m_orgImage;
+}
+
+bool WBFilter::supportsTiledProcessing() const
+{
+    return true;
+}
+
+void WBFilter::prepareTiledProcessing()
+{
+    prepareWhiteBalance();
+}
+
+void WBFilter::filterTile(uchar* const srcBits, uchar* const, uint width, uint height, bool sixteenBit)
+{
+    adjustWhiteBalance(srcBits, width, height, sixteenBit);
+}
+
+void WBFilter::prepareWhiteBalance()
 {
     d->WP      = m_orgImage.sixteenBit() ? 65536 : 256;
     d->rgbMax  = m_orgImage.sixteenBit() ? 65536 : 256;
@@ -137,10 +161,6 @@ void WBFilter::filterImage()
     }
 
     preventAutoExposure(m_settings.maxr, m_settings.maxg, m_settings.maxb);
-
-    // Apply White balance adjustments.
-    adjustWhiteBalance(m_orgImage.bits(), m_orgImage.width(), m_orgImage.height(), m_orgImage.sixteenBit());
-    m_destImage = m_orgImage;
 }
 
 void WBFilter::autoWBAdjustementFromColor(const QColor& tc, double& temperature, double& green)
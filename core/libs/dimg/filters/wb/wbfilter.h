@@ -90,12 +90,18 @@ protected:
 
     void filterImage() override;
 
+    bool supportsTiledProcessing() const override;
+    void prepareTiledProcessing()        override;
+    void filterTile(uchar* const srcBits, uchar* const destBits,
+                    uint width, uint height, bool sixteenBit) override;
+
 protected:
 
     WBContainer m_settings;
 
 private:
 
+    void prepareWhiteBalance();
     void setRGBmult();
     void setLUTv();
     void adjustWhiteBalance(uchar* const data, int width, int height, bool sixteenBit);
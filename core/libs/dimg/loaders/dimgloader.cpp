@@ -372,6 +372,36 @@ QByteArray DImgLoader::uniqueHashV2(const QString& filePath, const DImg* const i
     return hash;
 }
 
+QByteArray DImgLoader::uniqueHashV2FromData(const QByteArray& fileData, const DImg* const img)
+{
+    if (fileData.isNull())
+    {
+        return QByteArray();
+    }
+
+    QCryptographicHash md5(QCryptographicHash::Md5);
+
+    // Same parts of the file as uniqueHashV2(): first and last 100 kB, limited to file size
+
+    const int specifiedSize = 100 * 1024; // 100 kB
+    const int size          = qMin(fileData.size(), specifiedSize);
+
+    if (size)
+    {
+        md5.addData(fileData.constData(), size);
+        md5.addData(fileData.constData() + fileData.size() - size, size);
+    }
+
+    QByteArray hash = md5.result().toHex();
+
+    if (img && !hash.isNull())
+    {
+        const_cast<DImg*>(img)->setAttribute(QString::fromUtf8("uniqueHashV2"), hash);
+    }
+
+    return hash;
+}
+
 QByteArray DImgLoader::uniqueHash(const QString& filePath, const DImg& img, bool loadMetadata)
 {
     QByteArray bv;
@@ -79,6 +79,7 @@ public:
     virtual bool isReadOnly()    const = 0;
 
     static QByteArray     uniqueHashV2(const QString& filePath, const DImg* const img = nullptr);
+    static QByteArray     uniqueHashV2FromData(const QByteArray& fileData, const DImg* const img = nullptr);
     static QByteArray     uniqueHash(const QString& filePath, const DImg& img, bool loadMetadata);
     static HistoryImageId createHistoryImageId(const QString& filePath, const DImg& img, const DMetadata& metadata);
 
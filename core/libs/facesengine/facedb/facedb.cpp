@@ -825,4 +825,9 @@ void FaceDb::vacuum()
     d->db->execDBAction(d->db->getDBAction(QString::fromUtf8("vacuumRecognitionDB")));
 }
 
+void FaceDb::optimize()
+{
+    d->db->execDBAction(d->db->getDBAction(QString::fromUtf8("optimizeRecognitionDB")));
+}
+
 } // namespace Digikam
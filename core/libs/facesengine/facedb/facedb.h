@@ -107,6 +107,11 @@ public:
      */
     void vacuum();
 
+    /**
+     * Refreshes the statistics used by the query planner.
+     */
+    void optimize();
+
 private:
 
     FaceDb(const FaceDb&); // Disable
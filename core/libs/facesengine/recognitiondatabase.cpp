@@ -1183,4 +1183,16 @@ void RecognitionDatabase::vacuum()
     return FaceDbAccess().db()->vacuum();
 }
 
+void RecognitionDatabase::optimize()
+{
+    if (!d || !d->dbAvailable)
+    {
+        return;
+    }
+
+    QMutexLocker lock(&d->mutex);
+
+    return FaceDbAccess().db()->optimize();
+}
+
 } // namespace Digikam
@@ -224,6 +224,11 @@ public:
      */
     void vacuum();
 
+    /**
+     * Refreshes the statistics used by the query planner.
+     */
+    void optimize();
+
 public:
 
     // Declared as public to please with Clang compiler, due to use as argument with static methods.
@@ -83,7 +83,7 @@ void FileActionMngrDatabaseWorker::changeTags(FileActionItemInfoList infos,
 
             hub.write(info, DisjointMetadata::PartialWrite);
 
-            if (hub.willWriteMetadata(DisjointMetadata::FullWriteIfChanged) && d->shallSendForWriting(info.id()))
+            if (hub.willWriteMetadata(DisjointMetadata::FullWriteIfChanged) && d->shallSendForWriting(info.id(), MetadataHub::WRITE_TAGS))
             {
                 forWriting << info;
             }
@@ -130,7 +130,7 @@ void FileActionMngrDatabaseWorker::assignPickLabel(FileActionItemInfoList infos,
             hub.setPickLabel(pickId);
             hub.write(info, DisjointMetadata::PartialWrite);
 
-            if (hub.willWriteMetadata(DisjointMetadata::FullWriteIfChanged) && d->shallSendForWriting(info.id()))
+            if (hub.willWriteMetadata(DisjointMetadata::FullWriteIfChanged) && d->shallSendForWriting(info.id(), MetadataHub::WRITE_PICKLABEL))
             {
                 forWriting << info;
             }
@@ -175,7 +175,7 @@ void FileActionMngrDatabaseWorker::assignColorLabel(FileActionItemInfoList infos
             hub.setColorLabel(colorId);
             hub.write(info, DisjointMetadata::PartialWrite);
 
-            if (hub.willWriteMetadata(DisjointMetadata::FullWriteIfChanged) && d->shallSendForWriting(info.id()))
+            if (hub.willWriteMetadata(DisjointMetadata::FullWriteIfChanged) && d->shallSendForWriting(info.id(), MetadataHub::WRITE_COLORLABEL))
             {
                 forWriting << info;
             }
@@ -221,7 +221,7 @@ void FileActionMngrDatabaseWorker::assignRating(FileActionItemInfoList infos, in
             hub.setRating(rating);
             hub.write(info, DisjointMetadata::PartialWrite);
 
-            if (hub.willWriteMetadata(DisjointMetadata::FullWriteIfChanged) && d->shallSendForWriting(info.id()))
+            if (hub.willWriteMetadata(DisjointMetadata::FullWriteIfChanged) && d->shallSendForWriting(info.id(), MetadataHub::WRITE_RATING))
             {
                 forWriting << info;
             }
@@ -21,9 +21,14 @@
  *
  * ============================================================ */
 
+#include "fileactionimageinfolist.h"
+
+// KDE includes
+
+#include <klocalizedstring.h>
+
 // Local includes
 
-#include "fileactionimageinfolist.h"
 #include "digikam_debug.h"
 #include "progressmanager.h"
 
@@ -106,6 +111,19 @@ void FileActionProgressItemContainer::written(int numberOfInfos)
     advance(secondItem, numberOfInfos);
 }
 
+void FileActionProgressItemContainer::unchanged(int numberOfInfos)
+{
+    const int count          = unchangedItems.fetchAndAddOrdered(numberOfInfos) + numberOfInfos;
+    ProgressItem* const item = secondItem;
+
+    if (item)
+    {
+        item->setStatus(i18np("%1 file already up to date", "%1 files already up to date", count));
+    }
+
+    advance(secondItem, numberOfInfos);
+}
+
 void FileActionProgressItemContainer::finishedWriting()
 {
 //    checkFinish(secondItem);
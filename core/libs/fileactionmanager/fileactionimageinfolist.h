@@ -79,8 +79,13 @@ public:
     void dbFinished();
     void schedulingForWrite(int numberOfInfos, const QString& action, FileActionProgressItemCreator* const creator);
     void written(int numberOfInfos);
+    void unchanged(int numberOfInfos);
     void finishedWriting();
 
+private:
+
+    QAtomicInt unchangedItems;
+
 Q_SIGNALS:
 
     void signalWrittingDone();
@@ -152,6 +157,9 @@ public:
     /// file worker calls this when finished
     void writtenToOne()             { written(1);                         }
     void written(int numberOfInfos) { progress()->written(numberOfInfos); }
+
+    /// file worker calls this when the file was not rewritten, as its metadata were already up to date
+    void unchangedOne()             { progress()->unchanged(1);           }
     void finishedWriting()          { progress()->finishedWriting();      }
 
     QExplicitlySharedDataPointer<FileActionProgressItemContainer> container;
@@ -136,27 +136,40 @@ bool FileActionMngr::Private::isActive() const
     return dbProgress.activeProgressItems || fileProgress.activeProgressItems;
 }
 
-bool FileActionMngr::Private::shallSendForWriting(qlonglong id)
+bool FileActionMngr::Private::shallSendForWriting(qlonglong id, int writeComponents)
 {
     QMutexLocker lock(&mutex);
 
-    if (scheduledToWrite.contains(id))
+    QHash<qlonglong, int>::iterator it = scheduledToWrite.find(id);
+
+    if (it != scheduledToWrite.end())
     {
+        // The file is written only once, with all changes done until the file worker takes it.
+        it.value() |= writeComponents;
         return false;
     }
 
-    scheduledToWrite << id;
+    scheduledToWrite.insert(id, writeComponents);
     return true;
 }
 
-void FileActionMngr::Private::startingToWrite(const QList<ItemInfo>& infos)
+QHash<qlonglong, int> FileActionMngr::Private::startingToWrite(const QList<ItemInfo>& infos)
 {
     QMutexLocker lock(&mutex);
+    QHash<qlonglong, int> writeComponents;
 
     foreach (const ItemInfo& info, infos)
     {
-        scheduledToWrite.remove(info.id());
+        QHash<qlonglong, int>::iterator it = scheduledToWrite.find(info.id());
+
+        if (it != scheduledToWrite.end())
+        {
+            writeComponents.insert(info.id(), it.value());
+            scheduledToWrite.erase(it);
+        }
     }
+
+    return writeComponents;
 }
 
 void FileActionMngr::Private::slotSleepTimer()
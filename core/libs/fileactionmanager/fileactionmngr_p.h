@@ -27,8 +27,8 @@
 
 // Qt includes
 
+#include <QHash>
 #include <QMutex>
-#include <QSet>
 #include <QTimer>
 
 // Local includes
@@ -158,11 +158,17 @@ public:
 
     bool isActive() const;
 
-    /// db worker will send info to file worker if returns true
-    bool shallSendForWriting(qlonglong id);
+    /**
+     * db worker will send info to file worker if returns true. If the item is already
+     * waiting to be written, the components to write are merged in the pending write.
+     */
+    bool shallSendForWriting(qlonglong id, int writeComponents = MetadataHub::WRITE_ALL);
 
-    /// file worker calls this when receiving a task
-    void startingToWrite(const QList<ItemInfo>& infos);
+    /**
+     * file worker calls this when receiving a task. Return the components
+     * merged in the pending writes of the items, per item id.
+     */
+    QHash<qlonglong, int> startingToWrite(const QList<ItemInfo>& infos);
 
     void connectToDatabaseWorker();
     void connectDatabaseToFileWorker();
@@ -178,7 +184,7 @@ public Q_SLOTS:
 
 public:
 
-    QSet<qlonglong>                       scheduledToWrite;
+    QHash<qlonglong, int>                 scheduledToWrite;
     QString                               dbMessage;
     QString                               writerMessage;
     QMutex                                mutex;
@@ -87,6 +87,8 @@ void FileActionMngrFileWorker::writeMetadataToFiles(FileActionItemInfoList infos
 
     ScanController::instance()->suspendCollectionScan();
 
+    QStringList failedItems;
+
     foreach (const ItemInfo& info, infos)
     {
         MetadataHub hub;
@@ -97,33 +99,42 @@ void FileActionMngrFileWorker::writeMetadataToFiles(FileActionItemInfoList infos
         }
 
         hub.load(info);
-        QString filePath = info.filePath();
+        QString filePath                 = info.filePath();
+        MetadataHub::WriteResult written = MetadataHub::WriteFailed;
 
         if (MetaEngineSettings::instance()->settings().useLazySync)
         {
-            hub.write(filePath, MetadataHub::WRITE_ALL);
+            written = hub.write(filePath, MetadataHub::WRITE_ALL);
         }
         else
         {
             ScanController::FileMetadataWrite writeScope(info);
-            writeScope.changed(hub.write(filePath, MetadataHub::WRITE_ALL));
+            written = hub.write(filePath, MetadataHub::WRITE_ALL);
+            writeScope.changed(written == MetadataHub::WriteDone);
         }
 
         // hub emits fileMetadataChanged
-        infos.writtenToOne();
+        reportWriteResult(infos, info, written, failedItems);
     }
 
     ScanController::instance()->resumeCollectionScan();
 
+    if (!failedItems.isEmpty())
+    {
+        emit imageChangeFailed(i18n("Failed to write metadata to these files:"), failedItems);
+    }
+
     infos.finishedWriting();
 }
 
 void FileActionMngrFileWorker::writeMetadata(FileActionItemInfoList infos, int flags)
 {
-    d->startingToWrite(infos);
+    QHash<qlonglong, int> pendingComponents = d->startingToWrite(infos);
 
     ScanController::instance()->suspendCollectionScan();
 
+    QStringList failedItems;
+
     foreach (const ItemInfo& info, infos)
     {
         MetadataHub hub;
@@ -134,26 +145,58 @@ void FileActionMngrFileWorker::writeMetadata(FileActionItemInfoList infos, int f
         }
 
         hub.load(info);
+
+        // Also write the components changed while the item was waiting to be written.
+        MetadataHub::WriteComponents components = (MetadataHub::WriteComponents)(flags | pendingComponents.value(info.id()));
+        MetadataHub::WriteResult written        = MetadataHub::WriteFailed;
+
         // apply to file metadata
         if (MetaEngineSettings::instance()->settings().useLazySync)
         {
-            hub.writeToMetadata(info, (MetadataHub::WriteComponents)flags);
+            written = hub.writeToMetadata(info, components);
         }
         else
         {
             ScanController::FileMetadataWrite writeScope(info);
-            writeScope.changed(hub.writeToMetadata(info, (MetadataHub::WriteComponents)flags));
+            written = hub.writeToMetadata(info, components);
+            writeScope.changed(written == MetadataHub::WriteDone);
         }
 
         // hub emits fileMetadataChanged
-        infos.writtenToOne();
+        reportWriteResult(infos, info, written, failedItems);
     }
 
     ScanController::instance()->resumeCollectionScan();
 
+    if (!failedItems.isEmpty())
+    {
+        emit imageChangeFailed(i18n("Failed to write metadata to these files:"), failedItems);
+    }
+
     infos.finishedWriting();
 }
 
+void FileActionMngrFileWorker::reportWriteResult(FileActionItemInfoList& infos, const ItemInfo& info,
+                                                 MetadataHub::WriteResult result, QStringList& failedItems)
+{
+    switch (result)
+    {
+        case MetadataHub::WriteDone:
+            infos.writtenToOne();
+            break;
+
+        case MetadataHub::WriteUnchanged:
+            infos.unchangedOne();
+            break;
+
+        case MetadataHub::WriteFailed:
+            qCWarning(DIGIKAM_GENERAL_LOG) << "Failed to write metadata to" << info.filePath();
+            failedItems.append(info.name());
+            infos.writtenToOne();
+            break;
+    }
+}
+
 void FileActionMngrFileWorker::transform(FileActionItemInfoList infos, int action)
 {
     d->startingToWrite(infos);
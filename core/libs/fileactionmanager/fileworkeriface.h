@@ -29,13 +29,12 @@
 #include "fileactionmngr.h"
 #include "fileactionimageinfolist.h"
 #include "iteminfo.h"
+#include "metadatahub.h"
 #include "workerobject.h"
 
 namespace Digikam
 {
 
-class MetadataHub;
-
 class FileWorkerInterface : public WorkerObject
 {
     Q_OBJECT
@@ -75,6 +74,15 @@ public:
                                                     int newOrientation,
                                                     int oldOrientation);
 
+private:
+
+    /**
+     * Advance the progress of the write task. A file whose metadata could not be
+     * written is added to failedItems, to be reported at the end of the task.
+     */
+    static void reportWriteResult(FileActionItemInfoList& infos, const ItemInfo& info,
+                                  MetadataHub::WriteResult result, QStringList& failedItems);
+
 private:
 
     FileActionMngr::Private* const d;
@@ -27,6 +27,7 @@
 
 // Qt includes
 
+#include <QCryptographicHash>
 #include <QFileInfo>
 #include <QMutex>
 #include <QMutexLocker>
@@ -104,8 +105,32 @@ public:
 public:
 
     template <class T> void loadSingleValue(const T& data, T& storage, MetadataHub::Status& status);
+
+    /**
+     * Return a digest of the metadata serialized as they are written to file.
+     * If it is the same before and after setting the values of the hub,
+     * there is no need to rewrite the file.
+     */
+    static QByteArray metadataDigest(const DMetadata& metadata);
 };
 
+QByteArray MetadataHub::Private::metadataDigest(const DMetadata& metadata)
+{
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+
+    foreach (const QByteArray& data, QList<QByteArray>() << metadata.getExifEncoded()
+                                                         << metadata.getIptc()
+                                                         << metadata.getXmp()
+                                                         << metadata.getComments())
+    {
+        const int size = data.size();
+        hash.addData(reinterpret_cast<const char*>(&size), sizeof(int));
+        hash.addData(data);
+    }
+
+    return hash.result();
+}
+
 // ------------------------------------------------------------------------------------------
 
 MetadataHub::MetadataHub()
@@ -235,7 +260,7 @@ template <class T> void MetadataHub::Private::loadSingleValue(const T& data, T&
 // ------------------------------------------------------------------------------------------------------------
 
 /** safe **/
-bool MetadataHub::writeToMetadata(const ItemInfo& info, WriteComponent writeMode, bool ignoreLazySync, const MetaEngineSettingsContainer &settings)
+MetadataHub::WriteResult MetadataHub::writeToMetadata(const ItemInfo& info, WriteComponent writeMode, bool ignoreLazySync, const MetaEngineSettingsContainer &settings)
 {
     applyChangeNotifications();
 
@@ -243,27 +268,34 @@ bool MetadataHub::writeToMetadata(const ItemInfo& info, WriteComponent writeMode
     // important optimization if writing to file is turned off in setup!
     if (!willWriteMetadata(writeMode, settings))
     {
-        return false;
+        return WriteUnchanged;
     }
 
     if (!ignoreLazySync && settings.useLazySync)
     {
         MetadataHubMngr::instance()->addPending(info);
-        return true;
+        return WriteDone;
     }
 
     writeToBaloo(info.filePath());
 
     DMetadata metadata(info.filePath());
+    const QByteArray orgDigest = Private::metadataDigest(metadata);
 
     if (write(metadata, writeMode, settings))
     {
+        if (Private::metadataDigest(metadata) == orgDigest)
+        {
+            qCDebug(DIGIKAM_GENERAL_LOG) << "Metadata already up to date in" << info.filePath();
+            return WriteUnchanged;
+        }
+
         bool success = metadata.applyChanges();
         ItemAttributesWatch::instance()->fileMetadataChanged(QUrl::fromLocalFile(info.filePath()));
-        return success;
+        return (success ? WriteDone : WriteFailed);
     }
 
-    return false;
+    return WriteUnchanged;
 }
 
 bool MetadataHub::write(DMetadata& metadata, WriteComponent writeMode, const MetaEngineSettingsContainer& settings)
@@ -349,7 +381,7 @@ bool MetadataHub::write(DMetadata& metadata, WriteComponent writeMode, const Met
     return dirty;
 }
 
-bool MetadataHub::write(const QString& filePath, WriteComponent writeMode, bool ignoreLazySync, const MetaEngineSettingsContainer& settings)
+MetadataHub::WriteResult MetadataHub::write(const QString& filePath, WriteComponent writeMode, bool ignoreLazySync, const MetaEngineSettingsContainer& settings)
 {
     applyChangeNotifications();
 
@@ -357,28 +389,35 @@ bool MetadataHub::write(const QString& filePath, WriteComponent writeMode, bool
     // important optimization if writing to file is turned off in setup!
     if (!willWriteMetadata(writeMode, settings))
     {
-        return false;
+        return WriteUnchanged;
     }
 
     if (!ignoreLazySync && settings.useLazySync)
     {
         ItemInfo info = ItemInfo::fromLocalFile(filePath);
         MetadataHubMngr::instance()->addPending(info);
-        return true;
+        return WriteDone;
     }
 
     writeToBaloo(filePath);
 
     DMetadata metadata(filePath);
+    const QByteArray orgDigest = Private::metadataDigest(metadata);
 
     if (write(metadata, writeMode, settings))
     {
+        if (Private::metadataDigest(metadata) == orgDigest)
+        {
+            qCDebug(DIGIKAM_GENERAL_LOG) << "Metadata already up to date in" << filePath;
+            return WriteUnchanged;
+        }
+
         bool success = metadata.applyChanges();
         ItemAttributesWatch::instance()->fileMetadataChanged(QUrl::fromLocalFile(filePath));
-        return success;
+        return (success ? WriteDone : WriteFailed);
     }
 
-    return false;
+    return WriteUnchanged;
 }
 
 bool MetadataHub::write(DImg& image, WriteComponent writeMode, bool ignoreLazySync, const MetaEngineSettingsContainer& settings)
@@ -417,8 +456,8 @@ bool MetadataHub::write(DImg& image, WriteComponent writeMode, bool ignoreLazySy
     return write(metadata, writeMode, settings);
 }
 
-bool MetadataHub::writeTags(const QString& filePath, WriteComponent writeMode,
-                            const MetaEngineSettingsContainer& settings)
+MetadataHub::WriteResult MetadataHub::writeTags(const QString& filePath, WriteComponent writeMode,
+                                                const MetaEngineSettingsContainer& settings)
 {
     applyChangeNotifications();
 
@@ -426,13 +465,14 @@ bool MetadataHub::writeTags(const QString& filePath, WriteComponent writeMode,
     // important optimization if writing to file is turned off in setup!
     if (!willWriteMetadata(writeMode, settings))
     {
-        return false;
+        return WriteUnchanged;
     }
 
     DMetadata metadata(filePath);
     metadata.setSettings(settings);
-    bool saveFaces = settings.saveFaceTags;
-    bool saveTags  = settings.saveTags;
+    const QByteArray orgDigest = Private::metadataDigest(metadata);
+    bool saveFaces             = settings.saveFaceTags;
+    bool saveTags              = settings.saveTags;
 
     if (saveFaces)
     {
@@ -447,13 +487,19 @@ bool MetadataHub::writeTags(const QString& filePath, WriteComponent writeMode,
 
     if (writeTags(metadata, saveTags))
     {
+        if (Private::metadataDigest(metadata) == orgDigest)
+        {
+            qCDebug(DIGIKAM_GENERAL_LOG) << "Metadata already up to date in" << filePath;
+            return WriteUnchanged;
+        }
+
         bool success = metadata.applyChanges();
         ItemAttributesWatch::instance()->fileMetadataChanged(QUrl::fromLocalFile(filePath));
-        return success;
+        return (success ? WriteDone : WriteFailed);
     }
     else
     {
-        return false;
+        return WriteUnchanged;
     }
 }
 
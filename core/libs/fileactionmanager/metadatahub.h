@@ -98,6 +98,17 @@ public:
     };
      Q_DECLARE_FLAGS(WriteComponent, WriteComponents)
 
+    /**
+        The result of writing the metadata to a file. WriteFailed is zero,
+        so that a result can be tested as a failure flag.
+    */
+    enum WriteResult
+    {
+        WriteFailed = 0,   /// the metadata could not be saved to the file
+        WriteUnchanged,    /// there was nothing to write, or the file already contained the metadata and was not rewritten
+        WriteDone          /// the metadata were saved to the file, or scheduled for lazy synchronization
+    };
+
 public:
 
     /**
@@ -149,10 +160,10 @@ public:
      * @param info - image info to retrieve current tags
      * @param writeMode
      * @param settings
-     * @return true           - if everything is successful
+     * @return WriteDone      - if the file was written, WriteUnchanged if it was not touched
      */
-    bool writeToMetadata(const ItemInfo& info, WriteComponent writeMode = WRITE_ALL,
-               bool ignoreLazySync = false, const MetaEngineSettingsContainer& settings = MetaEngineSettings::instance()->settings());
+    WriteResult writeToMetadata(const ItemInfo& info, WriteComponent writeMode = WRITE_ALL,
+                                bool ignoreLazySync = false, const MetaEngineSettingsContainer& settings = MetaEngineSettings::instance()->settings());
 
 
     /**
@@ -162,10 +173,10 @@ public:
         WARNING: Do not use this method when multiple image infos are loaded
                  It will result in disjoint tags not being written
                  Use writeToMetadata(Image info ...) instead
-        @return Returns if the file has been touched
+        @return Returns WriteDone if the file has been touched
     */
-    bool write(const QString& filePath, WriteComponent writeMode = WRITE_ALL,
-               bool ignoreLazySync = false, const MetaEngineSettingsContainer& settings = MetaEngineSettings::instance()->settings());
+    WriteResult write(const QString& filePath, WriteComponent writeMode = WRITE_ALL,
+                      bool ignoreLazySync = false, const MetaEngineSettingsContainer& settings = MetaEngineSettings::instance()->settings());
 
     /**
         Constructs a DMetadata object from the metadata stored in the given DImg object,
@@ -178,10 +189,10 @@ public:
     /**
         Will write only Tags to image. Used by TagsManager to write tags to image
         Other metadata are not updated.
-        @return if tags were successfully written.
+        @return WriteDone if tags were successfully written.
     */
-    bool writeTags(const QString& filePath, WriteComponent writeMode = WRITE_ALL,
-                   const MetaEngineSettingsContainer& settings = MetaEngineSettings::instance()->settings());
+    WriteResult writeTags(const QString& filePath, WriteComponent writeMode = WRITE_ALL,
+                          const MetaEngineSettingsContainer& settings = MetaEngineSettings::instance()->settings());
 
     /**
      * @brief writeTags - used to deduplicate code from writeTags and usual write, all write to tags
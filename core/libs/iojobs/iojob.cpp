@@ -107,7 +107,8 @@ void CopyOrMoveJob::run()
                 if (!srcDir.rename(srcDir.path(), destenation))
                 {
                     // If QDir::rename fails, try copy and remove.
-                    if (!DFileOperations::copyFolderRecursively(srcDir.path(), dstDir.path(), &m_cancel))
+                    if (!DFileOperations::copyFolderRecursively(srcDir.path(), dstDir.path(),
+                                                                &m_cancel, m_data->bytesCounter()))
                     {
                         if (m_cancel)
                         {
@@ -131,8 +132,14 @@ void CopyOrMoveJob::run()
             }
             else
             {
-                if (!DFileOperations::renameFile(srcInfo.filePath(), destenation))
+                if (!DFileOperations::renameFile(srcInfo.filePath(), destenation,
+                                                 &m_cancel, m_data->bytesCounter()))
                 {
+                    if (m_cancel)
+                    {
+                        break;
+                    }
+
                     emit signalError(i18n("Could not move file %1 to album %2",
                                           srcInfo.filePath(),
                                           QDir::toNativeSeparators(dstDir.path())));
@@ -147,7 +154,8 @@ void CopyOrMoveJob::run()
             {
                 QDir srcDir(srcInfo.filePath());
 
-                if (!DFileOperations::copyFolderRecursively(srcDir.path(), dstDir.path(), &m_cancel))
+                if (!DFileOperations::copyFolderRecursively(srcDir.path(), dstDir.path(),
+                                                            &m_cancel, m_data->bytesCounter()))
                 {
                     if (m_cancel)
                     {
@@ -163,8 +171,14 @@ void CopyOrMoveJob::run()
             }
             else
             {
-                if (!DFileOperations::copyFile(srcInfo.filePath(), destenation))
+                if (!DFileOperations::copyFile(srcInfo.filePath(), destenation,
+                                               &m_cancel, m_data->bytesCounter()))
                 {
+                    if (m_cancel)
+                    {
+                        break;
+                    }
+
                     emit signalError(i18n("Could not copy file %1 to album %2",
                                           QDir::toNativeSeparators(srcInfo.path()),
                                           QDir::toNativeSeparators(dstDir.path())));
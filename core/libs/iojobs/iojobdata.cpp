@@ -58,6 +58,7 @@ public:
 
     QMap<QUrl, QUrl> changeDestMap;
     QList<ItemInfo>  itemInfosList;
+    QList<ItemInfo>  processedInfosList;
     QList<QUrl>      sourceUrlList;
 
     QUrl             destUrl;
@@ -65,6 +66,8 @@ public:
     QString          progressId;
     QDateTime        jobTime;
 
+    QAtomicInteger<qint64> bytesCounter;
+
     QMutex           mutex;
 };
 
@@ -244,6 +247,29 @@ ItemInfo IOJobData::findItemInfo(const QUrl& url) const
     return ItemInfo();
 }
 
+QAtomicInteger<qint64>* IOJobData::bytesCounter() const
+{
+    return &d->bytesCounter;
+}
+
+void IOJobData::addProcessedItem(const ItemInfo& info)
+{
+    d->processedInfosList << info;
+}
+
+int IOJobData::processedItemsCount() const
+{
+    return d->processedInfosList.count();
+}
+
+QList<ItemInfo> IOJobData::takeProcessedItems()
+{
+    QList<ItemInfo> infos = d->processedInfosList;
+    d->processedInfosList.clear();
+
+    return infos;
+}
+
 QList<QUrl> IOJobData::sourceUrls() const
 {
     return d->sourceUrlList;
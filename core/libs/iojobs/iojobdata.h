@@ -29,6 +29,7 @@
 #include <QUrl>
 #include <QList>
 #include <QDateTime>
+#include <QAtomicInteger>
 
 // Local includes
 
@@ -107,6 +108,19 @@ public:
 
     ItemInfo         findItemInfo(const QUrl& url)        const;
 
+    /**
+     * The counter of the bytes written by all jobs, to report the throughput.
+     */
+    QAtomicInteger<qint64>* bytesCounter()                const;
+
+    /**
+     * The moved items waiting for their database update, which is done
+     * in batches. takeProcessedItems() returns and forgets them.
+     */
+    void             addProcessedItem(const ItemInfo& info);
+    int              processedItemsCount()                const;
+    QList<ItemInfo>  takeProcessedItems();
+
     QList<QUrl>      sourceUrls()                         const;
     QList<ItemInfo>  itemInfos()                          const;
 
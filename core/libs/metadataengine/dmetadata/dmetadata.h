@@ -90,6 +90,12 @@ public: // File I/O helpers
      * ffmpeg probe methods if Exiv2 failed.
      */
     bool load(const QString& filePath) override;
+
+    /**
+     * Same as load(filePath), with the whole file content already read or mapped in memory
+     * as fileData. Exiv2 parses the data instead of opening the file again.
+     */
+    bool load(const QString& filePath, const QByteArray& fileData);
     bool save(const QString& filePath, bool setVersion = false) const;
     bool applyChanges(bool setVersion = false) const;
 
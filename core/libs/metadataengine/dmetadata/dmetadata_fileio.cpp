@@ -75,6 +75,42 @@ bool DMetadata::load(const QString& filePath)
     return hasLoaded;
 }
 
+bool DMetadata::load(const QString& filePath, const QByteArray& fileData)
+{
+    if (fileData.isEmpty())
+    {
+        return load(filePath);
+    }
+
+    FileReadLocker lock(filePath);
+
+    bool hasLoaded = false;
+    QMimeDatabase mimeDB;
+    QString mimeType = mimeDB.mimeTypeForFileNameAndData(filePath, fileData).name();
+
+    if (!mimeType.startsWith(QLatin1String("video/")) &&
+        !mimeType.startsWith(QLatin1String("audio/"))
+       )
+    {
+        // Same as MetaEngine::load(), parsing the data in memory.
+        hasLoaded  = loadFromData(fileData);
+        setFilePath(filePath);
+        hasLoaded |= loadFromSidecarAndMerge(filePath);
+
+        if (!hasLoaded)
+        {
+            hasLoaded = loadUsingRawEngine(filePath);
+        }
+    }
+    else
+    {
+        hasLoaded  = loadUsingFFmpeg(filePath);
+        hasLoaded |= loadFromSidecarAndMerge(filePath);
+    }
+
+    return hasLoaded;
+}
+
 bool DMetadata::save(const QString& filePath, bool setVersion) const
 {
     FileWriteLocker lock(filePath);
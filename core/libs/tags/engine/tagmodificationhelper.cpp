@@ -592,7 +592,7 @@ void TagModificationHelper::slotMultipleFaceTagDel(QList<TAlbum*>& tags)
                         {
                             metadataHub.load(info);
 
-                            if (!metadataHub.writeToMetadata(info))
+                            if (metadataHub.writeToMetadata(info) == MetadataHub::WriteFailed)
                             {
                                 qCWarning(DIGIKAM_GENERAL_LOG) << "Failed writing tags to image " << info.filePath();
                             }
@@ -31,6 +31,13 @@
 #include <sys/stat.h>
 #include <utime.h>
 
+#ifdef Q_OS_LINUX
+#   include <unistd.h>
+#   include <sys/ioctl.h>
+#   include <sys/syscall.h>
+#   include <linux/fs.h>
+#endif
+
 // Qt includes
 
 #include <QByteArray>
@@ -41,6 +48,11 @@
 #include <QMimeDatabase>
 #include <QDesktopServices>
 #include <QFileInfo>
+#include <QDirIterator>
+#include <QFuture>
+#include <QThreadPool>
+#include <QScopedArrayPointer>
+#include <QtConcurrent>    // krazy:exclude=includes
 #include <qplatformdefs.h>
 
 #ifdef HAVE_DBUS
@@ -520,7 +532,8 @@ void DFileOperations::openInFileManager(const QList<QUrl>& urls)
 
 bool DFileOperations::copyFolderRecursively(const QString& srcPath,
                                             const QString& dstPath,
-                                            const bool* cancel)
+                                            const bool* cancel,
+                                            QAtomicInteger<qint64>* const bytesCopied)
 {
     QDir srcDir(srcPath);
     QString newCopyPath = dstPath + QLatin1Char('/') + srcDir.dirName();
@@ -530,20 +543,75 @@ bool DFileOperations::copyFolderRecursively(const QString& srcPath,
         return false;
     }
 
-    foreach (const QFileInfo& fileInfo, srcDir.entryInfoList(QDir::Files))
+    // Create the tree of folders first and list the files to copy.
+    // The links to folders are followed as QDir::entryInfoList() does, the iterator
+    // does not enter twice a linked folder.
+
+    QList<QPair<QString, QString> > files;
+    QDirIterator it(srcDir.path(), QDir::Files | QDir::Dirs | QDir::NoDotAndDotDot,
+                    QDirIterator::Subdirectories | QDirIterator::FollowSymlinks);
+
+    while (it.hasNext())
     {
-        QString copyPath = newCopyPath + QLatin1Char('/') + fileInfo.fileName();
+        it.next();
 
         if (cancel && *cancel)
             return false;
 
-        if (!copyFile(fileInfo.filePath(), copyPath))
-            return false;
+        const QFileInfo& fileInfo = it.fileInfo();
+        QString copyPath          = newCopyPath + QLatin1Char('/') +
+                                    srcDir.relativeFilePath(fileInfo.filePath());
+
+        if (fileInfo.isDir())
+        {
+            if (!srcDir.mkpath(copyPath))
+                return false;
+        }
+        else
+        {
+            files << qMakePair(fileInfo.filePath(), copyPath);
+        }
+    }
+
+    // A few streams are enough to keep the disks busy, more only add seeks.
+
+    const int nbStreams = qMin(files.count(), qBound(1, QThreadPool::globalInstance()->maxThreadCount(), 4));
+    QList <QFuture<bool> > tasks;
+
+    for (int j = 0 ; j < nbStreams ; ++j)
+    {
+        const int step = files.count() / nbStreams;
+
+        tasks.append(QtConcurrent::run(&DFileOperations::copyFilesMultithreaded,
+                                       files,
+                                       j * step,
+                                       (j == nbStreams - 1) ? files.count() : (j + 1) * step,
+                                       cancel,
+                                       bytesCopied
+                                      ));
+    }
+
+    bool ret = true;
+
+    foreach (QFuture<bool> t, tasks)
+    {
+        ret &= t.result();
     }
 
-    foreach (const QFileInfo& fileInfo, srcDir.entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot))
+    return ret;
+}
+
+bool DFileOperations::copyFilesMultithreaded(const QList<QPair<QString, QString> >& files,
+                                             int start, int stop,
+                                             const bool* cancel,
+                                             QAtomicInteger<qint64>* const bytesCopied)
+{
+    for (int i = start ; i < stop ; ++i)
     {
-        if (!copyFolderRecursively(fileInfo.filePath(), newCopyPath, cancel))
+        if (cancel && *cancel)
+            return false;
+
+        if (!copyFile(files.at(i).first, files.at(i).second, cancel, bytesCopied))
             return false;
     }
 
@@ -566,11 +634,45 @@ bool DFileOperations::copyFiles(const QStringList& srcPaths,
 }
 
 bool DFileOperations::renameFile(const QString& srcFile,
-                                 const QString& dstFile)
+                                 const QString& dstFile,
+                                 const bool* cancel,
+                                 QAtomicInteger<qint64>* const bytesCopied)
 {
     QT_STATBUF st;
     int stat = QT_STAT(QFile::encodeName(srcFile).constData(), &st);
 
+#ifndef Q_OS_WIN
+
+    // Between devices, the file cannot be renamed and is copied. Use our own copy engine
+    // instead of the one from QFile::rename(), which cannot be canceled.
+
+    QT_STATBUF dst;
+    QString dstPath = QFileInfo(dstFile).absolutePath();
+
+    if (stat == 0 && QT_STAT(QFile::encodeName(dstPath).constData(), &dst) == 0 &&
+        st.st_dev != dst.st_dev)
+    {
+        if (!copyFile(srcFile, dstFile, cancel, bytesCopied))
+        {
+            return false;
+        }
+
+        if (!QFile::remove(srcFile))
+        {
+            QFile::remove(dstFile);
+            return false;
+        }
+
+        return true;
+    }
+
+#else
+
+    Q_UNUSED(cancel);
+    Q_UNUSED(bytesCopied);
+
+#endif // Q_OS_WIN
+
     bool ret = QFile::rename(srcFile, dstFile);
 
     if (ret && stat == 0)
@@ -590,7 +692,9 @@ bool DFileOperations::renameFile(const QString& srcFile,
 }
 
 bool DFileOperations::copyFile(const QString& srcFile,
-                               const QString& dstFile)
+                               const QString& dstFile,
+                               const bool* cancel,
+                               QAtomicInteger<qint64>* const bytesCopied)
 {
     QT_STATBUF st;
     QString tmpFile;
@@ -605,9 +709,14 @@ bool DFileOperations::copyFile(const QString& srcFile,
     tmpFile += (dot < 0) ? QLatin1String(".tmp")
                          : dstFile.right(ext);
 
-    bool ret = QFile::copy(srcFile, tmpFile);
+    bool ret = copyFileData(srcFile, tmpFile, cancel, bytesCopied);
+
+    if (ret)
+    {
+        QFile::setPermissions(tmpFile, QFile::permissions(srcFile));
+    }
 
-    if (ret && !(ret = QFile::rename(tmpFile, dstFile)))
+    if (!ret || !(ret = QFile::rename(tmpFile, dstFile)))
     {
         QFile::remove(tmpFile);
     }
@@ -628,4 +737,124 @@ bool DFileOperations::copyFile(const QString& srcFile,
     return ret;
 }
 
+bool DFileOperations::copyFileData(const QString& srcFile,
+                                   const QString& dstFile,
+                                   const bool* cancel,
+                                   QAtomicInteger<qint64>* const bytesCopied)
+{
+    if (cancel && *cancel)
+    {
+        return false;
+    }
+
+    QFile src(srcFile);
+    QFile dst(dstFile);
+
+    if (!src.open(QIODevice::ReadOnly | QIODevice::Unbuffered))
+    {
+        return false;
+    }
+
+    if (!dst.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Unbuffered))
+    {
+        return false;
+    }
+
+    const qint64 size = src.size();
+    qint64 done       = 0;
+
+#ifdef Q_OS_LINUX
+
+#   ifdef FICLONE
+
+    // Copy-on-write clone, for Btrfs, XFS and other filesystems supporting reflinks.
+    // No data are written, the clone is not counted in the bytes copied.
+
+    if (::ioctl(dst.handle(), FICLONE, src.handle()) == 0)
+    {
+        return true;
+    }
+
+#   endif
+
+#   ifdef SYS_copy_file_range
+
+    // In kernel copy, without transfer of the data through user space. Some filesystems
+    // (NFS, SMB) copy the data server side. The call fails with old kernels and across
+    // filesystems with kernels before 5.3, where the data are streamed below.
+
+    const qint64 chunk = 64 * 1024 * 1024;
+
+    while (done < size)
+    {
+        if (cancel && *cancel)
+        {
+            return false;
+        }
+
+        ssize_t ret = ::syscall(SYS_copy_file_range, src.handle(), nullptr, dst.handle(), nullptr,
+                                (size_t)qMin(chunk, size - done), 0);
+
+        if (ret <= 0)
+        {
+            break;
+        }
+
+        done += ret;
+
+        if (bytesCopied)
+        {
+            bytesCopied->fetchAndAddRelaxed(ret);
+        }
+    }
+
+    if (done == size)
+    {
+        return true;
+    }
+
+    // The file offsets were moved by the kernel, not through QFile.
+
+    if (!src.seek(done) || !dst.seek(done))
+    {
+        return false;
+    }
+
+#   endif
+
+#endif // Q_OS_LINUX
+
+    const qint64 bufferSize = 4 * 1024 * 1024;
+    QScopedArrayPointer<char> buffer(new char[bufferSize]);
+
+    while (done < size)
+    {
+        if (cancel && *cancel)
+        {
+            return false;
+        }
+
+        qint64 read = src.read(buffer.data(), bufferSize);
+
+        if (read <= 0)
+        {
+            break;
+        }
+
+        if (dst.write(buffer.data(), read) != read)
+        {
+            return false;
+        }
+
+        done += read;
+
+        if (bytesCopied)
+        {
+            bytesCopied->fetchAndAddRelaxed(read);
+        }
+    }
+
+    return (done == size);
+}
+
 } // namespace Digikam
@@ -29,6 +29,9 @@
 #include <QString>
 #include <QStringList>
 #include <QUrl>
+#include <QList>
+#include <QPair>
+#include <QAtomicInteger>
 
 // KDE includes
 
@@ -81,10 +84,13 @@ public:
     static void openInFileManager(const QList<QUrl>& urls);
 
     /** Copy recursively a directory contents to another one.
+     *  The tree of folders is created first, and the files are copied
+     *  with several streams at the same time, see copyFile().
      */
     static bool copyFolderRecursively(const QString& srcPath,
                                       const QString& dstPath,
-                                      const bool* cancel = nullptr);
+                                      const bool* cancel = nullptr,
+                                      QAtomicInteger<qint64>* const bytesCopied = nullptr);
 
     /** Copy a list of files to another place.
      */
@@ -92,14 +98,40 @@ public:
                           const QString& dstPath);
 
     /** Rename or move file and keep the source file modification time.
+     *  If the destination is on another device, the file is copied with copyFile()
+     *  and the source file is removed.
      */
     static bool renameFile(const QString& srcFile,
-                           const QString& dstFile);
+                           const QString& dstFile,
+                           const bool* cancel = nullptr,
+                           QAtomicInteger<qint64>* const bytesCopied = nullptr);
 
     /** Copy file and keep the source file modification time.
+     *  The data are copied with copyFileData().
      */
     static bool copyFile(const QString& srcFile,
-                         const QString& dstFile);
+                         const QString& dstFile,
+                         const bool* cancel = nullptr,
+                         QAtomicInteger<qint64>* const bytesCopied = nullptr);
+
+    /** Copy the data of file 'srcFile' to 'dstFile', which is created or truncated.
+     *  On Linux, the file is cloned if the filesystem supports copy-on-write reflinks,
+     *  else the data are copied in kernel space with copy_file_range(). The data are
+     *  streamed through a large buffer on other systems, or if the kernel fails.
+     *  The copy is aborted if 'cancel' is set, and the number of bytes written is added
+     *  to 'bytesCopied' while copying. A cloned file does not write any byte.
+     */
+    static bool copyFileData(const QString& srcFile,
+                             const QString& dstFile,
+                             const bool* cancel = nullptr,
+                             QAtomicInteger<qint64>* const bytesCopied = nullptr);
+
+private:
+
+    static bool copyFilesMultithreaded(const QList<QPair<QString, QString> >& files,
+                                       int start, int stop,
+                                       const bool* cancel,
+                                       QAtomicInteger<qint64>* const bytesCopied);
 };
 
 } // namespace Digikam
@@ -52,29 +52,13 @@ void ManagedLoadSaveThread::shutDown()
     {
         case TerminationPolicyTerminateLoading:
         {
-            QMutexLocker lock(threadMutex());
-            LoadingTask* loadingTask = nullptr;
-
-            if ((loadingTask = checkLoadingTask(m_currentTask, LoadingTaskFilterAll)))
-            {
-                loadingTask->setStatus(LoadingTask::LoadingTaskStatusStopping);
-            }
-
-            removeLoadingTasks(LoadingDescription(QString()), LoadingTaskFilterAll);
+            stopLoading(QString(), LoadingTaskFilterAll);
             break;
         }
 
         case TerminationPolicyTerminatePreloading:
         {
-            QMutexLocker lock(threadMutex());
-            LoadingTask* loadingTask = nullptr;
-
-            if ((loadingTask = checkLoadingTask(m_currentTask, LoadingTaskFilterPreloading)))
-            {
-                loadingTask->setStatus(LoadingTask::LoadingTaskStatusStopping);
-            }
-
-            removeLoadingTasks(LoadingDescription(QString()), LoadingTaskFilterPreloading);
+            stopLoading(QString(), LoadingTaskFilterPreloading);
             break;
         }
 
@@ -149,6 +133,28 @@ LoadingTask* ManagedLoadSaveThread::findExistingTask(const LoadingDescription& l
     return nullptr;
 }
 
+int ManagedLoadSaveThread::preloadingTaskIndex(bool pregenerate) const
+{
+    // Preloading tasks only pregenerating thumbnails come last, after the other preloading tasks.
+
+    if (pregenerate)
+    {
+        return m_todo.size();
+    }
+
+    for (int i = m_todo.size() ; i > 0 ; --i)
+    {
+        LoadingTask* const loadingTask = checkLoadingTask(m_todo.at(i - 1), LoadingTaskFilterPreloading);
+
+        if (!loadingTask || !loadingTask->loadingDescription().previewParameters.onlyPregenerate())
+        {
+            return i;
+        }
+    }
+
+    return 0;
+}
+
 void ManagedLoadSaveThread::setTerminationPolicy(TerminationPolicy terminationPolicy)
 {
     m_terminationPolicy = terminationPolicy;
@@ -372,8 +378,8 @@ void ManagedLoadSaveThread::preloadThumbnail(const LoadingDescription& descripti
     ThumbnailLoadingTask* const task = new ThumbnailLoadingTask(this, description);
     // mark as preload task
     task->setStatus(LoadingTask::LoadingTaskStatusPreloading);
-    // append to the end of the list
-    m_todo.append(task);
+    // append to the end of the list, but in front of pregenerating tasks
+    m_todo.insert(preloadingTaskIndex(description.previewParameters.onlyPregenerate()), task);
     start(lock);
 }
 
@@ -385,7 +391,10 @@ void ManagedLoadSaveThread::preloadThumbnailGroup(const QList<LoadingDescription
     }
 
     QMutexLocker lock(threadMutex());
-    QList<LoadSaveTask*> todo;
+
+    // A group is either preloaded or pregenerated, see ThumbnailLoadThread.
+    int  index = preloadingTaskIndex(descriptions.first().previewParameters.onlyPregenerate());
+    bool added = false;
 
     foreach (const LoadingDescription& description, descriptions)
     {
@@ -401,13 +410,13 @@ void ManagedLoadSaveThread::preloadThumbnailGroup(const QList<LoadingDescription
         ThumbnailLoadingTask* const task = new ThumbnailLoadingTask(this, description);
         // mark as preload task
         task->setStatus(LoadingTask::LoadingTaskStatusPreloading);
-        // append to the end of the list
-        todo << task;
+        // append to the end of the list, but in front of pregenerating tasks
+        m_todo.insert(index++, task);
+        added = true;
     }
 
-    if (!todo.isEmpty())
+    if (added)
     {
-        m_todo << todo;
         start(lock);
     }
 }
@@ -449,6 +458,21 @@ void ManagedLoadSaveThread::prependThumbnailGroup(const QList<LoadingDescription
     start(lock);
 }
 
+void ManagedLoadSaveThread::postponeLoadingTasks()
+{
+    QMutexLocker lock(threadMutex());
+
+    foreach (LoadSaveTask* const task, m_todo)
+    {
+        LoadingTask* const loadingTask = checkLoadingTask(task, LoadingTaskFilterAll);
+
+        if (loadingTask && loadingTask->status() == LoadingTask::LoadingTaskStatusLoading)
+        {
+            loadingTask->setStatus(LoadingTask::LoadingTaskStatusPreloading);
+        }
+    }
+}
+
 LoadingTask* ManagedLoadSaveThread::createLoadingTask(const LoadingDescription& description,
                                                       bool preloading, LoadingMode loadingMode,
                                                       AccessMode accessMode)
@@ -112,16 +112,19 @@ public:
 
     /// Stop and remove tasks filtered by filePath and policy.
     /// If filePath isNull, applies to all file paths.
-    void stopLoading(const QString& filePath = QString(), LoadingTaskFilter filter = LoadingTaskFilterAll);
+    virtual void stopLoading(const QString& filePath = QString(), LoadingTaskFilter filter = LoadingTaskFilterAll);
 
     /// Same than previous method, but Stop and remove tasks filtered by LoadingDescription.
-    void stopLoading(const LoadingDescription& desc, LoadingTaskFilter filter = LoadingTaskFilterAll);
+    virtual void stopLoading(const LoadingDescription& desc, LoadingTaskFilter filter = LoadingTaskFilterAll);
 
     /// Stop and remove saving tasks filtered by filePath.
     /// If filePath isNull, applies to all file paths.
     void stopSaving(const QString& filePath = QString());
 
-    void stopAllTasks();
+    /// Stop the current task and remove all pending tasks.
+    /// Subclasses dispatching tasks to other threads reimplement the stop methods,
+    /// which are also used by shutDown().
+    virtual void stopAllTasks();
 
     /// Append a task to save the image to the task list
     void save(DImg& image, const QString& filePath, const QString& format);
@@ -154,6 +157,10 @@ protected:
     void preloadThumbnailGroup(const QList<LoadingDescription>& descriptions);
     void prependThumbnailGroup(const QList<LoadingDescription>& descriptions);
 
+    /// Turn the pending loading tasks into preloading tasks, so that they are
+    /// postponed behind the tasks added next. The current task is not touched.
+    void postponeLoadingTasks();
+
 protected:
 
     LoadingPolicy     m_loadingPolicy;
@@ -163,6 +170,7 @@ private:
 
     LoadingTask* checkLoadingTask(LoadSaveTask* const task, LoadingTaskFilter filter) const;
     LoadingTask* findExistingTask(const LoadingDescription& description) const;
+    int          preloadingTaskIndex(bool pregenerate) const;
     LoadingTask* createLoadingTask(const LoadingDescription& description, bool preloading,
                                    LoadingMode loadingMode, AccessMode accessMode);
 
@@ -247,6 +247,11 @@ void LoadingCache::setCacheSize(int megabytes)
     d->imageCache.setMaxCost(megabytes * 1024 * 1024);
 }
 
+int LoadingCache::cacheSize() const
+{
+    return (d->imageCache.maxCost() / (1024 * 1024));
+}
+
 // --- Thumbnails ----
 
 const QImage* LoadingCache::retrieveThumbnail(const QString& cacheKey) const
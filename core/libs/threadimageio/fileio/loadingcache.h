@@ -210,6 +210,11 @@ public:
      */
     void setCacheSize(int megabytes);
 
+    /**
+     *  Returns the cache size in megabytes.
+     */
+    int cacheSize() const;
+
     // ------- Thumbnail cache -----------------------------------
 
     /// The LoadingCache support both the caching of QImage and QPixmap objects.
@@ -35,6 +35,7 @@
 #include "managedloadsavethread.h"
 #include "sharedloadsavethread.h"
 #include "loadingcache.h"
+#include "dprofiler.h"
 
 namespace Digikam
 {
@@ -46,6 +47,8 @@ void LoadingTask::execute()
         return;
     }
 
+    DIGIKAM_PROFILE_SCOPE("load", "LoadingTask");
+
     DImg img(m_loadingDescription.filePath, this, m_loadingDescription.rawDecodingSettings);
     m_thread->taskHasFinished();
     m_thread->imageLoaded(m_loadingDescription, img);
@@ -104,6 +107,8 @@ void SharedLoadingTask::execute()
         return;
     }
 
+    DIGIKAM_PROFILE_SCOPE("load", "SharedLoadingTask");
+
     // send StartedLoadingEvent from each single Task, not via LoadingProcess list
     m_thread->imageStartedLoading(m_loadingDescription);
 
@@ -455,6 +460,8 @@ LoadSaveThread::AccessMode SharedLoadingTask::accessMode()
 
 void SavingTask::execute()
 {
+    DIGIKAM_PROFILE_SCOPE("load", "SavingTask");
+
     m_thread->imageStartedSaving(m_filePath);
     bool success = m_img.save(m_filePath, m_format, this);
     m_thread->taskHasFinished();
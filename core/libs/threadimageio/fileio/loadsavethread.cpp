@@ -31,6 +31,7 @@
 #include "managedloadsavethread.h"
 #include "sharedloadsavethread.h"
 #include "loadsavetask.h"
+#include "dprofiler.h"
 
 namespace Digikam
 {
@@ -114,6 +115,8 @@ void LoadSaveThread::run()
             {
                 m_currentTask = m_todo.takeFirst();
 
+                DIGIKAM_PROFILE_COUNTER("load", "LoadSaveThread pending tasks", m_todo.count());
+
                 if (m_notificationPolicy == NotificationPolicyTimeLimited)
                 {
                     // set timing values so that first event is sent only
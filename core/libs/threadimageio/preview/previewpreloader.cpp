@@ -0,0 +1,490 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : adaptive preloading of the previews of a sequence of images
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "previewpreloader.h"
+
+// C++ includes
+
+#include <cmath>
+
+// Qt includes
+
+#include <QHash>
+#include <QSet>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QThread>
+#include <QThreadPool>
+#include <QElapsedTimer>
+#include <QFutureWatcher>
+#include <QtConcurrent>
+
+// Local includes
+
+#include "digikam_debug.h"
+#include "loadingcache.h"
+#include "previewloadthread.h"
+
+namespace Digikam
+{
+
+namespace
+{
+
+/**
+ * The previews loaded faster than this, in milliseconds, were found in the cache,
+ * and are not used to measure the loading time.
+ */
+const qint64 cachedLoadTime = 10;
+
+/**
+ * The time between two images above which the user is not skipping images anymore.
+ */
+const qint64 maxNavigationTime = 60000;
+
+} // namespace
+
+class Q_DECL_HIDDEN PreviewPreloader::Private
+{
+public:
+
+    explicit Private()
+      : loop(false),
+        size(0),
+        interval(0),
+        maxLookAhead(16),
+        currentIndex(-1),
+        forward(true),
+        lookAhead(1),
+        lookBehind(1),
+        loadTime(0.0),
+        navigationTime(0.0)
+    {
+        // Half of the cores are left to the viewer and to the loading of the displayed image.
+
+        pool.setMaxThreadCount(qBound(1, QThread::idealThreadCount() / 2, 4));
+    }
+
+    /**
+     * Run in the pool. Return the loading time, or -1 if the file is not wanted anymore.
+     * The files which cannot be loaded are not retried.
+     */
+    qint64 preload(const QString& filePath, const PreviewSettings& previewSettings,
+                   int previewSize, const IccProfile& iccProfile);
+
+    /**
+     * The index of the file at offset from the current one, or -1.
+     */
+    int    fileIndex(int offset) const;
+
+    /**
+     * The count of previews at the size of the display which fit in the LoadingCache,
+     * leaving room for the displayed image and the other previews.
+     */
+    int    previewsInCache() const;
+
+    static double movingAverage(double average, double value)
+    {
+        return ((average == 0.0) ? value : (0.7 * average + 0.3 * value));
+    }
+
+public:
+
+    QStringList                              files;
+    bool                                     loop;
+
+    PreviewSettings                          settings;
+    int                                      size;
+    IccProfile                               profile;
+
+    int                                      interval;
+    int                                      maxLookAhead;
+
+    int                                      currentIndex;
+    bool                                     forward;
+    int                                      lookAhead;
+    int                                      lookBehind;
+
+    /// Moving averages in milliseconds of the loading time of a preview and of the time between images.
+    double                                   loadTime;
+    double                                   navigationTime;
+    QElapsedTimer                            navigationTimer;
+
+    /// The files to preload, by priority, and the ones done for the current image.
+    QStringList                              queue;
+    QSet<QString>                            preloaded;
+    QHash<QFutureWatcher<qint64>*, QString>  running;
+
+    /// The files around the current image. The loadings not started yet for the others are skipped.
+    QSet<QString>                            wanted;
+    QMutex                                   mutex;
+
+    QThreadPool                              pool;
+};
+
+qint64 PreviewPreloader::Private::preload(const QString& filePath, const PreviewSettings& previewSettings,
+                                          int previewSize, const IccProfile& iccProfile)
+{
+    {
+        QMutexLocker lock(&mutex);
+
+        if (!wanted.contains(filePath))
+        {
+            return -1;
+        }
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+
+    // The preview is put in the LoadingCache by the loading task.
+
+    PreviewLoadThread::loadSynchronously(filePath, previewSettings, previewSize, iccProfile);
+
+    return timer.elapsed();
+}
+
+int PreviewPreloader::Private::fileIndex(int offset) const
+{
+    const int index = currentIndex + offset;
+
+    if ((index >= 0) && (index < files.count()))
+    {
+        return index;
+    }
+
+    if (!loop || (qAbs(offset) >= files.count()))
+    {
+        return -1;
+    }
+
+    return ((index + files.count()) % files.count());
+}
+
+int PreviewPreloader::Private::previewsInCache() const
+{
+    int cacheSize = 0;
+
+    {
+        LoadingCache* const cache = LoadingCache::cache();
+        LoadingCache::CacheLock lock(cache);
+        cacheSize                 = cache->cacheSize();
+    }
+
+    // A 3:2 preview in 32 bits per pixel, or a 24 Mpx image when it is not reduced.
+
+    const qint64 previewBytes = (size > 0) ? ((qint64)size * size * 8 / 3)
+                                           : (Q_INT64_C(24) * 1024 * 1024 * 4);
+
+    return qMax(1, (int)((qint64)cacheSize * 1024 * 1024 / previewBytes) - 2);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+PreviewPreloader::PreviewPreloader(QObject* const parent)
+    : QObject(parent),
+      d(new Private)
+{
+}
+
+PreviewPreloader::~PreviewPreloader()
+{
+    stop();
+
+    delete d;
+}
+
+void PreviewPreloader::setFiles(const QStringList& files, bool loop)
+{
+    d->files        = files;
+    d->loop         = loop;
+    d->currentIndex = -1;
+    d->queue.clear();
+    d->preloaded.clear();
+
+    QMutexLocker lock(&d->mutex);
+    d->wanted.clear();
+}
+
+void PreviewPreloader::setPreviewSettings(const PreviewSettings& settings, int size, const IccProfile& profile)
+{
+    d->settings = settings;
+    d->size     = size;
+    d->profile  = profile;
+    d->preloaded.clear();
+}
+
+void PreviewPreloader::setInterval(int interval)
+{
+    d->interval = interval;
+}
+
+void PreviewPreloader::setMaximumLookAhead(int count)
+{
+    d->maxLookAhead = qMax(1, count);
+}
+
+void PreviewPreloader::setCurrentIndex(int index)
+{
+    if ((index < 0) || (index >= d->files.count()))
+    {
+        return;
+    }
+
+    if ((d->currentIndex != -1) && (index != d->currentIndex))
+    {
+        int step = index - d->currentIndex;
+
+        if (d->loop)
+        {
+            if      (step >  d->files.count() / 2)
+            {
+                step -= d->files.count();
+            }
+            else if (step < -d->files.count() / 2)
+            {
+                step += d->files.count();
+            }
+        }
+
+        d->forward = (step > 0);
+
+        if (d->navigationTimer.isValid())
+        {
+            const qint64 elapsed = qMin(d->navigationTimer.elapsed() / qMax(1, qAbs(step)), maxNavigationTime);
+            d->navigationTime    = Private::movingAverage(d->navigationTime, elapsed);
+        }
+    }
+
+    d->navigationTimer.start();
+    d->currentIndex = index;
+
+    schedule();
+
+    qCDebug(DIGIKAM_GENERAL_LOG) << "Preloading" << d->lookBehind << "previews before and"
+                                 << d->lookAhead << "after, loading time" << d->loadTime
+                                 << "ms, time between images" << d->navigationTime << "ms";
+}
+
+DImg PreviewPreloader::load(const QString& filePath) const
+{
+    return PreviewLoadThread::loadSynchronously(filePath, d->settings, d->size, d->profile);
+}
+
+int PreviewPreloader::lookAhead() const
+{
+    return d->lookAhead;
+}
+
+int PreviewPreloader::lookBehind() const
+{
+    return d->lookBehind;
+}
+
+void PreviewPreloader::setCurrentFile(const QString& filePath)
+{
+    // The nearest occurrence after the current file.
+
+    int index = d->files.indexOf(filePath, qMax(0, d->currentIndex));
+
+    if (index == -1)
+    {
+        index = d->files.indexOf(filePath);
+    }
+
+    setCurrentIndex(index);
+}
+
+int PreviewPreloader::currentIndex() const
+{
+    return d->currentIndex;
+}
+
+QStringList PreviewPreloader::files() const
+{
+    return d->files;
+}
+
+void PreviewPreloader::removeFile(const QString& filePath)
+{
+    for (int i = d->files.count() - 1 ; i >= 0 ; --i)
+    {
+        if (d->files[i] == filePath)
+        {
+            d->files.removeAt(i);
+
+            if (i < d->currentIndex)
+            {
+                --d->currentIndex;
+            }
+        }
+    }
+
+    if (d->currentIndex >= d->files.count())
+    {
+        d->currentIndex = (d->loop && !d->files.isEmpty()) ? 0 : -1;
+    }
+
+    d->queue.removeAll(filePath);
+    d->preloaded.remove(filePath);
+
+    {
+        QMutexLocker lock(&d->mutex);
+        d->wanted.remove(filePath);
+    }
+
+    schedule();
+}
+
+int PreviewPreloader::lookAheadCount(double loadTime, double navigationTime, int interval, int maxCount)
+{
+    // The time between two images is the one measured, when the user skips images faster
+    // than the slideshow, or the interval of the slideshow.
+
+    double period = navigationTime;
+
+    if (interval > 0)
+    {
+        period = (period > 0.0) ? qMin(period, (double)interval) : interval;
+    }
+
+    if (period <= 0.0)
+    {
+        period = 1000.0;
+    }
+
+    // The images must be loaded when they are displayed, with one more image in advance.
+
+    const int count = 1 + (int)std::ceil(loadTime / period);
+
+    return qBound(1, count, qMax(1, maxCount));
+}
+
+void PreviewPreloader::stop()
+{
+    d->currentIndex = -1;
+    d->queue.clear();
+
+    {
+        QMutexLocker lock(&d->mutex);
+        d->wanted.clear();
+    }
+
+    d->pool.waitForDone();
+}
+
+void PreviewPreloader::schedule()
+{
+    if (d->currentIndex == -1)
+    {
+        return;
+    }
+
+    const int count = lookAheadCount(d->loadTime, d->navigationTime, d->interval,
+                                     qMin(d->maxLookAhead, d->previewsInCache()));
+
+    d->lookAhead  = d->forward ? count : 1;
+    d->lookBehind = d->forward ? 1     : count;
+
+    d->queue.clear();
+
+    for (int i = 1 ; i <= count ; ++i)
+    {
+        const int ahead  = (i <= d->lookAhead)  ? d->fileIndex(i)  : -1;
+        const int behind = (i <= d->lookBehind) ? d->fileIndex(-i) : -1;
+        const int first  = d->forward ? ahead  : behind;
+        const int second = d->forward ? behind : ahead;
+
+        if ((first != -1) && !d->files[first].isEmpty() && !d->queue.contains(d->files[first]))
+        {
+            d->queue << d->files[first];
+        }
+
+        if ((second != -1) && !d->files[second].isEmpty() && !d->queue.contains(d->files[second]))
+        {
+            d->queue << d->files[second];
+        }
+    }
+
+    d->queue.removeAll(d->files[d->currentIndex]);
+
+    {
+        QMutexLocker lock(&d->mutex);
+        d->wanted = d->queue.toSet();
+    }
+
+    d->preloaded.intersect(d->wanted);
+
+    foreach (const QString& filePath, d->running)
+    {
+        d->queue.removeAll(filePath);
+    }
+
+    foreach (const QString& filePath, d->preloaded)
+    {
+        d->queue.removeAll(filePath);
+    }
+
+    while (!d->queue.isEmpty() && (d->running.count() < d->pool.maxThreadCount()))
+    {
+        const QString filePath                = d->queue.takeFirst();
+        QFutureWatcher<qint64>* const watcher = new QFutureWatcher<qint64>(this);
+        d->running.insert(watcher, filePath);
+
+        connect(watcher, SIGNAL(finished()),
+                this, SLOT(slotPreloaded()));
+
+        watcher->setFuture(QtConcurrent::run(&d->pool, d, &Private::preload,
+                                             filePath, d->settings, d->size, d->profile));
+    }
+}
+
+void PreviewPreloader::slotPreloaded()
+{
+    QFutureWatcher<qint64>* const watcher = static_cast<QFutureWatcher<qint64>*>(sender());
+
+    if (!watcher || !d->running.contains(watcher))
+    {
+        return;
+    }
+
+    const QString filePath = d->running.take(watcher);
+    const qint64 elapsed   = watcher->result();
+    watcher->deleteLater();
+
+    if (elapsed >= 0)
+    {
+        d->preloaded << filePath;
+
+        if (elapsed >= cachedLoadTime)
+        {
+            d->loadTime = Private::movingAverage(d->loadTime, elapsed);
+        }
+    }
+
+    // The look-ahead follows the new loading time.
+
+    schedule();
+}
+
+} // namespace Digikam
@@ -0,0 +1,149 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : adaptive preloading of the previews of a sequence of images
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_PREVIEW_PRELOADER_H
+#define DIGIKAM_PREVIEW_PRELOADER_H
+
+// Qt includes
+
+#include <QObject>
+#include <QString>
+#include <QStringList>
+
+// Local includes
+
+#include "digikam_export.h"
+#include "dimg.h"
+#include "iccprofile.h"
+#include "previewsettings.h"
+
+namespace Digikam
+{
+
+/**
+ * Preload the previews of the images around the one displayed by a viewer going through a sequence
+ * of images, as the slideshow, the presentation and the light table.
+ *
+ * The previews are loaded by a pool of threads with PreviewLoadThread, at the size of the display,
+ * and kept in the LoadingCache, where the viewer finds them when it loads the displayed image
+ * with the same settings, and which is shared with the other previews of the application.
+ *
+ * The count of images preloaded after the current one (or before, when going backward) follows
+ * the measured loading time and the time between images, given by the slide interval or measured
+ * when the user skips images. It is bounded by the size of the LoadingCache.
+ */
+class DIGIKAM_EXPORT PreviewPreloader : public QObject
+{
+    Q_OBJECT
+
+public:
+
+    explicit PreviewPreloader(QObject* const parent = nullptr);
+    ~PreviewPreloader();
+
+    /**
+     * The files of the sequence. If loop is true, the first file follows the last one.
+     * The empty paths are skipped, as the items which are not images.
+     */
+    void setFiles(const QStringList& files, bool loop);
+
+    /**
+     * The settings used to load the previews, which must be the ones used by the viewer
+     * to load the displayed image, for the preloaded previews to be found in the cache.
+     * For the fast previews, size is the size of the display.
+     */
+    void setPreviewSettings(const PreviewSettings& settings, int size, const IccProfile& profile = IccProfile());
+
+    /**
+     * The interval between two images in milliseconds when the sequence runs automatically,
+     * or 0 if the images are changed only by the user.
+     */
+    void setInterval(int interval);
+
+    /**
+     * The maximum count of images preloaded in each direction, by default 16.
+     */
+    void setMaximumLookAhead(int count);
+
+    /**
+     * Set the index of the displayed file, and start the preloading of the next ones.
+     */
+    void setCurrentIndex(int index);
+
+    /**
+     * Set the displayed file by its path, for the viewers which remove files from their own
+     * list, where the indexes are not the ones of the preloader anymore. Does nothing if the
+     * file is not in the sequence.
+     */
+    void setCurrentFile(const QString& filePath);
+
+    int         currentIndex() const;
+    QStringList files()        const;
+
+    /**
+     * Load the preview of a file with the settings of the preloader. It is taken from the cache if
+     * it was preloaded, and the loading is shared if it is in progress. Can be called from any thread.
+     */
+    DImg load(const QString& filePath) const;
+
+    int lookAhead()  const;
+    int lookBehind() const;
+
+    /**
+     * The count of images to preload in the direction of the navigation. The images which take
+     * loadTime milliseconds to load must be ready when they are displayed, one every period, the
+     * time between images measured, or the interval when it is shorter, with one more image in
+     * advance. The result is between 1 and maxCount.
+     */
+    static int lookAheadCount(double loadTime, double navigationTime, int interval, int maxCount);
+
+    /**
+     * Stop the preloading, waiting for the loadings in progress.
+     */
+    void stop();
+
+public Q_SLOTS:
+
+    /**
+     * Remove all the occurrences of a file from the sequence, as a file the viewer cannot load.
+     * The current index moves to the file which followed it.
+     */
+    void removeFile(const QString& filePath);
+
+private Q_SLOTS:
+
+    void slotPreloaded();
+
+private:
+
+    void schedule();
+
+private:
+
+    class Private;
+    Private* const d;
+};
+
+} // namespace Digikam
+
+#endif // DIGIKAM_PREVIEW_PRELOADER_H
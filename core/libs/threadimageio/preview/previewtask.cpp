@@ -42,6 +42,7 @@
 #include "jpegutils.h"
 #include "metaenginesettings.h"
 #include "previewloadthread.h"
+#include "dprofiler.h"
 
 namespace Digikam
 {
@@ -53,6 +54,8 @@ void PreviewLoadingTask::execute()
         return;
     }
 
+    DIGIKAM_PROFILE_SCOPE("load", "PreviewLoadingTask");
+
     // Check if preview is in cache first.
 
     LoadingCache* const cache = LoadingCache::cache();
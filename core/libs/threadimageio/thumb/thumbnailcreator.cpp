@@ -65,6 +65,7 @@
 #include "thumbsdb.h"
 #include "thumbsdbbackend.h"
 #include "thumbnailsize.h"
+#include "dprofiler.h"
 
 #ifdef HAVE_MEDIAPLAYER
 #   include "videothumbnailer.h"
@@ -233,6 +234,8 @@ void ThumbnailCreator::pregenerateDetail(const ThumbnailIdentifier& identifier,
 
 QImage ThumbnailCreator::load(const ThumbnailIdentifier& identifier, const QRect& rect, bool pregenerate) const
 {
+    DIGIKAM_PROFILE_SCOPE("thumbnail", "ThumbnailCreator::load");
+
     if (d->storageSize() <= 0)
     {
         d->error = i18n("No or invalid size specified");
@@ -481,6 +484,8 @@ void ThumbnailCreator::deleteThumbnailsFromDisk(const QString& filePath) const
 
 ThumbnailImage ThumbnailCreator::createThumbnail(const ThumbnailInfo& info, const QRect& detailRect) const
 {
+    DIGIKAM_PROFILE_SCOPE("thumbnail", "ThumbnailCreator::createThumbnail");
+
     const QString path = info.filePath;
     QFileInfo fileInfo(path);
 
@@ -783,6 +788,8 @@ QImage ThumbnailCreator::exifRotate(const QImage& thumb, int orientation) const
 
 void ThumbnailCreator::storeInDatabase(const ThumbnailInfo& info, const ThumbnailImage& image) const
 {
+    DIGIKAM_PROFILE_SCOPE("thumbnail", "ThumbnailCreator::storeInDatabase");
+
     ThumbsDbInfo dbInfo;
 
     // We rely on loadThumbsDbInfo() being called before, so we do not need to look up
@@ -972,6 +979,8 @@ bool ThumbnailCreator::isInDatabase(const ThumbnailInfo& info) const
 
 ThumbnailImage ThumbnailCreator::loadFromDatabase(const ThumbnailInfo& info) const
 {
+    DIGIKAM_PROFILE_SCOPE("thumbnail", "ThumbnailCreator::loadFromDatabase");
+
     ThumbsDbInfo dbInfo = loadThumbsDbInfo(info);
     ThumbnailImage image;
 
@@ -36,6 +36,7 @@
 #include <QMimeType>
 #include <QMimeDatabase>
 #include <QDesktopWidget>
+#include <QThread>
 
 // KDE includes
 
@@ -117,6 +118,7 @@ public:
         sendSurrogate      = true;
         notifiedForResults = false;
         creator            = nullptr;
+        owner              = nullptr;
     }
 
     bool                               wantPixmap;
@@ -133,6 +135,12 @@ public:
 
     QList<LoadingDescription>          lastDescriptions;
 
+    /// Threads loading thumbnails on behalf of this one, if any.
+    QList<ThumbnailLoadThread*>        workers;
+
+    /// For a worker thread, the thread which receives the thumbnails.
+    ThumbnailLoadThread*               owner;
+
 public:
 
     LoadingDescription        createLoadingDescription(const ThumbnailIdentifier& identifier, int size, bool setLastDescription = true);
@@ -146,7 +154,22 @@ public:
     int                       thumbnailSizeForPixmapSize(int pixmapSize) const;
 };
 
-Q_GLOBAL_STATIC(ThumbnailLoadThread, defaultIconViewObject)
+/**
+ * The icon view requests thumbnails for full pages of items at once:
+ * use half of the cores to load them, other default threads are kept sequential.
+ */
+class Q_DECL_HIDDEN IconViewThumbnailLoadThread : public ThumbnailLoadThread
+{
+public:
+
+    explicit IconViewThumbnailLoadThread()
+        : ThumbnailLoadThread()
+    {
+        setMaximumNumberOfThreads(QThread::idealThreadCount() / 2);
+    }
+};
+
+Q_GLOBAL_STATIC(IconViewThumbnailLoadThread, defaultIconViewObject)
 Q_GLOBAL_STATIC(ThumbnailLoadThread, defaultObject)
 Q_GLOBAL_STATIC(ThumbnailLoadThread, defaultThumbBarObject)
 
@@ -171,6 +194,10 @@ ThumbnailLoadThread::ThumbnailLoadThread(QObject* const parent)
 
 ThumbnailLoadThread::~ThumbnailLoadThread()
 {
+    // Workers report their results to this thread, stop them first.
+    qDeleteAll(d->workers);
+    d->workers.clear();
+
     shutDown();
 
     delete d->creator;
@@ -237,6 +264,61 @@ void ThumbnailLoadThread::setThumbnailSize(int size, bool forFace)
     if (forFace)
     {
         d->creator->setThumbnailSize(size);
+
+        foreach (ThumbnailLoadThread* const worker, d->workers)
+        {
+            worker->setThumbnailSize(size, forFace);
+        }
+    }
+}
+
+void ThumbnailLoadThread::setMaximumNumberOfThreads(int count)
+{
+    if (!d->workers.isEmpty() || (count <= 1))
+    {
+        return;
+    }
+
+    for (int i = 0 ; i < count ; ++i)
+    {
+        ThumbnailLoadThread* const worker = new ThumbnailLoadThread;
+        worker->d->owner                  = this;
+        d->workers << worker;
+    }
+}
+
+int ThumbnailLoadThread::maximumNumberOfThreads() const
+{
+    return qMax(1, d->workers.count());
+}
+
+void ThumbnailLoadThread::stopLoading(const QString& filePath, LoadingTaskFilter filter)
+{
+    ManagedLoadSaveThread::stopLoading(filePath, filter);
+
+    foreach (ThumbnailLoadThread* const worker, d->workers)
+    {
+        worker->stopLoading(filePath, filter);
+    }
+}
+
+void ThumbnailLoadThread::stopLoading(const LoadingDescription& desc, LoadingTaskFilter filter)
+{
+    ManagedLoadSaveThread::stopLoading(desc, filter);
+
+    foreach (ThumbnailLoadThread* const worker, d->workers)
+    {
+        worker->stopLoading(desc, filter);
+    }
+}
+
+void ThumbnailLoadThread::stopAllTasks()
+{
+    ManagedLoadSaveThread::stopAllTasks();
+
+    foreach (ThumbnailLoadThread* const worker, d->workers)
+    {
+        worker->stopAllTasks();
     }
 }
 
@@ -543,7 +625,7 @@ void ThumbnailLoadThread::findGroup(QList<ThumbnailIdentifier>& identifiers, int
     }
 
     QList<LoadingDescription> descriptions = d->makeDescriptions(identifiers, size);
-    ManagedLoadSaveThread::prependThumbnailGroup(descriptions);
+    loadGroup(descriptions, true);
 }
 
 // --- Detail thumbnails ---
@@ -581,7 +663,7 @@ void ThumbnailLoadThread::findGroup(const QList<QPair<ThumbnailIdentifier, QRect
     }
 
     QList<LoadingDescription> descriptions = d->makeDescriptions(idsAndRects, size);
-    ManagedLoadSaveThread::prependThumbnailGroup(descriptions);
+    loadGroup(descriptions, true);
 }
 
 // --- Preloading ---
@@ -614,7 +696,7 @@ void ThumbnailLoadThread::preloadGroup(QList<ThumbnailIdentifier>& identifiers,
     }
 
     QList<LoadingDescription> descriptions = d->makeDescriptions(identifiers, size);
-    ManagedLoadSaveThread::preloadThumbnailGroup(descriptions);
+    loadGroup(descriptions, false);
 }
 
 void ThumbnailLoadThread::pregenerateGroup(const QList<ThumbnailIdentifier>& identifiers)
@@ -636,7 +718,7 @@ void ThumbnailLoadThread::pregenerateGroup(const QList<ThumbnailIdentifier>& ide
         descriptions[i].previewParameters.flags |= LoadingDescription::PreviewParameters::OnlyPregenerate;
     }
 
-    ManagedLoadSaveThread::preloadThumbnailGroup(descriptions);
+    loadGroup(descriptions, false);
 }
 
 // --- Basic load() ---
@@ -653,13 +735,67 @@ void ThumbnailLoadThread::load(const LoadingDescription& description, bool prelo
         return;
     }
 
+    ThumbnailLoadThread* const thread = workerThread(description);
+
     if (preload)
     {
-        ManagedLoadSaveThread::preloadThumbnail(description);
+        thread->preloadThumbnail(description);
     }
     else
     {
-        ManagedLoadSaveThread::loadThumbnail(description);
+        thread->loadThumbnail(description);
+    }
+}
+
+ThumbnailLoadThread* ThumbnailLoadThread::workerThread(const LoadingDescription& description)
+{
+    if (d->workers.isEmpty())
+    {
+        return this;
+    }
+
+    return d->workers.at(qHash(description.filePath) % d->workers.count());
+}
+
+void ThumbnailLoadThread::loadGroup(const QList<LoadingDescription>& descriptions, bool prepend)
+{
+    if (d->workers.isEmpty())
+    {
+        if (prepend)
+        {
+            postponeLoadingTasks();
+            prependThumbnailGroup(descriptions);
+        }
+        else
+        {
+            preloadThumbnailGroup(descriptions);
+        }
+
+        return;
+    }
+
+    // Split the group by worker, keeping the order of the descriptions.
+
+    QHash<ThumbnailLoadThread*, QList<LoadingDescription> > groups;
+
+    foreach (const LoadingDescription& description, descriptions)
+    {
+        groups[workerThread(description)] << description;
+    }
+
+    foreach (ThumbnailLoadThread* const worker, d->workers)
+    {
+        if (prepend)
+        {
+            // A new group of thumbnails to show: the ones requested before and still
+            // pending, as the items scrolled out of view, are only preloaded now.
+            worker->postponeLoadingTasks();
+            worker->prependThumbnailGroup(groups.value(worker));
+        }
+        else
+        {
+            worker->preloadThumbnailGroup(groups.value(worker));
+        }
     }
 }
 
@@ -696,6 +832,13 @@ bool ThumbnailLoadThread::checkSize(int size)
 // called by ThumbnailTask from working thread
 void ThumbnailLoadThread::thumbnailLoaded(const LoadingDescription& loadingDescription, const QImage& img)
 {
+    if (d->owner)
+    {
+        // Worker thread, the results are dispatched by the owner thread.
+        d->owner->thumbnailLoaded(loadingDescription, img);
+        return;
+    }
+
     // call parent to send signalThumbnailLoaded(LoadingDescription, QImage) - signal is part of public API
     ManagedLoadSaveThread::thumbnailLoaded(loadingDescription, img);
 
@@ -826,6 +969,11 @@ void ThumbnailLoadThread::storeDetailThumbnail(const QString& filePath, const QR
     d->creator->storeDetailThumbnail(filePath, detailRect, image);
 }
 
+void ThumbnailLoadThread::storeThumbnail(const QString& filePath, const QImage& image)
+{
+    d->creator->store(filePath, image);
+}
+
 int ThumbnailLoadThread::storedSize() const
 {
     return d->creator->storedSize();
@@ -136,6 +136,24 @@ public:
     void pregenerateGroup(const QList<ThumbnailIdentifier>& identifiers);
     void pregenerateGroup(const QList<ThumbnailIdentifier>& identifiers, int size);
 
+    /**
+     * Set the number of worker threads loading thumbnails concurrently.
+     * Requests are dispatched to the workers by file path, so that requests for the same file
+     * always go to the same worker and are still merged with the pending ones.
+     * Each worker keeps the priority order of requests: loading first, then preloading,
+     * then pregenerating. Call this method before the first request.
+     * Default value: 1, thumbnails are loaded by this thread.
+     */
+    void setMaximumNumberOfThreads(int count);
+    int  maximumNumberOfThreads() const;
+
+    /**
+     * Same as ManagedLoadSaveThread methods, applied to the worker threads as well.
+     */
+    void stopLoading(const QString& filePath = QString(), LoadingTaskFilter filter = LoadingTaskFilterAll) override;
+    void stopLoading(const LoadingDescription& desc, LoadingTaskFilter filter = LoadingTaskFilterAll) override;
+    void stopAllTasks() override;
+
     /**
      * Load a thumbnail.
      * You do not need to use this method directly, it will not access the pixmap cache. Use find().
@@ -218,6 +236,14 @@ public:
      * The image should at least have storedSize().
      */
     void storeDetailThumbnail(const QString& filePath, const QRect& detailRect, const QImage& image, bool isFace = false);
+
+    /**
+     * Stores the given thumbnail of the file, when an image of the file was already loaded
+     * for another purpose. The image must not be rotated according to the Exif orientation,
+     * as the thumbnails stored in the database.
+     * The image should at least have storedSize().
+     */
+    void storeThumbnail(const QString& filePath, const QImage& image);
     int  storedSize() const;
 
     /**
@@ -248,6 +274,9 @@ private:
     bool find(const ThumbnailIdentifier& identifier, int size, QPixmap* retPixmap, bool emitSignal, const QRect& detailRect);
     void load(const LoadingDescription& description, bool pregenerate);
     bool checkSize(int size);
+
+    ThumbnailLoadThread* workerThread(const LoadingDescription& description);
+    void                 loadGroup(const QList<LoadingDescription>& descriptions, bool prepend);
     QPixmap surrogatePixmap(const LoadingDescription& loadingDescription);
 
 Q_SIGNALS:
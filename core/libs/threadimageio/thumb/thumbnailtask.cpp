@@ -45,6 +45,7 @@
 #include "metaenginesettings.h"
 #include "thumbnailloadthread.h"
 #include "thumbnailcreator.h"
+#include "dprofiler.h"
 
 namespace Digikam
 {
@@ -66,6 +67,8 @@ void ThumbnailLoadingTask::execute()
         return;
     }
 
+    DIGIKAM_PROFILE_SCOPE("load", "ThumbnailLoadingTask");
+
     if (m_loadingDescription.previewParameters.onlyPregenerate())
     {
         setupCreator();
@@ -35,6 +35,7 @@
 // Local includes
 
 #include "digikam_debug.h"
+#include "workstealingscheduler.h"
 
 namespace Digikam
 {
@@ -65,20 +66,24 @@ public:
 
     explicit Private()
     {
-        running = false;
-        pool    = nullptr;
+        running   = false;
+        pool      = nullptr;
+        scheduler = nullptr;
     }
 
-    volatile bool       running;
+    volatile bool          running;
 
-    QWaitCondition      condVarJobs;
-    QMutex              mutex;
+    QWaitCondition         condVarJobs;
+    QMutex                 mutex;
 
-    ActionJobCollection todo;
-    ActionJobCollection pending;
-    ActionJobCollection processed;
+    ActionJobCollection    todo;
+    ActionJobCollection    pending;
+    ActionJobCollection    processed;
 
-    QThreadPool*        pool;
+    QThreadPool*           pool;
+
+    /// Used instead of the pool with the work stealing backend.
+    WorkStealingScheduler* scheduler;
 };
 
 ActionThreadBase::ActionThreadBase(QObject* const parent)
@@ -100,6 +105,11 @@ ActionThreadBase::~ActionThreadBase()
     //wait for the jobs to finish
     d->pool->waitForDone();
 
+    if (d->scheduler)
+    {
+        d->scheduler->waitForDone();
+    }
+
     // Cleanup all jobs from memory
     foreach (ActionJob* const job, d->todo.keys())
     {
@@ -119,9 +129,39 @@ ActionThreadBase::~ActionThreadBase()
     delete d;
 }
 
+void ActionThreadBase::setBackend(Backend backend)
+{
+    if      ((backend == WorkStealingBackend) && !d->scheduler)
+    {
+        d->scheduler = new WorkStealingScheduler(this);
+        d->scheduler->setMaximumNumberOfThreads(d->pool->maxThreadCount());
+
+        // Queued, as cancel() can emit the signal with the mutex locked.
+
+        connect(d->scheduler, SIGNAL(signalDone()),
+                this, SLOT(slotScheduledJobsDone()),
+                Qt::QueuedConnection);
+    }
+    else if ((backend == ThreadPoolBackend) && d->scheduler)
+    {
+        delete d->scheduler;
+        d->scheduler = nullptr;
+    }
+}
+
+ActionThreadBase::Backend ActionThreadBase::backend() const
+{
+    return (d->scheduler ? WorkStealingBackend : ThreadPoolBackend);
+}
+
 void ActionThreadBase::setMaximumNumberOfThreads(int n)
 {
     d->pool->setMaxThreadCount(n);
+
+    if (d->scheduler)
+    {
+        d->scheduler->setMaximumNumberOfThreads(n);
+    }
     qCDebug(DIGIKAM_GENERAL_LOG) << "Using " << n << " CPU core to run threads";
 }
 
@@ -160,6 +200,34 @@ void ActionThreadBase::slotJobFinished()
     d->condVarJobs.wakeAll();
 }
 
+void ActionThreadBase::slotScheduledJobsDone()
+{
+    QMutexLocker lock(&d->mutex);
+
+    // Jobs may have been scheduled since the signal was emitted.
+
+    if (!d->scheduler || (d->scheduler->pendingCount() > 0))
+    {
+        return;
+    }
+
+    qCDebug(DIGIKAM_GENERAL_LOG) << d->pending.count() << "jobs are done";
+
+    for (ActionJobCollection::const_iterator it = d->pending.constBegin() ; it != d->pending.constEnd() ; ++it)
+    {
+        d->processed.insert(it.key(), 0);
+    }
+
+    d->pending.clear();
+
+    if (d->todo.isEmpty())
+    {
+        d->running = false;
+    }
+
+    d->condVarJobs.wakeAll();
+}
+
 void ActionThreadBase::cancel()
 {
     qCDebug(DIGIKAM_GENERAL_LOG) << "Cancel Main Thread";
@@ -167,6 +235,11 @@ void ActionThreadBase::cancel()
 
     d->todo.clear();
 
+    if (d->scheduler)
+    {
+        d->scheduler->cancel();
+    }
+
     foreach (ActionJob* const job, d->pending.keys())
     {
         job->cancel();
@@ -186,6 +259,11 @@ bool ActionThreadBase::isEmpty() const
 
 int ActionThreadBase::pendingCount() const
 {
+    if (d->scheduler)
+    {
+        return d->scheduler->pendingCount();
+    }
+
     return d->pending.count();
 }
 
@@ -213,6 +291,21 @@ void ActionThreadBase::run()
         {
             qCDebug(DIGIKAM_GENERAL_LOG) << "Action Thread run " << d->todo.count() << " new jobs";
 
+            if (d->scheduler)
+            {
+                // The jobs are given at once, without a connection for each job.
+
+                for (ActionJobCollection::iterator it = d->todo.begin() ; it != d->todo.end() ; ++it)
+                {
+                    d->pending.insert(it.key(), it.value());
+                }
+
+                d->scheduler->schedule(d->todo);
+                d->todo.clear();
+
+                continue;
+            }
+
             for (ActionJobCollection::iterator it = d->todo.begin() ; it != d->todo.end() ; ++it)
             {
                 ActionJob* const job = it.key();
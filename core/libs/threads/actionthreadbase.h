@@ -93,11 +93,33 @@ class DIGIKAM_EXPORT ActionThreadBase : public QThread
 {
     Q_OBJECT
 
+public:
+
+    /** The way the jobs are run.
+     */
+    enum Backend
+    {
+        /** The jobs are started in a QThreadPool, and each job must emit signalDone() when it is done.
+         */
+        ThreadPoolBackend = 0,
+
+        /** The jobs are run by a WorkStealingScheduler, which balances long jobs over the threads
+         *  and has a lower cost for many small jobs. A job is done when its run() method returns.
+         */
+        WorkStealingBackend
+    };
+
 public:
 
     explicit ActionThreadBase(QObject* const parent=nullptr);
     virtual ~ActionThreadBase();
 
+    /** Select the way the jobs are run, ThreadPoolBackend by default.
+     *  It must be called before appending jobs.
+     */
+    void    setBackend(Backend backend);
+    Backend backend() const;
+
     /** Adjust maximum number of threads used to parallelize collection of job processing.
      */
     void setMaximumNumberOfThreads(int n);
@@ -138,6 +160,10 @@ protected Q_SLOTS:
 
     void slotJobFinished();
 
+private Q_SLOTS:
+
+    void slotScheduledJobsDone();
+
 private:
 
     class Private;
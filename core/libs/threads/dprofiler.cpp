@@ -0,0 +1,435 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-18
+ * Description : low overhead tracing of processing stages
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "dprofiler.h"
+
+// C++ includes
+
+#include <algorithm>
+
+// Qt includes
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QMap>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSet>
+#include <QSharedPointer>
+#include <QThread>
+#include <QThreadStorage>
+#include <QVector>
+
+// Local includes
+
+#include "digikam_debug.h"
+
+namespace Digikam
+{
+
+static QAtomicInt profilerEnabled(0);
+
+class Q_DECL_HIDDEN DProfiler::Private
+{
+public:
+
+    class Event
+    {
+    public:
+
+        const char* category;
+        const char* name;
+        qint64      start;
+
+        /// Duration in microseconds, or counter value
+        qint64      value;
+        bool        counter;
+    };
+
+    class ThreadBuffer
+    {
+    public:
+
+        explicit ThreadBuffer()
+          : tid(0)
+        {
+        }
+
+    public:
+
+        QMutex         mutex;
+        QVector<Event> events;
+        int            tid;
+        QByteArray     threadName;
+    };
+
+    typedef QSharedPointer<ThreadBuffer> ThreadBufferPtr;
+
+public:
+
+    explicit Private()
+      : maxEventsPerThread(1000000)
+    {
+        timer.start();
+    }
+
+    /**
+     * Return the buffer of the calling thread. The buffers are kept by the profiler
+     * when the threads are finished, to be able to export the events later.
+     */
+    ThreadBuffer* currentBuffer()
+    {
+        if (!localBuffer.hasLocalData())
+        {
+            ThreadBufferPtr buffer(new ThreadBuffer);
+            QThread* const thread = QThread::currentThread();
+
+            QMutexLocker lock(&mutex);
+
+            buffer->tid        = buffers.count() + 1;
+            buffer->threadName = thread->objectName().toUtf8();
+
+            if (buffer->threadName.isEmpty())
+            {
+                buffer->threadName = (QCoreApplication::instance() &&
+                                      (thread == QCoreApplication::instance()->thread()))
+                                     ? QByteArray("Main Thread")
+                                     : QByteArray("Thread ") + QByteArray::number(buffer->tid);
+            }
+
+            buffers << buffer;
+            localBuffer.setLocalData(buffer);
+        }
+
+        return localBuffer.localData().data();
+    }
+
+    void addEvent(const Event& event)
+    {
+        ThreadBuffer* const buffer = currentBuffer();
+        QMutexLocker lock(&buffer->mutex);
+
+        if (buffer->events.size() >= maxEventsPerThread)
+        {
+            dropped.fetchAndAddRelaxed(1);
+            return;
+        }
+
+        buffer->events << event;
+    }
+
+    static void appendJsonString(QByteArray& json, const char* str)
+    {
+        json += '"';
+
+        for (const char* c = str ; *c ; ++c)
+        {
+            if      (*c == '"' || *c == '\\')
+            {
+                json += '\\';
+                json += *c;
+            }
+            else if ((uchar)*c >= 0x20)
+            {
+                json += *c;
+            }
+        }
+
+        json += '"';
+    }
+
+public:
+
+    const int                       maxEventsPerThread;
+
+    QElapsedTimer                   timer;
+
+    QMutex                          mutex;
+    QList<ThreadBufferPtr>          buffers;
+    QThreadStorage<ThreadBufferPtr> localBuffer;
+    QSet<QByteArray>                names;
+
+    QAtomicInt                      dropped;
+};
+
+// -----------------------------------------------------------------------------------------
+
+class Q_DECL_HIDDEN DProfilerCreator
+{
+public:
+
+    DProfiler object;
+};
+
+Q_GLOBAL_STATIC(DProfilerCreator, creator)
+
+// -----------------------------------------------------------------------------------------
+
+DProfiler::DProfiler()
+    : d(new Private)
+{
+}
+
+DProfiler::~DProfiler()
+{
+    delete d;
+}
+
+DProfiler* DProfiler::instance()
+{
+    return &creator->object;
+}
+
+bool DProfiler::isEnabled()
+{
+    return profilerEnabled.loadAcquire();
+}
+
+void DProfiler::setEnabled(bool enabled)
+{
+    profilerEnabled.storeRelease(enabled ? 1 : 0);
+
+    qCDebug(DIGIKAM_GENERAL_LOG) << "Profiling" << (enabled ? "started" : "stopped");
+}
+
+void DProfiler::reset()
+{
+    QMutexLocker lock(&d->mutex);
+
+    foreach (const Private::ThreadBufferPtr& buffer, d->buffers)
+    {
+        QMutexLocker bufferLock(&buffer->mutex);
+        buffer->events.clear();
+    }
+
+    d->dropped.storeRelease(0);
+}
+
+qint64 DProfiler::now() const
+{
+    return (d->timer.nsecsElapsed() / 1000);
+}
+
+void DProfiler::addComplete(const char* category, const char* name, qint64 start, qint64 duration)
+{
+    Private::Event event;
+    event.category = category;
+    event.name     = name;
+    event.start    = start;
+    event.value    = duration;
+    event.counter  = false;
+
+    d->addEvent(event);
+}
+
+void DProfiler::addCounter(const char* category, const char* name, qint64 value)
+{
+    Private::Event event;
+    event.category = category;
+    event.name     = name;
+    event.start    = now();
+    event.value    = value;
+    event.counter  = true;
+
+    d->addEvent(event);
+}
+
+const char* DProfiler::internName(const QString& name)
+{
+    QMutexLocker lock(&d->mutex);
+
+    QSet<QByteArray>::const_iterator it = d->names.insert(name.toUtf8());
+
+    return it->constData();
+}
+
+qint64 DProfiler::eventsCount() const
+{
+    QMutexLocker lock(&d->mutex);
+    qint64 count = 0;
+
+    foreach (const Private::ThreadBufferPtr& buffer, d->buffers)
+    {
+        QMutexLocker bufferLock(&buffer->mutex);
+        count += buffer->events.size();
+    }
+
+    return count;
+}
+
+qint64 DProfiler::droppedCount() const
+{
+    return d->dropped.loadAcquire();
+}
+
+QList<DProfiler::Summary> DProfiler::summary() const
+{
+    QMap<QByteArray, Summary> map;
+
+    {
+        QMutexLocker lock(&d->mutex);
+
+        foreach (const Private::ThreadBufferPtr& buffer, d->buffers)
+        {
+            QMutexLocker bufferLock(&buffer->mutex);
+
+            foreach (const Private::Event& event, buffer->events)
+            {
+                // The same literal can have different addresses in different modules, compare the strings.
+
+                QByteArray key = QByteArray(event.category) + '/' + QByteArray(event.name);
+                Summary& item  = map[key];
+
+                if (item.count == 0)
+                {
+                    item.category = QByteArray(event.category);
+                    item.name     = QByteArray(event.name);
+                    item.counter  = event.counter;
+                    item.min      = event.value;
+                    item.max      = event.value;
+                }
+                else
+                {
+                    item.min      = qMin(item.min, event.value);
+                    item.max      = qMax(item.max, event.value);
+                }
+
+                item.count++;
+                item.total += event.value;
+            }
+        }
+    }
+
+    QList<Summary> list = map.values();
+
+    std::sort(list.begin(), list.end(),
+              [](const Summary& a, const Summary& b)
+              {
+                  if (a.counter != b.counter)
+                  {
+                      return b.counter;
+                  }
+
+                  return (a.total > b.total);
+              });
+
+    return list;
+}
+
+QByteArray DProfiler::chromeTrace() const
+{
+    const QByteArray pid = QByteArray::number(QCoreApplication::applicationPid());
+    QByteArray json;
+
+    json += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    QMutexLocker lock(&d->mutex);
+    bool first = true;
+
+    foreach (const Private::ThreadBufferPtr& buffer, d->buffers)
+    {
+        QMutexLocker bufferLock(&buffer->mutex);
+        const QByteArray tid = QByteArray::number(buffer->tid);
+
+        json.reserve(json.size() + buffer->events.size() * 120);
+
+        json += first ? "\n" : ",\n";
+        json += "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":" + pid + ",\"tid\":" + tid + ",\"args\":{\"name\":";
+        Private::appendJsonString(json, buffer->threadName.constData());
+        json += "}}";
+        first = false;
+
+        foreach (const Private::Event& event, buffer->events)
+        {
+            json += ",\n{\"ph\":\"";
+            json += event.counter ? "C" : "X";
+            json += "\",\"cat\":";
+            Private::appendJsonString(json, event.category);
+            json += ",\"name\":";
+            Private::appendJsonString(json, event.name);
+            json += ",\"pid\":" + pid + ",\"tid\":" + tid;
+            json += ",\"ts\":" + QByteArray::number(event.start);
+
+            if (event.counter)
+            {
+                json += ",\"args\":{\"value\":" + QByteArray::number(event.value) + "}}";
+            }
+            else
+            {
+                json += ",\"dur\":" + QByteArray::number(event.value) + "}";
+            }
+        }
+    }
+
+    json += "\n]}\n";
+
+    return json;
+}
+
+bool DProfiler::exportChromeTrace(const QString& filePath) const
+{
+    QFile file(filePath);
+
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        qCWarning(DIGIKAM_GENERAL_LOG) << "Cannot open" << filePath << "to export the profiling trace";
+        return false;
+    }
+
+    const QByteArray json = chromeTrace();
+
+    return (file.write(json) == json.size());
+}
+
+// -----------------------------------------------------------------------------------------
+
+DProfileScope::DProfileScope(const char* category, const char* name)
+    : m_category(category),
+      m_name(name),
+      m_start(DProfiler::isEnabled() ? DProfiler::instance()->now() : -1)
+{
+}
+
+DProfileScope::DProfileScope(const char* category, const QString& name)
+    : m_category(category),
+      m_name(nullptr),
+      m_start(-1)
+{
+    if (DProfiler::isEnabled())
+    {
+        m_name  = DProfiler::instance()->internName(name);
+        m_start = DProfiler::instance()->now();
+    }
+}
+
+DProfileScope::~DProfileScope()
+{
+    if (m_start >= 0)
+    {
+        DProfiler* const profiler = DProfiler::instance();
+        profiler->addComplete(m_category, m_name, m_start, profiler->now() - m_start);
+    }
+}
+
+} // namespace Digikam
@@ -0,0 +1,190 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-18
+ * Description : low overhead tracing of processing stages
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_DPROFILER_H
+#define DIGIKAM_DPROFILER_H
+
+// Qt includes
+
+#include <QList>
+#include <QString>
+#include <QByteArray>
+
+// Local includes
+
+#include "digikam_config.h"
+#include "digikam_export.h"
+
+namespace Digikam
+{
+
+/**
+ * DProfiler records the time spent in the processing stages of the application
+ * (scanning, loading, thumbnails, filters, database queries) and counter values.
+ *
+ * The stages are instrumented with the DIGIKAM_PROFILE_SCOPE() and DIGIKAM_PROFILE_COUNTER()
+ * macros, which compile to nothing if digiKam is not built with the ENABLE_PROFILING option.
+ * When built in, nothing is recorded until setEnabled() is called, and a disabled scope costs
+ * one atomic read. Each thread records in its own buffer, without contention with the others.
+ *
+ * The recorded events can be exported to the Chrome trace event JSON format, which can be opened
+ * with chrome://tracing or https://ui.perfetto.dev, or aggregated by stage with summary().
+ */
+class DIGIKAM_EXPORT DProfiler
+{
+public:
+
+    class Summary
+    {
+    public:
+
+        explicit Summary()
+          : counter(false),
+            count(0),
+            total(0),
+            min(0),
+            max(0)
+        {
+        }
+
+    public:
+
+        QByteArray category;
+        QByteArray name;
+
+        /// True for counter values, false for durations in microseconds
+        bool       counter;
+
+        qint64     count;
+        qint64     total;
+        qint64     min;
+        qint64     max;
+    };
+
+public:
+
+    static DProfiler* instance();
+
+    static bool isEnabled();
+    void setEnabled(bool enabled);
+
+    /**
+     * Remove all events recorded.
+     */
+    void reset();
+
+    /**
+     * Microseconds elapsed since the profiler was created.
+     */
+    qint64 now() const;
+
+    /**
+     * Record a stage of 'duration' microseconds started at 'start'. Category and name
+     * must be string literals, or strings returned by internName(), as only the pointers are stored.
+     */
+    void addComplete(const char* category, const char* name, qint64 start, qint64 duration);
+
+    /**
+     * Record the current value of a counter.
+     */
+    void addCounter(const char* category, const char* name, qint64 value);
+
+    /**
+     * Return a pointer to a copy of name which is kept until the application exits.
+     * Use it for names which are not string literals.
+     */
+    const char* internName(const QString& name);
+
+    /**
+     * Return the number of events recorded, and dropped after the buffers were full.
+     */
+    qint64 eventsCount()  const;
+    qint64 droppedCount() const;
+
+    /**
+     * Return the recorded events aggregated by category and name,
+     * sorted by decreasing total time.
+     */
+    QList<Summary> summary() const;
+
+    /**
+     * Return the recorded events in Chrome trace event JSON format.
+     */
+    QByteArray chromeTrace() const;
+    bool exportChromeTrace(const QString& filePath) const;
+
+private:
+
+    explicit DProfiler();
+    ~DProfiler();
+
+    DProfiler(const DProfiler&);            // Disable
+    DProfiler& operator=(const DProfiler&); // Disable
+
+private:
+
+    class Private;
+    Private* const d;
+
+    friend class DProfilerCreator;
+};
+
+// -----------------------------------------------------------------------------------------
+
+/**
+ * Record the time spent between creation and destruction of the object, if the profiler is enabled.
+ * Use it through DIGIKAM_PROFILE_SCOPE().
+ */
+class DIGIKAM_EXPORT DProfileScope
+{
+public:
+
+    explicit DProfileScope(const char* category, const char* name);
+    explicit DProfileScope(const char* category, const QString& name);
+    ~DProfileScope();
+
+private:
+
+    DProfileScope(const DProfileScope&);            // Disable
+    DProfileScope& operator=(const DProfileScope&); // Disable
+
+private:
+
+    const char* m_category;
+    const char* m_name;
+    qint64      m_start;
+};
+
+} // namespace Digikam
+
+#ifdef HAVE_PROFILING
+#   define DIGIKAM_PROFILE_CONCAT_(a, b)                  a##b
+#   define DIGIKAM_PROFILE_CONCAT(a, b)                   DIGIKAM_PROFILE_CONCAT_(a, b)
+#   define DIGIKAM_PROFILE_SCOPE(category, name)          Digikam::DProfileScope DIGIKAM_PROFILE_CONCAT(dprofileScope, __LINE__)(category, name)
+#   define DIGIKAM_PROFILE_COUNTER(category, name, value) do { if (Digikam::DProfiler::isEnabled()) Digikam::DProfiler::instance()->addCounter(category, name, value); } while (0)
+#else
+#   define DIGIKAM_PROFILE_SCOPE(category, name)
+#   define DIGIKAM_PROFILE_COUNTER(category, name, value)
+#endif
+
+#endif // DIGIKAM_DPROFILER_H
@@ -0,0 +1,496 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : Work stealing scheduler for batch processing jobs
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "workstealingscheduler.h"
+
+// Qt includes
+
+#include <QAtomicInt>
+#include <QList>
+#include <QMap>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QThread>
+#include <QWaitCondition>
+
+// Local includes
+
+#include "digikam_debug.h"
+
+namespace Digikam
+{
+
+class Q_DECL_HIDDEN WorkStealingScheduler::Private
+{
+public:
+
+    /**
+     * The queue of a worker. It is locked by its worker to take a job,
+     * and only by the other workers when they steal jobs.
+     */
+    class Queue
+    {
+    public:
+
+        explicit Queue()
+          : size(0),
+            running(nullptr)
+        {
+        }
+
+        QMutex                        mutex;
+
+        /// The jobs by priority, the highest priority is the last one.
+        QMap<int, QList<ActionJob*> > jobs;
+
+        /// The count of jobs, read without locking to find the queues to steal from.
+        QAtomicInt                    size;
+
+        /// The job run by the worker, to cancel it.
+        ActionJob*                    running;
+    };
+
+    class Worker : public QThread
+    {
+    public:
+
+        Worker(Private* const d, int index)
+          : QThread(),
+            m_d(d),
+            m_index(index)
+        {
+        }
+
+    protected:
+
+        void run() override
+        {
+            m_d->work(m_index);
+        }
+
+    private:
+
+        Private* const m_d;
+        const int      m_index;
+    };
+
+public:
+
+    explicit Private(WorkStealingScheduler* const q)
+      : q(q),
+        maxThreads(1),
+        nextQueue(0),
+        queued(0),
+        outstanding(0),
+        quit(0)
+    {
+    }
+
+    void       startWorkers();
+    void       stopWorkers();
+
+    /**
+     * The worker loop: run the jobs of the own queue, steal jobs from the others
+     * when it is empty, and sleep when all the queues are empty.
+     */
+    void       work(int index);
+
+    ActionJob* takeJob(int index);
+    ActionJob* stealJob(int index);
+
+    /**
+     * Account count jobs as done, and signal when no job is left.
+     */
+    void       jobsDone(int count);
+
+public:
+
+    WorkStealingScheduler* const q;
+
+    QList<Queue*>                queues;
+    QList<Worker*>               workers;
+    int                          maxThreads;
+    int                          nextQueue;
+
+    /// The count of jobs in the queues, and of jobs in the queues or running.
+    QAtomicInt                   queued;
+    QAtomicInt                   outstanding;
+    QAtomicInt                   quit;
+
+    /// Serializes the start and the stop of the workers with the scheduling and the canceling,
+    /// which use the queues.
+    QMutex                       workersMutex;
+
+    QMutex                       mutex;
+    QWaitCondition               jobsAvailable;
+    QWaitCondition               allDone;
+};
+
+void WorkStealingScheduler::Private::startWorkers()
+{
+    if (!workers.isEmpty())
+    {
+        return;
+    }
+
+    for (int i = 0 ; i < maxThreads ; ++i)
+    {
+        queues << new Queue;
+    }
+
+    for (int i = 0 ; i < maxThreads ; ++i)
+    {
+        Worker* const worker = new Worker(this, i);
+        workers << worker;
+        worker->start();
+    }
+}
+
+void WorkStealingScheduler::Private::stopWorkers()
+{
+    if (workers.isEmpty())
+    {
+        return;
+    }
+
+    {
+        QMutexLocker lock(&mutex);
+        quit.store(1);
+        jobsAvailable.wakeAll();
+    }
+
+    foreach (Worker* const worker, workers)
+    {
+        worker->wait();
+    }
+
+    qDeleteAll(workers);
+    workers.clear();
+    qDeleteAll(queues);
+    queues.clear();
+
+    quit.store(0);
+}
+
+void WorkStealingScheduler::Private::work(int index)
+{
+    Queue* const queue = queues.at(index);
+
+    while (!quit.load())
+    {
+        ActionJob* job = takeJob(index);
+
+        if (!job)
+        {
+            job = stealJob(index);
+        }
+
+        if (!job)
+        {
+            QMutexLocker lock(&mutex);
+
+            // The scheduling wakes up the workers after the jobs are queued,
+            // with this mutex locked: checking the count here does not miss it.
+
+            if (!quit.load() && (queued.load() <= 0))
+            {
+                jobsAvailable.wait(&mutex);
+            }
+
+            continue;
+        }
+
+        job->run();
+
+        {
+            QMutexLocker lock(&queue->mutex);
+            queue->running = nullptr;
+        }
+
+        jobsDone(1);
+    }
+}
+
+ActionJob* WorkStealingScheduler::Private::takeJob(int index)
+{
+    Queue* const queue = queues.at(index);
+
+    if (queue->size.load() == 0)
+    {
+        return nullptr;
+    }
+
+    QMutexLocker lock(&queue->mutex);
+
+    if (queue->jobs.isEmpty())
+    {
+        return nullptr;
+    }
+
+    QMap<int, QList<ActionJob*> >::iterator it = queue->jobs.end() - 1;
+    ActionJob* const job                       = it.value().takeFirst();
+
+    if (it.value().isEmpty())
+    {
+        queue->jobs.erase(it);
+    }
+
+    queue->size.deref();
+    queued.deref();
+    queue->running = job;
+
+    return job;
+}
+
+ActionJob* WorkStealingScheduler::Private::stealJob(int index)
+{
+    QList<ActionJob*> stolen;
+    int priority = 0;
+
+    for (int i = 1 ; stolen.isEmpty() && (i < queues.count()) ; ++i)
+    {
+        Queue* const victim = queues.at((index + i) % queues.count());
+
+        if (victim->size.load() == 0)
+        {
+            continue;
+        }
+
+        QMutexLocker lock(&victim->mutex);
+
+        if (victim->jobs.isEmpty())
+        {
+            continue;
+        }
+
+        // Take the second half of the jobs with the highest priority,
+        // the victim keeps the ones it would run first.
+
+        QMap<int, QList<ActionJob*> >::iterator it = victim->jobs.end() - 1;
+        const int count                            = (it.value().count() + 1) / 2;
+        stolen                                     = it.value().mid(it.value().count() - count);
+        priority                                   = it.key();
+
+        it.value().erase(it.value().end() - count, it.value().end());
+
+        if (it.value().isEmpty())
+        {
+            victim->jobs.erase(it);
+        }
+
+        victim->size.fetchAndAddOrdered(-count);
+    }
+
+    if (stolen.isEmpty())
+    {
+        return nullptr;
+    }
+
+    Queue* const queue   = queues.at(index);
+    ActionJob* const job = stolen.takeFirst();
+
+    QMutexLocker lock(&queue->mutex);
+
+    if (!stolen.isEmpty())
+    {
+        queue->jobs[priority] << stolen;
+        queue->size.fetchAndAddOrdered(stolen.count());
+    }
+
+    queued.deref();
+    queue->running = job;
+
+    return job;
+}
+
+void WorkStealingScheduler::Private::jobsDone(int count)
+{
+    if (outstanding.fetchAndAddOrdered(-count) != count)
+    {
+        return;
+    }
+
+    {
+        QMutexLocker lock(&mutex);
+        allDone.wakeAll();
+    }
+
+    emit q->signalDone();
+}
+
+// -----------------------------------------------------------------
+
+WorkStealingScheduler::WorkStealingScheduler(QObject* const parent)
+    : QObject(parent),
+      d(new Private(this))
+{
+    setMaximumNumberOfThreads(QThread::idealThreadCount());
+}
+
+WorkStealingScheduler::~WorkStealingScheduler()
+{
+    cancel();
+    waitForDone();
+
+    {
+        QMutexLocker lock(&d->workersMutex);
+        d->stopWorkers();
+    }
+
+    delete d;
+}
+
+void WorkStealingScheduler::setMaximumNumberOfThreads(int n)
+{
+    QMutexLocker lock(&d->workersMutex);
+
+    d->maxThreads = qMax(n, 1);
+
+    if ((d->outstanding.load() == 0) && (d->workers.count() != d->maxThreads))
+    {
+        d->stopWorkers();
+    }
+}
+
+int WorkStealingScheduler::maximumNumberOfThreads() const
+{
+    QMutexLocker lock(&d->workersMutex);
+
+    return d->maxThreads;
+}
+
+void WorkStealingScheduler::schedule(const ActionJobCollection& jobs)
+{
+    if (jobs.isEmpty())
+    {
+        return;
+    }
+
+    QMutexLocker workersLock(&d->workersMutex);
+
+    if ((d->outstanding.load() == 0) && (d->workers.count() != d->maxThreads))
+    {
+        d->stopWorkers();
+    }
+
+    d->startWorkers();
+
+    QMap<int, QList<ActionJob*> > byPriority;
+
+    for (ActionJobCollection::const_iterator it = jobs.constBegin() ; it != jobs.constEnd() ; ++it)
+    {
+        byPriority[it.value()] << it.key();
+    }
+
+    d->outstanding.fetchAndAddOrdered(jobs.count());
+
+    const int count = d->queues.count();
+
+    for (QMap<int, QList<ActionJob*> >::const_iterator it = byPriority.constBegin() ;
+         it != byPriority.constEnd() ; ++it)
+    {
+        const QList<ActionJob*>& list = it.value();
+
+        // One batch for each queue. The first queue changes for each priority,
+        // to spread the small collections over the workers.
+
+        for (int i = 0 ; i < count ; ++i)
+        {
+            const int begin = list.count() * i       / count;
+            const int end   = list.count() * (i + 1) / count;
+
+            if (begin == end)
+            {
+                continue;
+            }
+
+            Private::Queue* const queue = d->queues.at((d->nextQueue + i) % count);
+
+            QMutexLocker lock(&queue->mutex);
+            queue->jobs[it.key()] << list.mid(begin, end - begin);
+            queue->size.fetchAndAddOrdered(end - begin);
+            d->queued.fetchAndAddOrdered(end - begin);
+        }
+
+        d->nextQueue = (d->nextQueue + 1) % count;
+    }
+
+    QMutexLocker lock(&d->mutex);
+    d->jobsAvailable.wakeAll();
+}
+
+void WorkStealingScheduler::cancel()
+{
+    int removed = 0;
+
+    {
+        QMutexLocker workersLock(&d->workersMutex);
+
+        foreach (Private::Queue* const queue, d->queues)
+        {
+            QMutexLocker lock(&queue->mutex);
+            int count = 0;
+
+            foreach (const QList<ActionJob*>& list, queue->jobs)
+            {
+                count += list.count();
+            }
+
+            queue->jobs.clear();
+            queue->size.fetchAndAddOrdered(-count);
+            d->queued.fetchAndAddOrdered(-count);
+            removed += count;
+
+            if (queue->running)
+            {
+                queue->running->cancel();
+            }
+        }
+    }
+
+    // The last job done emits signalDone(), which may schedule new jobs.
+
+    if (removed)
+    {
+        qCDebug(DIGIKAM_GENERAL_LOG) << "Work stealing scheduler canceled" << removed << "jobs";
+
+        d->jobsDone(removed);
+    }
+}
+
+int WorkStealingScheduler::pendingCount() const
+{
+    return d->outstanding.load();
+}
+
+void WorkStealingScheduler::waitForDone()
+{
+    QMutexLocker lock(&d->mutex);
+
+    while (d->outstanding.load() > 0)
+    {
+        d->allDone.wait(&d->mutex);
+    }
+}
+
+} // namespace Digikam
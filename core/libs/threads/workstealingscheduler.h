@@ -0,0 +1,101 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : Work stealing scheduler for batch processing jobs
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_WORK_STEALING_SCHEDULER_H
+#define DIGIKAM_WORK_STEALING_SCHEDULER_H
+
+// Qt includes
+
+#include <QObject>
+
+// Local includes
+
+#include "digikam_export.h"
+#include "actionthreadbase.h"
+
+namespace Digikam
+{
+
+/**
+ * WorkStealingScheduler runs ActionJobs on its own worker threads, each one with its own queue.
+ *
+ * A collection of jobs is split in one batch for each worker, so the queues are locked once for
+ * the whole collection, and the workers take their jobs without contention with the others.
+ * A worker which has nothing left to do steals half of the jobs of the queue of another worker,
+ * so the cores are not starved while one queue holds long jobs, as the RAW files.
+ *
+ * In each queue, the jobs with a higher priority run first, as with QThreadPool.
+ * The jobs are not deleted by the scheduler, and the completion of each job is not
+ * signaled: signalDone() is emitted once when all the scheduled jobs are done.
+ */
+class DIGIKAM_EXPORT WorkStealingScheduler : public QObject
+{
+    Q_OBJECT
+
+public:
+
+    explicit WorkStealingScheduler(QObject* const parent = nullptr);
+
+    /** Cancel the jobs and wait for the running ones.
+     */
+    ~WorkStealingScheduler();
+
+    /** Adjust the number of worker threads. It is applied when no job is scheduled.
+     */
+    void setMaximumNumberOfThreads(int n);
+    int  maximumNumberOfThreads() const;
+
+    /** Queue a collection of jobs with their priorities.
+     */
+    void schedule(const ActionJobCollection& jobs);
+
+    /** Remove the jobs which are not started, and cancel the running ones,
+     *  which stop when they check their cancel flag.
+     */
+    void cancel();
+
+    /** Return the number of jobs queued or running.
+     */
+    int  pendingCount() const;
+
+    /** Wait until all the jobs are done.
+     */
+    void waitForDone();
+
+Q_SIGNALS:
+
+    /** Emitted from a worker thread when the last scheduled job is done.
+     *  Jobs must not be scheduled from a direct connection to it, as the workers can be stopped
+     *  by another thread while it is emitted.
+     */
+    void signalDone();
+
+private:
+
+    class Private;
+    Private* const d;
+};
+
+} // namespace Digikam
+
+#endif // DIGIKAM_WORK_STEALING_SCHEDULER_H
@@ -48,11 +48,29 @@ EffectMngr::EffectType EffectMngr::Private::getRandomEffect() const
 
 void EffectMngr::Private::updateCurrentFrame(const QRectF& area)
 {
-    QImage kbImg = eff_image.copy(area.toAlignedRect())
-                            .scaled(eff_outSize,
-                                    Qt::KeepAspectRatioByExpanding,
-                                    Qt::SmoothTransformation);
-    eff_curFrame = kbImg.convertToFormat(QImage::Format_ARGB32);
+    const QRect rect = area.toAlignedRect();
+
+    // The area is scaled directly in the buffer of the frame, without copying it first.
+
+    FrameKernels::prepareFrame(eff_curFrame,
+                               rect.size().scaled(eff_outSize, Qt::KeepAspectRatioByExpanding),
+                               QImage::Format_ARGB32);
+
+    if (!FrameKernels::scaledBlit(eff_image, rect, eff_curFrame))
+    {
+        QImage kbImg = eff_image.copy(rect)
+                                .scaled(eff_outSize,
+                                        Qt::KeepAspectRatioByExpanding,
+                                        Qt::SmoothTransformation);
+        eff_curFrame = kbImg.convertToFormat(QImage::Format_ARGB32);
+    }
+    else if (eff_curFrame.format() != QImage::Format_ARGB32)
+    {
+        // The blit keeps the format of the image, the frames are always ARGB32 as before.
+        // The images made by FrameUtils are already ARGB32 and are not converted.
+
+        eff_curFrame = eff_curFrame.convertToFormat(QImage::Format_ARGB32);
+    }
 }
 
 int EffectMngr::Private::effectRandom(bool /*aInit*/)
@@ -37,6 +37,7 @@
 // Local includes
 
 #include "effectmngr.h"
+#include "framekernels.h"
 #include "digikam_config.h"
 #include "digikam_debug.h"
 
@@ -0,0 +1,430 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : optimized pixel kernels to render transition and effect frames
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "framekernels.h"
+
+// C++ includes
+
+#ifdef __SSE2__
+#   include <emmintrin.h>
+#endif
+
+// Qt includes
+
+#include <QList>
+#include <QVector>
+#include <QFuture>
+#include <QThreadPool>
+#include <QtConcurrent>
+
+namespace Digikam
+{
+
+namespace
+{
+
+/**
+ * Interpolate the 4 channels of two pixels, with a + b = 256.
+ * The channels are computed two by two in 32 bits integers.
+ */
+inline quint32 interpolatePixel256(quint32 x, uint a, quint32 y, uint b)
+{
+    quint32 t = (x & 0x00ff00ff) * a + (y & 0x00ff00ff) * b;
+    t       >>= 8;
+    t        &= 0x00ff00ff;
+
+    x         = ((x >> 8) & 0x00ff00ff) * a + ((y >> 8) & 0x00ff00ff) * b;
+    x        &= 0xff00ff00;
+
+    return (x | t);
+}
+
+/**
+ * Add or remove the channels of a row of pixels to the sums of the columns.
+ */
+inline void addRow(quint32* const sums, const quint32* const line, int width)
+{
+    for (int x = 0 ; x < width ; ++x)
+    {
+        sums[x*4]     += (line[x] >> 24);
+        sums[x*4 + 1] += (line[x] >> 16) & 0xff;
+        sums[x*4 + 2] += (line[x] >> 8)  & 0xff;
+        sums[x*4 + 3] +=  line[x]        & 0xff;
+    }
+}
+
+inline void removeRow(quint32* const sums, const quint32* const line, int width)
+{
+    for (int x = 0 ; x < width ; ++x)
+    {
+        sums[x*4]     -= (line[x] >> 24);
+        sums[x*4 + 1] -= (line[x] >> 16) & 0xff;
+        sums[x*4 + 2] -= (line[x] >> 8)  & 0xff;
+        sums[x*4 + 3] -=  line[x]        & 0xff;
+    }
+}
+
+} // namespace
+
+bool FrameKernels::crossFade(const QImage& from, const QImage& to, int alpha, QImage& dest)
+{
+    if (from.isNull() || (from.size() != to.size()))
+    {
+        return false;
+    }
+
+    const QImage src1 = supportedImage(from);
+    const QImage src2 = supportedImage(to);
+
+    prepareFrame(dest, src1.size(), src1.format());
+
+    Args prm;
+    prm.width   = dest.width();
+    prm.height  = dest.height();
+    prm.src1    = src1.constBits();
+    prm.src1Bpl = src1.bytesPerLine();
+    prm.src2    = src2.constBits();
+    prm.src2Bpl = src2.bytesPerLine();
+    prm.dest    = dest.bits();
+    prm.destBpl = dest.bytesPerLine();
+    prm.value   = qBound(0, alpha, 256);
+    prm.xTable  = nullptr;
+
+    runMultithreaded(&FrameKernels::crossFadeMultithreaded, prm, bands(prm.height, 64));
+
+    return true;
+}
+
+void FrameKernels::boxBlur(const QImage& img, int radius, QImage& dest)
+{
+    if ((radius < 1) || img.isNull() || (img.width() < (radius << 1)))
+    {
+        dest = img;
+        return;
+    }
+
+    const QImage src = supportedImage(img);
+
+    prepareFrame(dest, src.size(), src.format());
+
+    Args prm;
+    prm.width   = dest.width();
+    prm.height  = dest.height();
+    prm.src1    = src.constBits();
+    prm.src1Bpl = src.bytesPerLine();
+    prm.src2    = nullptr;
+    prm.src2Bpl = 0;
+    prm.dest    = dest.bits();
+    prm.destBpl = dest.bytesPerLine();
+    prm.value   = radius;
+    prm.xTable  = nullptr;
+
+    // Each band sums the rows of the window of its first row, the bands are kept large
+    // enough compared to the radius for this to stay cheap.
+
+    runMultithreaded(&FrameKernels::boxBlurMultithreaded, prm, bands(prm.height, qMax(64, radius * 4)));
+}
+
+bool FrameKernels::scaledBlit(const QImage& img, const QRect& area, QImage& dest)
+{
+    const QRect rect = area.intersected(img.rect());
+
+    if (rect.isEmpty()                           ||
+        dest.isNull()                            ||
+        (rect.width()  > (dest.width()  * 2))    ||
+        (rect.height() > (dest.height() * 2)))
+    {
+        return false;
+    }
+
+    const QImage src = supportedImage(img);
+
+    // The columns and the weights of the source pixels used for each column of the frame.
+
+    QVector<int> xTable(dest.width() * 3);
+    const double sx = (double)rect.width() / (double)dest.width();
+
+    for (int x = 0 ; x < dest.width() ; ++x)
+    {
+        const double fx = qBound(0.0, (x + 0.5) * sx - 0.5, rect.width() - 1.0);
+        const int    x0 = (int)fx;
+
+        xTable[x*3]     = rect.left() + x0;
+        xTable[x*3 + 1] = rect.left() + qMin(x0 + 1, rect.width() - 1);
+        xTable[x*3 + 2] = qRound((fx - x0) * 256.0);
+    }
+
+    // The frame keeps its format, the pixels are copied as stored.
+
+    if (dest.format() != src.format())
+    {
+        prepareFrame(dest, dest.size(), src.format());
+    }
+
+    Args prm;
+    prm.width   = dest.width();
+    prm.height  = dest.height();
+    prm.src1    = src.constBits();
+    prm.src1Bpl = src.bytesPerLine();
+    prm.src2    = nullptr;
+    prm.src2Bpl = 0;
+    prm.dest    = dest.bits();
+    prm.destBpl = dest.bytesPerLine();
+    prm.value   = 0;
+    prm.area    = rect;
+    prm.xTable  = xTable.constData();
+
+    runMultithreaded(&FrameKernels::scaledBlitMultithreaded, prm, bands(prm.height, 64));
+
+    return true;
+}
+
+void FrameKernels::prepareFrame(QImage& dest, const QSize& size, QImage::Format format)
+{
+    if ((dest.size() != size) || (dest.format() != format) || !dest.isDetached())
+    {
+        dest = QImage(size, format);
+    }
+}
+
+QImage FrameKernels::supportedImage(const QImage& img)
+{
+    switch (img.format())
+    {
+        case QImage::Format_RGB32:
+        case QImage::Format_ARGB32:
+        case QImage::Format_ARGB32_Premultiplied:
+            return img;
+
+        default:
+            return img.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+    }
+}
+
+QList<int> FrameKernels::bands(int height, int minRows)
+{
+    const int nbCore = QThreadPool::globalInstance()->maxThreadCount();
+    const int count  = qBound(1, height / qMax(1, minRows), qMax(1, nbCore));
+    QList<int> vals;
+
+    for (int i = 0 ; i < count ; ++i)
+    {
+        vals << (int)((qint64)height * i / count);
+    }
+
+    vals << height;
+
+    return vals;
+}
+
+void FrameKernels::runMultithreaded(void (*func)(const Args&), Args prm, const QList<int>& vals)
+{
+    if (vals.count() == 2)
+    {
+        prm.start = vals[0];
+        prm.stop  = vals[1];
+        func(prm);
+
+        return;
+    }
+
+    QList <QFuture<void> > tasks;
+
+    for (int j = 0 ; j < (vals.count() - 1) ; ++j)
+    {
+        prm.start = vals[j];
+        prm.stop  = vals[j+1];
+        tasks.append(QtConcurrent::run(func, prm));
+    }
+
+    foreach (QFuture<void> t, tasks)
+    {
+        t.waitForFinished();
+    }
+}
+
+void FrameKernels::crossFadeMultithreaded(const Args& prm)
+{
+    const uint b = prm.value;
+    const uint a = 256 - b;
+
+#ifdef __SSE2__
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i va   = _mm_set1_epi16((short)a);
+    const __m128i vb   = _mm_set1_epi16((short)b);
+#endif
+
+    for (int y = prm.start ; y < prm.stop ; ++y)
+    {
+        const quint32* const line1 = reinterpret_cast<const quint32*>(prm.src1 + y * prm.src1Bpl);
+        const quint32* const line2 = reinterpret_cast<const quint32*>(prm.src2 + y * prm.src2Bpl);
+        quint32* const dline       = reinterpret_cast<quint32*>(prm.dest + y * prm.destBpl);
+        int x                      = 0;
+
+#ifdef __SSE2__
+        // 4 pixels at once, the channels are interpolated in 16 bits integers.
+
+        for ( ; x + 4 <= prm.width ; x += 4)
+        {
+            const __m128i p1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(line1 + x));
+            const __m128i p2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(line2 + x));
+
+            __m128i lo       = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(p1, zero), va),
+                                             _mm_mullo_epi16(_mm_unpacklo_epi8(p2, zero), vb));
+            __m128i hi       = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(p1, zero), va),
+                                             _mm_mullo_epi16(_mm_unpackhi_epi8(p2, zero), vb));
+            lo               = _mm_srli_epi16(lo, 8);
+            hi               = _mm_srli_epi16(hi, 8);
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dline + x), _mm_packus_epi16(lo, hi));
+        }
+#endif
+
+        for ( ; x < prm.width ; ++x)
+        {
+            dline[x] = interpolatePixel256(line1[x], a, line2[x], b);
+        }
+    }
+}
+
+void FrameKernels::boxBlurMultithreaded(const Args& prm)
+{
+    const int radius = prm.value;
+    const int w      = prm.width;
+    const int h      = prm.height;
+
+    // The sums of the channels of each column in the rows of the window, updated from row to row.
+
+    QVector<quint32> sums(w * 4, 0);
+    quint32* const cols = sums.data();
+
+    // The divisions by the count of pixels in the window are done with 32 bits fixed point
+    // reciprocals, exact for the radius used by the transitions.
+
+    QVector<quint64> reciprocals(2 * radius + 2, 0);
+    int lastHeight = 0;
+
+    for (int y = qMax(0, prm.start - radius) ; y <= qMin(h - 1, prm.start + radius) ; ++y)
+    {
+        addRow(cols, reinterpret_cast<const quint32*>(prm.src1 + y * prm.src1Bpl), w);
+    }
+
+    for (int y = prm.start ; y < prm.stop ; ++y)
+    {
+        const int mh = qMin(h - 1, y + radius) - qMax(0, y - radius) + 1;
+
+        if (mh != lastHeight)
+        {
+            for (int mw = 1 ; mw < reciprocals.size() ; ++mw)
+            {
+                const quint64 mt = mw * mh;
+                reciprocals[mw]  = ((Q_UINT64_C(1) << 32) + mt - 1) / mt;
+            }
+
+            lastHeight = mh;
+        }
+
+        quint32* const dline = reinterpret_cast<quint32*>(prm.dest + y * prm.destBpl);
+        quint32 a            = 0;
+        quint32 r            = 0;
+        quint32 g            = 0;
+        quint32 b            = 0;
+
+        for (int x = 0 ; x <= qMin(radius - 1, w - 1) ; ++x)
+        {
+            a += cols[x*4];
+            r += cols[x*4 + 1];
+            g += cols[x*4 + 2];
+            b += cols[x*4 + 3];
+        }
+
+        for (int x = 0 ; x < w ; ++x)
+        {
+            const int right = x + radius;
+            const int left  = x - radius - 1;
+
+            if (right < w)
+            {
+                a += cols[right*4];
+                r += cols[right*4 + 1];
+                g += cols[right*4 + 2];
+                b += cols[right*4 + 3];
+            }
+
+            if (left >= 0)
+            {
+                a -= cols[left*4];
+                r -= cols[left*4 + 1];
+                g -= cols[left*4 + 2];
+                b -= cols[left*4 + 3];
+            }
+
+            const quint64 inv = reciprocals[qMin(w - 1, right) - qMax(0, x - radius) + 1];
+
+            dline[x] = ((quint32)((a * inv) >> 32) << 24) |
+                       ((quint32)((r * inv) >> 32) << 16) |
+                       ((quint32)((g * inv) >> 32) << 8)  |
+                        (quint32)((b * inv) >> 32);
+        }
+
+        // Move the window to the next row.
+
+        if ((y - radius) >= 0)
+        {
+            removeRow(cols, reinterpret_cast<const quint32*>(prm.src1 + (y - radius) * prm.src1Bpl), w);
+        }
+
+        if ((y + radius + 1) < h)
+        {
+            addRow(cols, reinterpret_cast<const quint32*>(prm.src1 + (y + radius + 1) * prm.src1Bpl), w);
+        }
+    }
+}
+
+void FrameKernels::scaledBlitMultithreaded(const Args& prm)
+{
+    const QRect& rect = prm.area;
+    const double sy   = (double)rect.height() / (double)prm.height;
+
+    for (int y = prm.start ; y < prm.stop ; ++y)
+    {
+        const double fy            = qBound(0.0, (y + 0.5) * sy - 0.5, rect.height() - 1.0);
+        const int    y0            = (int)fy;
+        const int    y1            = qMin(y0 + 1, rect.height() - 1);
+        const uint   wy            = qRound((fy - y0) * 256.0);
+
+        const quint32* const line0 = reinterpret_cast<const quint32*>(prm.src1 + (rect.top() + y0) * prm.src1Bpl);
+        const quint32* const line1 = reinterpret_cast<const quint32*>(prm.src1 + (rect.top() + y1) * prm.src1Bpl);
+        quint32* const dline       = reinterpret_cast<quint32*>(prm.dest + y * prm.destBpl);
+        const int* xt              = prm.xTable;
+
+        for (int x = 0 ; x < prm.width ; ++x, xt += 3)
+        {
+            const uint wx      = xt[2];
+            const quint32 top  = interpolatePixel256(line0[xt[0]], 256 - wx, line0[xt[1]], wx);
+            const quint32 bot  = interpolatePixel256(line1[xt[0]], 256 - wx, line1[xt[1]], wx);
+            dline[x]           = interpolatePixel256(top, 256 - wy, bot, wy);
+        }
+    }
+}
+
+} // namespace Digikam
@@ -0,0 +1,110 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : optimized pixel kernels to render transition and effect frames
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_FRAME_KERNELS_H
+#define DIGIKAM_FRAME_KERNELS_H
+
+// Qt includes
+
+#include <QImage>
+#include <QRect>
+#include <QSize>
+
+// Local includes
+
+#include "digikam_export.h"
+
+namespace Digikam
+{
+
+/**
+ * The kernels work on 32 bits images, RGB32, ARGB32 or ARGB32_Premultiplied, other
+ * formats are converted. The channels are processed as stored, which is exact for
+ * premultiplied and opaque images, as the frames made by FrameUtils.
+ *
+ * The rows of the frame are processed by bands in the global thread pool. The frame is
+ * rendered in the destination image when it has the right size and format and is not
+ * shared, as the previous frame of a manager released by the caller, to not allocate
+ * a new buffer for each frame.
+ */
+class DIGIKAM_EXPORT FrameKernels
+{
+public:
+
+    /**
+     * Render in dest the cross-fade between two images, with alpha from 0, for the from image,
+     * to 256, for the to image. Return false, without rendering, if the images have not the same size.
+     */
+    static bool crossFade(const QImage& from, const QImage& to, int alpha, QImage& dest);
+
+    /**
+     * Render in dest the box blur of the image, the average of the pixels in a square
+     * of 2 x radius + 1 pixels, clipped to the image. The cost does not depend on the radius.
+     */
+    static void boxBlur(const QImage& img, int radius, QImage& dest);
+
+    /**
+     * Render in dest the area of the image scaled to the size of dest, with a bilinear
+     * interpolation. Return false, without rendering, if the area is reduced more than twice,
+     * where the interpolation is not smooth enough. The pixels are copied as stored, so dest
+     * takes the format of the image.
+     */
+    static bool scaledBlit(const QImage& img, const QRect& area, QImage& dest);
+
+    /**
+     * Prepare dest to receive a frame of this size and format.
+     */
+    static void prepareFrame(QImage& dest, const QSize& size, QImage::Format format);
+
+private:
+
+    struct Args
+    {
+        int          start;
+        int          stop;
+        int          width;
+        int          height;
+        const uchar* src1;
+        int          src1Bpl;
+        const uchar* src2;
+        int          src2Bpl;
+        uchar*       dest;
+        int          destBpl;
+        int          value;
+        QRect        area;
+        const int*   xTable;
+    };
+
+    static QImage     supportedImage(const QImage& img);
+
+    static QList<int> bands(int height, int minRows);
+
+    static void       crossFadeMultithreaded(const Args& prm);
+    static void       boxBlurMultithreaded(const Args& prm);
+    static void       scaledBlitMultithreaded(const Args& prm);
+
+    static void       runMultithreaded(void (*func)(const Args&), Args prm, const QList<int>& vals);
+};
+
+} // namespace Digikam
+
+#endif // DIGIKAM_FRAME_KERNELS_H
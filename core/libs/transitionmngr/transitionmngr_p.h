@@ -37,6 +37,7 @@
 // Local includes
 
 #include "transitionmngr.h"
+#include "framekernels.h"
 #include "digikam_config.h"
 #include "digikam_debug.h"
 
@@ -178,11 +179,6 @@ private:
     int transitionSwapB2T(bool aInit);
     int transitionBlurIn(bool aInit);
     int transitionBlurOut(bool aInit);
-
-private:
-
-    QRgb   convertFromPremult(const QRgb& p) const;
-    QImage fastBlur(const QImage& img, int radius) const;
 };
 
 } // namespace Digikam
@@ -33,6 +33,17 @@
 #include <QSize>
 #include <QPainter>
 #include <QFileInfo>
+#include <QQueue>
+#include <QList>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QWaitCondition>
+#include <QThread>
+#include <QThreadPool>
+#include <QFuture>
+#include <QElapsedTimer>
+#include <QTime>
+#include <QtConcurrent>
 
 // KDE includes
 
@@ -62,15 +73,136 @@ using namespace QtAV;
 namespace Digikam
 {
 
+namespace
+{
+
+/**
+ * The memory used by the rendered frames waiting to be encoded, when they are not encoded
+ * as fast as they are rendered. 4K frames use 32 MB in RGB, 12 MB in YUV 4:2:0.
+ */
+const qint64 framesMemoryBudget = 512 * 1024 * 1024;
+
+} // namespace
+
 class Q_DECL_HIDDEN VidSlideTask::Private
 {
+public:
+
+    /**
+     * A bounded queue of frames, filled by a rendering thread and emptied by the encoder.
+     */
+    class FrameQueue
+    {
+    public:
+
+        explicit FrameQueue(int capacity)
+          : capacity(capacity),
+            finished(false),
+            canceled(false)
+        {
+        }
+
+        /// Wait while the queue is full.
+        void push(const VideoFrame& frame)
+        {
+            QMutexLocker lock(&mutex);
+
+            while ((frames.size() >= capacity) && !canceled)
+            {
+                notFull.wait(&mutex);
+            }
+
+            frames.enqueue(frame);
+            notEmpty.wakeAll();
+        }
+
+        /// Wait while the queue is empty, return false when all the frames were taken.
+        bool pop(VideoFrame& frame)
+        {
+            QMutexLocker lock(&mutex);
+
+            while (frames.isEmpty() && !finished && !canceled)
+            {
+                notEmpty.wait(&mutex);
+            }
+
+            if (frames.isEmpty())
+            {
+                return false;
+            }
+
+            frame = frames.dequeue();
+            notFull.wakeAll();
+
+            return true;
+        }
+
+        void finish()
+        {
+            QMutexLocker lock(&mutex);
+            finished = true;
+            notEmpty.wakeAll();
+        }
+
+        void cancel()
+        {
+            QMutexLocker lock(&mutex);
+            canceled = true;
+            frames.clear();
+            notFull.wakeAll();
+            notEmpty.wakeAll();
+        }
+
+    private:
+
+        const int          capacity;
+        bool               finished;
+        bool               canceled;
+        QQueue<VideoFrame> frames;
+        QMutex             mutex;
+        QWaitCondition     notFull;
+        QWaitCondition     notEmpty;
+    };
+
+    /**
+     * The frames of one image of the slideshow: the transition from the previous image,
+     * and the effect on the image, except after the last image.
+     */
+    class Segment
+    {
+    public:
+
+        explicit Segment(int capacity)
+          : seed(0),
+            transitionFrames(capacity),
+            effectFrames(capacity)
+        {
+        }
+
+        QString         file;
+
+        /// The random transitions and effects are drawn from this seed, and not from the time
+        /// when the rendering threads start, which is the same for several segments.
+        uint            seed;
+        QFuture<QImage> image;
+        FrameQueue      transitionFrames;
+        FrameQueue      effectFrames;
+
+        /// The last frame of the effect, from where the next transition starts.
+        QFuture<QImage> effect;
+        QFuture<void>   transition;
+    };
+
 public:
 
     explicit Private()
     {
-        settings = nullptr;
-        astream  = 0;
-        adec     = AudioDecoder::create("FFmpeg");
+        settings    = nullptr;
+        astream     = 0;
+        adec        = AudioDecoder::create("FFmpeg");
+        pixelFormat = VideoFormat::Format_Invalid;
+        canceled    = 0;
+        capacity    = 2;
     }
 
     ~Private()
@@ -85,6 +217,27 @@ public:
 
     AudioFrame nextAudioFrame(const AudioFormat& afmt);
 
+    /**
+     * Start the loading of the image of the segment, and the rendering of its frames,
+     * from the last frame of the previous segment.
+     */
+    Segment*   startSegment(const QString& file, const QFuture<QImage>& previous, bool withEffect);
+
+    /**
+     * Stop the rendering threads and delete the segments.
+     */
+    void       stopSegments(QList<Segment*>& segments);
+
+    // Run in the pools.
+
+    QImage     loadImage(const QString& file);
+    void       renderTransition(QFuture<QImage> previous, QFuture<QImage> image,
+                                FrameQueue* const queue, uint seed);
+    QImage     renderEffect(QFuture<QImage> image, FrameQueue* const queue, uint seed);
+
+    /// Convert to the pixel format of the encoder, which is done by the rendering threads.
+    VideoFrame videoFrame(const QImage& image) const;
+
 public:
 
     VidSlideSettings*           settings;
@@ -94,6 +247,18 @@ public:
     int                         astream;
     AudioDecoder*               adec;
     QList<QUrl>::const_iterator curAudioFile;
+
+    QSize                       outSize;
+    VideoFormat::PixelFormat    pixelFormat;
+
+    /// Maximum number of frames waiting in each queue.
+    int                         capacity;
+    QAtomicInt                  canceled;
+
+    /// The images are loaded and scaled in a pool, and the frames are rendered in another one,
+    /// as the rendering threads wait for the images.
+    QThreadPool                 loadPool;
+    QThreadPool                 renderPool;
 };
 
 bool VidSlideTask::Private::encodeFrame(VideoFrame& vframe,
@@ -146,6 +311,125 @@ bool VidSlideTask::Private::encodeFrame(VideoFrame& vframe,
     return false;
 }
 
+VidSlideTask::Private::Segment* VidSlideTask::Private::startSegment(const QString& file,
+                                                                   const QFuture<QImage>& previous,
+                                                                   bool withEffect)
+{
+    Segment* const segment  = new Segment(capacity);
+    segment->file           = file;
+    segment->seed           = qrand();
+    segment->image          = QtConcurrent::run(&loadPool, this, &Private::loadImage, file);
+    segment->transition     = QtConcurrent::run(&renderPool, this, &Private::renderTransition,
+                                                previous, segment->image, &segment->transitionFrames,
+                                                segment->seed);
+
+    if (withEffect)
+    {
+        segment->effect     = QtConcurrent::run(&renderPool, this, &Private::renderEffect,
+                                                segment->image, &segment->effectFrames,
+                                                segment->seed + 1);
+    }
+    else
+    {
+        segment->effectFrames.finish();
+    }
+
+    return segment;
+}
+
+void VidSlideTask::Private::stopSegments(QList<Segment*>& segments)
+{
+    canceled = 1;
+
+    foreach (Segment* const segment, segments)
+    {
+        segment->transitionFrames.cancel();
+        segment->effectFrames.cancel();
+    }
+
+    loadPool.waitForDone();
+    renderPool.waitForDone();
+
+    qDeleteAll(segments);
+    segments.clear();
+}
+
+QImage VidSlideTask::Private::loadImage(const QString& file)
+{
+    return FrameUtils::makeFramedImage(file, outSize);
+}
+
+void VidSlideTask::Private::renderTransition(QFuture<QImage> previous,
+                                             QFuture<QImage> image,
+                                             FrameQueue* const queue,
+                                             uint seed)
+{
+    TransitionMngr transmngr;
+
+    // The random generator is per thread, and the manager seeds it with the time.
+
+    qsrand(seed);
+
+    transmngr.setOutputSize(outSize);
+    transmngr.setInImage(previous.result());
+    transmngr.setOutImage(image.result());
+    transmngr.setTransition(settings->transition);
+
+    int tmout = 0;
+
+    do
+    {
+        queue->push(videoFrame(transmngr.currentFrame(tmout)));
+    }
+    while (tmout != -1 && !canceled);
+
+    queue->finish();
+}
+
+QImage VidSlideTask::Private::renderEffect(QFuture<QImage> image, FrameQueue* const queue, uint seed)
+{
+    EffectMngr effmngr;
+
+    // The random generator is per thread, and the manager seeds it with the time.
+
+    qsrand(seed);
+
+    effmngr.setOutputSize(outSize);
+    effmngr.setFrames(settings->imgFrames);
+    effmngr.setImage(image.result());
+    effmngr.setEffect(settings->vEffect);
+
+    // The frames which cannot be encoded are completed by the encoder thread.
+
+    QImage frame;
+    int rendered = 0;
+    int tmout    = 0;
+
+    do
+    {
+        frame = effmngr.currentFrame(tmout);
+        queue->push(videoFrame(frame));
+        ++rendered;
+    }
+    while (rendered < settings->imgFrames && !canceled);
+
+    queue->finish();
+
+    return frame;
+}
+
+VideoFrame VidSlideTask::Private::videoFrame(const QImage& image) const
+{
+    VideoFrame frame(image);
+
+    if (frame.pixelFormat() != pixelFormat)
+    {
+        frame = frame.to(pixelFormat);
+    }
+
+    return frame;
+}
+
 AudioFrame VidSlideTask::Private::nextAudioFrame(const AudioFormat& afmt)
 {
     if (curAudioFile == settings->inputAudio.constEnd())
@@ -326,87 +610,132 @@ void VidSlideTask::run()
         return;
     }
 
-    QImage qiimg;
-
     // ---------------------------------------------
-    // Loop to encode frames with images list
+    // Pipeline to encode frames with images list:
+    // the images are loaded and the frames rendered in parallel for the next images,
+    // while the frames are encoded in order in this thread.
 
-    TransitionMngr transmngr;
-    transmngr.setOutputSize(osize);
+    const int count    = d->settings->inputImages.count();
+    const int inFlight = qMax(2, QThread::idealThreadCount());
 
-    EffectMngr effmngr;
-    effmngr.setOutputSize(osize);
-    effmngr.setFrames(d->settings->imgFrames);
+    d->outSize         = osize;
+    d->pixelFormat     = venc->pixelFormat();
+    d->capacity        = qBound<qint64>(2, framesMemoryBudget / (2 * inFlight * (qint64)osize.width() * osize.height() * 4), 32);
+    d->loadPool.setMaxThreadCount(inFlight);
+    d->renderPool.setMaxThreadCount(2 * inFlight);
+
+    QList<Private::Segment*> segments;
+    QFuture<QImage>          previous = QtConcurrent::run(&d->loadPool, d, &Private::loadImage, QString());
+    int                      started  = 0;
+    int                      encoded  = 0;
 
-    for (int i = 0 ; i < d->settings->inputImages.count()+1 && !m_cancel ; ++i)
+    // The seeds of the segments are drawn in this thread, in order.
+
+    qsrand(static_cast<quint64>(QTime::currentTime().msecsSinceStartOfDay()));
+
+    QElapsedTimer timer;
+    timer.start();
+
+    for (int i = 0 ; i < count+1 && !m_cancel ; ++i)
     {
-        if (i == 0)
+        // The segments are started in order, the ones rendered are always before the ones waiting.
+
+        while ((started < count+1) && (started < i + inFlight))
         {
-            qiimg = FrameUtils::makeFramedImage(QString(), osize);
-        }
+            QString ofile;
 
-        QString ofile;
+            if (started < count)
+            {
+                ofile = d->settings->inputImages[started].toLocalFile();
+            }
 
-        if (i < d->settings->inputImages.count())
-        {
-            ofile = d->settings->inputImages[i].toLocalFile();
+            Private::Segment* const segment = d->startSegment(ofile, previous, (started < count));
+            previous                        = segment->effect;
+            segments << segment;
+            ++started;
         }
 
-        QImage qoimg = FrameUtils::makeFramedImage(ofile, osize);
+        Private::Segment* const segment = segments.first();
+        VideoFrame frame;
 
         // -- Transition encoding ----------
 
-        transmngr.setInImage(qiimg);
-        transmngr.setOutImage(qoimg);
-        transmngr.setTransition(d->settings->transition);
-
-        int tmout = 0;
-
-        do
+        while (!m_cancel && segment->transitionFrames.pop(frame))
         {
-            VideoFrame frame(transmngr.currentFrame(tmout));
-
-            if (!d->encodeFrame(frame, venc, aenc, mux))
+            if (d->encodeFrame(frame, venc, aenc, mux))
+            {
+                ++encoded;
+            }
+            else
             {
                 qCWarning(DIGIKAM_GENERAL_LOG) << "Cannot encode transition frame";
             }
         }
-        while (tmout != -1 && !m_cancel);
 
         // -- Images encoding ----------
 
-        if (i < d->settings->inputImages.count())
-        {
-            VideoFrame frame;
-            int count = 0;
-            int tmout = 0;
-            effmngr.setImage(qoimg);
-            effmngr.setEffect(d->settings->vEffect);
+        VideoFrame imageFrame;
+        int        imageFrames = 0;
 
-            do
+        while (!m_cancel && segment->effectFrames.pop(imageFrame))
+        {
+            if (d->encodeFrame(imageFrame, venc, aenc, mux))
             {
-                qiimg = effmngr.currentFrame(tmout);
-                frame = VideoFrame(qiimg);
+                ++imageFrames;
+            }
+            else
+            {
+                qCWarning(DIGIKAM_GENERAL_LOG) << "Cannot encode image frame";
+            }
+        }
 
-                if (d->encodeFrame(frame, venc, aenc, mux))
-                {
+        // The image lasts the count of encoded frames. The next transition is already rendered
+        // from the last frame of the effect, so the frames which were not encoded are replaced
+        // by this last frame instead of rendering the effect further.
 
-                    ++count;
-/*
-                    qCDebug(DIGIKAM_GENERAL_LOG) << ofile
-                                                 << " => encode count:" << count
-                                                 << "frame size:"       << frame.width()
-                                                 << "x"                 << frame.height();
-*/
+        if (imageFrame.isValid())
+        {
+            int retries = d->settings->imgFrames;
+
+            while (!m_cancel && (imageFrames < d->settings->imgFrames) && (retries-- > 0))
+            {
+                if (d->encodeFrame(imageFrame, venc, aenc, mux))
+                {
+                    ++imageFrames;
                 }
             }
-            while (count < d->settings->imgFrames && !m_cancel);
         }
 
-        qCDebug(DIGIKAM_GENERAL_LOG) << "Encoded image" << i << "done";
+        encoded += imageFrames;
+
+        if (m_cancel)
+        {
+            break;
+        }
+
+        segment->transition.waitForFinished();
+        segment->effect.waitForFinished();
+
+        qCDebug(DIGIKAM_GENERAL_LOG) << "Encoded image" << i << "done at"
+                                     << encoded * 1000.0 / qMax<qint64>(1, timer.elapsed())
+                                     << "frames per second";
 
-        emit signalMessage(i18n("Encoding %1 Done", ofile), false);
+        emit signalMessage(i18n("Encoding %1 Done", segment->file), false);
         emit signalProgress(i);
+
+        delete segments.takeFirst();
+    }
+
+    d->stopSegments(segments);
+
+    if (!m_cancel)
+    {
+        const double elapsed = qMax<qint64>(1, timer.elapsed()) / 1000.0;
+
+        emit signalMessage(i18n("Encoded %1 frames in %2 s (%3 frames per second)",
+                                encoded,
+                                QString::number(elapsed, 'f', 1),
+                                QString::number(encoded / elapsed, 'f', 1)), false);
     }
 
     // ---------------------------------------------
@@ -115,6 +115,12 @@ void DImgPreviewItem::setPreviewSettings(const PreviewSettings& settings)
     reload();
 }
 
+int DImgPreviewItem::previewSize() const
+{
+    Q_D(const DImgPreviewItem);
+    return d->previewSize;
+}
+
 QString DImgPreviewItem::path() const
 {
     Q_D(const DImgPreviewItem);
@@ -64,6 +64,11 @@ public:
     void setDisplayingWidget(QWidget* const widget);
     void setPreviewSettings(const PreviewSettings& settings);
 
+    /**
+     * The size of the previews loaded, from the size of the screen.
+     */
+    int  previewSize() const;
+
     QString path() const;
     void    setPath(const QString& path, bool rePreview = false);
 
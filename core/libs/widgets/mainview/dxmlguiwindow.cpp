@@ -72,6 +72,7 @@
 #include "daboutdata.h"
 #include "dpluginloader.h"
 #include "webbrowserdlg.h"
+#include "dprofilerdlg.h"
 
 namespace Digikam
 {
@@ -259,6 +260,14 @@ void DXmlGuiWindow::createHelpActions(bool coreOptions)
     connect(rawCameraListAction, SIGNAL(triggered()), this, SLOT(slotRawCameraList()));
     actionCollection()->addAction(QLatin1String("help_rawcameralist"), rawCameraListAction);
 
+#ifdef HAVE_PROFILING
+
+    QAction* const profilerAction      = new QAction(QIcon::fromTheme(QLatin1String("chronometer")), i18n("Profiling"), this);
+    connect(profilerAction, SIGNAL(triggered()), this, SLOT(slotProfiler()));
+    actionCollection()->addAction(QLatin1String("help_profiler"), profilerAction);
+
+#endif // HAVE_PROFILING
+
     QAction* const donateMoneyAction   = new QAction(QIcon::fromTheme(QLatin1String("globe")), i18n("Donate..."), this);
     connect(donateMoneyAction, SIGNAL(triggered()), this, SLOT(slotDonateMoney()));
     actionCollection()->addAction(QLatin1String("help_donatemoney"), donateMoneyAction);
@@ -809,6 +818,13 @@ void DXmlGuiWindow::slotRawCameraList()
     showRawCameraList();
 }
 
+void DXmlGuiWindow::slotProfiler()
+{
+    DProfilerDlg* const dlg = new DProfilerDlg(qApp->activeWindow());
+    dlg->setAttribute(Qt::WA_DeleteOnClose);
+    dlg->show();
+}
+
 void DXmlGuiWindow::slotDonateMoney()
 {
     WebBrowserDlg* const browser
@@ -215,6 +215,7 @@ private Q_SLOTS:
     void slotNewToolbarConfig();
 
     void slotRawCameraList();
+    void slotProfiler();
     void slotDonateMoney();
     void slotRecipesBook();
     void slotContribute();
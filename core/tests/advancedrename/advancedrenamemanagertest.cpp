@@ -0,0 +1,262 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : Test the parallel parsing of the files to rename
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "advancedrenamemanagertest.h"
+
+// Qt includes
+
+#include <QTest>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSet>
+#include <QThread>
+#include <QThreadPool>
+#include <QDateTime>
+
+// Local includes
+
+#include "advancedrenamemanager.h"
+#include "parsesettings.h"
+
+using namespace Digikam;
+
+QTEST_MAIN(AdvancedRenameManagerTest)
+
+namespace
+{
+
+/**
+ * More than twice the 32 files parsed by each thread, for several threads to be used.
+ */
+const int fileCount = 150;
+
+} // namespace
+
+void AdvancedRenameManagerTest::initTestCase()
+{
+    QVERIFY(tempDir.isValid());
+
+    maxThreadCount           = QThreadPool::globalInstance()->maxThreadCount();
+    const QString image      = QFINDTESTDATA("data/advancedrename_testimage.jpg");
+    const QStringList groups = QStringList() << QLatin1String("jpg") << QLatin1String("png");
+
+    QVERIFY(!image.isEmpty());
+
+    // Two folders, with groups of files which differ only by their extension.
+
+    for (int i = 0 ; i < fileCount ; ++i)
+    {
+        const QString folder = tempDir.path() + ((i % 2) ? QLatin1String("/odd") : QLatin1String("/even"));
+        QVERIFY(QDir().mkpath(folder));
+
+        const QString file   = QString::fromLatin1("%1/img_%2.%3").arg(folder)
+                                                                  .arg(i / 4, 3, 10, QLatin1Char('0'))
+                                                                  .arg(groups.at((i / 2) % 2));
+
+        QVERIFY(QFile::copy(image, file));
+        files << file;
+    }
+}
+
+void AdvancedRenameManagerTest::cleanup()
+{
+    QThreadPool::globalInstance()->setMaxThreadCount(maxThreadCount);
+}
+
+int AdvancedRenameManagerTest::parallelThreads() const
+{
+    return qMax(4, QThread::idealThreadCount());
+}
+
+QMap<QString, QString> AdvancedRenameManagerTest::parse(const QString& parseString, int threads) const
+{
+    QThreadPool::globalInstance()->setMaxThreadCount(threads);
+
+    QList<ParseSettings> list;
+    const QDateTime date(QDate(2019, 8, 21), QTime(10, 0));
+
+    for (int i = 0 ; i < files.count() ; ++i)
+    {
+        ParseSettings ps;
+        ps.fileUrl      = QUrl::fromLocalFile(files.at(i));
+        ps.creationTime = date.addSecs(i * 3600);
+        list << ps;
+    }
+
+    AdvancedRenameManager manager(list);
+    manager.parseFiles(parseString);
+
+    return manager.newFileList();
+}
+
+void AdvancedRenameManagerTest::testParallelParsing_data()
+{
+    QTest::addColumn<QString>("parseString");
+
+    QTest::newRow("file and number")      << QString::fromLatin1("[file]_#");
+    QTest::newRow("padded number")        << QString::fromLatin1("###_[dir]");
+    QTest::newRow("number start step")    << QString::fromLatin1("img_###[,10,5]");
+    QTest::newRow("number per folder")    << QString::fromLatin1("[dir]_##[f,10,5]");
+    QTest::newRow("number per group")     << QString::fromLatin1("group_###[e]");
+    QTest::newRow("numbers and modifier") << QString::fromLatin1("[file]{upper}_###_#[f]");
+    QTest::newRow("metadata")             << QString::fromLatin1("[meta:Exif.Image.Make]_###");
+    QTest::newRow("date")                 << QString::fromLatin1("###_[date:yyyyMMdd-hhmm]");
+}
+
+void AdvancedRenameManagerTest::testParallelParsing()
+{
+    QFETCH(QString, parseString);
+
+    const QMap<QString, QString> sequential = parse(parseString, 1);
+    const QMap<QString, QString> parallel   = parse(parseString, parallelThreads());
+
+    QCOMPARE(sequential.count(), files.count());
+    QCOMPARE(parallel,           sequential);
+
+    // The sequence numbers follow the order of the files in the parallel parsing too.
+
+    if (parseString == QLatin1String("img_###[,10,5]"))
+    {
+        for (int i = 0 ; i < files.count() ; ++i)
+        {
+            const QString name = QString::fromLatin1("img_%1.%2").arg(10 + i * 5, 3, 10, QLatin1Char('0'))
+                                                                 .arg(QFileInfo(files.at(i)).suffix());
+            QCOMPARE(parallel.value(files.at(i)), name);
+        }
+    }
+}
+
+void AdvancedRenameManagerTest::testUniqueModifier_data()
+{
+    QTest::addColumn<QString>("parseString");
+
+    QTest::newRow("unique")            << QString::fromLatin1("[dir]{unique}");
+    QTest::newRow("unique and width")  << QString::fromLatin1("[dir]{unique:3}");
+    QTest::newRow("unique and number") << QString::fromLatin1("[dir]{unique}_#[f]");
+}
+
+void AdvancedRenameManagerTest::testUniqueModifier()
+{
+    QFETCH(QString, parseString);
+
+    // The unique modifier depends on the names of the previous files, the manager
+    // parses the files in order even with several threads.
+
+    const QMap<QString, QString> sequential = parse(parseString, 1);
+    const QMap<QString, QString> parallel   = parse(parseString, parallelThreads());
+
+    QCOMPARE(parallel, sequential);
+
+    QSet<QString> names;
+
+    for (int i = 0 ; i < files.count() ; ++i)
+    {
+        const QString name = QDir(QFileInfo(files.at(i)).path()).filePath(parallel.value(files.at(i)));
+        QVERIFY2(!names.contains(name), qPrintable(name));
+        names << name;
+    }
+
+    // The first name of each series has no suffix, the next ones follow the order of the files.
+
+    if (parseString == QLatin1String("[dir]{unique:3}"))
+    {
+        QCOMPARE(parallel.value(files.at(0)), QString::fromLatin1("even.jpg"));
+        QCOMPARE(parallel.value(files.at(1)), QString::fromLatin1("odd.jpg"));
+        QCOMPARE(parallel.value(files.at(2)), QString::fromLatin1("even_001.png"));
+        QCOMPARE(parallel.value(files.at(4)), QString::fromLatin1("even_002.jpg"));
+    }
+}
+
+void AdvancedRenameManagerTest::testParseCache()
+{
+    QThreadPool::globalInstance()->setMaxThreadCount(parallelThreads());
+
+    QList<ParseSettings> list;
+
+    foreach (const QString& file, files)
+    {
+        ParseSettings ps;
+        ps.fileUrl = QUrl::fromLocalFile(file);
+        list << ps;
+    }
+
+    AdvancedRenameManager manager(list);
+    const QString first  = QLatin1String("[meta:Exif.Image.Make]_###");
+    const QString second = QLatin1String("[file]_#");
+
+    manager.parseFiles(first);
+    const QMap<QString, QString> names = manager.newFileList();
+
+    // The same parse string gives the names kept from the previous parsing.
+
+    manager.parseFiles(first);
+    QCOMPARE(manager.newFileList(), names);
+
+    // Another parse string, and back to the first one, with the metadata read before.
+
+    manager.parseFiles(second);
+    QVERIFY(manager.newFileList() != names);
+
+    manager.parseFiles(first);
+    QCOMPARE(manager.newFileList(), names);
+
+    // A new start index parses the files again.
+
+    manager.setStartIndex(5);
+    manager.parseFiles(first);
+
+    const QString make = names.value(files.first()).section(QLatin1Char('_'), 0, 0);
+    QCOMPARE(manager.newName(files.first()), QString::fromLatin1("%1_005.jpg").arg(make));
+    QCOMPARE(manager.newFileList().count(),  files.count());
+}
+
+void AdvancedRenameManagerTest::testIncrementalParsing()
+{
+    QThreadPool::globalInstance()->setMaxThreadCount(parallelThreads());
+
+    QList<ParseSettings> list;
+
+    foreach (const QString& file, files)
+    {
+        ParseSettings ps;
+        ps.fileUrl = QUrl::fromLocalFile(file);
+        list << ps;
+    }
+
+    // The parse string typed character by character, as in the live preview.
+
+    const QString parseString = QLatin1String("[meta:Exif.Image.Model]_[dir]_###[f]");
+    AdvancedRenameManager manager(list);
+
+    for (int i = 1 ; i <= parseString.length() ; ++i)
+    {
+        manager.parseFiles(parseString.left(i));
+    }
+
+    AdvancedRenameManager fresh(list);
+    fresh.parseFiles(parseString);
+
+    QCOMPARE(manager.newFileList(), fresh.newFileList());
+    QCOMPARE(manager.newFileList(), parse(parseString, 1));
+}
@@ -0,0 +1,71 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : Test the parallel parsing of the files to rename
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_ADVANCED_RENAME_MANAGER_TEST_H
+#define DIGIKAM_ADVANCED_RENAME_MANAGER_TEST_H
+
+// Qt includes
+
+#include <QObject>
+#include <QMap>
+#include <QString>
+#include <QStringList>
+#include <QTemporaryDir>
+
+class AdvancedRenameManagerTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+
+    void initTestCase();
+    void cleanup();
+
+    void testParallelParsing_data();
+    void testParallelParsing();
+    void testUniqueModifier_data();
+    void testUniqueModifier();
+    void testParseCache();
+    void testIncrementalParsing();
+
+private:
+
+    /**
+     * Parse the files with at most threads threads in the global pool. The manager parses
+     * one file every 32 in each thread, so a single thread is a sequential parsing.
+     */
+    QMap<QString, QString> parse(const QString& parseString, int threads) const;
+
+    /**
+     * Enough threads for the manager to use several of them with the test files.
+     */
+    int parallelThreads() const;
+
+private:
+
+    QTemporaryDir tempDir;
+    QStringList   files;
+    int           maxThreadCount = 0;
+};
+
+#endif // DIGIKAM_ADVANCED_RENAME_MANAGER_TEST_H
@@ -0,0 +1,669 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-18
+ * Description : Benchmarks of the database listing, similarity search and thumbnails hot paths
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "databasebenchmark.h"
+
+// Qt includes
+
+#include <QDate>
+#include <QDateTime>
+#include <QDir>
+#include <QTime>
+#include <QVariantList>
+#include <QFuture>
+#include <QtConcurrent>
+
+// Local includes
+
+#include "metaengine.h"
+#include "dimg.h"
+#include "coredb.h"
+#include "coredbaccess.h"
+#include "coredbbackend.h"
+#include "coredbtransaction.h"
+#include "itemlister.h"
+#include "itemlisterreceiver.h"
+#include "haariface.h"
+#include "similaritydbaccess.h"
+#include "similaritydbbackend.h"
+#include "thumbsdbaccess.h"
+#include "thumbsdbbackend.h"
+#include "thumbsdb.h"
+#include "thumbnailcreator.h"
+#include "thumbnailinfo.h"
+
+using namespace Digikam;
+
+QTEST_GUILESS_MAIN(DatabaseBenchmark)
+
+namespace
+{
+
+/**
+ * The size of the generated collection, spread in albums of itemsPerAlbum items,
+ * and in tagsCount tags.
+ */
+const int itemsCount    = 100000;
+const int itemsPerAlbum = 1000;
+const int tagsCount     = 10;
+
+/**
+ * The number of different Haar signatures given to the items.
+ */
+const int signaturesCount = 16;
+
+/**
+ * The number of items of the SQLite profiles benchmarks, and the size of their thumbnails data.
+ */
+const int profileItemsCount = 2000;
+const int profileDataSize   = 16 * 1024;
+
+/**
+ * The number of threads listing the items while a scan writes, and the number
+ * of listings made by each one.
+ */
+const int profileReadersCount  = 4;
+const int profileReadsByThread = 20;
+
+QString profileFilePath(int i)
+{
+    return QString::fromLatin1("/profile/IMG_%1.JPG").arg(i, 6, 10, QLatin1Char('0'));
+}
+
+int listProfileAlbum(int rootId)
+{
+    ItemLister lister;
+    lister.setListOnlyAvailable(false);
+    int count = 0;
+
+    for (int i = 0 ; i < profileReadsByThread ; ++i)
+    {
+        ItemListerValueListReceiver receiver;
+        lister.listPAlbum(&receiver, rootId, QLatin1String("/profile"));
+        count += receiver.records.count();
+    }
+
+    return count;
+}
+
+} // namespace
+
+void DatabaseBenchmark::initTestCase()
+{
+    MetaEngine::initializeExiv2();
+
+    QVERIFY(tempDir.isValid());
+
+    scannedAlbums = 0;
+    parameters    = DbEngineParameters(QLatin1String("QSQLITE"), QString());
+    parameters.setCoreDatabasePath(tempDir.path());
+    parameters.setThumbsDatabasePath(tempDir.path());
+    parameters.setSimilarityDatabasePath(tempDir.path());
+
+    CoreDbAccess::setParameters(parameters, CoreDbAccess::MainApplication);
+    QVERIFY(CoreDbAccess::checkReadyForUse(nullptr));
+
+    ThumbsDbAccess::setParameters(parameters.thumbnailParameters());
+    QVERIFY(ThumbsDbAccess::checkReadyForUse(nullptr));
+
+    SimilarityDbAccess::setParameters(parameters.similarityParameters());
+    QVERIFY(SimilarityDbAccess::checkReadyForUse(nullptr));
+
+    HaarIface haarIface;
+
+    for (int i = 0 ; i < signaturesCount ; ++i)
+    {
+        signatures << QByteArray::fromBase64(haarIface.signatureAsText(syntheticImage(640, 480, i)).toLatin1());
+    }
+
+    QTime time;
+    time.start();
+
+    populateDatabases();
+
+    qDebug() << "Generated databases with" << itemsCount << "items in" << time.elapsed() << "ms";
+
+    // Source of the thumbnails benchmarks, as a 6 Mpx JPEG file without embedded preview.
+
+    thumbnailFile = tempDir.filePath(QLatin1String("thumbnail.jpg"));
+    QVERIFY(DImg(syntheticImage(3000, 2000, 0)).save(thumbnailFile, QLatin1String("JPG")));
+}
+
+void DatabaseBenchmark::cleanupTestCase()
+{
+    CoreDbAccess::cleanUpDatabase();
+    ThumbsDbAccess::cleanUpDatabase();
+    SimilarityDbAccess::cleanUpDatabase();
+
+    MetaEngine::cleanupExiv2();
+}
+
+QImage DatabaseBenchmark::syntheticImage(int width, int height, int variant) const
+{
+    QImage image(width, height, QImage::Format_RGB32);
+    quint32 seed = 12345 + variant;
+
+    for (int y = 0 ; y < height ; ++y)
+    {
+        QRgb* const line = reinterpret_cast<QRgb*>(image.scanLine(y));
+
+        for (int x = 0 ; x < width ; ++x)
+        {
+            seed        = seed * 1664525 + 1013904223;
+            const int n = (int)(seed >> 27) - 16;
+            const int u = (variant & 1) ? (width - x) : x;
+            const int v = (variant & 2) ? (height - y) : y;
+
+            line[x] = qRgb(qBound(0, u * 255 / width  + n, 255),
+                           qBound(0, v * 255 / height + n, 255),
+                           qBound(0, ((u + v) * (variant + 1) / 8) % 256 + n, 255));
+        }
+    }
+
+    return image;
+}
+
+void DatabaseBenchmark::populateDatabases()
+{
+    CoreDbAccess access;
+
+    albumRootId = access.db()->addAlbumRoot(AlbumRoot::VolumeHardWired,
+                                            QLatin1String("volumeid:?path=") + tempDir.path(),
+                                            QLatin1String("/"),
+                                            QLatin1String("Benchmark"));
+    QVERIFY(albumRootId != -1);
+
+    for (int i = 0 ; i < tagsCount ; ++i)
+    {
+        tagIds << access.db()->addTag(0, QString::fromLatin1("Benchmark %1").arg(i), QLatin1String("tag"), 0);
+    }
+
+    QVariantList ids, albums, names, modDates, sizes, hashes;
+    QVariantList ratings, creationDates, formats, widths, heights;
+    QVariantList tags, matrices;
+
+    const QDateTime date(QDate(2019, 1, 1), QTime(12, 0));
+    int albumId = -1;
+
+    for (int i = 0 ; i < itemsCount ; ++i)
+    {
+        if ((i % itemsPerAlbum) == 0)
+        {
+            albumId = access.db()->addAlbum(albumRootId,
+                                            QString::fromLatin1("/album%1").arg(i / itemsPerAlbum, 3, 10, QLatin1Char('0')),
+                                            QString(), date.date(), QString());
+        }
+
+        const qlonglong id = i + 1;
+
+        ids           << id;
+        albums        << albumId;
+        names         << QString::fromLatin1("IMG_%1.JPG").arg(i, 6, 10, QLatin1Char('0'));
+        modDates      << date.addSecs(i);
+        sizes         << 4000000 + i;
+        hashes        << QString::number(id, 16).rightJustified(32, QLatin1Char('0'));
+        ratings       << (i % 6);
+        creationDates << date.addSecs(i * 60);
+        formats       << QLatin1String("JPG");
+        widths        << 6000;
+        heights       << 4000;
+        tags          << tagIds.at(i % tagsCount);
+        matrices      << signatures.at(i % signaturesCount);
+    }
+
+    {
+        CoreDbTransaction transaction(&access);
+
+        DbEngineSqlQuery images = access.backend()->prepareQuery(QString::fromUtf8(
+            "INSERT INTO Images (id, album, name, status, category, modificationDate, fileSize, uniqueHash) "
+            " VALUES (?, ?, ?, 1, 1, ?, ?, ?);"));
+        images.addBindValue(ids);
+        images.addBindValue(albums);
+        images.addBindValue(names);
+        images.addBindValue(modDates);
+        images.addBindValue(sizes);
+        images.addBindValue(hashes);
+        QVERIFY(access.backend()->execBatch(images));
+
+        DbEngineSqlQuery infos = access.backend()->prepareQuery(QString::fromUtf8(
+            "INSERT INTO ImageInformation (imageid, rating, creationDate, orientation, width, height, format) "
+            " VALUES (?, ?, ?, 1, ?, ?, ?);"));
+        infos.addBindValue(ids);
+        infos.addBindValue(ratings);
+        infos.addBindValue(creationDates);
+        infos.addBindValue(widths);
+        infos.addBindValue(heights);
+        infos.addBindValue(formats);
+        QVERIFY(access.backend()->execBatch(infos));
+
+        DbEngineSqlQuery imageTags = access.backend()->prepareQuery(QString::fromUtf8(
+            "INSERT INTO ImageTags (imageid, tagid) VALUES (?, ?);"));
+        imageTags.addBindValue(ids);
+        imageTags.addBindValue(tags);
+        QVERIFY(access.backend()->execBatch(imageTags));
+    }
+
+    SimilarityDbAccess similarityAccess;
+    similarityAccess.backend()->beginTransaction();
+
+    DbEngineSqlQuery haar = similarityAccess.backend()->prepareQuery(QString::fromUtf8(
+        "INSERT INTO ImageHaarMatrix (imageid, modificationDate, uniqueHash, matrix) VALUES (?, ?, ?, ?);"));
+    haar.addBindValue(ids);
+    haar.addBindValue(modDates);
+    haar.addBindValue(hashes);
+    haar.addBindValue(matrices);
+    QVERIFY(similarityAccess.backend()->execBatch(haar));
+
+    similarityAccess.backend()->commitTransaction();
+}
+
+// -------------------------------------------------------------------------------------------
+
+void DatabaseBenchmark::benchListPAlbum()
+{
+    ItemLister lister;
+    lister.setListOnlyAvailable(false);
+
+    QBENCHMARK
+    {
+        ItemListerValueListReceiver receiver;
+        lister.listPAlbum(&receiver, albumRootId, QLatin1String("/album050"));
+        QCOMPARE(receiver.records.count(), itemsPerAlbum);
+    }
+}
+
+void DatabaseBenchmark::benchListPAlbumRecursive()
+{
+    ItemLister lister;
+    lister.setListOnlyAvailable(false);
+    lister.setRecursive(true);
+
+    QBENCHMARK
+    {
+        ItemListerValueListReceiver receiver;
+        lister.listPAlbum(&receiver, albumRootId, QLatin1String("/"));
+        QCOMPARE(receiver.records.count(), itemsCount);
+    }
+}
+
+void DatabaseBenchmark::benchListTag()
+{
+    ItemLister lister;
+    lister.setListOnlyAvailable(false);
+
+    QBENCHMARK
+    {
+        ItemListerValueListReceiver receiver;
+        lister.listTag(&receiver, QList<int>() << tagIds.first());
+        QCOMPARE(receiver.records.count(), itemsCount / tagsCount);
+    }
+}
+
+void DatabaseBenchmark::benchItemsCount()
+{
+    QBENCHMARK
+    {
+        QVERIFY(CoreDbAccess().db()->getNumberOfImagesInAlbums().count() >= itemsCount / itemsPerAlbum);
+    }
+}
+
+void DatabaseBenchmark::benchAllItemsWithAlbum()
+{
+    QBENCHMARK
+    {
+        QCOMPARE(CoreDbAccess().db()->getAllItemsWithAlbum().count(), itemsCount);
+    }
+}
+
+// -------------------------------------------------------------------------------------------
+
+void DatabaseBenchmark::benchHaarSignature()
+{
+    HaarIface haarIface;
+    const QImage image = syntheticImage(1024, 768, 3);
+
+    QBENCHMARK
+    {
+        QVERIFY(!haarIface.signatureAsText(image).isEmpty());
+    }
+}
+
+void DatabaseBenchmark::benchHaarSearch()
+{
+    HaarIface haarIface;
+    const QString signature = QString::fromLatin1(signatures.first().toBase64());
+
+    QBENCHMARK
+    {
+        QVERIFY(!haarIface.bestMatchesForSignature(signature, QList<int>(), 20).isEmpty());
+    }
+}
+
+// -------------------------------------------------------------------------------------------
+
+void DatabaseBenchmark::benchThumbnailCreateAndStore()
+{
+    ThumbnailCreator creator(256, ThumbnailCreator::ThumbnailDatabase);
+    const ThumbnailIdentifier identifier(thumbnailFile);
+
+    QBENCHMARK
+    {
+        // Without a removal, the thumbnail would only be created once.
+
+        ThumbsDbAccess().db()->removeByFilePath(thumbnailFile);
+        creator.pregenerate(identifier);
+    }
+
+    QVERIFY(ThumbsDbAccess().db()->findByFilePath(thumbnailFile).id != -1);
+}
+
+void DatabaseBenchmark::benchThumbnailLoad()
+{
+    ThumbnailCreator creator(256, ThumbnailCreator::ThumbnailDatabase);
+    const ThumbnailIdentifier identifier(thumbnailFile);
+
+    creator.pregenerate(identifier);
+
+    QBENCHMARK
+    {
+        QVERIFY(!creator.load(identifier).isNull());
+    }
+}
+
+// -------------------------------------------------------------------------------------------
+
+void DatabaseBenchmark::profileData() const
+{
+    QTest::addColumn<bool>("walMode");
+
+    QTest::newRow("rollback journal") << false;
+    QTest::newRow("write-ahead log")  << true;
+}
+
+int DatabaseBenchmark::openProfileDatabases(bool walMode)
+{
+    const QString directory = tempDir.filePath(walMode ? QLatin1String("wal")
+                                                       : QLatin1String("rollback"));
+
+    if (!QDir().mkpath(directory))
+    {
+        return -1;
+    }
+
+    DbEngineParameters params(QLatin1String("QSQLITE"), QString());
+    params.setCoreDatabasePath(directory);
+    params.setThumbsDatabasePath(directory);
+    params.walMode = walMode;
+
+    CoreDbAccess::cleanUpDatabase();
+    CoreDbAccess::setParameters(params, CoreDbAccess::MainApplication);
+
+    ThumbsDbAccess::cleanUpDatabase();
+    ThumbsDbAccess::setParameters(params.thumbnailParameters());
+
+    if (!CoreDbAccess::checkReadyForUse(nullptr) || !ThumbsDbAccess::checkReadyForUse(nullptr))
+    {
+        return -1;
+    }
+
+    QList<AlbumRootInfo> roots = CoreDbAccess().db()->getAlbumRoots();
+
+    if (!roots.isEmpty())
+    {
+        return roots.first().id;
+    }
+
+    // First use of the profile: one album of items, each one with its thumbnail.
+
+    const int rootId = CoreDbAccess().db()->addAlbumRoot(AlbumRoot::VolumeHardWired,
+                                                         QLatin1String("volumeid:?path=") + directory,
+                                                         QLatin1String("/"),
+                                                         QLatin1String("Profile"));
+
+    if (rootId == -1)
+    {
+        return -1;
+    }
+
+    const QDateTime date(QDate(2019, 1, 1), QTime(12, 0));
+    const int albumId = CoreDbAccess().db()->addAlbum(rootId, QLatin1String("/profile"),
+                                                      QString(), date.date(), QString());
+
+    {
+        CoreDbAccess access;
+        CoreDbTransaction transaction(&access);
+
+        for (int i = 0 ; i < profileItemsCount ; ++i)
+        {
+            const qlonglong id = access.db()->addItem(albumId,
+                                                      QString::fromLatin1("IMG_%1.JPG").arg(i, 6, 10, QLatin1Char('0')),
+                                                      DatabaseItem::Visible, DatabaseItem::Image,
+                                                      date.addSecs(i), 4000000 + i,
+                                                      QString::number(i + 1, 16).rightJustified(32, QLatin1Char('0')));
+
+            access.db()->addItemInformation(id, QVariantList() << (i % 6) << date.addSecs(i * 60),
+                                            DatabaseFields::Rating | DatabaseFields::CreationDate);
+        }
+    }
+
+    ThumbsDbInfo info;
+    info.type             = DatabaseThumbnail::PGF;
+    info.modificationDate = date;
+    info.data             = QByteArray(profileDataSize, 'x');
+
+    ThumbsDbAccess access;
+    access.backend()->beginTransaction();
+
+    for (int i = 0 ; i < profileItemsCount ; ++i)
+    {
+        QVariant id;
+        access.db()->insertThumbnail(info, &id);
+        access.db()->insertFilePath(profileFilePath(i), id.toInt());
+    }
+
+    access.backend()->commitTransaction();
+
+    return rootId;
+}
+
+bool DatabaseBenchmark::restoreDatabases()
+{
+    CoreDbAccess::cleanUpDatabase();
+    CoreDbAccess::setParameters(parameters, CoreDbAccess::MainApplication);
+
+    ThumbsDbAccess::cleanUpDatabase();
+    ThumbsDbAccess::setParameters(parameters.thumbnailParameters());
+
+    return (CoreDbAccess::checkReadyForUse(nullptr) && ThumbsDbAccess::checkReadyForUse(nullptr));
+}
+
+int DatabaseBenchmark::scanItems(int rootId, int count)
+{
+    const QDateTime date(QDate(2020, 1, 1), QTime(12, 0));
+    const int albumId = CoreDbAccess().db()->addAlbum(rootId, QString::fromLatin1("/scan%1").arg(scannedAlbums++),
+                                                      QString(), date.date(), QString());
+    int inserted      = 0;
+
+    CoreDbAccess().backend()->setRelaxedSynchronization(true);
+
+    for (int i = 0 ; i < count ; ++i)
+    {
+        CoreDbAccess access;
+        CoreDbTransaction transaction(&access);
+
+        const qlonglong id = access.db()->addItem(albumId,
+                                                  QString::fromLatin1("IMG_%1.JPG").arg(i, 6, 10, QLatin1Char('0')),
+                                                  DatabaseItem::Visible, DatabaseItem::Image,
+                                                  date.addSecs(i), 4000000 + i, QString::number(i + 1, 16));
+
+        if (id != -1)
+        {
+            access.db()->addItemInformation(id, QVariantList() << 0 << date.addSecs(i * 60),
+                                            DatabaseFields::Rating | DatabaseFields::CreationDate);
+            ++inserted;
+        }
+    }
+
+    CoreDbAccess().backend()->setRelaxedSynchronization(false);
+
+    return inserted;
+}
+
+void DatabaseBenchmark::benchProfileListing_data()
+{
+    profileData();
+}
+
+void DatabaseBenchmark::benchProfileListing()
+{
+    QFETCH(bool, walMode);
+
+    const int rootId = openProfileDatabases(walMode);
+    QVERIFY(rootId != -1);
+
+    ItemLister lister;
+    lister.setListOnlyAvailable(false);
+
+    QBENCHMARK
+    {
+        ItemListerValueListReceiver receiver;
+        lister.listPAlbum(&receiver, rootId, QLatin1String("/profile"));
+        QCOMPARE(receiver.records.count(), profileItemsCount);
+    }
+
+    QVERIFY(restoreDatabases());
+}
+
+void DatabaseBenchmark::benchProfileScan_data()
+{
+    profileData();
+}
+
+void DatabaseBenchmark::benchProfileScan()
+{
+    // Each item is stored in its own transaction, so the scan measures the cost
+    // of the commits of each profile.
+
+    QFETCH(bool, walMode);
+
+    const int rootId = openProfileDatabases(walMode);
+    QVERIFY(rootId != -1);
+
+    QBENCHMARK
+    {
+        QCOMPARE(scanItems(rootId, profileItemsCount / 4), profileItemsCount / 4);
+    }
+
+    QVERIFY(restoreDatabases());
+}
+
+void DatabaseBenchmark::benchProfileThumbnailWrite_data()
+{
+    profileData();
+}
+
+void DatabaseBenchmark::benchProfileThumbnailWrite()
+{
+    // Each thumbnail is stored in its own transaction, as ThumbnailCreator does.
+
+    QFETCH(bool, walMode);
+
+    QVERIFY(openProfileDatabases(walMode) != -1);
+
+    ThumbsDbInfo info;
+    info.type             = DatabaseThumbnail::PGF;
+    info.modificationDate = QDateTime::currentDateTime();
+    info.data             = QByteArray(profileDataSize, 'y');
+
+    QBENCHMARK
+    {
+        ThumbsDbAccess access;
+        const QString path(QLatin1String("/profile/written.jpg"));
+        QVariant id;
+
+        QVERIFY(access.backend()->beginTransaction()            == BdEngineBackend::NoErrors);
+        QVERIFY(access.db()->removeByFilePath(path)           == BdEngineBackend::NoErrors);
+        QVERIFY(access.db()->insertThumbnail(info, &id)       == BdEngineBackend::NoErrors);
+        QVERIFY(access.db()->insertFilePath(path, id.toInt()) == BdEngineBackend::NoErrors);
+        QVERIFY(access.backend()->commitTransaction()           == BdEngineBackend::NoErrors);
+    }
+
+    QVERIFY(restoreDatabases());
+}
+
+void DatabaseBenchmark::benchProfileThumbnailRead_data()
+{
+    profileData();
+}
+
+void DatabaseBenchmark::benchProfileThumbnailRead()
+{
+    QFETCH(bool, walMode);
+
+    QVERIFY(openProfileDatabases(walMode) != -1);
+
+    int i = 0;
+
+    QBENCHMARK
+    {
+        ThumbsDbInfo found = ThumbsDbAccess().db()->findByFilePath(profileFilePath(i++ % profileItemsCount));
+        QCOMPARE(found.data.size(), profileDataSize);
+    }
+
+    QVERIFY(restoreDatabases());
+}
+
+void DatabaseBenchmark::benchProfileConcurrentReaders_data()
+{
+    profileData();
+}
+
+void DatabaseBenchmark::benchProfileConcurrentReaders()
+{
+    // Threads list the items while the test thread scans new ones. Each thread
+    // opens its own database connection.
+
+    QFETCH(bool, walMode);
+
+    const int rootId = openProfileDatabases(walMode);
+    QVERIFY(rootId != -1);
+
+    QBENCHMARK
+    {
+        QList<QFuture<int> > readers;
+
+        for (int i = 0 ; i < profileReadersCount ; ++i)
+        {
+            readers << QtConcurrent::run(&listProfileAlbum, rootId);
+        }
+
+        QCOMPARE(scanItems(rootId, profileItemsCount / 10), profileItemsCount / 10);
+
+        foreach (QFuture<int> reader, readers)
+        {
+            QCOMPARE(reader.result(), profileItemsCount * profileReadsByThread);
+        }
+    }
+
+    QVERIFY(restoreDatabases());
+}
@@ -0,0 +1,121 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-18
+ * Description : Benchmarks of the database listing, similarity search and thumbnails hot paths
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_DATABASE_BENCHMARK_H
+#define DIGIKAM_DATABASE_BENCHMARK_H
+
+// Qt includes
+
+#include <QtTest>
+#include <QTemporaryDir>
+#include <QImage>
+#include <QList>
+#include <QByteArray>
+
+// Local includes
+
+#include "dbengineparameters.h"
+
+using namespace Digikam;
+
+class DatabaseBenchmark : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+
+    void initTestCase();
+    void cleanupTestCase();
+
+    void benchListPAlbum();
+    void benchListPAlbumRecursive();
+    void benchListTag();
+    void benchItemsCount();
+    void benchAllItemsWithAlbum();
+
+    void benchHaarSignature();
+    void benchHaarSearch();
+
+    void benchThumbnailCreateAndStore();
+    void benchThumbnailLoad();
+
+    void benchProfileListing_data();
+    void benchProfileListing();
+    void benchProfileScan_data();
+    void benchProfileScan();
+    void benchProfileThumbnailWrite_data();
+    void benchProfileThumbnailWrite();
+    void benchProfileThumbnailRead_data();
+    void benchProfileThumbnailRead();
+    void benchProfileConcurrentReaders_data();
+    void benchProfileConcurrentReaders();
+
+private:
+
+    /**
+     * Fill the core database with itemsCount items spread in albums and tags,
+     * and the similarity database with the signatures of the items.
+     */
+    void populateDatabases();
+
+    /**
+     * The rows of the SQLite profiles benchmarks: rollback journal and write-ahead log.
+     */
+    void profileData() const;
+
+    /**
+     * Open the core and thumbnails databases of the given SQLite profile, in their own
+     * directory, and fill them with profileItemsCount items the first time.
+     * Return the id of the album root of the profile, or -1 on failure.
+     */
+    int openProfileDatabases(bool walMode);
+
+    /**
+     * Reopen the databases used by the other benchmarks.
+     */
+    bool restoreDatabases();
+
+    /**
+     * Insert count items in a new album of the album root, as a scan does: one
+     * transaction per item. Return the number of items inserted.
+     */
+    int scanItems(int rootId, int count);
+
+    /**
+     * Return a synthetic photo-like image, different for each variant.
+     */
+    QImage syntheticImage(int width, int height, int variant) const;
+
+private:
+
+    QTemporaryDir      tempDir;
+    QString            thumbnailFile;
+    DbEngineParameters parameters;
+
+    int                albumRootId;
+    int                scannedAlbums;
+    QList<int>         tagIds;
+    QList<QByteArray>  signatures;
+};
+
+#endif // DIGIKAM_DATABASE_BENCHMARK_H
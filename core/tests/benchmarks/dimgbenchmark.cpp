@@ -0,0 +1,344 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-18
+ * Description : Benchmarks of the image loading, saving and filtering hot paths
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "dimgbenchmark.h"
+
+// Qt includes
+
+#include <QFile>
+
+// Local includes
+
+#include "digikam_globals.h"
+#include "metaengine.h"
+#include "blurfilter.h"
+#include "sharpenfilter.h"
+#include "nrfilter.h"
+#include "localcontrastfilter.h"
+#include "curvesfilter.h"
+#include "imagecurves.h"
+#include "iccprofile.h"
+#include "icctransform.h"
+
+using namespace Digikam;
+
+QTEST_GUILESS_MAIN(DImgBenchmark)
+
+namespace
+{
+
+/**
+ * The size of the generated image, as the one of a 6 Mpx camera.
+ */
+const int benchWidth  = 3000;
+const int benchHeight = 2000;
+
+/**
+ * Fill the image with gradients and a deterministic noise, which makes the
+ * compression and the filters behave as with a photo, and not as with a flat area.
+ */
+void fillImage(DImg& image)
+{
+    quint32 seed = 12345;
+
+    for (uint y = 0 ; y < image.height() ; ++y)
+    {
+        for (uint x = 0 ; x < image.width() ; ++x)
+        {
+            seed        = seed * 1664525 + 1013904223;
+            const int n = (int)(seed >> 26) - 32;
+
+            if (image.sixteenBit())
+            {
+                unsigned short* const p = reinterpret_cast<unsigned short*>(image.scanLine(y)) + x * 4;
+                p[0] = qBound(0, (int)(x * 65535 / image.width())  + n * 64, 65535);
+                p[1] = qBound(0, (int)(y * 65535 / image.height()) + n * 64, 65535);
+                p[2] = qBound(0, (int)((x + y) * 16) % 65536       + n * 64, 65535);
+                p[3] = 65535;
+            }
+            else
+            {
+                uchar* const p = image.scanLine(y) + x * 4;
+                p[0] = qBound(0, (int)(x * 255 / image.width())  + n, 255);
+                p[1] = qBound(0, (int)(y * 255 / image.height()) + n, 255);
+                p[2] = qBound(0, (int)((x + y) / 16) % 256       + n, 255);
+                p[3] = 255;
+            }
+        }
+    }
+}
+
+} // namespace
+
+void DImgBenchmark::initTestCase()
+{
+    MetaEngine::initializeExiv2();
+
+    QVERIFY(tempDir.isValid());
+
+    image8  = DImg(benchWidth, benchHeight, false);
+    image16 = DImg(benchWidth, benchHeight, true);
+    fillImage(image8);
+    fillImage(image16);
+
+    // Files read by the loading benchmarks.
+
+    const QStringList formats = QStringList() << QLatin1String("JPG")
+                                              << QLatin1String("PNG")
+                                              << QLatin1String("TIFF")
+                                              << QLatin1String("PGF");
+
+    foreach (const QString& format, formats)
+    {
+        QVERIFY(image8.save(tempDir.filePath(QLatin1String("load8.")   + format.toLower()), format));
+
+        if (format != QLatin1String("JPG"))
+        {
+            QVERIFY(image16.save(tempDir.filePath(QLatin1String("load16.") + format.toLower()), format));
+        }
+    }
+}
+
+void DImgBenchmark::cleanupTestCase()
+{
+    MetaEngine::cleanupExiv2();
+}
+
+void DImgBenchmark::addDepthRows() const
+{
+    QTest::addColumn<bool>("sixteenBit");
+
+    QTest::newRow("8 bits")  << false;
+    QTest::newRow("16 bits") << true;
+}
+
+DImg& DImgBenchmark::imageForRow()
+{
+    QFETCH(bool, sixteenBit);
+
+    return (sixteenBit ? image16 : image8);
+}
+
+void DImgBenchmark::runFilter(DImgThreadedFilter* const filter) const
+{
+    filter->startFilterDirectly();
+    QVERIFY(!filter->getTargetImage().isNull());
+}
+
+// -------------------------------------------------------------------------------------------
+
+void DImgBenchmark::benchLoad_data()
+{
+    QTest::addColumn<QString>("fileName");
+
+    QTest::newRow("JPEG 8 bits")  << QString::fromLatin1("load8.jpg");
+    QTest::newRow("PNG 8 bits")   << QString::fromLatin1("load8.png");
+    QTest::newRow("PNG 16 bits")  << QString::fromLatin1("load16.png");
+    QTest::newRow("TIFF 8 bits")  << QString::fromLatin1("load8.tiff");
+    QTest::newRow("TIFF 16 bits") << QString::fromLatin1("load16.tiff");
+    QTest::newRow("PGF 8 bits")   << QString::fromLatin1("load8.pgf");
+    QTest::newRow("PGF 16 bits")  << QString::fromLatin1("load16.pgf");
+}
+
+void DImgBenchmark::benchLoad()
+{
+    QFETCH(QString, fileName);
+
+    const QString path = tempDir.filePath(fileName);
+    DImg img;
+
+    QBENCHMARK
+    {
+        QVERIFY(img.load(path));
+    }
+
+    QCOMPARE((int)img.width(), benchWidth);
+}
+
+void DImgBenchmark::benchSave_data()
+{
+    QTest::addColumn<QString>("format");
+    QTest::addColumn<bool>("sixteenBit");
+
+    QTest::newRow("JPEG 8 bits")  << QString::fromLatin1("JPG")  << false;
+    QTest::newRow("PNG 8 bits")   << QString::fromLatin1("PNG")  << false;
+    QTest::newRow("PNG 16 bits")  << QString::fromLatin1("PNG")  << true;
+    QTest::newRow("TIFF 8 bits")  << QString::fromLatin1("TIFF") << false;
+    QTest::newRow("TIFF 16 bits") << QString::fromLatin1("TIFF") << true;
+    QTest::newRow("PGF 8 bits")   << QString::fromLatin1("PGF")  << false;
+    QTest::newRow("PGF 16 bits")  << QString::fromLatin1("PGF")  << true;
+}
+
+void DImgBenchmark::benchSave()
+{
+    QFETCH(QString, format);
+
+    DImg img           = imageForRow().copy();
+    const QString path = tempDir.filePath(QLatin1String("save.") + format.toLower());
+
+    QBENCHMARK
+    {
+        QVERIFY(img.save(path, format));
+    }
+
+    QFile::remove(path);
+}
+
+// -------------------------------------------------------------------------------------------
+
+void DImgBenchmark::benchSmoothScale_data()
+{
+    addDepthRows();
+}
+
+void DImgBenchmark::benchSmoothScale()
+{
+    const DImg& img = imageForRow();
+    DImg scaled;
+
+    QBENCHMARK
+    {
+        scaled = img.smoothScale(1024, 1024, Qt::KeepAspectRatio);
+    }
+
+    QCOMPARE((int)scaled.width(), 1024);
+}
+
+void DImgBenchmark::benchBlur_data()
+{
+    addDepthRows();
+}
+
+void DImgBenchmark::benchBlur()
+{
+    DImg& img = imageForRow();
+
+    QBENCHMARK
+    {
+        BlurFilter filter(&img, nullptr, 10);
+        runFilter(&filter);
+    }
+}
+
+void DImgBenchmark::benchSharpen_data()
+{
+    addDepthRows();
+}
+
+void DImgBenchmark::benchSharpen()
+{
+    DImg& img = imageForRow();
+
+    QBENCHMARK
+    {
+        SharpenFilter filter(&img, nullptr, 2.0, 1.0);
+        runFilter(&filter);
+    }
+}
+
+void DImgBenchmark::benchNoiseReduction_data()
+{
+    addDepthRows();
+}
+
+void DImgBenchmark::benchNoiseReduction()
+{
+    DImg& img = imageForRow();
+
+    QBENCHMARK
+    {
+        NRFilter filter(&img, nullptr, NRContainer());
+        runFilter(&filter);
+    }
+}
+
+void DImgBenchmark::benchLocalContrast_data()
+{
+    addDepthRows();
+}
+
+void DImgBenchmark::benchLocalContrast()
+{
+    DImg& img = imageForRow();
+
+    QBENCHMARK
+    {
+        LocalContrastFilter filter(&img, nullptr, LocalContrastContainer());
+        runFilter(&filter);
+    }
+}
+
+void DImgBenchmark::benchCurves_data()
+{
+    addDepthRows();
+}
+
+void DImgBenchmark::benchCurves()
+{
+    DImg& img = imageForRow();
+
+    ImageCurves curves(img.sixteenBit());
+    const int   max = img.sixteenBit() ? 65535 : 255;
+    curves.setCurvePoint(LuminosityChannel, 8, QPoint(max / 2, max * 5 / 8));
+    curves.curvesCalculateCurve(LuminosityChannel);
+
+    const CurvesContainer settings = curves.getContainer();
+
+    QBENCHMARK
+    {
+        CurvesFilter filter(&img, nullptr, settings);
+        runFilter(&filter);
+    }
+}
+
+// -------------------------------------------------------------------------------------------
+
+void DImgBenchmark::benchIccTransform_data()
+{
+    addDepthRows();
+}
+
+void DImgBenchmark::benchIccTransform()
+{
+    IccProfile input  = IccProfile::sRGB();
+    IccProfile output = IccProfile::wideGamutRGB();
+
+    if (!input.open() || !output.open())
+    {
+        QSKIP("The color profiles shipped with digiKam are not installed");
+    }
+
+    // The transform is applied repeatedly on the same copy: its cost does not depend on the pixel values.
+
+    DImg img = imageForRow().copy();
+
+    IccTransform transform;
+    transform.setInputProfile(input);
+    transform.setOutputProfile(output);
+    transform.setIntent(IccTransform::Perceptual);
+
+    QBENCHMARK
+    {
+        QVERIFY(transform.apply(img));
+    }
+}
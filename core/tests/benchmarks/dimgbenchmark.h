@@ -0,0 +1,92 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-18
+ * Description : Benchmarks of the image loading, saving and filtering hot paths
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_DIMG_BENCHMARK_H
+#define DIGIKAM_DIMG_BENCHMARK_H
+
+// Qt includes
+
+#include <QtTest>
+#include <QTemporaryDir>
+
+// Local includes
+
+#include "dimg.h"
+
+namespace Digikam
+{
+class DImgThreadedFilter;
+}
+
+class DImgBenchmark : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+
+    void initTestCase();
+    void cleanupTestCase();
+
+    void benchLoad_data();
+    void benchLoad();
+    void benchSave_data();
+    void benchSave();
+
+    void benchSmoothScale_data();
+    void benchSmoothScale();
+
+    void benchBlur_data();
+    void benchBlur();
+    void benchSharpen_data();
+    void benchSharpen();
+    void benchNoiseReduction_data();
+    void benchNoiseReduction();
+    void benchLocalContrast_data();
+    void benchLocalContrast();
+    void benchCurves_data();
+    void benchCurves();
+
+    void benchIccTransform_data();
+    void benchIccTransform();
+
+private:
+
+    /**
+     * Add a row for the 8 bits and 16 bits per color channel versions of the image.
+     */
+    void addDepthRows() const;
+    Digikam::DImg& imageForRow();
+
+    /**
+     * Run the filter in the current thread and check that it produced an image.
+     */
+    void runFilter(Digikam::DImgThreadedFilter* const filter) const;
+
+private:
+
+    QTemporaryDir tempDir;
+    Digikam::DImg image8;
+    Digikam::DImg image16;
+};
+
+#endif // DIGIKAM_DIMG_BENCHMARK_H
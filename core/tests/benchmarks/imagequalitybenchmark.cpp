@@ -0,0 +1,211 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : Benchmark of the image quality detectors used to assign Pick Labels
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "imagequalitybenchmark.h"
+
+// Qt includes
+
+#include <QElapsedTimer>
+#include <QTemporaryDir>
+#include <QtConcurrent>    // krazy:exclude=includes
+
+// Local includes
+
+#include "blurfilter.h"
+#include "imagequalitycontainer.h"
+#include "imagequalityparser.h"
+#include "metaengine.h"
+
+using namespace Digikam;
+
+QTEST_GUILESS_MAIN(ImageQualityBenchmark)
+
+namespace
+{
+
+/**
+ * The count of images of each kind.
+ */
+const int imagesPerKind = 4;
+
+/**
+ * Fill the image with gradients and a deterministic noise of the given amplitude.
+ * If overExposed is true, most of the pixels are saturated.
+ */
+void fillImage(DImg& image, quint32 seed, int noise, bool overExposed)
+{
+    for (uint y = 0 ; y < image.height() ; ++y)
+    {
+        uchar* p = image.scanLine(y);
+
+        for (uint x = 0 ; x < image.width() ; ++x)
+        {
+            seed        = seed * 1664525 + 1013904223;
+            const int n = (int)(seed >> 24) * noise / 256 - noise / 2;
+            const int o = overExposed ? 200 : 0;
+
+            p[0] = qBound(0, o + (int)(x * 255 / image.width())  + n, 255);
+            p[1] = qBound(0, o + (int)(y * 255 / image.height()) + n, 255);
+            p[2] = qBound(0, o + (int)(((x / 32 + y / 32) % 2) ? 200 : 40) + n, 255);
+            p[3] = 255;
+            p   += 4;
+        }
+    }
+}
+
+void analyseItem(ImageQualityBenchmark::Item& item)
+{
+    ImageQualityContainer settings;
+    ImageQualityParser    parser(item.image, settings, &item.label);
+    parser.startAnalyse();
+}
+
+void reportRate(int images, qint64 elapsed)
+{
+    qDebug() << images << "images analysed in" << elapsed << "ms:"
+             << qPrintable(QString::number(images * 1000.0 / qMax<qint64>(1, elapsed), 'f', 2))
+             << "images per second";
+}
+
+} // namespace
+
+QList<ImageQualityBenchmark::Item> ImageQualityBenchmark::createItems() const
+{
+    QList<Item>   list;
+    QTemporaryDir tempDir;
+
+    for (int i = 0 ; i < imagesPerKind ; ++i)
+    {
+        Item sharp;
+        sharp.image = DImg(1024, 768, false, true);
+        fillImage(sharp.image, i + 1, 16, false);
+        list << sharp;
+
+        Item blurred;
+        blurred.image = sharp.image.copy();
+        BlurFilter filter(&blurred.image, nullptr, 8);
+        filter.startFilterDirectly();
+        blurred.image = filter.getTargetImage();
+        list << blurred;
+
+        Item noisy;
+        noisy.image = DImg(1024, 768, false, true);
+        fillImage(noisy.image, i + 1, 160, false);
+        list << noisy;
+
+        Item overExposed;
+        overExposed.image = DImg(1024, 768, false, true);
+        fillImage(overExposed.image, i + 1, 16, true);
+        list << overExposed;
+
+        Item compressed;
+        const QString path = tempDir.filePath(QString::fromLatin1("compressed%1.jpg").arg(i));
+        sharp.image.setAttribute(QLatin1String("quality"), 5);
+        sharp.image.save(path, QLatin1String("JPG"));
+        compressed.image.load(path);
+        list << compressed;
+    }
+
+    return list;
+}
+
+void ImageQualityBenchmark::initTestCase()
+{
+    MetaEngine::initializeExiv2();
+
+    items = createItems();
+
+    foreach (const Item& item, items)
+    {
+        QVERIFY(!item.image.isNull());
+    }
+
+    for (int i = 0 ; i < items.count() ; ++i)
+    {
+        analyseItem(items[i]);
+        reference << items[i].label;
+    }
+}
+
+void ImageQualityBenchmark::benchAnalyse_data()
+{
+    QTest::addColumn<bool>("concurrent");
+
+    QTest::newRow("one image at a time") << false;
+    QTest::newRow("one image per core")  << true;
+}
+
+void ImageQualityBenchmark::benchAnalyse()
+{
+    QFETCH(bool, concurrent);
+
+    int    images  = 0;
+    qint64 elapsed = 0;
+
+    QBENCHMARK
+    {
+        QList<Item> work = items;
+
+        for (int i = 0 ; i < work.count() ; ++i)
+        {
+            work[i].label = NoPickLabel;
+        }
+
+        QElapsedTimer timer;
+        timer.start();
+
+        if (concurrent)
+        {
+            // As the maintenance tool, which runs one task per core.
+
+            QtConcurrent::blockingMap(work, analyseItem);
+        }
+        else
+        {
+            for (int i = 0 ; i < work.count() ; ++i)
+            {
+                analyseItem(work[i]);
+            }
+        }
+
+        elapsed += timer.elapsed();
+        images  += work.count();
+
+        // The labels must agree with the ones of the reference pass.
+
+        int agreed = 0;
+
+        for (int i = 0 ; i < work.count() ; ++i)
+        {
+            if (work[i].label == reference[i])
+            {
+                ++agreed;
+            }
+        }
+
+        qDebug() << "Labels agreeing with the reference pass:" << agreed << "/" << work.count();
+        QCOMPARE(agreed, work.count());
+    }
+
+    reportRate(images, elapsed);
+}
@@ -0,0 +1,77 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : Benchmark of the image quality detectors used to assign Pick Labels
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_IMAGE_QUALITY_BENCHMARK_H
+#define DIGIKAM_IMAGE_QUALITY_BENCHMARK_H
+
+// Qt includes
+
+#include <QtTest>
+#include <QList>
+
+// Local includes
+
+#include "dimg.h"
+#include "digikam_globals.h"
+
+class ImageQualityBenchmark : public QObject
+{
+    Q_OBJECT
+
+public:
+
+    /**
+     * A generated image and the Pick Label assigned to it.
+     */
+    class Item
+    {
+    public:
+
+        Digikam::DImg      image;
+        Digikam::PickLabel label = Digikam::NoPickLabel;
+    };
+
+private Q_SLOTS:
+
+    void initTestCase();
+
+    void benchAnalyse_data();
+    void benchAnalyse();
+
+private:
+
+    /**
+     * The images are sharp, blurred, noisy, over-exposed or JPEG compressed, with
+     * the 1024 pixels size of the previews analysed by the image quality sorter.
+     */
+    QList<Item> createItems() const;
+
+private:
+
+    QList<Item>               items;
+
+    /// Labels assigned when the images are analysed one by one, in the calling thread.
+    QList<Digikam::PickLabel> reference;
+};
+
+#endif // DIGIKAM_IMAGE_QUALITY_BENCHMARK_H
@@ -0,0 +1,324 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : Benchmarks of the slideshow transitions and effects
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "transitionbenchmark.h"
+
+// Qt includes
+
+#include <QElapsedTimer>
+#include <QThread>
+#include <QThreadPool>
+#include <QFuture>
+#include <QtConcurrent>
+
+// Local includes
+
+#include "transitionmngr.h"
+#include "effectmngr.h"
+#include "frameutils.h"
+
+using namespace Digikam;
+
+QTEST_GUILESS_MAIN(TransitionBenchmark)
+
+namespace
+{
+
+/**
+ * The maximum count of frames rendered for each transition, and the count of frames
+ * of the effects, 4 seconds at 25 frames per second as by default in the video slideshow.
+ */
+const int maxFrames = 100;
+
+QImage makeSource(int seed)
+{
+    // A 6 Mpx image with gradients and a deterministic noise.
+
+    QImage image(3000, 2000, QImage::Format_ARGB32);
+    quint32 n = seed;
+
+    for (int y = 0 ; y < image.height() ; ++y)
+    {
+        QRgb* const line = reinterpret_cast<QRgb*>(image.scanLine(y));
+
+        for (int x = 0 ; x < image.width() ; ++x)
+        {
+            n       = n * 1664525 + 1013904223;
+            line[x] = qRgb((x * 255 / image.width()  + (n >> 27)) & 0xff,
+                           (y * 255 / image.height() + (n >> 27)) & 0xff,
+                           ((x + y) / (seed + 8)     + (n >> 27)) & 0xff);
+        }
+    }
+
+    return image;
+}
+
+void reportFps(int frames, qint64 elapsed)
+{
+    qDebug() << frames << "frames rendered in" << elapsed << "ms:"
+             << qPrintable(QString::number(frames * 1000.0 / qMax<qint64>(1, elapsed), 'f', 1))
+             << "frames per second";
+}
+
+} // namespace
+
+void TransitionBenchmark::initTestCase()
+{
+    source1 = makeSource(1);
+    source2 = makeSource(2);
+}
+
+QList<QSize> TransitionBenchmark::frameSizes()
+{
+    return QList<QSize>() << QSize(1920, 1080) << QSize(3840, 2160);
+}
+
+QImage TransitionBenchmark::imageForSize(const QSize& size, int index) const
+{
+    QImage image = (index == 0) ? source1 : source2;
+
+    return FrameUtils::makeScaledImage(image, size);
+}
+
+void TransitionBenchmark::benchTransition_data()
+{
+    QTest::addColumn<int>("type");
+    QTest::addColumn<QSize>("size");
+
+    const QMap<TransitionMngr::TransType, QString> names = TransitionMngr::transitionNames();
+
+    foreach (const QSize& size, frameSizes())
+    {
+        for (QMap<TransitionMngr::TransType, QString>::const_iterator it = names.constBegin() ;
+             it != names.constEnd() ; ++it)
+        {
+            if (it.key() == TransitionMngr::Random)
+            {
+                continue;
+            }
+
+            const QString row = QString::fromLatin1("%1 %2x%3").arg(it.value())
+                                                               .arg(size.width())
+                                                               .arg(size.height());
+
+            QTest::newRow(row.toLatin1().constData()) << (int)it.key() << size;
+        }
+    }
+}
+
+void TransitionBenchmark::benchTransition()
+{
+    QFETCH(int,   type);
+    QFETCH(QSize, size);
+
+    const QImage inImage  = imageForSize(size, 0);
+    const QImage outImage = imageForSize(size, 1);
+
+    TransitionMngr mngr;
+    mngr.setOutputSize(size);
+    mngr.setInImage(inImage);
+    mngr.setOutImage(outImage);
+
+    int    frames  = 0;
+    qint64 elapsed = 0;
+
+    QBENCHMARK
+    {
+        QElapsedTimer timer;
+        timer.start();
+
+        mngr.setTransition((TransitionMngr::TransType)type);
+
+        int tmout = 0;
+        int count = 0;
+
+        do
+        {
+            QImage frame = mngr.currentFrame(tmout);
+            QVERIFY(!frame.isNull());
+            ++count;
+        }
+        while ((tmout != -1) && (count < maxFrames));
+
+        frames  += count;
+        elapsed += timer.elapsed();
+    }
+
+    reportFps(frames, elapsed);
+}
+
+void TransitionBenchmark::benchEffect_data()
+{
+    QTest::addColumn<int>("type");
+    QTest::addColumn<QSize>("size");
+
+    const QMap<EffectMngr::EffectType, QString> names = EffectMngr::effectNames();
+
+    foreach (const QSize& size, frameSizes())
+    {
+        for (QMap<EffectMngr::EffectType, QString>::const_iterator it = names.constBegin() ;
+             it != names.constEnd() ; ++it)
+        {
+            if (it.key() == EffectMngr::Random)
+            {
+                continue;
+            }
+
+            const QString row = QString::fromLatin1("%1 %2x%3").arg(it.value())
+                                                               .arg(size.width())
+                                                               .arg(size.height());
+
+            QTest::newRow(row.toLatin1().constData()) << (int)it.key() << size;
+        }
+    }
+}
+
+void TransitionBenchmark::benchEffect()
+{
+    QFETCH(int,   type);
+    QFETCH(QSize, size);
+
+    EffectMngr mngr;
+    mngr.setOutputSize(size);
+    mngr.setFrames(maxFrames);
+    mngr.setImage(imageForSize(size, 0));
+
+    int    frames  = 0;
+    qint64 elapsed = 0;
+
+    QBENCHMARK
+    {
+        QElapsedTimer timer;
+        timer.start();
+
+        mngr.setEffect((EffectMngr::EffectType)type);
+
+        int tmout = 0;
+        int count = 0;
+
+        do
+        {
+            QImage frame = mngr.currentFrame(tmout);
+            QVERIFY(!frame.isNull());
+            ++count;
+        }
+        while ((tmout != -1) && (count < maxFrames));
+
+        frames  += count;
+        elapsed += timer.elapsed();
+    }
+
+    reportFps(frames, elapsed);
+}
+
+void TransitionBenchmark::benchSegments_data()
+{
+    QTest::addColumn<int>("threads");
+
+    QTest::newRow("1 thread") << 1;
+
+    if (QThread::idealThreadCount() > 1)
+    {
+        QTest::newRow("all threads") << QThread::idealThreadCount();
+    }
+}
+
+void TransitionBenchmark::benchSegments()
+{
+    QFETCH(int, threads);
+
+    // The rendering part of the video slideshow pipeline: the segments are rendered
+    // in parallel, without the encoding.
+
+    const QSize  size(1920, 1080);
+    const QImage inImage  = imageForSize(size, 0);
+    const QImage outImage = imageForSize(size, 1);
+    const int    segments = 2 * threads;
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(threads);
+
+    int    frames  = 0;
+    qint64 elapsed = 0;
+
+    QBENCHMARK
+    {
+        QElapsedTimer timer;
+        timer.start();
+
+        QList<QFuture<int> > futures;
+
+        for (int i = 0 ; i < segments ; ++i)
+        {
+            futures << QtConcurrent::run(&pool, this, &TransitionBenchmark::renderSegment,
+                                         inImage, outImage, (uint)i);
+        }
+
+        foreach (QFuture<int> future, futures)
+        {
+            frames += future.result();
+        }
+
+        elapsed += timer.elapsed();
+    }
+
+    reportFps(frames, elapsed);
+}
+
+int TransitionBenchmark::renderSegment(const QImage& inImage, const QImage& outImage, uint seed) const
+{
+    int frames = 0;
+    int tmout  = 0;
+
+    TransitionMngr transmngr;
+    EffectMngr     effmngr;
+
+    // The managers seed the random generator of the thread with the time.
+
+    qsrand(seed);
+
+    transmngr.setOutputSize(outImage.size());
+    transmngr.setInImage(inImage);
+    transmngr.setOutImage(outImage);
+    transmngr.setTransition(TransitionMngr::Random);
+
+    do
+    {
+        transmngr.currentFrame(tmout);
+        ++frames;
+    }
+    while ((tmout != -1) && (frames < maxFrames));
+
+    effmngr.setOutputSize(outImage.size());
+    effmngr.setFrames(maxFrames);
+    effmngr.setImage(outImage);
+    effmngr.setEffect(EffectMngr::Random);
+
+    for (int i = 0 ; i < maxFrames ; ++i)
+    {
+        effmngr.currentFrame(tmout);
+        ++frames;
+    }
+
+    return frames;
+}
@@ -0,0 +1,72 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : Benchmarks of the slideshow transitions and effects
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_TRANSITION_BENCHMARK_H
+#define DIGIKAM_TRANSITION_BENCHMARK_H
+
+// Qt includes
+
+#include <QtTest>
+#include <QImage>
+#include <QSize>
+
+class TransitionBenchmark : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+
+    void initTestCase();
+
+    void benchTransition_data();
+    void benchTransition();
+    void benchEffect_data();
+    void benchEffect();
+    void benchSegments_data();
+    void benchSegments();
+
+private:
+
+    /**
+     * The frames are rendered in 1080p and in 4K, as encoded by the video slideshow.
+     */
+    static QList<QSize> frameSizes();
+
+    /**
+     * The two images of the slideshow, scaled to the size of the frames.
+     */
+    QImage imageForSize(const QSize& size, int index) const;
+
+    /**
+     * Render the frames of one image of the video slideshow, a random transition and a
+     * random effect, as a rendering thread of the slideshow does. Returns the count of frames.
+     */
+    int renderSegment(const QImage& inImage, const QImage& outImage, uint seed) const;
+
+private:
+
+    QImage source1;
+    QImage source2;
+};
+
+#endif // DIGIKAM_TRANSITION_BENCHMARK_H
@@ -0,0 +1,244 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-18
+ * Description : Benchmarks of the image editor undo cache
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "undocachebenchmark.h"
+
+// C++ includes
+
+#include <cstring>
+
+// Qt includes
+
+#include <QFile>
+#include <QDataStream>
+#include <QStandardPaths>
+
+// Local includes
+
+#include "undocache.h"
+
+using namespace Digikam;
+
+QTEST_GUILESS_MAIN(UndoCacheBenchmark)
+
+namespace
+{
+
+enum Engine
+{
+    /// The raw image data written in a file for each level, as done by the former undo cache
+    RawFile = 0,
+    TilesInMemory,
+    TilesOnDisk
+};
+
+bool putRawFile(const QString& path, const DImg& img)
+{
+    QFile file(path);
+
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        return false;
+    }
+
+    QDataStream ds(&file);
+    ds << img.width();
+    ds << img.height();
+    ds << img.numBytes();
+    ds << img.hasAlpha();
+    ds << img.sixteenBit();
+
+    return (file.write((const char*)img.bits(), img.numBytes()) == (qint64)img.numBytes());
+}
+
+DImg getRawFile(const QString& path)
+{
+    uint w          = 0;
+    uint h          = 0;
+    uint numBytes   = 0;
+    bool hasAlpha   = false;
+    bool sixteenBit = false;
+
+    QFile file(path);
+
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        return DImg();
+    }
+
+    QDataStream ds(&file);
+    ds >> w;
+    ds >> h;
+    ds >> numBytes;
+    ds >> hasAlpha;
+    ds >> sixteenBit;
+
+    DImg img(w, h, sixteenBit, hasAlpha);
+
+    if (file.read((char*)img.bits(), numBytes) != (qint64)numBytes)
+    {
+        return DImg();
+    }
+
+    return img;
+}
+
+} // namespace
+
+void UndoCacheBenchmark::initTestCase()
+{
+    QStandardPaths::setTestModeEnabled(true);
+    QVERIFY(tempDir.isValid());
+
+    // A 24 Mpx image in 16 bits per color channel, as from a camera raw file.
+
+    before            = DImg(6000, 4000, true);
+    quint32 seed      = 12345;
+    uchar* const bits = before.bits();
+
+    for (uint i = 0 ; i < before.numBytes() ; ++i)
+    {
+        seed    = seed * 1664525 + 1013904223;
+        bits[i] = (uchar)((i / 2048) + (seed >> 28));
+    }
+
+    // A global change such as a color correction changes all pixels,
+    // a local change such as a red eye correction changes a small area.
+
+    globalChange       = before.copy();
+    uchar* const gbits = globalChange.bits();
+
+    for (uint i = 0 ; i < globalChange.numBytes() ; i += 2)
+    {
+        gbits[i] ^= 0x55;
+    }
+
+    localChange        = before.copy();
+
+    for (uint y = 2000 ; y < 2100 ; ++y)
+    {
+        uchar* const line = localChange.scanLine(y);
+
+        for (uint x = 3000 * 8 ; x < 3100 * 8 ; ++x)
+        {
+            line[x] = ~line[x];
+        }
+    }
+}
+
+void UndoCacheBenchmark::addRows() const
+{
+    QTest::addColumn<int>("engine");
+    QTest::addColumn<bool>("local");
+
+    QTest::newRow("raw file, global change")        << (int)RawFile       << false;
+    QTest::newRow("raw file, local change")         << (int)RawFile       << true;
+    QTest::newRow("tiles in memory, global change") << (int)TilesInMemory << false;
+    QTest::newRow("tiles in memory, local change")  << (int)TilesInMemory << true;
+    QTest::newRow("tiles on disk, global change")   << (int)TilesOnDisk   << false;
+    QTest::newRow("tiles on disk, local change")    << (int)TilesOnDisk   << true;
+}
+
+void UndoCacheBenchmark::benchUndoStore_data()
+{
+    addRows();
+}
+
+void UndoCacheBenchmark::benchUndoStore()
+{
+    QFETCH(int,  engine);
+    QFETCH(bool, local);
+
+    const DImg& after  = local ? localChange : globalChange;
+    const QString path = tempDir.filePath(QLatin1String("level.bin"));
+
+    UndoCache cache;
+
+    if (engine == TilesOnDisk)
+    {
+        cache.setMemoryLimit(0);
+    }
+
+    // The level before the step is stored when the step is done,
+    // and the level after the step when it is undone.
+
+    QVERIFY(cache.putData(1, before));
+    QVERIFY(putRawFile(tempDir.filePath(QLatin1String("before.bin")), before));
+
+    QBENCHMARK
+    {
+        if (engine == RawFile)
+        {
+            QVERIFY(putRawFile(path, after));
+        }
+        else
+        {
+            cache.clearFrom(2);
+            QVERIFY(cache.putData(2, after));
+        }
+    }
+
+    qDebug() << "Bytes stored in memory:" << cache.memoryUsage() << "on disk:" << cache.diskUsage();
+}
+
+void UndoCacheBenchmark::benchUndoRestore_data()
+{
+    addRows();
+}
+
+void UndoCacheBenchmark::benchUndoRestore()
+{
+    QFETCH(int,  engine);
+    QFETCH(bool, local);
+
+    const DImg& after  = local ? localChange : globalChange;
+    const QString path = tempDir.filePath(QLatin1String("level.bin"));
+
+    UndoCache cache;
+
+    if (engine == TilesOnDisk)
+    {
+        cache.setMemoryLimit(0);
+    }
+
+    QVERIFY(cache.putData(1, before));
+    QVERIFY(cache.putData(2, after));
+    QVERIFY(putRawFile(path, after));
+
+    DImg img;
+
+    QBENCHMARK
+    {
+        if (engine == RawFile)
+        {
+            img = getRawFile(path);
+        }
+        else
+        {
+            img = cache.getData(2);
+        }
+    }
+
+    QVERIFY(!img.isNull());
+    QCOMPARE(memcmp(img.bits(), after.bits(), after.numBytes()), 0);
+}
@@ -0,0 +1,63 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-18
+ * Description : Benchmarks of the image editor undo cache
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_UNDO_CACHE_BENCHMARK_H
+#define DIGIKAM_UNDO_CACHE_BENCHMARK_H
+
+// Qt includes
+
+#include <QtTest>
+#include <QTemporaryDir>
+
+// Local includes
+
+#include "dimg.h"
+
+class UndoCacheBenchmark : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+
+    void initTestCase();
+
+    void benchUndoStore_data();
+    void benchUndoStore();
+    void benchUndoRestore_data();
+    void benchUndoRestore();
+
+private:
+
+    void addRows() const;
+
+private:
+
+    QTemporaryDir tempDir;
+
+    /// The image before the step, and after a global and a local change
+    Digikam::DImg before;
+    Digikam::DImg globalChange;
+    Digikam::DImg localChange;
+};
+
+#endif // DIGIKAM_UNDO_CACHE_BENCHMARK_H
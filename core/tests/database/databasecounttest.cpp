@@ -0,0 +1,236 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : Test the items count of the albums and tags in the core database
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "databasecounttest.h"
+
+// Qt includes
+
+#include <QDir>
+#include <QFile>
+#include <QDateTime>
+#include <QTime>
+
+// Local includes
+
+#include "coredb.h"
+#include "coredbaccess.h"
+#include "dbengineparameters.h"
+
+using namespace Digikam;
+
+QTEST_GUILESS_MAIN(DatabaseCountTest)
+
+void DatabaseCountTest::initTestCase()
+{
+    dbFile = QDir::tempPath() + QLatin1String("/digikamtests-databasecounttest-") +
+             QTime::currentTime().toString(QLatin1String("hhmmsszzz")) + QLatin1String(".db");
+
+    DbEngineParameters params(QLatin1String("QSQLITE"), dbFile, QLatin1String("QSQLITE"), dbFile);
+    CoreDbAccess::setParameters(params, CoreDbAccess::MainApplication);
+    QVERIFY(CoreDbAccess::checkReadyForUse(nullptr));
+
+    // Three albums with 3, 2 and 0 visible items, and a trashed item in the second one.
+    // Three tags assigned to 2, 1 and 0 visible items, and to the trashed item.
+
+    CoreDbAccess access;
+    const QDateTime date(QDate(2019, 1, 1), QTime(12, 0));
+
+    const int rootId = access.db()->addAlbumRoot(AlbumRoot::VolumeHardWired,
+                                                 QLatin1String("volumeid:?path=") + QDir::tempPath(),
+                                                 QLatin1String("/"),
+                                                 QLatin1String("Test"));
+    QVERIFY(rootId != -1);
+
+    for (int i = 0 ; i < 3 ; ++i)
+    {
+        albumIds << access.db()->addAlbum(rootId, QString::fromLatin1("/album%1").arg(i),
+                                          QString(), date.date(), QString());
+        tagIds   << access.db()->addTag(0, QString::fromLatin1("Tag %1").arg(i), QLatin1String("tag"), 0);
+    }
+
+    // The items of the first album are taken in January, the others in March.
+
+    QList<qlonglong>& items = itemIds;
+    const int itemAlbums[]  = { 0, 0, 0, 1, 1, 1 };
+    const QDateTime creationDates[] =
+    {
+        date, date, date,
+        QDateTime(QDate(2019, 3, 15), QTime(12, 0)),
+        QDateTime(QDate(2019, 3, 15), QTime(12, 0)),
+        QDateTime(QDate(2019, 3, 20), QTime(12, 0))
+    };
+
+    for (int i = 0 ; i < 6 ; ++i)
+    {
+        items << access.db()->addItem(albumIds.at(itemAlbums[i]),
+                                      QString::fromLatin1("IMG_%1.JPG").arg(i),
+                                      DatabaseItem::Visible, DatabaseItem::Image,
+                                      date, 1000 + i, QString::number(i));
+        QVERIFY(items.last() != -1);
+
+        access.db()->addItemInformation(items.last(), QVariantList() << creationDates[i],
+                                        DatabaseFields::CreationDate);
+    }
+
+    access.db()->setItemStatus(items.last(), DatabaseItem::Trashed);
+
+    access.db()->addItemTag(items.at(0), tagIds.at(0));
+    access.db()->addItemTag(items.at(3), tagIds.at(0));
+    access.db()->addItemTag(items.at(1), tagIds.at(1));
+    access.db()->addItemTag(items.at(5), tagIds.at(0));
+    access.db()->addItemTag(items.at(5), tagIds.at(2));
+}
+
+void DatabaseCountTest::cleanupTestCase()
+{
+    CoreDbAccess::cleanUpDatabase();
+    QFile(dbFile).remove();
+}
+
+void DatabaseCountTest::testAlbumsCount()
+{
+    QMap<int, int> counts = CoreDbAccess().db()->getNumberOfImagesInAlbums();
+
+    QCOMPARE(counts.value(albumIds.at(0), -1), 3);
+    QCOMPARE(counts.value(albumIds.at(1), -1), 2);
+    QCOMPARE(counts.value(albumIds.at(2), -1), 0);
+}
+
+void DatabaseCountTest::testChangedAlbumsCount()
+{
+    // Only the given albums are counted, and an album without item is counted as 0.
+
+    QMap<int, int> counts = CoreDbAccess().db()->getNumberOfImagesInAlbums(QList<int>() << albumIds.at(1)
+                                                                                        << albumIds.at(2));
+
+    QCOMPARE(counts.size(), 2);
+    QCOMPARE(counts.value(albumIds.at(1), -1), 2);
+    QCOMPARE(counts.value(albumIds.at(2), -1), 0);
+
+    // The counts agree with the full count.
+
+    QMap<int, int> all = CoreDbAccess().db()->getNumberOfImagesInAlbums();
+    counts             = CoreDbAccess().db()->getNumberOfImagesInAlbums(albumIds);
+
+    foreach (int id, albumIds)
+    {
+        QCOMPARE(counts.value(id, -1), all.value(id, -1));
+    }
+
+    QVERIFY(CoreDbAccess().db()->getNumberOfImagesInAlbums(QList<int>()).isEmpty());
+}
+
+void DatabaseCountTest::testTagsCount()
+{
+    QMap<int, int> counts = CoreDbAccess().db()->getNumberOfImagesInTags();
+
+    QCOMPARE(counts.value(tagIds.at(0), -1), 2);
+    QCOMPARE(counts.value(tagIds.at(1), -1), 1);
+    QCOMPARE(counts.value(tagIds.at(2), -1), 0);
+}
+
+void DatabaseCountTest::testChangedTagsCount()
+{
+    QMap<int, int> counts = CoreDbAccess().db()->getNumberOfImagesInTags(QList<int>() << tagIds.at(0)
+                                                                                    << tagIds.at(2));
+
+    QCOMPARE(counts.size(), 2);
+    QCOMPARE(counts.value(tagIds.at(0), -1), 2);
+    QCOMPARE(counts.value(tagIds.at(2), -1), 0);
+
+    QMap<int, int> all = CoreDbAccess().db()->getNumberOfImagesInTags();
+    counts             = CoreDbAccess().db()->getNumberOfImagesInTags(tagIds);
+
+    foreach (int id, tagIds)
+    {
+        QCOMPARE(counts.value(id, -1), all.value(id, -1));
+    }
+
+    QVERIFY(CoreDbAccess().db()->getNumberOfImagesInTags(QList<int>()).isEmpty());
+}
+
+void DatabaseCountTest::testChunkedCount()
+{
+    // More ids than bound values allowed in one query: the list is counted by chunks.
+
+    QList<int> ids = tagIds;
+
+    for (int i = 0 ; i < 1200 ; ++i)
+    {
+        ids << 100000 + i;
+    }
+
+    QMap<int, int> counts = CoreDbAccess().db()->getNumberOfImagesInTags(ids);
+
+    QCOMPARE(counts.size(), ids.size());
+    QCOMPARE(counts.value(tagIds.at(0), -1), 2);
+    QCOMPARE(counts.value(tagIds.at(1), -1), 1);
+    QCOMPARE(counts.value(100000 + 1199, -1), 0);
+
+    ids = albumIds;
+
+    for (int i = 0 ; i < 1200 ; ++i)
+    {
+        ids << 100000 + i;
+    }
+
+    counts = CoreDbAccess().db()->getNumberOfImagesInAlbums(ids);
+
+    QCOMPARE(counts.size(), ids.size());
+    QCOMPARE(counts.value(albumIds.at(0), -1), 3);
+    QCOMPARE(counts.value(albumIds.at(1), -1), 2);
+    QCOMPARE(counts.value(100000 + 1199, -1), 0);
+}
+
+void DatabaseCountTest::testChangedDatesCount()
+{
+    const QDateTime january(QDate(2019, 1, 1), QTime(12, 0));
+    const QDateTime march(QDate(2019, 3, 15), QTime(12, 0));
+
+    QMap<QDateTime, int> all = CoreDbAccess().db()->getAllCreationDatesAndNumberOfImages();
+
+    QCOMPARE(all.size(), 2);
+    QCOMPARE(all.value(january, -1), 3);
+    QCOMPARE(all.value(march, -1), 2);
+
+    // The trashed item only gives its month: the visible items of March are counted,
+    // and the month itself is in the map.
+
+    QMap<QDateTime, int> counts = CoreDbAccess().db()->getCreationDatesAndNumberOfImages(QList<qlonglong>() << itemIds.last());
+
+    QCOMPARE(counts.size(), 2);
+    QCOMPARE(counts.value(march, -1), 2);
+    QCOMPARE(counts.value(QDateTime(QDate(2019, 3, 1)), -1), 0);
+    QVERIFY(!counts.contains(january));
+
+    // The counts of all months agree with the full count.
+
+    counts = CoreDbAccess().db()->getCreationDatesAndNumberOfImages(itemIds);
+
+    for (QMap<QDateTime, int>::const_iterator it = all.constBegin() ; it != all.constEnd() ; ++it)
+    {
+        QCOMPARE(counts.value(it.key(), -1), it.value());
+    }
+
+    QVERIFY(CoreDbAccess().db()->getCreationDatesAndNumberOfImages(QList<qlonglong>()).isEmpty());
+}
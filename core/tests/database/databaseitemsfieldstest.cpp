@@ -0,0 +1,277 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : Test the batch getters of item fields in the core database
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "databaseitemsfieldstest.h"
+
+// Qt includes
+
+#include <QDir>
+#include <QFile>
+#include <QDateTime>
+#include <QTime>
+
+// Local includes
+
+#include "coredb.h"
+#include "coredbaccess.h"
+#include "coredbtransaction.h"
+#include "dbengineparameters.h"
+
+using namespace Digikam;
+
+QTEST_GUILESS_MAIN(DatabaseItemsFieldsTest)
+
+namespace
+{
+    // More items than the ids bound in one query by the batch getters.
+    const int itemsCount = 1234;
+
+    const DatabaseFields::ImageMetadata imageFields = DatabaseFields::Make        |
+                                                      DatabaseFields::Model       |
+                                                      DatabaseFields::Aperture    |
+                                                      DatabaseFields::Sensitivity;
+
+    const DatabaseFields::VideoMetadata videoFields = DatabaseFields::AspectRatio |
+                                                      DatabaseFields::Duration    |
+                                                      DatabaseFields::FrameRate   |
+                                                      DatabaseFields::VideoCodec;
+
+    const DatabaseFields::ItemPositions positionFields = DatabaseFields::LatitudeNumber  |
+                                                         DatabaseFields::LongitudeNumber |
+                                                         DatabaseFields::Altitude        |
+                                                         DatabaseFields::PositionDescription;
+}
+
+void DatabaseItemsFieldsTest::initTestCase()
+{
+    dbFile = QDir::tempPath() + QLatin1String("/digikamtests-databaseitemsfieldstest-") +
+             QTime::currentTime().toString(QLatin1String("hhmmsszzz")) + QLatin1String(".db");
+
+    DbEngineParameters params(QLatin1String("QSQLITE"), dbFile, QLatin1String("QSQLITE"), dbFile);
+    CoreDbAccess::setParameters(params, CoreDbAccess::MainApplication);
+    QVERIFY(CoreDbAccess::checkReadyForUse(nullptr));
+
+    // Every second item has image metadata, every third item has video metadata,
+    // and every fifth item has a position, with a null altitude for some of them.
+
+    CoreDbAccess access;
+    const QDateTime date(QDate(2019, 1, 1), QTime(12, 0));
+
+    const int rootId  = access.db()->addAlbumRoot(AlbumRoot::VolumeHardWired,
+                                                  QLatin1String("volumeid:?path=") + QDir::tempPath(),
+                                                  QLatin1String("/"),
+                                                  QLatin1String("Test"));
+    QVERIFY(rootId != -1);
+
+    const int albumId = access.db()->addAlbum(rootId, QLatin1String("/album"), QString(), date.date(), QString());
+    QVERIFY(albumId != -1);
+
+    CoreDbTransaction transaction(&access);
+
+    for (int i = 0 ; i < itemsCount ; ++i)
+    {
+        const qlonglong id = access.db()->addItem(albumId, QString::fromLatin1("IMG_%1.JPG").arg(i),
+                                                  DatabaseItem::Visible, DatabaseItem::Image,
+                                                  date, 1000 + i, QString::number(i));
+        QVERIFY(id != -1);
+        itemIds << id;
+
+        if ((i % 2) == 0)
+        {
+            access.db()->addImageMetadata(id, QVariantList() << QString::fromLatin1("Make %1").arg(i % 7)
+                                                             << QString::fromLatin1("Model %1").arg(i)
+                                                             << 1.4 + (i % 10)
+                                                             << 100 * (i % 32),
+                                          imageFields);
+        }
+
+        if ((i % 3) == 0)
+        {
+            access.db()->addVideoMetadata(id, QVariantList() << QLatin1String("16:9")
+                                                             << QString::number(1000 * i)
+                                                             << QLatin1String("25")
+                                                             << QLatin1String("h264"),
+                                          videoFields);
+        }
+
+        if ((i % 5) == 0)
+        {
+            access.db()->addItemPosition(id, QVariantList() << 45.0 + i / 1000.0
+                                                            << -3.0 - i / 1000.0
+                                                            << (((i % 10) == 0) ? QVariant() : QVariant(10.0 * i))
+                                                            << QString::fromLatin1("Place %1").arg(i),
+                                         positionFields);
+        }
+    }
+}
+
+void DatabaseItemsFieldsTest::cleanupTestCase()
+{
+    CoreDbAccess::cleanUpDatabase();
+    QFile(dbFile).remove();
+}
+
+QList<qlonglong> DatabaseItemsFieldsTest::queriedIds() const
+{
+    QList<qlonglong> ids;
+
+    for (int i = itemIds.size() - 1 ; i >= 0 ; i -= 2)
+    {
+        ids << itemIds.at(i);
+    }
+
+    for (int i = 0 ; i < itemIds.size() ; i += 2)
+    {
+        ids << itemIds.at(i);
+    }
+
+    ids << itemIds.at(0) << itemIds.at(10) << itemIds.last() + 1000 << -1;
+
+    return ids;
+}
+
+void DatabaseItemsFieldsTest::testItemsImageMetadata()
+{
+    const QList<qlonglong> ids          = queriedIds();
+    const QVector<QVariantList> results = CoreDbAccess().db()->getItemsImageMetadata(ids, imageFields);
+
+    QCOMPARE(results.size(), ids.size());
+
+    for (int i = 0 ; i < ids.size() ; ++i)
+    {
+        QCOMPARE(results.at(i), CoreDbAccess().db()->getImageMetadata(ids.at(i), imageFields));
+    }
+
+    // Only some of the fields.
+
+    const DatabaseFields::ImageMetadata fields = DatabaseFields::Model | DatabaseFields::Sensitivity;
+    const QVector<QVariantList> some           = CoreDbAccess().db()->getItemsImageMetadata(itemIds, fields);
+
+    QCOMPARE(some.size(), itemIds.size());
+    QCOMPARE(some.at(0).size(), 2);
+    QVERIFY(some.at(1).isEmpty());
+
+    for (int i = 0 ; i < itemIds.size() ; ++i)
+    {
+        QCOMPARE(some.at(i), CoreDbAccess().db()->getImageMetadata(itemIds.at(i), fields));
+    }
+}
+
+void DatabaseItemsFieldsTest::testItemsVideoMetadata()
+{
+    const QList<qlonglong> ids          = queriedIds();
+    const QVector<QVariantList> results = CoreDbAccess().db()->getItemsVideoMetadata(ids, videoFields);
+
+    QCOMPARE(results.size(), ids.size());
+
+    for (int i = 0 ; i < ids.size() ; ++i)
+    {
+        QCOMPARE(results.at(i), CoreDbAccess().db()->getVideoMetadata(ids.at(i), videoFields));
+    }
+
+    const QVector<QVariantList> all = CoreDbAccess().db()->getItemsVideoMetadata(itemIds);
+
+    QCOMPARE(all.size(), itemIds.size());
+    QVERIFY(!all.at(0).isEmpty());
+    QVERIFY(all.at(1).isEmpty());
+
+    for (int i = 0 ; i < itemIds.size() ; ++i)
+    {
+        QCOMPARE(all.at(i), CoreDbAccess().db()->getVideoMetadata(itemIds.at(i)));
+    }
+}
+
+void DatabaseItemsFieldsTest::testItemsPositions()
+{
+    const QList<qlonglong> ids          = queriedIds();
+    const QVector<QVariantList> results = CoreDbAccess().db()->getItemsPositions(ids, positionFields);
+
+    QCOMPARE(results.size(), ids.size());
+
+    for (int i = 0 ; i < ids.size() ; ++i)
+    {
+        QCOMPARE(results.at(i), CoreDbAccess().db()->getItemPosition(ids.at(i), positionFields));
+    }
+
+    // The coordinates are numbers, and a missing altitude stays null.
+
+    const DatabaseFields::ItemPositions fields = DatabaseFields::LatitudeNumber |
+                                                 DatabaseFields::LongitudeNumber |
+                                                 DatabaseFields::Altitude;
+    const QVector<QVariantList> positions      = CoreDbAccess().db()->getItemsPositions(itemIds, fields);
+
+    QCOMPARE(positions.size(), itemIds.size());
+    QCOMPARE(positions.at(5).size(), 3);
+    QCOMPARE(positions.at(5).at(0).type(), QVariant::Double);
+    QCOMPARE(positions.at(5).at(0).toDouble(), 45.005);
+    QCOMPARE(positions.at(5).at(2).toDouble(), 50.0);
+    QVERIFY(positions.at(10).at(2).isNull());
+    QVERIFY(positions.at(1).isEmpty());
+
+    for (int i = 0 ; i < itemIds.size() ; ++i)
+    {
+        QCOMPARE(positions.at(i), CoreDbAccess().db()->getItemPosition(itemIds.at(i), fields));
+    }
+}
+
+void DatabaseItemsFieldsTest::testIdsOrder()
+{
+    // The values follow the order of the ids, and a duplicated id gets the values twice.
+
+    const QList<qlonglong> ids = QList<qlonglong>() << itemIds.at(4) << itemIds.at(2) << itemIds.at(4) << itemIds.at(0);
+    const QVector<QVariantList> results = CoreDbAccess().db()->getItemsImageMetadata(ids, DatabaseFields::Model);
+
+    QCOMPARE(results.size(), 4);
+    QCOMPARE(results.at(0), QVariantList() << QLatin1String("Model 4"));
+    QCOMPARE(results.at(1), QVariantList() << QLatin1String("Model 2"));
+    QCOMPARE(results.at(2), QVariantList() << QLatin1String("Model 4"));
+    QCOMPARE(results.at(3), QVariantList() << QLatin1String("Model 0"));
+
+    QVERIFY(CoreDbAccess().db()->getItemsImageMetadata(QList<qlonglong>()).isEmpty());
+    QVERIFY(CoreDbAccess().db()->getItemsVideoMetadata(QList<qlonglong>()).isEmpty());
+    QVERIFY(CoreDbAccess().db()->getItemsPositions(QList<qlonglong>()).isEmpty());
+}
+
+void DatabaseItemsFieldsTest::testNoFields()
+{
+    // Without fields, each item gets an empty list and no query is needed.
+
+    const QList<qlonglong> ids = itemIds.mid(0, 10);
+
+    foreach (const QVariantList& values, CoreDbAccess().db()->getItemsImageMetadata(ids, DatabaseFields::ImageMetadataNone))
+    {
+        QVERIFY(values.isEmpty());
+    }
+
+    foreach (const QVariantList& values, CoreDbAccess().db()->getItemsVideoMetadata(ids, DatabaseFields::VideoMetadataNone))
+    {
+        QVERIFY(values.isEmpty());
+    }
+
+    foreach (const QVariantList& values, CoreDbAccess().db()->getItemsPositions(ids, DatabaseFields::ItemPositionsNone))
+    {
+        QVERIFY(values.isEmpty());
+    }
+
+    QCOMPARE(CoreDbAccess().db()->getItemsPositions(ids, DatabaseFields::ItemPositionsNone).size(), ids.size());
+}
@@ -0,0 +1,60 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : Test the batch getters of item fields in the core database
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_DATABASE_ITEMS_FIELDS_TEST_H
+#define DIGIKAM_DATABASE_ITEMS_FIELDS_TEST_H
+
+// Qt includes
+
+#include <QtTest>
+#include <QList>
+
+class DatabaseItemsFieldsTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+
+    void initTestCase();
+    void cleanupTestCase();
+
+    void testItemsImageMetadata();
+    void testItemsVideoMetadata();
+    void testItemsPositions();
+    void testIdsOrder();
+    void testNoFields();
+
+private:
+
+    /**
+     * The item ids in a shuffled order, with duplicates and ids which do not exist.
+     */
+    QList<qlonglong> queriedIds() const;
+
+private:
+
+    QString          dbFile;
+    QList<qlonglong> itemIds;
+};
+
+#endif // DIGIKAM_DATABASE_ITEMS_FIELDS_TEST_H
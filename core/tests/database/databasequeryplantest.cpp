@@ -0,0 +1,206 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-18
+ * Description : Test the query plans of the most used core database queries
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "databasequeryplantest.h"
+
+// Qt includes
+
+#include <QDir>
+#include <QFile>
+#include <QRegExp>
+#include <QStringList>
+#include <QTime>
+
+// Local includes
+
+#include "coredb.h"
+#include "coredbaccess.h"
+#include "coredbbackend.h"
+#include "dbengineaction.h"
+#include "dbengineparameters.h"
+
+using namespace Digikam;
+
+QTEST_GUILESS_MAIN(DatabaseQueryPlanTest)
+
+void DatabaseQueryPlanTest::initTestCase()
+{
+    dbFile = QDir::tempPath() + QLatin1String("/digikamtests-databasequeryplantest-") +
+             QTime::currentTime().toString(QLatin1String("hhmmsszzz")) + QLatin1String(".db");
+
+    DbEngineParameters params(QLatin1String("QSQLITE"), dbFile, QLatin1String("QSQLITE"), dbFile);
+    CoreDbAccess::setParameters(params, CoreDbAccess::MainApplication);
+    QVERIFY(CoreDbAccess::checkReadyForUse(nullptr));
+    QVERIFY(QFile(dbFile).exists());
+}
+
+void DatabaseQueryPlanTest::cleanupTestCase()
+{
+    CoreDbAccess::cleanUpDatabase();
+    QFile(dbFile).remove();
+}
+
+QStringList DatabaseQueryPlanTest::queryPlan(const QString& query,
+                                             const QList<QVariant>& boundValues,
+                                             const QMap<QString, QVariant>& bindingMap) const
+{
+    QList<QVariant> values;
+    const QString sql = QLatin1String("EXPLAIN QUERY PLAN ") + query;
+
+    if (bindingMap.isEmpty())
+    {
+        CoreDbAccess().backend()->execSql(sql, boundValues, &values);
+    }
+    else
+    {
+        CoreDbAccess().backend()->execSql(sql, bindingMap, &values);
+    }
+
+    // The rows are made of id, parent, notused and detail columns.
+
+    QStringList plan;
+
+    for (int i = 3 ; i < values.size() ; i += 4)
+    {
+        plan << values.at(i).toString();
+    }
+
+    return plan;
+}
+
+QString DatabaseQueryPlanTest::actionStatement(const QString& action) const
+{
+    DbEngineAction dbAction = CoreDbAccess().backend()->getDBAction(action);
+
+    if (dbAction.dbActionElements.isEmpty())
+    {
+        return QString();
+    }
+
+    return dbAction.dbActionElements.first().statement;
+}
+
+void DatabaseQueryPlanTest::verifyNoFullScan(const QStringList& plan) const
+{
+    QVERIFY2(!plan.isEmpty(), "Empty query plan");
+
+    // A step such as "SCAN Images" or "SCAN TABLE Images AS img" reads all rows of the table.
+    // "SCAN Images USING COVERING INDEX ..." only reads the index and is accepted.
+
+    QRegExp fullScan(QLatin1String("^SCAN (TABLE )?\\w+( AS \\w+)?$"));
+
+    foreach (const QString& step, plan)
+    {
+        QVERIFY2(!fullScan.exactMatch(step.trimmed()),
+                 qPrintable(QLatin1String("Full table scan in query plan: ") + step +
+                            QLatin1String(" [") + plan.join(QLatin1String(" | ")) + QLatin1Char(']')));
+    }
+}
+
+void DatabaseQueryPlanTest::testListPAlbum()
+{
+    // See ItemLister::listPAlbum()
+
+    QStringList plan = queryPlan(QLatin1String("SELECT DISTINCT Images.id, Images.name, Images.album, "
+                                               "       ImageInformation.rating, Images.category, "
+                                               "       ImageInformation.format, ImageInformation.creationDate, "
+                                               "       Images.modificationDate, Images.fileSize, "
+                                               "       ImageInformation.width, ImageInformation.height "
+                                               " FROM Images "
+                                               "       LEFT JOIN ImageInformation ON Images.id=ImageInformation.imageid "
+                                               " WHERE Images.status=1 AND Images.album = ?;"),
+                                 QList<QVariant>() << 1);
+
+    verifyNoFullScan(plan);
+    QVERIFY2(plan.first().contains(QLatin1String("dir_status_index")),
+             qPrintable(plan.join(QLatin1String(" | "))));
+}
+
+void DatabaseQueryPlanTest::testListTag()
+{
+    // See ItemLister::listTag()
+
+    QMap<QString, QVariant> parameters;
+    parameters.insert(QLatin1String(":tagID"), 1);
+
+    QString query = actionStatement(QLatin1String("listTag"));
+    QVERIFY(!query.isEmpty());
+
+    QStringList plan = queryPlan(query, QList<QVariant>(), parameters);
+
+    verifyNoFullScan(plan);
+    QVERIFY2(!plan.filter(QLatin1String("COVERING INDEX tag_image_index")).isEmpty(),
+             qPrintable(plan.join(QLatin1String(" | "))));
+}
+
+void DatabaseQueryPlanTest::testListTagRecursive()
+{
+    // See ItemLister::listTag() with recursive tags listing
+
+    QMap<QString, QVariant> parameters;
+    parameters.insert(QLatin1String(":tagPID"), 1);
+    parameters.insert(QLatin1String(":tagID"),  1);
+
+    QString query = actionStatement(QLatin1String("listTagRecursive"));
+    QVERIFY(!query.isEmpty());
+
+    verifyNoFullScan(queryPlan(query, QList<QVariant>(), parameters));
+}
+
+void DatabaseQueryPlanTest::testCreationDates()
+{
+    // See CoreDB::getAllCreationDatesAndNumberOfImages()
+
+    verifyNoFullScan(queryPlan(QLatin1String("SELECT creationDate, COUNT(*) FROM ImageInformation "
+                                             "INNER JOIN Images ON Images.id=ImageInformation.imageid "
+                                             " WHERE Images.status=1 "
+                                             "  GROUP BY creationDate;"),
+                               QList<QVariant>()));
+}
+
+void DatabaseQueryPlanTest::testItemsCount()
+{
+    // See CoreDB::getNumberOfImagesInAlbums() and CoreDB::getNumberOfImagesInTags()
+
+    verifyNoFullScan(queryPlan(QLatin1String("SELECT album, COUNT(*) FROM Images "
+                                             " WHERE Images.status=1 "
+                                             "  GROUP BY album;"),
+                               QList<QVariant>()));
+
+    verifyNoFullScan(queryPlan(QLatin1String("SELECT tagid, COUNT(*) FROM ImageTags "
+                                             " LEFT JOIN Images ON Images.id=ImageTags.imageid "
+                                             "  WHERE Images.status=1 "
+                                             "   GROUP BY tagid;"),
+                               QList<QVariant>()));
+}
+
+void DatabaseQueryPlanTest::testAllItemsWithAlbum()
+{
+    // See CoreDB::getAllItemsWithAlbum(), used by the fuzzy searches
+
+    verifyNoFullScan(queryPlan(QLatin1String("SELECT Images.id, Albums.albumRoot, Albums.id "
+                                             "FROM Images "
+                                             " LEFT JOIN Albums ON Albums.id=Images.album "
+                                             "  WHERE Images.status<3;"),
+                               QList<QVariant>()));
+}
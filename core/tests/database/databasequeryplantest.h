@@ -0,0 +1,74 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-18
+ * Description : Test the query plans of the most used core database queries
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_DATABASE_QUERY_PLAN_TEST_H
+#define DIGIKAM_DATABASE_QUERY_PLAN_TEST_H
+
+// Qt includes
+
+#include <QtTest>
+#include <QMap>
+#include <QVariant>
+
+class DatabaseQueryPlanTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+
+    void initTestCase();
+    void cleanupTestCase();
+
+    void testListPAlbum();
+    void testListTag();
+    void testListTagRecursive();
+    void testCreationDates();
+    void testItemsCount();
+    void testAllItemsWithAlbum();
+
+private:
+
+    /**
+     * Return the steps of the SQLite query plan of the query. Use the positional
+     * bound values, or the named bound values if bindingMap is not empty.
+     */
+    QStringList queryPlan(const QString& query,
+                          const QList<QVariant>& boundValues,
+                          const QMap<QString, QVariant>& bindingMap = QMap<QString, QVariant>()) const;
+
+    /**
+     * Return the action statement from dbconfig.xml.
+     */
+    QString actionStatement(const QString& action) const;
+
+    /**
+     * Check that no step of the query plan scans a whole table without using an index.
+     */
+    void verifyNoFullScan(const QStringList& plan) const;
+
+private:
+
+    QString dbFile;
+};
+
+#endif // DIGIKAM_DATABASE_QUERY_PLAN_TEST_H
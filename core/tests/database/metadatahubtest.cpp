@@ -0,0 +1,180 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : Test the results of the metadata hub writes to files
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "metadatahubtest.h"
+
+// Qt includes
+
+#include <QDateTime>
+#include <QFile>
+#include <QFileInfo>
+#include <QImage>
+
+// Local includes
+
+#include "captionvalues.h"
+#include "dmetadata.h"
+#include "metadatahub.h"
+#include "template.h"
+
+using namespace Digikam;
+
+QTEST_GUILESS_MAIN(MetadataHubTest)
+
+namespace
+{
+
+/**
+ * The values of a hub are loaded from the database by the application.
+ * This hub is given them directly.
+ */
+class RatingHub : public MetadataHub
+{
+public:
+
+    explicit RatingHub(int rating)
+    {
+        load(QDateTime(), CaptionsMap(), CaptionsMap(), -1, -1, rating, Template());
+    }
+};
+
+} // namespace
+
+void MetadataHubTest::initTestCase()
+{
+    MetaEngine::initializeExiv2();
+
+    QVERIFY(tempDir.isValid());
+
+    QImage image(64, 48, QImage::Format_RGB32);
+    image.fill(Qt::darkGreen);
+
+    sourceFile = tempDir.filePath(QLatin1String("source.jpg"));
+    QVERIFY(image.save(sourceFile, "JPG"));
+}
+
+void MetadataHubTest::cleanupTestCase()
+{
+    MetaEngine::cleanupExiv2();
+}
+
+QString MetadataHubTest::copyOfSource(const QString& name) const
+{
+    const QString filePath = tempDir.filePath(name);
+
+    if (!QFile::copy(sourceFile, filePath))
+    {
+        return QString();
+    }
+
+    return filePath;
+}
+
+MetaEngineSettingsContainer MetadataHubTest::ratingSettings() const
+{
+    MetaEngineSettingsContainer settings;
+    settings.saveComments        = false;
+    settings.saveDateTime        = false;
+    settings.savePickLabel       = false;
+    settings.saveColorLabel      = false;
+    settings.saveRating          = true;
+    settings.saveTemplate        = false;
+    settings.saveTags            = false;
+    settings.saveFaceTags        = false;
+    settings.useLazySync         = false;
+    settings.metadataWritingMode = MetaEngine::WRITE_TO_FILE_ONLY;
+
+    return settings;
+}
+
+void MetadataHubTest::testWriteDone()
+{
+    const QString filePath = copyOfSource(QLatin1String("done.jpg"));
+    QVERIFY(!filePath.isEmpty());
+
+    RatingHub hub(3);
+    QCOMPARE(hub.write(filePath, MetadataHub::WRITE_ALL, true, ratingSettings()), MetadataHub::WriteDone);
+
+    QCOMPARE(DMetadata(filePath).getItemRating(), 3);
+}
+
+void MetadataHubTest::testWriteUnchanged()
+{
+    // A second write of the same values does not rewrite the file.
+
+    const QString filePath = copyOfSource(QLatin1String("unchanged.jpg"));
+    QVERIFY(!filePath.isEmpty());
+
+    RatingHub first(4);
+    QCOMPARE(first.write(filePath, MetadataHub::WRITE_ALL, true, ratingSettings()), MetadataHub::WriteDone);
+
+    QFile file(filePath);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    const QByteArray content = file.readAll();
+    file.close();
+
+    RatingHub second(4);
+    QCOMPARE(second.write(filePath, MetadataHub::WRITE_ALL, true, ratingSettings()), MetadataHub::WriteUnchanged);
+
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    QCOMPARE(file.readAll(), content);
+    file.close();
+
+    // A different value is written again.
+
+    RatingHub third(5);
+    QCOMPARE(third.write(filePath, MetadataHub::WRITE_ALL, true, ratingSettings()), MetadataHub::WriteDone);
+    QCOMPARE(DMetadata(filePath).getItemRating(), 5);
+}
+
+void MetadataHubTest::testNothingToWrite()
+{
+    // Without any component to write, the file is not touched.
+
+    const QString filePath = copyOfSource(QLatin1String("nothing.jpg"));
+    QVERIFY(!filePath.isEmpty());
+
+    const QDateTime modified = QFileInfo(filePath).lastModified();
+
+    MetaEngineSettingsContainer settings = ratingSettings();
+    settings.saveRating                  = false;
+
+    RatingHub hub(2);
+    QCOMPARE(hub.write(filePath, MetadataHub::WRITE_ALL, true, settings), MetadataHub::WriteUnchanged);
+
+    RatingHub other(2);
+    QCOMPARE(other.write(filePath, MetadataHub::WRITE_TITLE, true, ratingSettings()), MetadataHub::WriteUnchanged);
+
+    QCOMPARE(QFileInfo(filePath).lastModified(), modified);
+}
+
+void MetadataHubTest::testWriteFailed()
+{
+    // A failure is reported apart from an unchanged file.
+
+    const QString filePath = tempDir.filePath(QLatin1String("missing/failed.jpg"));
+
+    RatingHub hub(1);
+    QCOMPARE(hub.write(filePath, MetadataHub::WRITE_ALL, true, ratingSettings()), MetadataHub::WriteFailed);
+    QVERIFY(!QFile::exists(filePath));
+}
@@ -0,0 +1,68 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : Test the results of the metadata hub writes to files
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_METADATA_HUB_TEST_H
+#define DIGIKAM_METADATA_HUB_TEST_H
+
+// Qt includes
+
+#include <QtTest>
+#include <QTemporaryDir>
+
+// Local includes
+
+#include "metaenginesettingscontainer.h"
+
+class MetadataHubTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+
+    void initTestCase();
+    void cleanupTestCase();
+
+    void testWriteDone();
+    void testWriteUnchanged();
+    void testNothingToWrite();
+    void testWriteFailed();
+
+private:
+
+    /**
+     * Copy the source JPEG file to a new file of the temporary directory.
+     */
+    QString copyOfSource(const QString& name) const;
+
+    /**
+     * Settings writing only the rating to the files.
+     */
+    Digikam::MetaEngineSettingsContainer ratingSettings() const;
+
+private:
+
+    QTemporaryDir tempDir;
+    QString       sourceFile;
+};
+
+#endif // DIGIKAM_METADATA_HUB_TEST_H
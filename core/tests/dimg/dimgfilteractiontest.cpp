@@ -31,6 +31,7 @@
 #include <QHBoxLayout>
 #include <QTest>
 #include <QDebug>
+#include <QScopedPointer>
 
 // Local includes
 
@@ -38,6 +39,14 @@
 #include "dimagehistory.h"
 #include "drawdecoding.h"
 #include "filteractionfilter.h"
+#include "pointfilterchain.h"
+#include "bcgfilter.h"
+#include "cbfilter.h"
+#include "invertfilter.h"
+#include "hslfilter.h"
+#include "mixerfilter.h"
+#include "wbfilter.h"
+#include "dimgfiltermanager.h"
 
 QTEST_MAIN(DImgFilterActionTest)
 
@@ -124,6 +133,191 @@ void DImgFilterActionTest::testActions()
     }
 }
 
+void DImgFilterActionTest::testPointFilterChain()
+{
+    DImg original(imageDir().filePath(originalImage()));
+    QVERIFY(!original.isNull());
+
+    BCGContainer bcgPrm;
+    bcgPrm.brightness = 0.1;
+    bcgPrm.contrast   = 1.2;
+    bcgPrm.gamma      = 0.8;
+
+    CBContainer cbPrm;
+    cbPrm.red         = 0.2;
+    cbPrm.blue        = -0.1;
+
+    // Lookup tables only, composed in a single stage.
+
+    QList<FilterAction> actions;
+    actions << BCGFilter(nullptr, nullptr, bcgPrm).filterAction();
+    actions << CBFilter(nullptr, nullptr, cbPrm).filterAction();
+    actions << InvertFilter(nullptr, nullptr).filterAction();
+
+    DImg sequential = applySequentially(original, actions);
+    DImg fused      = original.copy();
+
+    PointFilterChain chain;
+
+    foreach (const FilterAction& action, actions)
+    {
+        QVERIFY(chain.addFilterAction(action, fused));
+    }
+
+    QCOMPARE(chain.count(), 3);
+    QCOMPARE(chain.filterActions().count(), 3);
+
+    chain.apply(fused);
+
+    QVERIFY(chain.isEmpty());
+    QVERIFY(fused.size() == sequential.size());
+    QVERIFY(memcmp(fused.bits(), sequential.bits(), fused.numBytes()) == 0);
+}
+
+void DImgFilterActionTest::testPointFilterChainKernels_data()
+{
+    QTest::addColumn<bool>("sixteenBit");
+
+    QTest::newRow("8 bits")  << false;
+    QTest::newRow("16 bits") << true;
+}
+
+void DImgFilterActionTest::testPointFilterChainKernels()
+{
+    QFETCH(bool, sixteenBit);
+
+    DImg original(imageDir().filePath(originalImage()));
+    QVERIFY(!original.isNull());
+
+    if (sixteenBit)
+    {
+        original.convertToSixteenBit();
+    }
+    else
+    {
+        original.convertToEightBit();
+    }
+
+    // Lookup tables and kernels mixed. The white balance finds its channel maxima
+    // from the image, the filters chained before it are applied first.
+
+    QList<FilterAction> actions = mixedActions();
+
+    DImg sequential = applySequentially(original, actions);
+    DImg fused      = original.copy();
+
+    PointFilterChain chain;
+
+    foreach (const FilterAction& action, actions)
+    {
+        QVERIFY(chain.addFilterAction(action, fused));
+    }
+
+    QCOMPARE(chain.count(), actions.count());
+
+    chain.apply(fused);
+
+    QVERIFY(chain.isEmpty());
+    QVERIFY(fused.size() == sequential.size());
+    QVERIFY(memcmp(fused.bits(), sequential.bits(), fused.numBytes()) == 0);
+}
+
+void DImgFilterActionTest::testPointFilterChainDepthChange()
+{
+    DImg original(imageDir().filePath(originalImage()));
+    QVERIFY(!original.isNull());
+    original.convertToEightBit();
+
+    QList<FilterAction> actions = mixedActions();
+
+    // The filters are chained for an 8 bits image, which is converted to 16 bits before
+    // the chain is applied: the pending filters must be prepared again, not dropped.
+
+    DImg fused = original.copy();
+
+    PointFilterChain chain;
+
+    foreach (const FilterAction& action, actions)
+    {
+        QVERIFY(chain.addFilterAction(action, fused));
+    }
+
+    fused.convertToSixteenBit();
+    chain.apply(fused);
+
+    QVERIFY(chain.isEmpty());
+    QVERIFY(fused.sixteenBit());
+
+    // The filters applied before the white balance, while the image was 8 bits, are applied
+    // the same way to the reference.
+
+    DImg sequential = applySequentially(original, actions.mid(0, 3));
+    sequential.convertToSixteenBit();
+    sequential      = applySequentially(sequential, actions.mid(3));
+
+    QVERIFY(fused.size() == sequential.size());
+    QVERIFY(memcmp(fused.bits(), sequential.bits(), fused.numBytes()) == 0);
+}
+
+QList<FilterAction> DImgFilterActionTest::mixedActions() const
+{
+    BCGContainer bcgPrm;
+    bcgPrm.brightness     = 0.05;
+    bcgPrm.contrast       = 1.1;
+    bcgPrm.gamma          = 0.9;
+
+    HSLContainer hslPrm;
+    hslPrm.hue            = 20.0;
+    hslPrm.saturation     = 15.0;
+    hslPrm.lightness      = -5.0;
+
+    MixerContainer mixerPrm;
+    mixerPrm.redRedGain   = 0.8;
+    mixerPrm.redGreenGain = 0.2;
+    mixerPrm.blueBlueGain = 1.1;
+
+    WBContainer wbPrm;
+    wbPrm.temperature     = 4750.0;
+    wbPrm.expositionMain  = 0.3;
+    wbPrm.saturation      = 1.2;
+
+    CBContainer cbPrm;
+    cbPrm.green           = 0.1;
+
+    QList<FilterAction> actions;
+    actions << BCGFilter(nullptr, nullptr, bcgPrm).filterAction();
+    actions << HSLFilter(nullptr, nullptr, hslPrm).filterAction();
+    actions << MixerFilter(nullptr, nullptr, mixerPrm).filterAction();
+    actions << WBFilter(nullptr, nullptr, wbPrm).filterAction();
+    actions << CBFilter(nullptr, nullptr, cbPrm).filterAction();
+    actions << InvertFilter(nullptr, nullptr).filterAction();
+
+    return actions;
+}
+
+DImg DImgFilterActionTest::applySequentially(const DImg& image, const QList<FilterAction>& actions) const
+{
+    DImg img = image.copy();
+
+    foreach (const FilterAction& action, actions)
+    {
+        QScopedPointer<DImgThreadedFilter> filter(DImgFilterManager::instance()->createFilter(action.identifier(),
+                                                                                             action.version()));
+
+        if (!filter)
+        {
+            return DImg();
+        }
+
+        filter->readParameters(action);
+        filter->setupFilter(img);
+        filter->startFilterDirectly();
+        img = filter->getTargetImage();
+    }
+
+    return img;
+}
+
 void DImgFilterActionTest::showDiff(const DImg& orig, const DImg& ref,
                                     const DImg& result, const DImg& diff)
 {
@@ -33,6 +33,7 @@
 // Local includes
 
 #include "dimg.h"
+#include "filteraction.h"
 
 using namespace Digikam;
 
@@ -47,10 +48,17 @@ public:
 
     void showDiff(const DImg& orig, const DImg& ref, const DImg& result, const DImg& diff);
 
+    QList<FilterAction> mixedActions() const;
+    DImg applySequentially(const DImg& image, const QList<FilterAction>& actions) const;
+
 private Q_SLOTS:
 
     void testDRawDecoding();
     void testActions();
+    void testPointFilterChain();
+    void testPointFilterChainKernels_data();
+    void testPointFilterChainKernels();
+    void testPointFilterChainDepthChange();
 
     void initTestCase();
     void cleanupTestCase();
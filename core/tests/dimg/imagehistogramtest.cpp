@@ -0,0 +1,176 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : Test the parallel computation of the image histogram
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "imagehistogramtest.h"
+
+// Qt includes
+
+#include <QTest>
+#include <QThreadPool>
+
+// Local includes
+
+#include "digikam_globals.h"
+#include "imagehistogram.h"
+
+using namespace Digikam;
+
+QTEST_GUILESS_MAIN(ImageHistogramTest)
+
+void ImageHistogramTest::initTestCase()
+{
+    // Count the large images with several threads, even on a single core.
+
+    m_maxThreadCount = QThreadPool::globalInstance()->maxThreadCount();
+    QThreadPool::globalInstance()->setMaxThreadCount(qMax(4, m_maxThreadCount));
+}
+
+void ImageHistogramTest::cleanupTestCase()
+{
+    QThreadPool::globalInstance()->setMaxThreadCount(m_maxThreadCount);
+}
+
+void ImageHistogramTest::testCalculate_data()
+{
+    QTest::addColumn<uint>("width");
+    QTest::addColumn<uint>("height");
+    QTest::addColumn<bool>("sixteenBit");
+
+    // The large images have a number of pixels which is not a multiple of the threads count.
+
+    QTest::newRow("small 8 bits")  << 101U  << 67U   << false;
+    QTest::newRow("small 16 bits") << 101U  << 67U   << true;
+    QTest::newRow("large 8 bits")  << 1531U << 1019U << false;
+    QTest::newRow("large 16 bits") << 1531U << 1019U << true;
+}
+
+void ImageHistogramTest::testCalculate()
+{
+    QFETCH(uint, width);
+    QFETCH(uint, height);
+    QFETCH(bool, sixteenBit);
+
+    const DImg img = createImage(width, height, sixteenBit);
+    ImageHistogram histogram(img);
+    histogram.calculate();
+
+    QVERIFY(histogram.isValid());
+    QCOMPARE(histogram.getHistogramSegments(), sixteenBit ? NUM_SEGMENTS_16BIT : NUM_SEGMENTS_8BIT);
+
+    for (int channel = LuminosityChannel ; channel <= AlphaChannel ; ++channel)
+    {
+        const QVector<double> reference = serialHistogram(img, channel);
+
+        for (int bin = 0 ; bin < reference.size() ; ++bin)
+        {
+            if (histogram.getValue(channel, bin) != reference[bin])
+            {
+                QFAIL(qPrintable(QString::fromLatin1("Channel %1, bin %2: %3 instead of %4")
+                                 .arg(channel).arg(bin)
+                                 .arg(histogram.getValue(channel, bin))
+                                 .arg(reference[bin])));
+            }
+        }
+    }
+}
+
+void ImageHistogramTest::testStopCalculation()
+{
+    // A histogram stopped before its calculation, as by a cancelled filter, is not valid.
+
+    ImageHistogram histogram(createImage(1531, 1019, false));
+    histogram.stopCalculation();
+    histogram.calculate();
+
+    QVERIFY(!histogram.isValid());
+}
+
+DImg ImageHistogramTest::createImage(uint width, uint height, bool sixteenBit) const
+{
+    DImg img(width, height, sixteenBit, true);
+    quint32 seed = 12345;
+
+    if (sixteenBit)
+    {
+        unsigned short* data = reinterpret_cast<unsigned short*>(img.bits());
+
+        for (uint i = 0 ; i < img.numPixels() * 4 ; ++i)
+        {
+            seed    = seed * 1103515245 + 12345;
+            data[i] = (unsigned short)(seed >> 16);
+        }
+    }
+    else
+    {
+        uchar* data = img.bits();
+
+        for (uint i = 0 ; i < img.numPixels() * 4 ; ++i)
+        {
+            seed    = seed * 1103515245 + 12345;
+            data[i] = (uchar)(seed >> 16);
+        }
+    }
+
+    return img;
+}
+
+QVector<double> ImageHistogramTest::serialHistogram(const DImg& img, int channel) const
+{
+    QVector<double> histogram(img.sixteenBit() ? NUM_SEGMENTS_16BIT : NUM_SEGMENTS_8BIT, 0.0);
+
+    for (uint x = 0 ; x < img.width() ; ++x)
+    {
+        for (uint y = 0 ; y < img.height() ; ++y)
+        {
+            const DColor color = img.getPixelColor(x, y);
+            int value          = 0;
+
+            switch (channel)
+            {
+                case LuminosityChannel:
+                    value = qMax(qMax(color.red(), color.green()), color.blue());
+                    break;
+
+                case RedChannel:
+                    value = color.red();
+                    break;
+
+                case GreenChannel:
+                    value = color.green();
+                    break;
+
+                case BlueChannel:
+                    value = color.blue();
+                    break;
+
+                case AlphaChannel:
+                    value = color.alpha();
+                    break;
+            }
+
+            histogram[value] += 1.0;
+        }
+    }
+
+    return histogram;
+}
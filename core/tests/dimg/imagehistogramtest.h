@@ -0,0 +1,67 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : Test the parallel computation of the image histogram
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_IMAGE_HISTOGRAM_TEST_H
+#define DIGIKAM_IMAGE_HISTOGRAM_TEST_H
+
+// Qt includes
+
+#include <QObject>
+#include <QVector>
+
+// Local includes
+
+#include "dimg.h"
+
+class ImageHistogramTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+
+    void initTestCase();
+    void cleanupTestCase();
+
+    void testCalculate_data();
+    void testCalculate();
+    void testStopCalculation();
+
+private:
+
+    /**
+     * Return an image filled with pseudo random pixels. The large sizes are counted by several threads.
+     */
+    Digikam::DImg createImage(uint width, uint height, bool sixteenBit) const;
+
+    /**
+     * Return the histogram of a channel counted serially, as the histogram was computed before it
+     * was split in several threads.
+     */
+    QVector<double> serialHistogram(const Digikam::DImg& img, int channel) const;
+
+private:
+
+    int m_maxThreadCount;
+};
+
+#endif // DIGIKAM_IMAGE_HISTOGRAM_TEST_H
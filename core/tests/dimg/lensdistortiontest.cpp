@@ -0,0 +1,131 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : Test the versions of the lens distortion filter
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "lensdistortiontest.h"
+
+// Qt includes
+
+#include <QTest>
+
+// Local includes
+
+#include "dcolor.h"
+#include "filteraction.h"
+#include "lensdistortionfilter.h"
+
+using namespace Digikam;
+
+QTEST_GUILESS_MAIN(LensDistortionTest)
+
+namespace
+{
+    const int    gray         = 128;
+    const double mainCoeff    = 50.0;
+    const double rescaleCoeff = 40.0;
+}
+
+DImg LensDistortionTest::runFilter(int version, double brighten) const
+{
+    DImg img(240, 160, false, true);
+    img.fill(DColor(gray, gray, gray, 255, false));
+
+    LensDistortionFilter filter(&img, nullptr, mainCoeff, 0.0, rescaleCoeff, brighten, 0, 0);
+
+    if (version)
+    {
+        FilterAction action(LensDistortionFilter::FilterIdentifier(), version);
+        action.addParameters(filter.filterAction().parameters());
+        filter.readParameters(action);
+    }
+
+    filter.startFilterDirectly();
+
+    return filter.getTargetImage();
+}
+
+void LensDistortionTest::centralRange(const DImg& img, int& min, int& max) const
+{
+    min = 255;
+    max = 0;
+
+    for (uint y = img.height() / 4 ; y < img.height() * 3 / 4 ; ++y)
+    {
+        for (uint x = img.width() / 4 ; x < img.width() * 3 / 4 ; ++x)
+        {
+            DColor col = img.getPixelColor(x, y);
+            min        = qMin(min, qMin(col.red(), qMin(col.green(), col.blue())));
+            max        = qMax(max, qMax(col.red(), qMax(col.green(), col.blue())));
+        }
+    }
+}
+
+void LensDistortionTest::testVersions()
+{
+    LensDistortionFilter filter;
+    QCOMPARE(filter.filterAction().version(), LensDistortionFilter::CurrentVersion());
+    QVERIFY(LensDistortionFilter::SupportedVersions().contains(1));
+    QCOMPARE(filter.supportedVersions(), LensDistortionFilter::SupportedVersions());
+    QCOMPARE(filter.filterVersion(), LensDistortionFilter::CurrentVersion());
+
+    // A version 1 action from an old image history must be replayed as version 1.
+
+    FilterAction action(LensDistortionFilter::FilterIdentifier(), 1);
+    action.addParameter(QLatin1String("brighten"), 5.0);
+    action.addParameter(QLatin1String("centre_x"), 0);
+    action.addParameter(QLatin1String("centre_y"), 0);
+    action.addParameter(QLatin1String("edge"),     0.0);
+    action.addParameter(QLatin1String("main"),     mainCoeff);
+    action.addParameter(QLatin1String("rescale"),  rescaleCoeff);
+
+    filter.readParameters(action);
+
+    QCOMPARE(filter.filterAction().version(), 1);
+    QCOMPARE(filter.filterVersion(), 1);
+    QCOMPARE(filter.filterAction().parameters(), action.parameters());
+
+    // An unknown version is ignored.
+
+    filter.setFilterVersion(LensDistortionFilter::CurrentVersion() + 1);
+    QCOMPARE(filter.filterVersion(), 1);
+}
+
+void LensDistortionTest::testBrighten()
+{
+    // Without brightening, a distorted uniform image stays uniform, up to the interpolation rounding.
+
+    int min, max;
+    centralRange(runFilter(0, 0.0), min, max);
+
+    QVERIFY(min >= gray - 1);
+    QVERIFY(max <= gray);
+}
+
+void LensDistortionTest::testLegacyBrighten()
+{
+    // Version 1 accumulates the brightening factor from pixel to pixel, even with a zero setting.
+
+    int min, max;
+    centralRange(runFilter(1, 0.0), min, max);
+
+    QVERIFY(max > gray);
+}
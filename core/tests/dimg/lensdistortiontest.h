@@ -0,0 +1,59 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : Test the versions of the lens distortion filter
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_LENS_DISTORTION_TEST_H
+#define DIGIKAM_LENS_DISTORTION_TEST_H
+
+// Qt includes
+
+#include <QObject>
+
+// Local includes
+
+#include "dimg.h"
+
+class LensDistortionTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+
+    void testVersions();
+    void testBrighten();
+    void testLegacyBrighten();
+
+private:
+
+    /**
+     * Run the filter on an uniform gray image. The settings map all the target pixels inside
+     * the source image. If version is 0, the current version of the filter is used.
+     */
+    Digikam::DImg runFilter(int version, double brighten) const;
+
+    /**
+     * Return the bounds of the values in the central part of the image.
+     */
+    void centralRange(const Digikam::DImg& img, int& min, int& max) const;
+};
+
+#endif // DIGIKAM_LENS_DISTORTION_TEST_H
@@ -0,0 +1,243 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : Test the tiled execution mode of the threaded filters
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "tiledfiltertest.h"
+
+// C++ includes
+
+#include <cstring>
+
+// Qt includes
+
+#include <QTest>
+
+// Local includes
+
+#include "digikam_globals.h"
+#include "dimgthreadedfilter.h"
+#include "levelsfilter.h"
+#include "curvesfilter.h"
+#include "imagecurves.h"
+
+using namespace Digikam;
+
+QTEST_GUILESS_MAIN(TiledFilterTest)
+
+namespace
+{
+
+/**
+ * A vertical box blur, to check the bands with overlapping rows.
+ */
+class Q_DECL_HIDDEN VerticalBoxFilter : public DImgThreadedFilter
+{
+public:
+
+    explicit VerticalBoxFilter(DImg* const orgImage)
+        : DImgThreadedFilter(orgImage, nullptr, QLatin1String("VerticalBoxFilter"))
+    {
+        initFilter();
+    }
+
+    ~VerticalBoxFilter()
+    {
+        cancelFilter();
+    }
+
+    FilterAction filterAction() override
+    {
+        return FilterAction(filterIdentifier(), 1);
+    }
+
+    void readParameters(const FilterAction&) override
+    {
+    }
+
+    QString filterIdentifier() const override
+    {
+        return QLatin1String("digikam:TestVerticalBoxFilter");
+    }
+
+protected:
+
+    void filterImage() override
+    {
+        blur(m_orgImage.bits(), m_destImage.bits(), m_orgImage.width(),
+             m_orgImage.height(), m_orgImage.sixteenBit());
+    }
+
+    bool supportsTiledProcessing() const override
+    {
+        return true;
+    }
+
+    int tileOverlap() const override
+    {
+        return 1;
+    }
+
+    void filterTile(uchar* const srcBits, uchar* const destBits, uint width, uint height, bool sixteenBit) override
+    {
+        blur(srcBits, destBits, width, height, sixteenBit);
+    }
+
+private:
+
+    static void blur(const uchar* const src, uchar* const dest, uint width, uint height, bool sixteenBit)
+    {
+        const uint values = width * 4;
+
+        for (uint y = 0 ; y < height ; ++y)
+        {
+            const uint above = (y > 0)            ? y - 1 : y;
+            const uint below = (y + 1 < height)   ? y + 1 : y;
+
+            for (uint x = 0 ; x < values ; ++x)
+            {
+                if (sixteenBit)
+                {
+                    const unsigned short* const s = reinterpret_cast<const unsigned short*>(src);
+                    unsigned short* const d       = reinterpret_cast<unsigned short*>(dest);
+                    d[y * values + x]             = (s[above * values + x] + s[y * values + x] + s[below * values + x]) / 3;
+                }
+                else
+                {
+                    dest[y * values + x] = (src[above * values + x] + src[y * values + x] + src[below * values + x]) / 3;
+                }
+            }
+        }
+    }
+};
+
+DImg runFilter(DImgThreadedFilter* const filter, bool tiled)
+{
+    // Odd bands height, for the last band to be shorter than the others.
+
+    filter->setTiledProcessing(tiled, 7);
+    filter->startFilterDirectly();
+
+    return filter->getTargetImage();
+}
+
+} // namespace
+
+void TiledFilterTest::addDepths()
+{
+    QTest::addColumn<bool>("sixteenBit");
+
+    QTest::newRow("8 bits")  << false;
+    QTest::newRow("16 bits") << true;
+}
+
+DImg TiledFilterTest::createImage(bool sixteenBit) const
+{
+    DImg img(301, 200, sixteenBit, true);
+    uchar* const bits = img.bits();
+    quint32 seed      = 42;
+
+    for (uint i = 0 ; i < img.numBytes() ; ++i)
+    {
+        seed    = seed * 1664525 + 1013904223;
+        bits[i] = (uchar)((i / 64) + (seed >> 27));
+    }
+
+    return img;
+}
+
+bool TiledFilterTest::isSame(const DImg& a, const DImg& b) const
+{
+    return ((a.width()      == b.width())      &&
+            (a.height()     == b.height())     &&
+            (a.sixteenBit() == b.sixteenBit()) &&
+            (memcmp(a.bits(), b.bits(), a.numBytes()) == 0));
+}
+
+void TiledFilterTest::testLevels_data()
+{
+    addDepths();
+}
+
+void TiledFilterTest::testLevels()
+{
+    QFETCH(bool, sixteenBit);
+
+    DImg img      = createImage(sixteenBit);
+    const int max = sixteenBit ? 65535 : 255;
+
+    LevelsContainer settings;
+
+    for (int i = 0 ; i < 5 ; ++i)
+    {
+        settings.lInput[i]  = max / 10;
+        settings.hInput[i]  = max - max / 8;
+        settings.lOutput[i] = max / 20;
+        settings.hOutput[i] = max;
+        settings.gamma[i]   = 1.4;
+    }
+
+    LevelsFilter direct(&img, nullptr, settings);
+    LevelsFilter tiled(&img, nullptr, settings);
+
+    QVERIFY(isSame(runFilter(&direct, false), runFilter(&tiled, true)));
+}
+
+void TiledFilterTest::testCurves_data()
+{
+    addDepths();
+}
+
+void TiledFilterTest::testCurves()
+{
+    QFETCH(bool, sixteenBit);
+
+    DImg img      = createImage(sixteenBit);
+    const int max = sixteenBit ? 65535 : 255;
+
+    ImageCurves curves(sixteenBit);
+    curves.setCurvePoint(LuminosityChannel, 8, QPoint(max / 2, max * 3 / 4));
+    curves.setCurvePoint(RedChannel,        4, QPoint(max / 4, max / 8));
+    curves.curvesCalculateCurve(LuminosityChannel);
+    curves.curvesCalculateCurve(RedChannel);
+
+    CurvesFilter direct(&img, nullptr, curves.getContainer());
+    CurvesFilter tiled(&img, nullptr, curves.getContainer());
+
+    QVERIFY(isSame(runFilter(&direct, false), runFilter(&tiled, true)));
+}
+
+void TiledFilterTest::testOverlap_data()
+{
+    addDepths();
+}
+
+void TiledFilterTest::testOverlap()
+{
+    QFETCH(bool, sixteenBit);
+
+    DImg img = createImage(sixteenBit);
+
+    VerticalBoxFilter direct(&img);
+    VerticalBoxFilter tiled(&img);
+
+    QVERIFY(isSame(runFilter(&direct, false), runFilter(&tiled, true)));
+}
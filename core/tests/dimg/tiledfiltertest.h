@@ -0,0 +1,60 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : Test the tiled execution mode of the threaded filters
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_TILED_FILTER_TEST_H
+#define DIGIKAM_TILED_FILTER_TEST_H
+
+// Qt includes
+
+#include <QObject>
+
+// Local includes
+
+#include "dimg.h"
+
+class TiledFilterTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+
+    void testLevels_data();
+    void testLevels();
+    void testCurves_data();
+    void testCurves();
+    void testOverlap_data();
+    void testOverlap();
+
+private:
+
+    void addDepths();
+
+    /**
+     * Return an image with a height which is not a multiple of the bands height.
+     */
+    Digikam::DImg createImage(bool sixteenBit) const;
+
+    bool isSame(const Digikam::DImg& a, const Digikam::DImg& b) const;
+};
+
+#endif // DIGIKAM_TILED_FILTER_TEST_H
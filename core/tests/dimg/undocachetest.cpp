@@ -0,0 +1,231 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-18
+ * Description : Test the tiled and compressed undo cache of the image editor
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "undocachetest.h"
+
+// C++ includes
+
+#include <cstring>
+
+// Qt includes
+
+#include <QTest>
+#include <QCoreApplication>
+#include <QFileInfo>
+#include <QStandardPaths>
+
+// Local includes
+
+#include "undocache.h"
+
+using namespace Digikam;
+
+QTEST_GUILESS_MAIN(UndoCacheTest)
+
+void UndoCacheTest::initTestCase()
+{
+    QStandardPaths::setTestModeEnabled(true);
+}
+
+DImg UndoCacheTest::createImage(bool sixteenBit, bool hasAlpha) const
+{
+    DImg img(1000, 700, sixteenBit, hasAlpha);
+    uchar* const bits = img.bits();
+    quint32 seed      = 42;
+
+    for (uint i = 0 ; i < img.numBytes() ; ++i)
+    {
+        // Smooth gradients with some noise, as in a photo.
+
+        seed    = seed * 1664525 + 1013904223;
+        bits[i] = (uchar)((i / 64) + (seed >> 29));
+    }
+
+    return img;
+}
+
+bool UndoCacheTest::isSame(const DImg& a, const DImg& b) const
+{
+    return ((a.width()      == b.width())      &&
+            (a.height()     == b.height())     &&
+            (a.sixteenBit() == b.sixteenBit()) &&
+            (a.hasAlpha()   == b.hasAlpha())   &&
+            (a.numBytes()   == b.numBytes())   &&
+            (memcmp(a.bits(), b.bits(), a.numBytes()) == 0));
+}
+
+void UndoCacheTest::testRoundTrip_data()
+{
+    QTest::addColumn<bool>("sixteenBit");
+    QTest::addColumn<bool>("hasAlpha");
+
+    QTest::newRow("8 bits")          << false << false;
+    QTest::newRow("8 bits alpha")    << false << true;
+    QTest::newRow("16 bits")         << true  << false;
+    QTest::newRow("16 bits alpha")   << true  << true;
+}
+
+void UndoCacheTest::testRoundTrip()
+{
+    QFETCH(bool, sixteenBit);
+    QFETCH(bool, hasAlpha);
+
+    UndoCache cache;
+    DImg img = createImage(sixteenBit, hasAlpha);
+
+    QVERIFY(cache.putData(1, img));
+    QVERIFY(!cache.putData(1, img));
+    QVERIFY(isSame(cache.getData(1), img));
+    QVERIFY(cache.getData(2).isNull());
+
+    // The compressed data must be smaller than the image.
+
+    QVERIFY(cache.memoryUsage() < (qint64)img.numBytes());
+}
+
+void UndoCacheTest::testSharedTiles()
+{
+    UndoCache cache;
+    DImg img = createImage(false, false);
+
+    QVERIFY(cache.putData(1, img));
+    const qint64 firstLevel = cache.memoryUsage();
+
+    // The same image again costs nothing.
+
+    QVERIFY(cache.putData(2, img));
+    QCOMPARE(cache.memoryUsage(), firstLevel);
+
+    // A local change only costs the tile changed.
+
+    DImg changed = img.copy();
+    changed.bits()[10] ^= 0xFF;
+
+    QVERIFY(cache.putData(3, changed));
+    const qint64 localChange = cache.memoryUsage() - firstLevel;
+    QVERIFY(localChange > 0);
+    QVERIFY(localChange < firstLevel / 4);
+
+    QVERIFY(isSame(cache.getData(1), img));
+    QVERIFY(isSame(cache.getData(2), img));
+    QVERIFY(isSame(cache.getData(3), changed));
+
+    // The tile changed is released with its level, not the shared ones.
+
+    cache.clearFrom(3);
+    QCOMPARE(cache.memoryUsage(), firstLevel);
+    QVERIFY(isSame(cache.getData(2), img));
+
+    cache.clear();
+    QCOMPARE(cache.memoryUsage(), (qint64)0);
+}
+
+void UndoCacheTest::testDiskTier()
+{
+    UndoCache cache;
+    cache.setMemoryLimit(0);
+
+    DImg img8  = createImage(false, false);
+    DImg img16 = createImage(true, true);
+
+    QVERIFY(cache.putData(1, img8));
+    QVERIFY(cache.putData(2, img16));
+
+    QCOMPARE(cache.memoryUsage(), (qint64)0);
+    QVERIFY(cache.diskUsage() > 0);
+
+    QVERIFY(isSame(cache.getData(2), img16));
+    QVERIFY(isSame(cache.getData(1), img8));
+
+    cache.clear();
+    QCOMPARE(cache.diskUsage(), (qint64)0);
+}
+
+void UndoCacheTest::testDiskSpaceReused()
+{
+    UndoCache cache;
+    cache.setMemoryLimit(0);
+
+    const QString cacheFile = QString::fromUtf8("%1/undocache-%2.bin")
+                              .arg(QStandardPaths::writableLocation(QStandardPaths::CacheLocation))
+                              .arg(QCoreApplication::applicationPid());
+
+    DImg img = createImage(false, false);
+    QVERIFY(cache.putData(1, img));
+
+    qint64 fileSize = 0;
+
+    // Undo and redo changes of the whole image: the space of the levels removed is reused.
+
+    for (int i = 0 ; i < 10 ; ++i)
+    {
+        DImg changed = img.copy();
+
+        for (uint j = 0 ; j < changed.numBytes() ; j += 97)
+        {
+            changed.bits()[j] += i + 1;
+        }
+
+        QVERIFY(cache.putData(2, changed));
+        QVERIFY(isSame(cache.getData(2), changed));
+
+        if (i == 0)
+        {
+            fileSize = QFileInfo(cacheFile).size();
+            QVERIFY(fileSize > 0);
+        }
+
+        cache.clearFrom(2);
+    }
+
+    QVERIFY(QFileInfo(cacheFile).size() < fileSize);
+    QVERIFY(isSame(cache.getData(1), img));
+
+    // The free space at the end of the file is truncated.
+
+    QCOMPARE(QFileInfo(cacheFile).size(), cache.diskUsage());
+
+    cache.clear();
+    QVERIFY(!QFileInfo::exists(cacheFile));
+}
+
+void UndoCacheTest::testClearFrom()
+{
+    UndoCache cache;
+    DImg img = createImage(false, false);
+
+    for (int level = 1 ; level <= 3 ; ++level)
+    {
+        img.bits()[level * 4] = level;
+        QVERIFY(cache.putData(level, img));
+    }
+
+    cache.clearFrom(2);
+
+    QVERIFY(!cache.getData(1).isNull());
+    QVERIFY(cache.getData(2).isNull());
+    QVERIFY(cache.getData(3).isNull());
+
+    QVERIFY(cache.putData(2, img));
+    QVERIFY(isSame(cache.getData(2), img));
+}
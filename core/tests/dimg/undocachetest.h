@@ -0,0 +1,60 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-18
+ * Description : Test the tiled and compressed undo cache of the image editor
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_UNDO_CACHE_TEST_H
+#define DIGIKAM_UNDO_CACHE_TEST_H
+
+// Qt includes
+
+#include <QObject>
+
+// Local includes
+
+#include "dimg.h"
+
+class UndoCacheTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+
+    void initTestCase();
+
+    void testRoundTrip_data();
+    void testRoundTrip();
+    void testSharedTiles();
+    void testDiskTier();
+    void testDiskSpaceReused();
+    void testClearFrom();
+
+private:
+
+    /**
+     * Return an image with a size which is not a multiple of the tiles size.
+     */
+    Digikam::DImg createImage(bool sixteenBit, bool hasAlpha) const;
+
+    bool isSame(const Digikam::DImg& a, const Digikam::DImg& b) const;
+};
+
+#endif // DIGIKAM_UNDO_CACHE_TEST_H
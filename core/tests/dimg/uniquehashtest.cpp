@@ -0,0 +1,138 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : Test the unique hash computed from the file content
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "uniquehashtest.h"
+
+// Qt includes
+
+#include <QFile>
+#include <QTest>
+
+// Local includes
+
+#include "dimg.h"
+
+using namespace Digikam;
+
+QTEST_GUILESS_MAIN(UniqueHashTest)
+
+void UniqueHashTest::initTestCase()
+{
+    QVERIFY(m_tempDir.isValid());
+}
+
+void UniqueHashTest::addSizes() const
+{
+    // The hash reads the first and the last 100 kB of a file: cover files smaller than one part,
+    // files where both parts overlap, and files where they are disjoint.
+
+    QTest::addColumn<int>("size");
+
+    QTest::newRow("1 byte")            << 1;
+    QTest::newRow("small")             << 10 * 1024 + 7;
+    QTest::newRow("one part")          << 100 * 1024;
+    QTest::newRow("overlapping parts") << 150 * 1024 + 3;
+    QTest::newRow("two parts")         << 200 * 1024;
+    QTest::newRow("large")             << 3 * 1024 * 1024 + 11;
+}
+
+QString UniqueHashTest::createFile(int size) const
+{
+    QString path = m_tempDir.filePath(QString::fromLatin1("file-%1.bin").arg(size));
+    QFile file(path);
+
+    if (!file.open(QIODevice::WriteOnly))
+    {
+        return QString();
+    }
+
+    QByteArray content(size, '\0');
+    quint32 seed = size;
+
+    for (int i = 0 ; i < size ; ++i)
+    {
+        seed       = seed * 1103515245 + 12345;
+        content[i] = (char)(seed >> 16);
+    }
+
+    file.write(content);
+    file.close();
+
+    return path;
+}
+
+void UniqueHashTest::testHashFromData_data()
+{
+    addSizes();
+}
+
+void UniqueHashTest::testHashFromData()
+{
+    QFETCH(int, size);
+
+    const QString path = createFile(size);
+    QVERIFY(!path.isEmpty());
+
+    QFile file(path);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    const QByteArray content = file.readAll();
+    file.close();
+
+    QCOMPARE(content.size(), size);
+
+    const QByteArray pathHash = DImg::getUniqueHashV2(path);
+
+    QVERIFY(!pathHash.isEmpty());
+    QCOMPARE(DImg().getUniqueHashV2FromData(content), pathHash);
+}
+
+void UniqueHashTest::testHashFromMappedData_data()
+{
+    addSizes();
+}
+
+void UniqueHashTest::testHashFromMappedData()
+{
+    QFETCH(int, size);
+
+    const QString path = createFile(size);
+    QVERIFY(!path.isEmpty());
+
+    QFile file(path);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+
+    uchar* const map = file.map(0, file.size());
+    QVERIFY(map);
+
+    const QByteArray content = QByteArray::fromRawData(reinterpret_cast<const char*>(map), size);
+
+    QCOMPARE(DImg().getUniqueHashV2FromData(content), DImg::getUniqueHashV2(path));
+
+    file.unmap(map);
+    file.close();
+}
+
+void UniqueHashTest::testNullData()
+{
+    QVERIFY(DImg().getUniqueHashV2FromData(QByteArray()).isNull());
+}
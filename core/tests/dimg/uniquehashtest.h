@@ -0,0 +1,60 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : Test the unique hash computed from the file content
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_UNIQUE_HASH_TEST_H
+#define DIGIKAM_UNIQUE_HASH_TEST_H
+
+// Qt includes
+
+#include <QObject>
+#include <QTemporaryDir>
+
+class UniqueHashTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+
+    void initTestCase();
+
+    void testHashFromData_data();
+    void testHashFromData();
+    void testHashFromMappedData_data();
+    void testHashFromMappedData();
+    void testNullData();
+
+private:
+
+    void addSizes() const;
+
+    /**
+     * Write a file with pseudo random content of the given size in the temporary directory.
+     */
+    QString createFile(int size) const;
+
+private:
+
+    QTemporaryDir m_tempDir;
+};
+
+#endif // DIGIKAM_UNIQUE_HASH_TEST_H
@@ -0,0 +1,224 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : Test the manifest of the incremental HTML gallery exports
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "gallerymanifesttest.h"
+
+// Qt includes
+
+#include <QtTest>
+#include <QFile>
+#include <QFileInfo>
+
+// Local includes
+
+#include "gallerymanifest.h"
+
+using namespace DigikamGenericHtmlGalleryPlugin;
+
+QTEST_GUILESS_MAIN(GalleryManifestTest)
+
+namespace
+{
+
+const QByteArray uniqueHash("0123456789abcdef");
+const QByteArray settingsHash("fedcba9876543210");
+
+} // namespace
+
+void GalleryManifestTest::init()
+{
+    tempDir = new QTemporaryDir;
+    QVERIFY(tempDir->isValid());
+}
+
+void GalleryManifestTest::cleanup()
+{
+    delete tempDir;
+    tempDir = nullptr;
+}
+
+GalleryElement GalleryManifestTest::createElement(const QString& name) const
+{
+    GalleryElement element;
+    element.m_path              = QLatin1String("/photos/") + name + QLatin1String(".jpg");
+    element.m_baseFileName      = name;
+    element.m_fullFileName      = name + QLatin1String(".jpg");
+    element.m_fullSize          = QSize(800, 600);
+    element.m_thumbnailFileName = QLatin1String("thumb_") + name + QLatin1String(".jpg");
+    element.m_thumbnailSize     = QSize(160, 120);
+    element.m_valid             = true;
+
+    foreach (const QString& fileName, QStringList() << element.m_fullFileName << element.m_thumbnailFileName)
+    {
+        QFile file(tempDir->filePath(fileName));
+
+        if (file.open(QIODevice::WriteOnly))
+        {
+            file.write(name.toLatin1());
+        }
+    }
+
+    return element;
+}
+
+void GalleryManifestTest::exportElements(const QList<GalleryElement>& elements) const
+{
+    GalleryManifest manifest(tempDir->path());
+
+    foreach (const GalleryElement& element, elements)
+    {
+        manifest.update(element, uniqueHash, settingsHash);
+    }
+
+    QVERIFY(manifest.save());
+}
+
+bool GalleryManifestTest::exists(const QString& fileName) const
+{
+    return QFileInfo::exists(tempDir->filePath(fileName));
+}
+
+void GalleryManifestTest::testReuseUnchanged()
+{
+    const GalleryElement exported = createElement(QLatin1String("a"));
+    exportElements(QList<GalleryElement>() << exported);
+
+    GalleryManifest manifest(tempDir->path());
+    QVERIFY(manifest.load());
+
+    GalleryElement element;
+    element.m_path         = exported.m_path;
+    element.m_baseFileName = exported.m_baseFileName;
+
+    QVERIFY(manifest.reuse(element, uniqueHash, settingsHash));
+    QVERIFY(element.m_valid);
+    QCOMPARE(element.m_fullFileName,      exported.m_fullFileName);
+    QCOMPARE(element.m_fullSize,          exported.m_fullSize);
+    QCOMPARE(element.m_thumbnailFileName, exported.m_thumbnailFileName);
+    QCOMPARE(element.m_thumbnailSize,     exported.m_thumbnailSize);
+    QCOMPARE(manifest.reusedCount(),  1);
+    QCOMPARE(manifest.updatedCount(), 0);
+
+    // The files reused are kept, and the element stays in the manifest.
+
+    QVERIFY(manifest.save());
+    QVERIFY(exists(exported.m_fullFileName));
+    QVERIFY(exists(exported.m_thumbnailFileName));
+
+    GalleryManifest next(tempDir->path());
+    QVERIFY(next.load());
+    QVERIFY(next.reuse(element, uniqueHash, settingsHash));
+}
+
+void GalleryManifestTest::testChangedSource()
+{
+    GalleryElement element = createElement(QLatin1String("a"));
+    exportElements(QList<GalleryElement>() << element);
+
+    GalleryManifest manifest(tempDir->path());
+    QVERIFY(manifest.load());
+    QVERIFY(!manifest.reuse(element, QByteArray("changed"), settingsHash));
+
+    // Another source file exported with the same name.
+
+    element.m_path = QLatin1String("/photos/other/a.jpg");
+    QVERIFY(!manifest.reuse(element, uniqueHash, settingsHash));
+    QCOMPARE(manifest.reusedCount(), 0);
+}
+
+void GalleryManifestTest::testChangedSettings()
+{
+    GalleryElement element = createElement(QLatin1String("a"));
+    exportElements(QList<GalleryElement>() << element);
+
+    GalleryManifest manifest(tempDir->path());
+    QVERIFY(manifest.load());
+    QVERIFY(!manifest.reuse(element, uniqueHash, QByteArray("changed")));
+    QCOMPARE(manifest.reusedCount(), 0);
+}
+
+void GalleryManifestTest::testMissingOutput()
+{
+    GalleryElement element = createElement(QLatin1String("a"));
+    exportElements(QList<GalleryElement>() << element);
+
+    QVERIFY(QFile::remove(tempDir->filePath(element.m_thumbnailFileName)));
+
+    GalleryManifest manifest(tempDir->path());
+    QVERIFY(manifest.load());
+    QVERIFY(!manifest.reuse(element, uniqueHash, settingsHash));
+    QCOMPARE(manifest.reusedCount(), 0);
+}
+
+void GalleryManifestTest::testRemovedImages()
+{
+    GalleryElement kept    = createElement(QLatin1String("a"));
+    GalleryElement removed = createElement(QLatin1String("b"));
+    exportElements(QList<GalleryElement>() << kept << removed);
+
+    GalleryManifest manifest(tempDir->path());
+    QVERIFY(manifest.load());
+    QVERIFY(manifest.reuse(kept, uniqueHash, settingsHash));
+    QVERIFY(manifest.save());
+
+    // The files of the image removed from the collection are deleted.
+
+    QVERIFY(exists(kept.m_fullFileName));
+    QVERIFY(exists(kept.m_thumbnailFileName));
+    QVERIFY(!exists(removed.m_fullFileName));
+    QVERIFY(!exists(removed.m_thumbnailFileName));
+
+    GalleryManifest next(tempDir->path());
+    QVERIFY(next.load());
+    QVERIFY(!next.reuse(removed, uniqueHash, settingsHash));
+}
+
+void GalleryManifestTest::testCanceledExport()
+{
+    GalleryElement changed     = createElement(QLatin1String("a"));
+    GalleryElement failed      = createElement(QLatin1String("b"));
+    GalleryElement unprocessed = createElement(QLatin1String("c"));
+    exportElements(QList<GalleryElement>() << changed << failed << unprocessed);
+
+    // The export is canceled after the generation of the first element changed,
+    // during the one of the second.
+
+    GalleryManifest manifest(tempDir->path());
+    QVERIFY(manifest.load());
+    QVERIFY(!manifest.reuse(changed, QByteArray("changed"), settingsHash));
+    manifest.update(changed, QByteArray("changed"), settingsHash);
+    QVERIFY(!manifest.reuse(failed, QByteArray("changed"), settingsHash));
+    QVERIFY(manifest.save(false));
+
+    // No file is removed, and only the element generated again is not reused with its old source.
+
+    QVERIFY(exists(failed.m_fullFileName));
+    QVERIFY(exists(unprocessed.m_fullFileName));
+
+    GalleryManifest next(tempDir->path());
+    QVERIFY(next.load());
+    QVERIFY(next.reuse(changed, QByteArray("changed"), settingsHash));
+    QVERIFY(!next.reuse(failed, uniqueHash, settingsHash));
+    QVERIFY(next.reuse(unprocessed, uniqueHash, settingsHash));
+    QCOMPARE(next.reusedCount(), 2);
+}
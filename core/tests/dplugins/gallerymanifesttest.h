@@ -0,0 +1,73 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : Test the manifest of the incremental HTML gallery exports
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_GALLERY_MANIFEST_TEST_H
+#define DIGIKAM_GALLERY_MANIFEST_TEST_H
+
+// Qt includes
+
+#include <QObject>
+#include <QStringList>
+#include <QTemporaryDir>
+
+// Local includes
+
+#include "galleryelement.h"
+
+class GalleryManifestTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+
+    void init();
+    void cleanup();
+
+    void testReuseUnchanged();
+    void testChangedSource();
+    void testChangedSettings();
+    void testMissingOutput();
+    void testRemovedImages();
+    void testCanceledExport();
+
+private:
+
+    /**
+     * Return an element of the source image name, with its generated files written
+     * in the export folder.
+     */
+    DigikamGenericHtmlGalleryPlugin::GalleryElement createElement(const QString& name) const;
+
+    /**
+     * Record the elements in the manifest of a finished export.
+     */
+    void exportElements(const QList<DigikamGenericHtmlGalleryPlugin::GalleryElement>& elements) const;
+
+    bool exists(const QString& fileName) const;
+
+private:
+
+    QTemporaryDir* tempDir;
+};
+
+#endif // DIGIKAM_GALLERY_MANIFEST_TEST_H
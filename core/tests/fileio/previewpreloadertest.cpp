@@ -0,0 +1,193 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : Test the adaptive preloading of the previews
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "previewpreloadertest.h"
+
+// Qt includes
+
+#include <QTest>
+#include <QDir>
+
+// Local includes
+
+#include "previewpreloader.h"
+
+using namespace Digikam;
+
+QTEST_GUILESS_MAIN(PreviewPreloaderTest)
+
+QStringList PreviewPreloaderTest::missingFiles(int count) const
+{
+    QStringList files;
+
+    for (int i = 0 ; i < count ; ++i)
+    {
+        files << QDir::temp().filePath(QString::fromLatin1("previewpreloadertest-missing-%1.jpg").arg(i));
+    }
+
+    return files;
+}
+
+void PreviewPreloaderTest::testLookAheadCount_data()
+{
+    QTest::addColumn<double>("loadTime");
+    QTest::addColumn<double>("navigationTime");
+    QTest::addColumn<int>("interval");
+    QTest::addColumn<int>("maxCount");
+    QTest::addColumn<int>("count");
+
+    QTest::newRow("nothing measured")              << 0.0     << 0.0    << 0    << 16 << 1;
+    QTest::newRow("loaded within the interval")    << 500.0   << 0.0    << 3000 << 16 << 2;
+    QTest::newRow("loaded in several intervals")   << 2500.0  << 0.0    << 1000 << 16 << 4;
+    QTest::newRow("user faster than interval")     << 1000.0  << 200.0  << 3000 << 16 << 6;
+    QTest::newRow("interval faster than user")     << 1000.0  << 5000.0 << 500  << 16 << 3;
+    QTest::newRow("user without interval")         << 1000.0  << 250.0  << 0    << 16 << 5;
+    QTest::newRow("nothing but the loading time")  << 1500.0  << 0.0    << 0    << 16 << 3;
+    QTest::newRow("exact multiple")                << 2000.0  << 0.0    << 1000 << 16 << 3;
+    QTest::newRow("bounded")                       << 10000.0 << 100.0  << 0    << 16 << 16;
+    QTest::newRow("bounded by the cache")          << 10000.0 << 100.0  << 0    << 4  << 4;
+    QTest::newRow("nothing fits")                  << 10000.0 << 100.0  << 0    << 0  << 1;
+}
+
+void PreviewPreloaderTest::testLookAheadCount()
+{
+    QFETCH(double, loadTime);
+    QFETCH(double, navigationTime);
+    QFETCH(int,    interval);
+    QFETCH(int,    maxCount);
+    QFETCH(int,    count);
+
+    QCOMPARE(PreviewPreloader::lookAheadCount(loadTime, navigationTime, interval, maxCount), count);
+}
+
+void PreviewPreloaderTest::testLookAheadBounds()
+{
+    PreviewPreloader preloader;
+    preloader.setFiles(missingFiles(20), false);
+    preloader.setInterval(1000);
+    preloader.setMaximumLookAhead(8);
+
+    // Nothing is measured yet, one image is preloaded in each direction.
+
+    preloader.setCurrentIndex(5);
+    QCOMPARE(preloader.currentIndex(), 5);
+    QCOMPARE(preloader.lookAhead(),    1);
+    QCOMPARE(preloader.lookBehind(),   1);
+
+    preloader.setCurrentIndex(4);
+    QCOMPARE(preloader.lookAhead(),    1);
+    QCOMPARE(preloader.lookBehind(),   1);
+
+    // The indexes out of the sequence are ignored.
+
+    preloader.setCurrentIndex(20);
+    QCOMPARE(preloader.currentIndex(), 4);
+
+    preloader.stop();
+    QCOMPARE(preloader.currentIndex(), -1);
+}
+
+void PreviewPreloaderTest::testCurrentFile()
+{
+    const QStringList files = missingFiles(5);
+
+    PreviewPreloader preloader;
+    preloader.setFiles(files, false);
+
+    preloader.setCurrentFile(files[2]);
+    QCOMPARE(preloader.currentIndex(), 2);
+
+    preloader.setCurrentFile(files[4]);
+    QCOMPARE(preloader.currentIndex(), 4);
+
+    preloader.setCurrentFile(QLatin1String("/not/in/the/sequence.jpg"));
+    QCOMPARE(preloader.currentIndex(), 4);
+
+    preloader.stop();
+}
+
+void PreviewPreloaderTest::testRemoveFile()
+{
+    QStringList files = missingFiles(6);
+
+    PreviewPreloader preloader;
+    preloader.setFiles(files, false);
+    preloader.setCurrentIndex(2);
+
+    // A file before the current one.
+
+    preloader.removeFile(files.takeAt(0));
+    QCOMPARE(preloader.files(),        files);
+    QCOMPARE(preloader.currentIndex(), 1);
+
+    // The current file, as the Ken Burns loader does when it cannot load it.
+
+    preloader.removeFile(files.takeAt(1));
+    QCOMPARE(preloader.files(),        files);
+    QCOMPARE(preloader.currentIndex(), 1);
+
+    // A file after the current one.
+
+    preloader.removeFile(files.takeAt(2));
+    QCOMPARE(preloader.files(),        files);
+    QCOMPARE(preloader.currentIndex(), 1);
+
+    // Not in the sequence.
+
+    preloader.removeFile(QLatin1String("/not/in/the/sequence.jpg"));
+    QCOMPARE(preloader.files(),        files);
+
+    // The viewer finds the next file with its own list.
+
+    preloader.setCurrentFile(files[2]);
+    QCOMPARE(preloader.currentIndex(), 2);
+
+    preloader.stop();
+}
+
+void PreviewPreloaderTest::testRemoveLastFile_data()
+{
+    QTest::addColumn<bool>("loop");
+    QTest::addColumn<int>("index");
+
+    QTest::newRow("no loop") << false << -1;
+    QTest::newRow("loop")    << true  << 0;
+}
+
+void PreviewPreloaderTest::testRemoveLastFile()
+{
+    QFETCH(bool, loop);
+    QFETCH(int,  index);
+
+    const QStringList files = missingFiles(3);
+
+    PreviewPreloader preloader;
+    preloader.setFiles(files, loop);
+    preloader.setCurrentIndex(2);
+
+    preloader.removeFile(files[2]);
+    QCOMPARE(preloader.files().count(), 2);
+    QCOMPARE(preloader.currentIndex(),  index);
+
+    preloader.stop();
+}
@@ -0,0 +1,54 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : Test the adaptive preloading of the previews
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_PREVIEW_PRELOADER_TEST_H
+#define DIGIKAM_PREVIEW_PRELOADER_TEST_H
+
+// Qt includes
+
+#include <QObject>
+#include <QStringList>
+
+class PreviewPreloaderTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+
+    void testLookAheadCount_data();
+    void testLookAheadCount();
+    void testLookAheadBounds();
+    void testCurrentFile();
+    void testRemoveFile();
+    void testRemoveLastFile_data();
+    void testRemoveLastFile();
+
+private:
+
+    /**
+     * Paths of files which do not exist, quickly preloaded without measuring a loading time.
+     */
+    QStringList missingFiles(int count) const;
+};
+
+#endif // DIGIKAM_PREVIEW_PRELOADER_TEST_H
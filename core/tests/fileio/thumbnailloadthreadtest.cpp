@@ -0,0 +1,158 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : Test the worker threads of the thumbnail loader
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "thumbnailloadthreadtest.h"
+
+// Qt includes
+
+#include <QImage>
+#include <QSignalSpy>
+#include <QStandardPaths>
+#include <QTest>
+
+// Local includes
+
+#include "managedloadsavethread.h"
+#include "thumbnailloadthread.h"
+
+using namespace Digikam;
+
+QTEST_MAIN(ThumbnailLoadThreadTest)
+
+namespace
+{
+
+const int workers = 2;
+
+QList<ThumbnailIdentifier> identifiers(const QStringList& paths)
+{
+    QList<ThumbnailIdentifier> ids;
+
+    foreach (const QString& path, paths)
+    {
+        ids << ThumbnailIdentifier(path);
+    }
+
+    return ids;
+}
+
+} // namespace
+
+void ThumbnailLoadThreadTest::initTestCase()
+{
+    // Do not write the thumbnails in the cache of the user.
+    QStandardPaths::setTestModeEnabled(true);
+
+    QVERIFY(tempDir.isValid());
+}
+
+QStringList ThumbnailLoadThreadTest::createImages(int count)
+{
+    QStringList paths;
+
+    for (int i = 0 ; i < count ; ++i)
+    {
+        QImage image(1600, 1200, QImage::Format_RGB32);
+        quint32 seed = ++imageCount;
+
+        for (int y = 0 ; y < image.height() ; ++y)
+        {
+            QRgb* const line = reinterpret_cast<QRgb*>(image.scanLine(y));
+
+            for (int x = 0 ; x < image.width() ; ++x)
+            {
+                seed    = seed * 1664525 + 1013904223;
+                line[x] = qRgb(x & 0xff, y & 0xff, seed >> 24);
+            }
+        }
+
+        const QString path = tempDir.filePath(QString::fromLatin1("image%1.png").arg(imageCount));
+        image.save(path, "PNG");
+        paths << path;
+    }
+
+    return paths;
+}
+
+void ThumbnailLoadThreadTest::testLoadWithWorkers()
+{
+    const QStringList paths = createImages(8);
+
+    ThumbnailLoadThread thread;
+    thread.setMaximumNumberOfThreads(workers);
+    thread.setThumbnailSize(256);
+    QCOMPARE(thread.maximumNumberOfThreads(), workers);
+
+    QSignalSpy spy(&thread, SIGNAL(signalThumbnailLoaded(LoadingDescription,QPixmap)));
+
+    QList<ThumbnailIdentifier> ids = identifiers(paths);
+    thread.findGroup(ids);
+
+    QTRY_COMPARE_WITH_TIMEOUT(spy.count(), paths.count(), 60000);
+}
+
+void ThumbnailLoadThreadTest::testStopAllTasksThroughBase()
+{
+    const QStringList paths = createImages(40);
+
+    ThumbnailLoadThread thread;
+    thread.setMaximumNumberOfThreads(workers);
+    thread.setThumbnailSize(256);
+
+    QSignalSpy spy(&thread, SIGNAL(signalThumbnailLoaded(LoadingDescription,QPixmap)));
+
+    QList<ThumbnailIdentifier> ids = identifiers(paths);
+    thread.findGroup(ids);
+
+    // The requests are queued in the workers, which must be stopped through the base class too.
+
+    ManagedLoadSaveThread* const base = &thread;
+    base->stopAllTasks();
+
+    QTest::qWait(5000);
+
+    // Only the tasks in progress in the workers can still complete.
+
+    QVERIFY(spy.count() <= 2 * workers);
+}
+
+void ThumbnailLoadThreadTest::testStopLoadingThroughBase()
+{
+    const QStringList paths = createImages(40);
+
+    ThumbnailLoadThread thread;
+    thread.setMaximumNumberOfThreads(workers);
+    thread.setThumbnailSize(256);
+
+    QSignalSpy spy(&thread, SIGNAL(signalThumbnailLoaded(LoadingDescription,QPixmap)));
+
+    QList<ThumbnailIdentifier> ids = identifiers(paths);
+    thread.findGroup(ids);
+
+    ManagedLoadSaveThread* const base = &thread;
+    base->stopLoading(QString(), ManagedLoadSaveThread::LoadingTaskFilterAll);
+
+    QTest::qWait(5000);
+
+    QVERIFY(spy.count() <= 2 * workers);
+}
@@ -0,0 +1,59 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : Test the worker threads of the thumbnail loader
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_THUMBNAIL_LOAD_THREAD_TEST_H
+#define DIGIKAM_THUMBNAIL_LOAD_THREAD_TEST_H
+
+// Qt includes
+
+#include <QObject>
+#include <QTemporaryDir>
+#include <QStringList>
+
+class ThumbnailLoadThreadTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+
+    void initTestCase();
+
+    void testLoadWithWorkers();
+    void testStopAllTasksThroughBase();
+    void testStopLoadingThroughBase();
+
+private:
+
+    /**
+     * Write count new images, large enough for the thumbnails to take some time to create,
+     * and return their paths.
+     */
+    QStringList createImages(int count);
+
+private:
+
+    QTemporaryDir tempDir;
+    int           imageCount = 0;
+};
+
+#endif // DIGIKAM_THUMBNAIL_LOAD_THREAD_TEST_H
@@ -0,0 +1,303 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : Test the downloads of the camera controller from a mass storage camera
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "cameracontrollertest.h"
+
+// Qt includes
+
+#include <QtTest>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QImage>
+#include <QSignalSpy>
+
+// Local includes
+
+#include "cameracontroller.h"
+#include "camiteminfo.h"
+#include "dmetadata.h"
+#include "setupcamera.h"
+
+using namespace Digikam;
+
+QTEST_GUILESS_MAIN(CameraControllerTest)
+
+void CameraControllerTest::initTestCase()
+{
+    MetaEngine::initializeExiv2();
+
+    qRegisterMetaType<CamItemInfo>("CamItemInfo");
+}
+
+void CameraControllerTest::cleanupTestCase()
+{
+    MetaEngine::cleanupExiv2();
+}
+
+void CameraControllerTest::init()
+{
+    tempDir   = new QTemporaryDir;
+    QVERIFY(tempDir->isValid());
+
+    cameraDir = tempDir->filePath(QLatin1String("DCIM"));
+    QVERIFY(QDir().mkpath(cameraDir));
+
+    cameraFiles.clear();
+}
+
+void CameraControllerTest::cleanup()
+{
+    delete tempDir;
+    tempDir = nullptr;
+}
+
+void CameraControllerTest::createCameraFiles(int count, int padding)
+{
+    QImage image(64, 48, QImage::Format_RGB32);
+
+    for (int i = 0 ; i < count ; ++i)
+    {
+        image.fill(qRgb(i % 256, (i * 7) % 256, 128));
+
+        const QString name     = QString::fromLatin1("IMG_%1.JPG").arg(i, 4, 10, QLatin1Char('0'));
+        const QString filePath = cameraDir + QLatin1Char('/') + name;
+        QVERIFY(image.save(filePath, "JPG"));
+
+        if (padding > 0)
+        {
+            // The JPEG decoders ignore the data after the end of the image.
+
+            QFile file(filePath);
+            QVERIFY(file.open(QIODevice::Append));
+            QVERIFY(file.write(QByteArray(padding, (char)i)) == padding);
+        }
+
+        cameraFiles << name;
+    }
+}
+
+CameraController* CameraControllerTest::connectController() const
+{
+    CameraController* const controller = new CameraController(nullptr, QLatin1String("Test Camera"),
+                                                               QLatin1String("directory browse"),
+                                                               QLatin1String("directory browse"),
+                                                               cameraDir);
+
+    QSignalSpy connected(controller, SIGNAL(signalConnected(bool)));
+    controller->start();
+    controller->slotConnect();
+
+    if (!connected.wait(10000) || !connected.first().first().toBool())
+    {
+        delete controller;
+        return nullptr;
+    }
+
+    controller->downloadPrep(SetupCamera::DIFFNAME);
+
+    return controller;
+}
+
+DownloadSettingsList CameraControllerTest::downloadList(const QString& destDir) const
+{
+    DownloadSettingsList list;
+
+    foreach (const QString& name, cameraFiles)
+    {
+        DownloadSettings settings;
+        settings.folder = cameraDir;
+        settings.file   = name;
+        settings.mime   = QLatin1String("image/jpeg");
+        settings.dest   = destDir + QLatin1Char('/') + name;
+        list << settings;
+    }
+
+    return list;
+}
+
+QStringList CameraControllerTest::tempFiles(const QString& dir)
+{
+    return QDir(dir).entryList(QStringList() << QLatin1String("*digikamtempfile*"), QDir::Files);
+}
+
+QByteArray CameraControllerTest::fileContent(const QString& filePath)
+{
+    QFile file(filePath);
+
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        return QByteArray();
+    }
+
+    return file.readAll();
+}
+
+void CameraControllerTest::testDownload()
+{
+    // More items than the places of the pipeline, with the pre-rating written to the files.
+
+    createCameraFiles(40, 0);
+
+    const QString destDir = tempDir->filePath(QLatin1String("album"));
+    QVERIFY(QDir().mkpath(destDir));
+
+    CameraController* const controller = connectController();
+    QVERIFY(controller);
+
+    QSignalSpy complete(controller, SIGNAL(signalDownloadComplete(QString,QString,QString,QString)));
+
+    DownloadSettingsList list = downloadList(destDir);
+
+    for (int i = 0 ; i < list.count() ; ++i)
+    {
+        list[i].rating = 1 + (i % 5);
+    }
+
+    controller->download(list);
+
+    QTRY_COMPARE_WITH_TIMEOUT(complete.count(), cameraFiles.count(), 60000);
+
+    delete controller;
+
+    for (int i = 0 ; i < cameraFiles.count() ; ++i)
+    {
+        const QString destFile = destDir + QLatin1Char('/') + cameraFiles.at(i);
+        QVERIFY2(QFile::exists(destFile), qPrintable(destFile));
+        QCOMPARE(DMetadata(destFile).getItemRating(), 1 + (i % 5));
+    }
+
+    QCOMPARE(QDir(destDir).entryList(QDir::Files).count(), cameraFiles.count());
+    QVERIFY(tempFiles(destDir).isEmpty());
+}
+
+void CameraControllerTest::testDownloadScript()
+{
+    // The script runs on each file once it is at its destination.
+
+    createCameraFiles(10, 0);
+
+    const QString destDir = tempDir->filePath(QLatin1String("album"));
+    QVERIFY(QDir().mkpath(destDir));
+
+    CameraController* const controller = connectController();
+    QVERIFY(controller);
+
+    DownloadSettingsList list = downloadList(destDir);
+
+    for (int i = 0 ; i < list.count() ; ++i)
+    {
+        list[i].script = QLatin1String("cp %file %file.done");
+    }
+
+    controller->download(list);
+
+    foreach (const QString& name, cameraFiles)
+    {
+        const QString destFile = destDir + QLatin1Char('/') + name;
+        QTRY_VERIFY_WITH_TIMEOUT(QFile::exists(destFile + QLatin1String(".done")), 30000);
+        QVERIFY(fileContent(destFile + QLatin1String(".done")) == fileContent(destFile));
+    }
+
+    delete controller;
+
+    QVERIFY(tempFiles(destDir).isEmpty());
+}
+
+void CameraControllerTest::testCancelAndNewBatch()
+{
+    createCameraFiles(60, 1024 * 1024);
+
+    const QString canceledDir = tempDir->filePath(QLatin1String("canceled"));
+    const QString destDir     = tempDir->filePath(QLatin1String("album"));
+    QVERIFY(QDir().mkpath(canceledDir));
+    QVERIFY(QDir().mkpath(destDir));
+
+    CameraController* const controller = connectController();
+    QVERIFY(controller);
+
+    QSignalSpy complete(controller, SIGNAL(signalDownloadComplete(QString,QString,QString,QString)));
+    QSignalSpy busy(controller, SIGNAL(signalBusy(bool)));
+
+    controller->download(downloadList(canceledDir));
+
+    QTRY_VERIFY_WITH_TIMEOUT(complete.count() > 0, 30000);
+    controller->slotCancel();
+
+    // The canceled batch ends, without the downloads in progress left as temporary files.
+
+    QTRY_VERIFY_WITH_TIMEOUT(tempFiles(canceledDir).isEmpty() && !busy.isEmpty() &&
+                             !busy.last().first().toBool(), 30000);
+
+    foreach (const QString& name, QDir(canceledDir).entryList(QDir::Files))
+    {
+        QVERIFY(fileContent(canceledDir + QLatin1Char('/') + name) ==
+                fileContent(cameraDir + QLatin1Char('/') + name));
+    }
+
+    // A new batch is not canceled by the previous one.
+
+    complete.clear();
+    controller->download(downloadList(destDir));
+
+    QTRY_COMPARE_WITH_TIMEOUT(complete.count(), cameraFiles.count(), 60000);
+
+    delete controller;
+
+    foreach (const QString& name, cameraFiles)
+    {
+        QVERIFY(fileContent(destDir + QLatin1Char('/') + name) ==
+                fileContent(cameraDir + QLatin1Char('/') + name));
+    }
+
+    QVERIFY(tempFiles(destDir).isEmpty());
+}
+
+void CameraControllerTest::testDestroyWhileDownloading()
+{
+    // The controller is destroyed while items wait to be moved by the main thread.
+
+    createCameraFiles(60, 1024 * 1024);
+
+    const QString destDir = tempDir->filePath(QLatin1String("album"));
+    QVERIFY(QDir().mkpath(destDir));
+
+    CameraController* const controller = connectController();
+    QVERIFY(controller);
+
+    QSignalSpy downloaded(controller, SIGNAL(signalDownloaded(QString,QString,int)));
+
+    controller->download(downloadList(destDir));
+
+    QTRY_VERIFY_WITH_TIMEOUT(downloaded.count() > 4, 30000);
+
+    delete controller;
+
+    QVERIFY(tempFiles(destDir).isEmpty());
+
+    foreach (const QString& name, QDir(destDir).entryList(QDir::Files))
+    {
+        QVERIFY(fileContent(destDir + QLatin1Char('/') + name) ==
+                fileContent(cameraDir + QLatin1Char('/') + name));
+    }
+}
@@ -0,0 +1,79 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : Test the downloads of the camera controller from a mass storage camera
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_CAMERA_CONTROLLER_TEST_H
+#define DIGIKAM_CAMERA_CONTROLLER_TEST_H
+
+// Qt includes
+
+#include <QObject>
+#include <QStringList>
+#include <QTemporaryDir>
+
+// Local includes
+
+#include "downloadsettings.h"
+
+namespace Digikam
+{
+class CameraController;
+}
+
+class CameraControllerTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+
+    void initTestCase();
+    void cleanupTestCase();
+    void init();
+    void cleanup();
+
+    void testDownload();
+    void testDownloadScript();
+    void testCancelAndNewBatch();
+    void testDestroyWhileDownloading();
+
+private:
+
+    /**
+     * Create 'count' JPEG files of the camera folder, with some bytes after the image data
+     * to make them larger.
+     */
+    void createCameraFiles(int count, int padding);
+
+    Digikam::CameraController* connectController() const;
+    Digikam::DownloadSettingsList downloadList(const QString& destDir) const;
+
+    static QStringList tempFiles(const QString& dir);
+    static QByteArray  fileContent(const QString& filePath);
+
+private:
+
+    QTemporaryDir* tempDir;
+    QString        cameraDir;
+    QStringList    cameraFiles;
+};
+
+#endif // DIGIKAM_CAMERA_CONTROLLER_TEST_H
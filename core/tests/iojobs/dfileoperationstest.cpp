@@ -0,0 +1,254 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : Test the copy of files and folders with DFileOperations
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "dfileoperationstest.h"
+
+// C ANSI includes
+
+#include <sys/types.h>
+#include <utime.h>
+
+// Qt includes
+
+#include <QtTest>
+#include <QAtomicInteger>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+
+// Local includes
+
+#include "dfileoperations.h"
+
+using namespace Digikam;
+
+QTEST_GUILESS_MAIN(DFileOperationsTest)
+
+void DFileOperationsTest::init()
+{
+    tempDir = new QTemporaryDir;
+    QVERIFY(tempDir->isValid());
+}
+
+void DFileOperationsTest::cleanup()
+{
+    delete tempDir;
+    tempDir = nullptr;
+}
+
+QString DFileOperationsTest::createFile(const QString& name, qint64 size) const
+{
+    const QString filePath = tempDir->filePath(name);
+    QDir().mkpath(QFileInfo(filePath).path());
+
+    QFile file(filePath);
+
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        return QString();
+    }
+
+    QByteArray block(64 * 1024, '\0');
+    quint32 value = (quint32)size + 1;
+    qint64 left   = size;
+
+    while (left > 0)
+    {
+        const int count = (int)qMin((qint64)block.size(), left);
+
+        for (int i = 0 ; i < count ; ++i)
+        {
+            value    = value * 1103515245 + 12345;
+            block[i] = (char)(value >> 16);
+        }
+
+        if (file.write(block.constData(), count) != count)
+        {
+            return QString();
+        }
+
+        left -= count;
+    }
+
+    return filePath;
+}
+
+QByteArray DFileOperationsTest::fileContent(const QString& filePath)
+{
+    QFile file(filePath);
+
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        return QByteArray();
+    }
+
+    return file.readAll();
+}
+
+void DFileOperationsTest::copyFileData()
+{
+    QFETCH(qint64, size);
+
+    const QString srcFile = createFile(QLatin1String("source.bin"), size);
+    QVERIFY(!srcFile.isEmpty());
+
+    const QString dstFile = tempDir->filePath(QLatin1String("copy.bin"));
+    QAtomicInteger<qint64> bytesCopied(0);
+
+    QVERIFY(DFileOperations::copyFileData(srcFile, dstFile, nullptr, &bytesCopied));
+
+    QCOMPARE(QFileInfo(dstFile).size(), size);
+
+    // A cloned file is not counted.
+
+    QVERIFY((bytesCopied.load() == size) || (bytesCopied.load() == 0));
+    QVERIFY(fileContent(dstFile) == fileContent(srcFile));
+}
+
+void DFileOperationsTest::copyFileData_data()
+{
+    QTest::addColumn<qint64>("size");
+
+    // The streamed copy uses a buffer of 4 MB: check the sizes around it.
+
+    QTest::newRow("empty")             << (qint64)0;
+    QTest::newRow("one byte")          << (qint64)1;
+    QTest::newRow("small")             << (qint64)(10 * 1024 + 7);
+    QTest::newRow("buffer size")       << (qint64)(4 * 1024 * 1024);
+    QTest::newRow("above buffer size") << (qint64)(4 * 1024 * 1024 + 13);
+    QTest::newRow("several buffers")   << (qint64)(9 * 1024 * 1024 + 1);
+}
+
+void DFileOperationsTest::copyFileDataTruncate()
+{
+    // A larger existing destination file is replaced.
+
+    const QString srcFile = createFile(QLatin1String("source.bin"), 1000);
+    const QString dstFile = createFile(QLatin1String("copy.bin"),   5000);
+    QVERIFY(!srcFile.isEmpty() && !dstFile.isEmpty());
+
+    QVERIFY(DFileOperations::copyFileData(srcFile, dstFile));
+
+    QCOMPARE(QFileInfo(dstFile).size(), (qint64)1000);
+    QVERIFY(fileContent(dstFile) == fileContent(srcFile));
+}
+
+void DFileOperationsTest::copyFileDataCancel()
+{
+    const QString srcFile = createFile(QLatin1String("source.bin"), 100 * 1024);
+    QVERIFY(!srcFile.isEmpty());
+
+    const QString dstFile = tempDir->filePath(QLatin1String("copy.bin"));
+    const bool cancel     = true;
+    QAtomicInteger<qint64> bytesCopied(0);
+
+    QVERIFY(!DFileOperations::copyFileData(srcFile, dstFile, &cancel, &bytesCopied));
+    QCOMPARE(bytesCopied.load(), (qint64)0);
+
+    // The canceled copy does not leave any file.
+
+    QVERIFY(!DFileOperations::copyFile(srcFile, dstFile, &cancel));
+    QVERIFY(!QFile::exists(dstFile));
+}
+
+void DFileOperationsTest::copyFileDataMissingSource()
+{
+    const QString srcFile = tempDir->filePath(QLatin1String("missing.bin"));
+    const QString dstFile = tempDir->filePath(QLatin1String("copy.bin"));
+
+    QVERIFY(!DFileOperations::copyFileData(srcFile, dstFile));
+    QVERIFY(!DFileOperations::copyFile(srcFile, dstFile));
+    QVERIFY(!QFile::exists(dstFile));
+}
+
+void DFileOperationsTest::copyFileKeepsModificationTime()
+{
+    const QString srcFile = createFile(QLatin1String("source.jpg"), 300 * 1024);
+    QVERIFY(!srcFile.isEmpty());
+
+    const QDateTime modified = QDateTime::currentDateTime().addDays(-10);
+    struct utimbuf ut;
+    ut.modtime               = (time_t)modified.toTime_t();
+    ut.actime                = ut.modtime;
+    QCOMPARE(::utime(QFile::encodeName(srcFile).constData(), &ut), 0);
+
+    const QString dstFile = tempDir->filePath(QLatin1String("copy.jpg"));
+
+    QVERIFY(DFileOperations::copyFile(srcFile, dstFile));
+
+    QCOMPARE(QFileInfo(dstFile).lastModified().toTime_t(), modified.toTime_t());
+    QVERIFY(fileContent(dstFile) == fileContent(srcFile));
+
+    // No temporary file is left.
+
+    QCOMPARE(QDir(tempDir->path()).entryList(QDir::Files).count(), 2);
+}
+
+void DFileOperationsTest::copyFolderRecursively()
+{
+    QStringList files;
+    files << QLatin1String("album/a.jpg")
+          << QLatin1String("album/b.jpg")
+          << QLatin1String("album/sub/c.jpg")
+          << QLatin1String("album/sub/deeper/d.jpg")
+          << QLatin1String("album/sub/deeper/e.jpg");
+
+    qint64 total = 0;
+
+    for (int i = 0 ; i < files.count() ; ++i)
+    {
+        const qint64 size = (i + 1) * 70 * 1024 + i;
+        QVERIFY(!createFile(files.at(i), size).isEmpty());
+        total            += size;
+    }
+
+    QVERIFY(QDir().mkpath(tempDir->filePath(QLatin1String("album/empty"))));
+
+    // A link to a folder outside of the copied one is followed.
+
+    const QString linked = createFile(QLatin1String("outside/f.jpg"), 1234);
+    QVERIFY(!linked.isEmpty());
+    total               += 1234;
+
+    QVERIFY(QFile::link(tempDir->filePath(QLatin1String("outside")),
+                        tempDir->filePath(QLatin1String("album/link"))));
+
+    const QString dstPath = tempDir->filePath(QLatin1String("dest"));
+    QVERIFY(QDir().mkpath(dstPath));
+
+    QAtomicInteger<qint64> bytesCopied(0);
+    QVERIFY(DFileOperations::copyFolderRecursively(tempDir->filePath(QLatin1String("album")),
+                                                   dstPath, nullptr, &bytesCopied));
+
+    foreach (const QString& name, files)
+    {
+        const QString copy = dstPath + QLatin1Char('/') + name;
+        QVERIFY2(QFile::exists(copy), qPrintable(copy));
+        QVERIFY(fileContent(copy) == fileContent(tempDir->filePath(name)));
+    }
+
+    QVERIFY(QFileInfo(dstPath + QLatin1String("/album/empty")).isDir());
+    QVERIFY(fileContent(dstPath + QLatin1String("/album/link/f.jpg")) == fileContent(linked));
+    QVERIFY(bytesCopied.load() <= total);
+}
@@ -0,0 +1,65 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : Test the copy of files and folders with DFileOperations
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_DFILE_OPERATIONS_TEST_H
+#define DIGIKAM_DFILE_OPERATIONS_TEST_H
+
+// Qt includes
+
+#include <QObject>
+#include <QTemporaryDir>
+
+class DFileOperationsTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+
+    void init();
+    void cleanup();
+
+    void copyFileData();
+    void copyFileData_data();
+
+    void copyFileDataTruncate();
+    void copyFileDataCancel();
+    void copyFileDataMissingSource();
+
+    void copyFileKeepsModificationTime();
+    void copyFolderRecursively();
+
+private:
+
+    /**
+     * Write a file of the temporary directory with 'size' bytes of a non repetitive pattern.
+     */
+    QString createFile(const QString& name, qint64 size) const;
+
+    static QByteArray fileContent(const QString& filePath);
+
+private:
+
+    QTemporaryDir* tempDir;
+};
+
+#endif // DIGIKAM_DFILE_OPERATIONS_TEST_H
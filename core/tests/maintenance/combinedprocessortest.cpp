@@ -0,0 +1,224 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : Test the stages and the items selected by the combined maintenance
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "combinedprocessortest.h"
+
+// Qt includes
+
+#include <QTest>
+
+// Local includes
+
+#include "combinedprocessor.h"
+#include "combinedtask.h"
+#include "coredbconstants.h"
+#include "facescansettings.h"
+#include "imagequalitysorter.h"
+#include "maintenancesettings.h"
+
+using namespace Digikam;
+
+QTEST_GUILESS_MAIN(CombinedProcessorTest)
+
+void CombinedProcessorTest::testCombinedStages_data()
+{
+    QTest::addColumn<bool>("thumbnails");
+    QTest::addColumn<bool>("fingerPrints");
+    QTest::addColumn<bool>("qualitySort");
+    QTest::addColumn<bool>("enableSorter");
+    QTest::addColumn<bool>("faceManagement");
+    QTest::addColumn<int>("faceTask");
+    QTest::addColumn<int>("stages");
+
+    const int thumbs  = CombinedTask::Thumbnails;
+    const int prints  = CombinedTask::FingerPrints;
+    const int quality = CombinedTask::ImageQuality;
+    const int faces   = CombinedTask::Faces;
+
+    // Less than two stages run faster with their own tools.
+
+    QTest::newRow("nothing")           << false << false << false << false << false << (int)FaceScanSettings::Detect << 0;
+    QTest::newRow("thumbnails only")   << true  << false << false << false << false << (int)FaceScanSettings::Detect << 0;
+    QTest::newRow("fingerprints only") << false << true  << false << false << false << (int)FaceScanSettings::Detect << 0;
+    QTest::newRow("faces only")        << false << false << false << false << true  << (int)FaceScanSettings::Detect << 0;
+
+    QTest::newRow("thumbnails and fingerprints")
+        << true  << true  << false << false << false << (int)FaceScanSettings::Detect
+        << (thumbs | prints);
+
+    // The image quality is sorted only with the sorter enabled.
+
+    QTest::newRow("quality sorter disabled")
+        << true  << false << true  << false << false << (int)FaceScanSettings::Detect
+        << 0;
+
+    QTest::newRow("quality sorter enabled")
+        << true  << false << true  << true  << false << (int)FaceScanSettings::Detect
+        << (thumbs | quality);
+
+    // The faces are combined only to detect them.
+
+    QTest::newRow("detect faces")
+        << false << true  << false << false << true  << (int)FaceScanSettings::Detect
+        << (prints | faces);
+
+    QTest::newRow("detect and recognize faces")
+        << false << true  << false << false << true  << (int)FaceScanSettings::DetectAndRecognize
+        << (prints | faces);
+
+    QTest::newRow("recognize marked faces")
+        << false << true  << false << false << true  << (int)FaceScanSettings::RecognizeMarkedFaces
+        << 0;
+
+    QTest::newRow("retrain faces")
+        << true  << true  << false << false << true  << (int)FaceScanSettings::RetrainAll
+        << (thumbs | prints);
+
+    QTest::newRow("all stages")
+        << true  << true  << true  << true  << true  << (int)FaceScanSettings::DetectAndRecognize
+        << (thumbs | prints | quality | faces);
+}
+
+void CombinedProcessorTest::testCombinedStages()
+{
+    QFETCH(bool, thumbnails);
+    QFETCH(bool, fingerPrints);
+    QFETCH(bool, qualitySort);
+    QFETCH(bool, enableSorter);
+    QFETCH(bool, faceManagement);
+    QFETCH(int,  faceTask);
+    QFETCH(int,  stages);
+
+    MaintenanceSettings settings;
+    settings.thumbnails           = thumbnails;
+    settings.fingerPrints         = fingerPrints;
+    settings.qualitySort          = qualitySort;
+    settings.quality.enableSorter = enableSorter;
+    settings.faceManagement       = faceManagement;
+    settings.faceSettings.task    = (FaceScanSettings::ScanTask)faceTask;
+
+    QCOMPARE(CombinedProcessor::combinedStages(settings), stages);
+}
+
+void CombinedProcessorTest::testItemStages_data()
+{
+    QTest::addColumn<bool>("scanThumbs");
+    QTest::addColumn<int>("qualityScanMode");
+    QTest::addColumn<int>("category");
+    QTest::addColumn<bool>("inItems");
+    QTest::addColumn<bool>("inFaceItems");
+    QTest::addColumn<bool>("hasThumbnail");
+    QTest::addColumn<bool>("noPickLabel");
+    QTest::addColumn<int>("selected");
+
+    const int thumbs  = CombinedTask::Thumbnails;
+    const int prints  = CombinedTask::FingerPrints;
+    const int quality = CombinedTask::ImageQuality;
+    const int faces   = CombinedTask::Faces;
+    const int all     = ImageQualitySorter::AllItems;
+    const int dirty   = ImageQualitySorter::NonAssignedItems;
+
+    // Thumbnails: all the images, videos and audio files, or only the ones without a thumbnail.
+
+    QTest::newRow("rebuild thumbnail")
+        << false << all   << (int)DatabaseItem::Image << true  << false << true  << false
+        << (thumbs | prints | quality);
+
+    QTest::newRow("existing thumbnail")
+        << true  << all   << (int)DatabaseItem::Image << true  << false << true  << false
+        << (prints | quality);
+
+    QTest::newRow("missing thumbnail")
+        << true  << all   << (int)DatabaseItem::Image << true  << false << false << false
+        << (thumbs | prints | quality);
+
+    QTest::newRow("video thumbnail")
+        << true  << all   << (int)DatabaseItem::Video << true  << false << false << false
+        << (thumbs | prints | quality);
+
+    QTest::newRow("audio thumbnail")
+        << false << all   << (int)DatabaseItem::Audio << true  << false << true  << false
+        << (thumbs | prints | quality);
+
+    QTest::newRow("other file")
+        << false << all   << (int)DatabaseItem::Other << true  << false << false << false
+        << (prints | quality);
+
+    // Image quality: all the items, or only the ones without a pick label.
+
+    QTest::newRow("quality of a labeled item")
+        << false << dirty << (int)DatabaseItem::Image << true  << false << false << false
+        << (thumbs | prints);
+
+    QTest::newRow("quality of an item without label")
+        << false << dirty << (int)DatabaseItem::Image << true  << false << false << true
+        << (thumbs | prints | quality);
+
+    // Faces: only the images of the face scan albums, which can differ from the other albums.
+
+    QTest::newRow("image in both scopes")
+        << false << all   << (int)DatabaseItem::Image << true  << true  << false << false
+        << (thumbs | prints | quality | faces);
+
+    QTest::newRow("image in the face scope only")
+        << false << all   << (int)DatabaseItem::Image << false << true  << false << false
+        << faces;
+
+    QTest::newRow("video in the face scope")
+        << false << all   << (int)DatabaseItem::Video << true  << true  << false << false
+        << (thumbs | prints | quality);
+
+    QTest::newRow("item out of the scopes")
+        << false << all   << (int)DatabaseItem::Image << false << false << false << true
+        << 0;
+}
+
+void CombinedProcessorTest::testItemStages()
+{
+    QFETCH(bool, scanThumbs);
+    QFETCH(int,  qualityScanMode);
+    QFETCH(int,  category);
+    QFETCH(bool, inItems);
+    QFETCH(bool, inFaceItems);
+    QFETCH(bool, hasThumbnail);
+    QFETCH(bool, noPickLabel);
+    QFETCH(int,  selected);
+
+    MaintenanceSettings settings;
+    settings.scanThumbs      = scanThumbs;
+    settings.qualityScanMode = qualityScanMode;
+
+    const int stages = CombinedTask::Thumbnails   | CombinedTask::FingerPrints |
+                       CombinedTask::ImageQuality | CombinedTask::Faces;
+
+    QCOMPARE(CombinedProcessor::itemStages(stages, settings, (DatabaseItem::Category)category,
+                                           inItems, inFaceItems, hasThumbnail, noPickLabel),
+             selected);
+
+    // The stages which are not combined are never selected.
+
+    QCOMPARE(CombinedProcessor::itemStages(CombinedTask::FingerPrints, settings,
+                                           (DatabaseItem::Category)category,
+                                           inItems, inFaceItems, hasThumbnail, noPickLabel),
+             (selected & CombinedTask::FingerPrints));
+}
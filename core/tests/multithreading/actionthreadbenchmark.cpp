@@ -0,0 +1,217 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : a micro-benchmark of the ActionThreadBase job scheduling
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "actionthreadbenchmark.h"
+
+// Qt includes
+
+#include <QTest>
+#include <QAtomicInt>
+#include <QElapsedTimer>
+#include <QEventLoop>
+
+// Local includes
+
+#include "actionthreadbase.h"
+
+using namespace Digikam;
+
+QTEST_GUILESS_MAIN(ActionThreadBenchmark)
+
+namespace
+{
+
+QAtomicInt s_jobsRun;
+
+/**
+ * A job which keeps a core busy for a duration, as the image processing jobs.
+ */
+class Q_DECL_HIDDEN BenchJob : public ActionJob
+{
+public:
+
+    explicit BenchJob(int duration)
+        : ActionJob(),
+          m_duration(duration)
+    {
+    }
+
+protected:
+
+    void run() override
+    {
+        if (m_cancel)
+        {
+            return;
+        }
+
+        QElapsedTimer timer;
+        timer.start();
+
+        while (!m_cancel && (timer.nsecsElapsed() < m_duration * 1000LL))
+        {
+        }
+
+        s_jobsRun.ref();
+
+        emit signalDone();
+    }
+
+private:
+
+    const int m_duration;
+};
+
+class Q_DECL_HIDDEN BenchThread : public ActionThreadBase
+{
+public:
+
+    using ActionThreadBase::appendJobs;
+};
+
+} // namespace
+
+void ActionThreadBenchmark::addBackends()
+{
+    QTest::addColumn<int>("backend");
+
+    QTest::newRow("thread pool")   << (int)ActionThreadBase::ThreadPoolBackend;
+    QTest::newRow("work stealing") << (int)ActionThreadBase::WorkStealingBackend;
+}
+
+int ActionThreadBenchmark::runJobs(int backend, const QList<int>& durations)
+{
+    s_jobsRun.store(0);
+
+    BenchThread thread;
+    thread.setBackend((ActionThreadBase::Backend)backend);
+
+    ActionJobCollection collection;
+
+    foreach (int duration, durations)
+    {
+        collection.insert(new BenchJob(duration), 0);
+    }
+
+    thread.appendJobs(collection);
+
+    // The thread pool backend is notified of each job done through the event loop.
+
+    QEventLoop loop;
+
+    connect(&thread, SIGNAL(finished()),
+            &loop, SLOT(quit()));
+
+    thread.start();
+    loop.exec();
+
+    return s_jobsRun.load();
+}
+
+void ActionThreadBenchmark::benchSmallJobs_data()
+{
+    addBackends();
+}
+
+void ActionThreadBenchmark::benchSmallJobs()
+{
+    QFETCH(int, backend);
+
+    // Jobs which do almost nothing, as the metadata synchronization of an unchanged item.
+
+    QList<int> durations;
+
+    for (int i = 0 ; i < 20000 ; ++i)
+    {
+        durations << 0;
+    }
+
+    QBENCHMARK
+    {
+        QCOMPARE(runJobs(backend, durations), durations.count());
+    }
+}
+
+void ActionThreadBenchmark::benchUnbalancedJobs_data()
+{
+    addBackends();
+}
+
+void ActionThreadBenchmark::benchUnbalancedJobs()
+{
+    QFETCH(int, backend);
+
+    // A few long jobs, as the RAW files, in a list of short ones.
+
+    QList<int> durations;
+
+    for (int i = 0 ; i < 4000 ; ++i)
+    {
+        durations << (((i % 250) == 0) ? 50000 : 50);
+    }
+
+    QBENCHMARK
+    {
+        QCOMPARE(runJobs(backend, durations), durations.count());
+    }
+}
+
+void ActionThreadBenchmark::testCancel_data()
+{
+    addBackends();
+}
+
+void ActionThreadBenchmark::testCancel()
+{
+    QFETCH(int, backend);
+
+    s_jobsRun.store(0);
+
+    BenchThread thread;
+    thread.setBackend((ActionThreadBase::Backend)backend);
+
+    ActionJobCollection collection;
+
+    for (int i = 0 ; i < 2000 ; ++i)
+    {
+        collection.insert(new BenchJob(1000), 0);
+    }
+
+    thread.appendJobs(collection);
+
+    QEventLoop loop;
+
+    connect(&thread, SIGNAL(finished()),
+            &loop, SLOT(quit()));
+
+    thread.start();
+    QTest::qWait(20);
+    thread.cancel();
+
+    if (thread.isRunning())
+    {
+        loop.exec();
+    }
+
+    QVERIFY(s_jobsRun.load() < collection.count());
+}
@@ -0,0 +1,55 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : a micro-benchmark of the ActionThreadBase job scheduling
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_ACTION_THREAD_BENCHMARK_H
+#define DIGIKAM_ACTION_THREAD_BENCHMARK_H
+
+// Qt includes
+
+#include <QObject>
+#include <QList>
+
+class ActionThreadBenchmark : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+
+    void benchSmallJobs_data();
+    void benchSmallJobs();
+    void benchUnbalancedJobs_data();
+    void benchUnbalancedJobs();
+    void testCancel_data();
+    void testCancel();
+
+private:
+
+    void addBackends();
+
+    /**
+     * Run one job for each duration, in microseconds, and return the count of jobs which ran.
+     */
+    int  runJobs(int backend, const QList<int>& durations);
+};
+
+#endif // DIGIKAM_ACTION_THREAD_BENCHMARK_H
@@ -0,0 +1,158 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-18
+ * Description : a test for the processing stages profiler
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "dprofilertest.h"
+
+// Qt includes
+
+#include <QTest>
+#include <QThread>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QtConcurrent>    // krazy:exclude=includes
+
+// Local includes
+
+#include "dprofiler.h"
+
+using namespace Digikam;
+
+QTEST_GUILESS_MAIN(DProfilerTest)
+
+void DProfilerTest::cleanup()
+{
+    DProfiler::instance()->setEnabled(false);
+    DProfiler::instance()->reset();
+}
+
+void DProfilerTest::testDisabled()
+{
+    {
+        DProfileScope scope("test", "disabled");
+    }
+
+    QCOMPARE(DProfiler::instance()->eventsCount(), (qint64)0);
+}
+
+void DProfilerTest::testSummary()
+{
+    DProfiler::instance()->setEnabled(true);
+
+    DProfiler::instance()->addComplete("test", "stage", 0,   100);
+    DProfiler::instance()->addComplete("test", "stage", 200, 300);
+    DProfiler::instance()->addCounter("test",  "queue", 5);
+    DProfiler::instance()->addCounter("test",  "queue", 1);
+
+    {
+        DProfileScope scope("test", QString::fromLatin1("dynamic"));
+        QThread::msleep(2);
+    }
+
+    QList<DProfiler::Summary> summary = DProfiler::instance()->summary();
+    QCOMPARE(summary.count(), 3);
+
+    // Durations come first, sorted by decreasing total time, then counters.
+
+    QCOMPARE(summary[0].name,    QByteArray("dynamic"));
+    QVERIFY(summary[0].total >= 2000);
+
+    QCOMPARE(summary[1].name,    QByteArray("stage"));
+    QCOMPARE(summary[1].count,   (qint64)2);
+    QCOMPARE(summary[1].total,   (qint64)400);
+    QCOMPARE(summary[1].min,     (qint64)100);
+    QCOMPARE(summary[1].max,     (qint64)300);
+
+    QCOMPARE(summary[2].name,    QByteArray("queue"));
+    QVERIFY(summary[2].counter);
+    QCOMPARE(summary[2].min,     (qint64)1);
+    QCOMPARE(summary[2].max,     (qint64)5);
+
+    DProfiler::instance()->reset();
+    QVERIFY(DProfiler::instance()->summary().isEmpty());
+}
+
+void DProfilerTest::testThreads()
+{
+    DProfiler::instance()->setEnabled(true);
+
+    QList<QFuture<void> > tasks;
+
+    for (int i = 0 ; i < 4 ; ++i)
+    {
+        tasks << QtConcurrent::run([]()
+            {
+                for (int j = 0 ; j < 1000 ; ++j)
+                {
+                    DProfileScope scope("test", "worker");
+                }
+            }
+        );
+    }
+
+    foreach (QFuture<void> t, tasks)
+    {
+        t.waitForFinished();
+    }
+
+    QCOMPARE(DProfiler::instance()->eventsCount(), (qint64)4000);
+    QCOMPARE(DProfiler::instance()->summary().first().count, (qint64)4000);
+}
+
+void DProfilerTest::testChromeTrace()
+{
+    DProfiler::instance()->setEnabled(true);
+
+    DProfiler::instance()->addComplete("test", "a \"quoted\" stage", 10, 20);
+    DProfiler::instance()->addCounter("test", "queue", 3);
+
+    QJsonParseError error;
+    QJsonDocument doc = QJsonDocument::fromJson(DProfiler::instance()->chromeTrace(), &error);
+
+    QCOMPARE(error.error, QJsonParseError::NoError);
+
+    int complete = 0;
+    int counters = 0;
+
+    foreach (const QJsonValue& value, doc.object().value(QLatin1String("traceEvents")).toArray())
+    {
+        QJsonObject event = value.toObject();
+        QString phase     = event.value(QLatin1String("ph")).toString();
+
+        if (phase == QLatin1String("X"))
+        {
+            QCOMPARE(event.value(QLatin1String("name")).toString(), QString::fromLatin1("a \"quoted\" stage"));
+            QCOMPARE(event.value(QLatin1String("ts")).toInt(),  10);
+            QCOMPARE(event.value(QLatin1String("dur")).toInt(), 20);
+            ++complete;
+        }
+        else if (phase == QLatin1String("C"))
+        {
+            QCOMPARE(event.value(QLatin1String("args")).toObject().value(QLatin1String("value")).toInt(), 3);
+            ++counters;
+        }
+    }
+
+    QCOMPARE(complete, 1);
+    QCOMPARE(counters, 1);
+}
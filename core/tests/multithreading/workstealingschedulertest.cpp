@@ -0,0 +1,307 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : a test for the work stealing scheduler
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "workstealingschedulertest.h"
+
+// Qt includes
+
+#include <QTest>
+#include <QSignalSpy>
+#include <QList>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSemaphore>
+#include <QThread>
+
+// Local includes
+
+#include "workstealingscheduler.h"
+
+using namespace Digikam;
+
+QTEST_GUILESS_MAIN(WorkStealingSchedulerTest)
+
+/**
+ * The state shared by the jobs of a test.
+ */
+class JobTracker
+{
+public:
+
+    void record(int id)
+    {
+        QMutexLocker lock(&mutex);
+        order << id;
+    }
+
+public:
+
+    QMutex     mutex;
+
+    /// The ids of the jobs, in the order they were run.
+    QList<int> order;
+
+    QSemaphore started;
+    QSemaphore gate;
+    QSemaphore done;
+};
+
+class TrackedJob : public ActionJob
+{
+public:
+
+    enum Mode
+    {
+        Short = 0,
+        Gate,           ///< Wait until the gate of the tracker is released.
+        UntilCanceled   ///< Wait until the job is canceled.
+    };
+
+public:
+
+    explicit TrackedJob(JobTracker* const tracker, int id, Mode mode = Short)
+      : ActionJob(),
+        thread(nullptr),
+        runs(0),
+        m_tracker(tracker),
+        m_id(id),
+        m_mode(mode)
+    {
+    }
+
+    void run() override
+    {
+        thread = QThread::currentThread();
+        runs.ref();
+        m_tracker->record(m_id);
+
+        if      (m_mode == Gate)
+        {
+            m_tracker->started.release();
+            m_tracker->gate.acquire();
+        }
+        else if (m_mode == UntilCanceled)
+        {
+            m_tracker->started.release();
+
+            while (!m_cancel)
+            {
+                QThread::msleep(1);
+            }
+        }
+
+        m_tracker->done.release();
+    }
+
+public:
+
+    QThread*    thread;
+    QAtomicInt  runs;
+
+private:
+
+    JobTracker* m_tracker;
+    int         m_id;
+    Mode        m_mode;
+};
+
+// -----------------------------------------------------------------
+
+void WorkStealingSchedulerTest::testRunOnce()
+{
+    JobTracker tracker;
+    WorkStealingScheduler scheduler;
+    scheduler.setMaximumNumberOfThreads(4);
+    QSignalSpy spy(&scheduler, SIGNAL(signalDone()));
+
+    ActionJobCollection jobs;
+
+    for (int i = 0 ; i < 1000 ; ++i)
+    {
+        jobs.insert(new TrackedJob(&tracker, i), i % 3);
+    }
+
+    scheduler.schedule(jobs);
+    scheduler.waitForDone();
+
+    QCOMPARE(scheduler.pendingCount(), 0);
+    QCOMPARE(tracker.order.count(),    1000);
+
+    foreach (ActionJob* const job, jobs.keys())
+    {
+        QCOMPARE(static_cast<TrackedJob*>(job)->runs.load(), 1);
+    }
+
+    QTRY_COMPARE(spy.count(), 1);
+
+    qDeleteAll(jobs.keys());
+}
+
+void WorkStealingSchedulerTest::testPriorityOrder()
+{
+    JobTracker tracker;
+    WorkStealingScheduler scheduler;
+    scheduler.setMaximumNumberOfThreads(1);
+
+    // Keep the worker busy while the jobs are queued, so it finds them all in its queue.
+
+    TrackedJob* const gate = new TrackedJob(&tracker, -1, TrackedJob::Gate);
+    ActionJobCollection first;
+    first.insert(gate, 0);
+    scheduler.schedule(first);
+
+    QVERIFY(tracker.started.tryAcquire(1, 5000));
+
+    ActionJobCollection jobs;
+
+    for (int i = 0 ; i < 10 ; ++i)
+    {
+        jobs.insert(new TrackedJob(&tracker, i), i);
+    }
+
+    scheduler.schedule(jobs);
+    tracker.gate.release();
+    scheduler.waitForDone();
+
+    QList<int> expected;
+    expected << -1;
+
+    for (int i = 9 ; i >= 0 ; --i)
+    {
+        expected << i;
+    }
+
+    QCOMPARE(tracker.order, expected);
+
+    delete gate;
+    qDeleteAll(jobs.keys());
+}
+
+void WorkStealingSchedulerTest::testStealing()
+{
+    JobTracker tracker;
+    WorkStealingScheduler scheduler;
+    scheduler.setMaximumNumberOfThreads(2);
+
+    // A long job blocks one worker, while the next jobs are split over both queues:
+    // the other worker has to steal the jobs queued for the blocked one.
+
+    TrackedJob* const gate = new TrackedJob(&tracker, -1, TrackedJob::Gate);
+    ActionJobCollection first;
+    first.insert(gate, 0);
+    scheduler.schedule(first);
+
+    QVERIFY(tracker.started.tryAcquire(1, 5000));
+
+    ActionJobCollection jobs;
+
+    for (int i = 0 ; i < 100 ; ++i)
+    {
+        jobs.insert(new TrackedJob(&tracker, i), 0);
+    }
+
+    scheduler.schedule(jobs);
+
+    QVERIFY(tracker.done.tryAcquire(100, 10000));
+    QTRY_COMPARE(scheduler.pendingCount(), 1);
+
+    foreach (ActionJob* const job, jobs.keys())
+    {
+        TrackedJob* const tracked = static_cast<TrackedJob*>(job);
+
+        QCOMPARE(tracked->runs.load(), 1);
+        QVERIFY(tracked->thread != gate->thread);
+    }
+
+    tracker.gate.release();
+    scheduler.waitForDone();
+
+    QCOMPARE(gate->runs.load(), 1);
+
+    delete gate;
+    qDeleteAll(jobs.keys());
+}
+
+void WorkStealingSchedulerTest::testCancel()
+{
+    JobTracker tracker;
+    WorkStealingScheduler scheduler;
+    scheduler.setMaximumNumberOfThreads(2);
+    QSignalSpy spy(&scheduler, SIGNAL(signalDone()));
+
+    // Both workers run a job until it is canceled, the next jobs stay queued.
+
+    ActionJobCollection running;
+
+    for (int i = 0 ; i < 2 ; ++i)
+    {
+        running.insert(new TrackedJob(&tracker, -1, TrackedJob::UntilCanceled), 1);
+    }
+
+    scheduler.schedule(running);
+
+    QVERIFY(tracker.started.tryAcquire(2, 5000));
+
+    ActionJobCollection queued;
+
+    for (int i = 0 ; i < 50 ; ++i)
+    {
+        queued.insert(new TrackedJob(&tracker, i), 0);
+    }
+
+    scheduler.schedule(queued);
+
+    QCOMPARE(scheduler.pendingCount(), 52);
+
+    scheduler.cancel();
+    scheduler.waitForDone();
+
+    QCOMPARE(scheduler.pendingCount(), 0);
+
+    foreach (ActionJob* const job, running.keys())
+    {
+        QCOMPARE(static_cast<TrackedJob*>(job)->runs.load(), 1);
+    }
+
+    foreach (ActionJob* const job, queued.keys())
+    {
+        QCOMPARE(static_cast<TrackedJob*>(job)->runs.load(), 0);
+    }
+
+    QTRY_COMPARE(spy.count(), 1);
+
+    // The scheduler runs the jobs scheduled after the cancel.
+
+    scheduler.schedule(queued);
+    scheduler.waitForDone();
+
+    foreach (ActionJob* const job, queued.keys())
+    {
+        QCOMPARE(static_cast<TrackedJob*>(job)->runs.load(), 1);
+    }
+
+    QTRY_COMPARE(spy.count(), 2);
+
+    qDeleteAll(running.keys());
+    qDeleteAll(queued.keys());
+}
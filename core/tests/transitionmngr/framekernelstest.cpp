@@ -0,0 +1,348 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : Test the pixel kernels of the transitions and effects
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "framekernelstest.h"
+
+// Qt includes
+
+#include <QTest>
+#include <QPainter>
+#include <QRect>
+
+// Local includes
+
+#include "framekernels.h"
+#include "effectmngr.h"
+
+using namespace Digikam;
+
+QTEST_GUILESS_MAIN(FrameKernelsTest)
+
+QImage FrameKernelsTest::noiseImage(int width, int height, int seed) const
+{
+    QImage image(width, height, QImage::Format_ARGB32);
+    quint32 n = seed;
+
+    for (int y = 0 ; y < height ; ++y)
+    {
+        QRgb* const line = reinterpret_cast<QRgb*>(image.scanLine(y));
+
+        for (int x = 0 ; x < width ; ++x)
+        {
+            n       = n * 1664525 + 1013904223;
+            line[x] = qRgb(n >> 24, (n >> 16) & 0xff, (n >> 8) & 0xff);
+        }
+    }
+
+    return image;
+}
+
+QImage FrameKernelsTest::gradientImage(int width, int height) const
+{
+    QImage image(width, height, QImage::Format_ARGB32);
+
+    for (int y = 0 ; y < height ; ++y)
+    {
+        QRgb* const line = reinterpret_cast<QRgb*>(image.scanLine(y));
+
+        for (int x = 0 ; x < width ; ++x)
+        {
+            line[x] = qRgb((x * 2) & 0xff, (y * 3) & 0xff, (x + y) & 0xff);
+        }
+    }
+
+    return image;
+}
+
+QImage FrameKernelsTest::referenceBlur(const QImage& img, int radius) const
+{
+    const int w = img.width();
+    const int h = img.height();
+    QImage blur(w, h, img.format());
+
+    for (int y = 0 ; y < h ; ++y)
+    {
+        for (int x = 0 ; x < w ; ++x)
+        {
+            int a     = 0;
+            int r     = 0;
+            int g     = 0;
+            int b     = 0;
+            int count = 0;
+
+            for (int yy = qMax(0, y - radius) ; yy <= qMin(h - 1, y + radius) ; ++yy)
+            {
+                for (int xx = qMax(0, x - radius) ; xx <= qMin(w - 1, x + radius) ; ++xx)
+                {
+                    const QRgb p = img.pixel(xx, yy);
+                    a           += qAlpha(p);
+                    r           += qRed(p);
+                    g           += qGreen(p);
+                    b           += qBlue(p);
+                    ++count;
+                }
+            }
+
+            blur.setPixel(x, y, qRgba(r / count, g / count, b / count, a / count));
+        }
+    }
+
+    return blur;
+}
+
+int FrameKernelsTest::maxDifference(const QImage& a, const QImage& b) const
+{
+    if (a.size() != b.size())
+    {
+        return 256;
+    }
+
+    int diff = 0;
+
+    for (int y = 0 ; y < a.height() ; ++y)
+    {
+        const QRgb* const la = reinterpret_cast<const QRgb*>(a.constScanLine(y));
+        const QRgb* const lb = reinterpret_cast<const QRgb*>(b.constScanLine(y));
+
+        for (int x = 0 ; x < a.width() ; ++x)
+        {
+            diff = qMax(diff, qAbs(qAlpha(la[x]) - qAlpha(lb[x])));
+            diff = qMax(diff, qAbs(qRed(la[x])   - qRed(lb[x])));
+            diff = qMax(diff, qAbs(qGreen(la[x]) - qGreen(lb[x])));
+            diff = qMax(diff, qAbs(qBlue(la[x])  - qBlue(lb[x])));
+        }
+    }
+
+    return diff;
+}
+
+void FrameKernelsTest::testCrossFade_data()
+{
+    QTest::addColumn<int>("width");
+    QTest::addColumn<int>("alpha");
+
+    // The odd widths are not a multiple of the 4 pixels processed at once.
+
+    QList<int> widths;
+    widths << 1 << 3 << 7 << 33 << 64;
+
+    QList<int> alphas;
+    alphas << 0 << 1 << 77 << 128 << 255 << 256;
+
+    foreach (int width, widths)
+    {
+        foreach (int alpha, alphas)
+        {
+            const QString row = QString::fromLatin1("width %1 alpha %2").arg(width).arg(alpha);
+            QTest::newRow(row.toLatin1().constData()) << width << alpha;
+        }
+    }
+}
+
+void FrameKernelsTest::testCrossFade()
+{
+    QFETCH(int, width);
+    QFETCH(int, alpha);
+
+    const QImage from = noiseImage(width, 19, 1);
+    const QImage to   = noiseImage(width, 19, 2);
+    QImage dest;
+
+    QVERIFY(FrameKernels::crossFade(from, to, alpha, dest));
+    QCOMPARE(dest.size(),   from.size());
+    QCOMPARE(dest.format(), from.format());
+
+    // The former Fade transition drew the second image with an opacity over the first one.
+    // QPainter rounds the opacity to 255 levels and each product, the kernel rounds down once.
+
+    QImage reference = from.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+    QPainter painter(&reference);
+    painter.setOpacity(alpha / 256.0);
+    painter.drawImage(0, 0, to);
+    painter.end();
+
+    QVERIFY(maxDifference(dest, reference) <= 3);
+
+    if (alpha == 0)
+    {
+        QCOMPARE(maxDifference(dest, from), 0);
+    }
+    else if (alpha == 256)
+    {
+        QCOMPARE(maxDifference(dest, to), 0);
+    }
+}
+
+void FrameKernelsTest::testCrossFadeSizes()
+{
+    QImage dest;
+
+    QVERIFY(!FrameKernels::crossFade(noiseImage(16, 8, 1), noiseImage(17, 8, 2), 128, dest));
+    QVERIFY(!FrameKernels::crossFade(QImage(), QImage(), 128, dest));
+    QVERIFY(dest.isNull());
+}
+
+void FrameKernelsTest::testBoxBlur_data()
+{
+    QTest::addColumn<int>("width");
+    QTest::addColumn<int>("height");
+    QTest::addColumn<int>("radius");
+
+    QTest::newRow("radius 1")                  << 17  << 9   << 1;
+    QTest::newRow("odd width")                 << 33  << 21  << 5;
+    QTest::newRow("window as large as image")  << 51  << 51  << 25;
+    QTest::newRow("width twice the radius")    << 50  << 25  << 25;
+    QTest::newRow("width below twice radius")  << 49  << 80  << 25;
+    QTest::newRow("window higher than image")  << 101 << 3   << 25;
+    QTest::newRow("largest radius")            << 97  << 130 << 31;
+    QTest::newRow("several bands")             << 129 << 700 << 3;
+    QTest::newRow("no radius")                 << 20  << 20  << 0;
+}
+
+void FrameKernelsTest::testBoxBlur()
+{
+    QFETCH(int, width);
+    QFETCH(int, height);
+    QFETCH(int, radius);
+
+    const QImage img = noiseImage(width, height, 3);
+    QImage dest;
+
+    FrameKernels::boxBlur(img, radius, dest);
+
+    if ((radius < 1) || (width < 2 * radius))
+    {
+        // Left unchanged, as by fastBlur().
+
+        QCOMPARE(maxDifference(dest, img), 0);
+    }
+    else
+    {
+        QCOMPARE(dest.format(), img.format());
+        QCOMPARE(maxDifference(dest, referenceBlur(img, radius)), 0);
+    }
+}
+
+void FrameKernelsTest::testBoxBlurBuffer()
+{
+    const QImage img = noiseImage(64, 48, 4);
+    QImage dest;
+
+    FrameKernels::boxBlur(img, 4, dest);
+    const uchar* const bits = dest.constBits();
+
+    // The frame released by the caller is rendered in place.
+
+    FrameKernels::boxBlur(img, 5, dest);
+    QCOMPARE(dest.constBits(), bits);
+    QCOMPARE(maxDifference(dest, referenceBlur(img, 5)), 0);
+
+    // A frame still used by the caller is not overwritten.
+
+    const QImage previous = dest;
+    FrameKernels::boxBlur(img, 6, dest);
+    QVERIFY(dest.constBits() != previous.constBits());
+    QCOMPARE(maxDifference(previous, referenceBlur(img, 5)), 0);
+    QCOMPARE(maxDifference(dest,     referenceBlur(img, 6)), 0);
+}
+
+void FrameKernelsTest::testScaledBlit_data()
+{
+    QTest::addColumn<QRect>("area");
+    QTest::addColumn<QSize>("size");
+
+    QTest::newRow("same size")             << QRect(0, 0, 101, 67)  << QSize(101, 67);
+    QTest::newRow("enlarged twice")        << QRect(0, 0, 101, 67)  << QSize(203, 135);
+    QTest::newRow("area enlarged")         << QRect(10, 5, 51, 33)  << QSize(77, 49);
+    QTest::newRow("area of one column")    << QRect(40, 0, 1, 67)   << QSize(9, 67);
+    QTest::newRow("reduced")               << QRect(0, 0, 101, 67)  << QSize(67, 45);
+    QTest::newRow("reduced twice")         << QRect(0, 0, 100, 66)  << QSize(50, 33);
+}
+
+void FrameKernelsTest::testScaledBlit()
+{
+    QFETCH(QRect, area);
+    QFETCH(QSize, size);
+
+    const QImage img = gradientImage(101, 67);
+    QImage dest(size, QImage::Format_ARGB32);
+
+    QVERIFY(FrameKernels::scaledBlit(img, area, dest));
+    QCOMPARE(dest.size(),   size);
+    QCOMPARE(dest.format(), img.format());
+
+    // The Ken Burns effects scaled a copy of the area before. The interpolations differ
+    // a little at the borders, the gradients change by 3 at most from one pixel to the next.
+
+    const QImage reference = img.copy(area).scaled(size, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+
+    QVERIFY(maxDifference(dest, reference) <= 4);
+}
+
+void FrameKernelsTest::testScaledBlitReduced()
+{
+    const QImage img = gradientImage(101, 67);
+    QImage dest(40, 30, QImage::Format_ARGB32);
+    dest.fill(Qt::black);
+
+    QVERIFY(!FrameKernels::scaledBlit(img, QRect(0, 0, 101, 67), dest));
+    QVERIFY(!FrameKernels::scaledBlit(img, QRect(200, 200, 10, 10), dest));
+    QCOMPARE(dest.pixel(0, 0), qRgb(0, 0, 0));
+}
+
+void FrameKernelsTest::testEffectFormat_data()
+{
+    QTest::addColumn<int>("format");
+
+    QTest::newRow("RGB32")                << (int)QImage::Format_RGB32;
+    QTest::newRow("ARGB32")               << (int)QImage::Format_ARGB32;
+    QTest::newRow("ARGB32 premultiplied") << (int)QImage::Format_ARGB32_Premultiplied;
+}
+
+void FrameKernelsTest::testEffectFormat()
+{
+    QFETCH(int, format);
+
+    const QImage img = gradientImage(96, 64).convertToFormat((QImage::Format)format);
+
+    EffectMngr mngr;
+    mngr.setOutputSize(img.size());
+    mngr.setFrames(5);
+    mngr.setImage(img);
+    mngr.setEffect(EffectMngr::KenBurnsZoomIn);
+
+    int tmout = 0;
+    int count = 0;
+
+    do
+    {
+        const QImage frame = mngr.currentFrame(tmout);
+
+        QCOMPARE(frame.format(), QImage::Format_ARGB32);
+        QCOMPARE(frame.size(),   img.size());
+        ++count;
+    }
+    while ((tmout != -1) && (count < 10));
+
+    QCOMPARE(count, 5);
+}
@@ -0,0 +1,74 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : Test the pixel kernels of the transitions and effects
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_FRAME_KERNELS_TEST_H
+#define DIGIKAM_FRAME_KERNELS_TEST_H
+
+// Qt includes
+
+#include <QObject>
+#include <QImage>
+
+class FrameKernelsTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+
+    void testCrossFade_data();
+    void testCrossFade();
+    void testCrossFadeSizes();
+    void testBoxBlur_data();
+    void testBoxBlur();
+    void testBoxBlurBuffer();
+    void testScaledBlit_data();
+    void testScaledBlit();
+    void testScaledBlitReduced();
+    void testEffectFormat_data();
+    void testEffectFormat();
+
+private:
+
+    /**
+     * An opaque image with a deterministic noise, the worst case of the roundings.
+     */
+    QImage noiseImage(int width, int height, int seed) const;
+
+    /**
+     * An opaque image with smooth gradients, where all the interpolations give close results.
+     */
+    QImage gradientImage(int width, int height) const;
+
+    /**
+     * The blur of the former fastBlur() of the transitions, the average of the pixels in the window
+     * rounded down, which is the same on opaque images, computed pixel by pixel.
+     */
+    QImage referenceBlur(const QImage& img, int radius) const;
+
+    /**
+     * The greatest difference between the channels of the pixels of two images of the same size.
+     */
+    int maxDifference(const QImage& a, const QImage& b) const;
+};
+
+#endif // DIGIKAM_FRAME_KERNELS_TEST_H
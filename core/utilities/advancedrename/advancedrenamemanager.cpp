@@ -31,8 +31,12 @@
 
 #include <QList>
 #include <QMap>
+#include <QHash>
+#include <QVector>
 #include <QFileInfo>
 #include <QStorageInfo>
+#include <QThreadPool>
+#include <QtConcurrent>
 
 // Local includes
 
@@ -42,6 +46,11 @@
 #include "parser.h"
 #include "defaultrenameparser.h"
 #include "importrenameparser.h"
+#include "parsefilecache.h"
+#include "cameranameoption.h"
+#include "databaseoption.h"
+#include "metadataoption.h"
+#include "uniquemodifier.h"
 #include "iteminfo.h"
 
 namespace Digikam
@@ -85,10 +94,42 @@ public:
         parserType(AdvancedRenameManager::DefaultParser),
         sortAction(AdvancedRenameManager::SortCustom),
         sortDirection(AdvancedRenameManager::SortAscending),
-        startIndex(1)
+        startIndex(1),
+        parsed(false),
+        parsedWithFileDates(false)
     {
     }
 
+    struct ParseArgs
+    {
+        Parser*       parser;
+        ParseSettings settings;
+        bool          useFileDates;
+        QStringList   keywords;
+        bool          camera;
+        QString*      names;
+        int           start;
+        int           step;
+    };
+
+    static Parser* createParser(AdvancedRenameManager::ParserType type)
+    {
+        if (type == AdvancedRenameManager::ImportParser)
+        {
+            return new ImportRenameParser();
+        }
+
+        return new DefaultRenameParser();
+    }
+
+    /**
+     * Parse the files from args.start, every args.step files. Run in the thread pool,
+     * each thread with its own parser, as the rules are not reentrant.
+     */
+    void parseRange(const ParseArgs& args);
+
+public:
+
     QStringList                          files;
     QMap<QString, int>                   fileIndexMap;
     QMap<QString, int>                   folderIndexMap;
@@ -96,15 +137,53 @@ public:
     QMap<QString, QDateTime>             fileDatesMap;
     QMap<QString, QString>               renamedFiles;
 
+    /// The information of the files read by the options, kept while the parse string is edited.
+    QHash<QString, ParseFileCache*>      fileCaches;
+
+    /// The characters which are replaced in the new names, by folder.
+    QHash<QString, QRegExp>              invalidCharacters;
+
     Parser*                              parser;
+    QList<Parser*>                       threadParsers;
     AdvancedRenameWidget*                widget;
     AdvancedRenameManager::ParserType    parserType;
     AdvancedRenameManager::SortAction    sortAction;
     AdvancedRenameManager::SortDirection sortDirection;
 
     int                                  startIndex;
+
+    /// The parsing of renamedFiles, which is not done again if nothing changed.
+    bool                                 parsed;
+    QString                              parsedString;
+    ParseSettings                        parsedSettings;
+    bool                                 parsedWithFileDates;
 };
 
+void AdvancedRenameManager::Private::parseRange(const ParseArgs& args)
+{
+    for (int i = args.start ; i < files.count() ; i += args.step)
+    {
+        const QString& file    = files.at(i);
+        ParseSettings settings = args.settings;
+        settings.fileUrl       = QUrl::fromLocalFile(file);
+        settings.fileCache     = fileCaches.value(file);
+
+        if (args.useFileDates)
+        {
+            settings.creationTime = fileDatesMap.value(file);
+        }
+
+        // The metadata used by the parse string are read at once for the file.
+
+        if (settings.fileCache)
+        {
+            settings.fileCache->prefetch(args.keywords, args.camera);
+        }
+
+        args.names[i] = args.parser->parse(settings);
+    }
+}
+
 AdvancedRenameManager::AdvancedRenameManager()
     : d(new Private)
 {
@@ -122,6 +201,7 @@ AdvancedRenameManager::~AdvancedRenameManager()
 {
     clearAll();
 
+    qDeleteAll(d->threadParsers);
     delete d->parser;
     delete d;
 }
@@ -187,17 +267,12 @@ void AdvancedRenameManager::setWidget(AdvancedRenameWidget* widget)
 void AdvancedRenameManager::setParserType(ParserType type)
 {
     delete d->parser;
+    qDeleteAll(d->threadParsers);
+    d->threadParsers.clear();
 
-    if (type == ImportParser)
-    {
-        d->parser = new ImportRenameParser();
-    }
-    else
-    {
-        d->parser = new DefaultRenameParser();
-    }
-
+    d->parser     = Private::createParser(type);
     d->parserType = type;
+    d->parsed     = false;
 
     if (d->widget)
     {
@@ -245,47 +320,160 @@ void AdvancedRenameManager::parseFiles(const ParseSettings& _settings)
 }
 
 void AdvancedRenameManager::parseFiles(const QString& parseString)
+{
+    parseFiles(parseString, ParseSettings(), true);
+}
+
+void AdvancedRenameManager::parseFiles(const QString& parseString, const ParseSettings& _settings)
+{
+    parseFiles(parseString, _settings, false);
+}
+
+void AdvancedRenameManager::parseFiles(const QString& parseString, const ParseSettings& _settings, bool useFileDates)
 {
     if (!d->parser)
     {
         return;
     }
 
+    // The names are kept until the files, their order or the settings change.
+
+    if (d->parsed                                                                          &&
+        (parseString                        == d->parsedString)                            &&
+        (useFileDates                       == d->parsedWithFileDates)                     &&
+        (_settings.useOriginalFileExtension == d->parsedSettings.useOriginalFileExtension) &&
+        (_settings.creationTime             == d->parsedSettings.creationTime))
+    {
+        return;
+    }
+
     d->parser->reset();
 
-    foreach(const QString& file, d->files)
+    // Find the information which the options of the parse string read for each file.
+
+    bool camera   = false;
+    bool database = false;
+    bool unique   = false;
+
+    foreach (Rule* const option, d->parser->options())
     {
-        QUrl url = QUrl::fromLocalFile(file);
-        ParseSettings settings;
-        settings.fileUrl      = url;
-        settings.parseString  = parseString;
-        settings.startIndex   = d->startIndex;
-        settings.creationTime = d->fileDatesMap[file];
-        settings.manager      = this;
-        d->renamedFiles[file] = d->parser->parse(settings);
+        if (QRegExp(option->regExp()).indexIn(parseString) != -1)
+        {
+            camera   |= (dynamic_cast<CameraNameOption*>(option) != nullptr);
+            database |= (dynamic_cast<DatabaseOption*>(option)   != nullptr);
+        }
     }
-}
 
-void AdvancedRenameManager::parseFiles(const QString& parseString, const ParseSettings& _settings)
-{
-    if (!d->parser)
+    foreach (Rule* const modifier, d->parser->modifiers())
     {
-        return;
+        if (QRegExp(modifier->regExp()).indexIn(parseString) != -1)
+        {
+            unique |= (dynamic_cast<UniqueModifier*>(modifier) != nullptr);
+        }
     }
 
-    d->parser->reset();
+    foreach (const QString& file, d->files)
+    {
+        if (!d->fileCaches.contains(file))
+        {
+            d->fileCaches.insert(file, new ParseFileCache(file));
+        }
+    }
 
-    foreach(const QString& file, d->files)
+    if (camera || database)
+    {
+        // Read the fields of the items of the collection with a few queries,
+        // instead of one query for each file and each token.
+
+        ItemInfoList infos;
+
+        foreach (const QString& file, d->files)
+        {
+            ItemInfo info = d->fileCaches.value(file)->itemInfo();
+
+            if (!info.isNull())
+            {
+                infos << info;
+            }
+        }
+
+        DatabaseFields::Set fields;
+        fields.setFields(DatabaseFields::Set(DatabaseFields::ImageMetadataAll));
+
+        if (database)
+        {
+            fields.setFields(DatabaseFields::Set(DatabaseFields::VideoMetadataAll));
+            infos.loadPositions();
+        }
+
+        infos.loadDatabaseFields(fields);
+    }
+
+    QVector<QString> names(d->files.count());
+
+    Private::ParseArgs prm;
+    prm.settings              = _settings;
+    prm.settings.parseString  = parseString;
+    prm.settings.startIndex   = d->startIndex;
+    prm.settings.manager      = this;
+    prm.useFileDates          = useFileDates;
+    prm.keywords              = MetadataOption::keywords(parseString);
+    prm.camera                = camera;
+    prm.names                 = names.data();
+
+    // The files are parsed in parallel, except when a modifier depends on the names of
+    // the previous files.
+
+    const int minFilesPerThread = 32;
+    const int threads           = qMin(QThreadPool::globalInstance()->maxThreadCount(),
+                                       d->files.count() / minFilesPerThread);
+
+    if (unique || (threads < 2))
     {
-        QUrl url = QUrl::fromLocalFile(file);
-        ParseSettings settings = _settings;
-        settings.fileUrl       = url;
-        settings.parseString   = parseString;
-        settings.startIndex    = d->startIndex;
-        settings.manager       = this;
-
-        d->renamedFiles[file] = d->parser->parse(settings);
+        prm.parser = d->parser;
+        prm.start  = 0;
+        prm.step   = 1;
+        d->parseRange(prm);
+    }
+    else
+    {
+        while (d->threadParsers.count() < threads)
+        {
+            d->threadParsers << Private::createParser(d->parserType);
+        }
+
+        QList<QFuture<void> > tasks;
+
+        for (int j = 0 ; j < threads ; ++j)
+        {
+            prm.parser = d->threadParsers.at(j);
+            prm.parser->reset();
+            prm.start  = j;
+            prm.step   = threads;
+
+            tasks.append(QtConcurrent::run(d,
+                                           &AdvancedRenameManager::Private::parseRange,
+                                           prm
+                                          ));
+        }
+
+        foreach (QFuture<void> t, tasks)
+        {
+            t.waitForFinished();
+        }
     }
+
+    d->renamedFiles.clear();
+
+    for (int i = 0 ; i < d->files.count() ; ++i)
+    {
+        d->renamedFiles.insert(d->files.at(i), names.at(i));
+    }
+
+    d->parsed              = true;
+    d->parsedString        = parseString;
+    d->parsedSettings      = _settings;
+    d->parsedWithFileDates = useFileDates;
 }
 
 void AdvancedRenameManager::addFiles(const QList<ParseSettings>& files)
@@ -304,12 +492,17 @@ void AdvancedRenameManager::clearMappings()
     d->folderIndexMap.clear();
     d->fileGroupIndexMap.clear();
     d->renamedFiles.clear();
+    d->parsed = false;
 }
 
 void AdvancedRenameManager::clearAll()
 {
     d->files.clear();
     clearMappings();
+
+    qDeleteAll(d->fileCaches);
+    d->fileCaches.clear();
+    d->invalidCharacters.clear();
 }
 
 void AdvancedRenameManager::reset()
@@ -470,21 +663,28 @@ QString AdvancedRenameManager::newName(const QString& filename) const
 {
     // For the Linux or Windows file system,
     // we need to replace unsupported characters.
-    QStorageInfo info(QFileInfo(filename).path());
+    // The file system is checked once for each folder.
+    const QString path = QFileInfo(filename).path();
 
-    QString regExpStr = QLatin1String("[?*");
-    QString newName   = d->renamedFiles.value(filename, filename);
-    QString sysType   = QString::fromLatin1(info.fileSystemType()).toUpper();
-
-    if (sysType.contains(QLatin1String("FAT"))  ||
-        sysType.contains(QLatin1String("NTFS")) ||
-        sysType.contains(QLatin1String("FUSEBLK")))
+    if (!d->invalidCharacters.contains(path))
     {
-        regExpStr.append(QLatin1String("<>,+:=\";|\\\\/"));
+        QStorageInfo info(path);
+
+        QString regExpStr = QLatin1String("[?*");
+        QString sysType   = QString::fromLatin1(info.fileSystemType()).toUpper();
+
+        if (sysType.contains(QLatin1String("FAT"))  ||
+            sysType.contains(QLatin1String("NTFS")) ||
+            sysType.contains(QLatin1String("FUSEBLK")))
+        {
+            regExpStr.append(QLatin1String("<>,+:=\";|\\\\/"));
+        }
+
+        d->invalidCharacters.insert(path, QRegExp(regExpStr + QLatin1Char(']')));
     }
 
-    QRegExp regExp(regExpStr + QLatin1Char(']'));
-    newName.replace(regExp, QLatin1String("_"));
+    QString newName = d->renamedFiles.value(filename, filename);
+    newName.replace(d->invalidCharacters.value(path), QLatin1String("_"));
 
     return newName;
 }
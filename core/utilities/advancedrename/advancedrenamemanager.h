@@ -112,6 +112,8 @@ private:
     AdvancedRenameManager(const AdvancedRenameManager&);
     AdvancedRenameManager& operator=(const AdvancedRenameManager&);
 
+    void parseFiles(const QString& parseString, const ParseSettings& settings, bool useFileDates);
+
     void addFile(const QString& filename) const;
     void addFile(const QString& filename, const QDateTime& datetime) const;
     bool initialize();
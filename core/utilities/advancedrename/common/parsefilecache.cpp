@@ -0,0 +1,264 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : a cache of the file information read by the parser options
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "parsefilecache.h"
+
+// Qt includes
+
+#include <QFileInfo>
+#include <QHash>
+
+// Local includes
+
+#include "dmetadata.h"
+#include "coredbinfocontainers.h"
+
+namespace Digikam
+{
+
+class Q_DECL_HIDDEN ParseFileCache::Private
+{
+public:
+
+    explicit Private()
+      : infoLoaded(false),
+        dateLoaded(false),
+        cameraLoaded(false)
+    {
+    }
+
+    static QString findTag(const MetaEngine::MetaDataMap& tags, const QString& keyword)
+    {
+        for (MetaEngine::MetaDataMap::const_iterator it = tags.constBegin() ; it != tags.constEnd() ; ++it)
+        {
+            if (it.key().toLower().contains(keyword))
+            {
+                return it.value();
+            }
+        }
+
+        return QString();
+    }
+
+public:
+
+    QString                 filePath;
+
+    ItemInfo                info;
+    bool                    infoLoaded;
+
+    QDateTime               dateTime;
+    bool                    dateLoaded;
+
+    QString                 cameraName;
+    bool                    cameraLoaded;
+
+    /// The values of the metadata keywords, in lower case.
+    QHash<QString, QString> metadata;
+};
+
+ParseFileCache::ParseFileCache(const QString& filePath)
+    : d(new Private)
+{
+    d->filePath = filePath;
+}
+
+ParseFileCache::~ParseFileCache()
+{
+    delete d;
+}
+
+QString ParseFileCache::filePath() const
+{
+    return d->filePath;
+}
+
+ItemInfo ParseFileCache::itemInfo()
+{
+    if (!d->infoLoaded)
+    {
+        d->info       = ItemInfo::fromLocalFile(d->filePath);
+        d->infoLoaded = true;
+    }
+
+    return d->info;
+}
+
+QDateTime ParseFileCache::dateTime()
+{
+    if (!d->dateLoaded)
+    {
+        ItemInfo info = itemInfo();
+
+        if (!info.isNull())
+        {
+            d->dateTime = info.dateTime();
+        }
+
+        if (d->dateTime.isNull() || !d->dateTime.isValid())
+        {
+            // still no date info, use Qt file information
+            d->dateTime = QFileInfo(d->filePath).created();
+        }
+
+        d->dateLoaded = true;
+    }
+
+    return d->dateTime;
+}
+
+QString ParseFileCache::cameraName()
+{
+    prefetch(QStringList(), true);
+
+    return d->cameraName;
+}
+
+QString ParseFileCache::metadataValue(const QString& keyword)
+{
+    const QString key = keyword.toLower();
+
+    if (key.isEmpty())
+    {
+        return QString();
+    }
+
+    prefetch(QStringList() << key, false);
+
+    return d->metadata.value(key);
+}
+
+void ParseFileCache::prefetch(const QStringList& keywords, bool camera)
+{
+    if (camera && !d->cameraLoaded)
+    {
+        // The camera of the items of the collection is read from the database,
+        // where the metadata fields may have been loaded for all the files at once.
+
+        ItemInfo info = itemInfo();
+
+        if (!info.isNull())
+        {
+            ImageMetadataContainer container = info.imageMetadataContainer();
+            d->cameraName                    = container.make + QLatin1Char(' ') + container.model;
+            d->cameraLoaded                  = true;
+        }
+    }
+
+    const bool readCamera = (camera && !d->cameraLoaded);
+    bool readExif         = readCamera;
+    bool readIptc         = false;
+    bool readXmp          = false;
+    QStringList missing;
+
+    foreach (const QString& keyword, keywords)
+    {
+        const QString key = keyword.toLower();
+
+        if (key.isEmpty() || d->metadata.contains(key) || missing.contains(key))
+        {
+            continue;
+        }
+
+        missing << key;
+
+        readExif |= key.startsWith(QLatin1String("exif."));
+        readIptc |= key.startsWith(QLatin1String("iptc."));
+        readXmp  |= key.startsWith(QLatin1String("xmp."));
+    }
+
+    if (missing.isEmpty() && !readCamera)
+    {
+        return;
+    }
+
+    MetaEngine::MetaDataMap exifTags;
+    MetaEngine::MetaDataMap iptcTags;
+    MetaEngine::MetaDataMap xmpTags;
+    DMetadata meta(d->filePath);
+
+    if (!meta.isEmpty())
+    {
+        if (readExif)
+        {
+            exifTags = meta.getExifTagsDataList(QStringList(), true);
+        }
+
+        if (readIptc)
+        {
+            iptcTags = meta.getIptcTagsDataList(QStringList(), true);
+        }
+
+        if (readXmp)
+        {
+            xmpTags = meta.getXmpTagsDataList(QStringList(), true);
+        }
+    }
+
+    foreach (const QString& key, missing)
+    {
+        QString value;
+
+        if      (key.startsWith(QLatin1String("exif.")))
+        {
+            value = Private::findTag(exifTags, key);
+        }
+        else if (key.startsWith(QLatin1String("iptc.")))
+        {
+            value = Private::findTag(iptcTags, key);
+        }
+        else if (key.startsWith(QLatin1String("xmp.")))
+        {
+            value = Private::findTag(xmpTags, key);
+        }
+
+        d->metadata.insert(key, value);
+    }
+
+    if (readCamera)
+    {
+        // If the file is not in the collection, read the information from the Exif data
+
+        QString make;
+        QString model;
+
+        for (MetaEngine::MetaDataMap::const_iterator it = exifTags.constBegin() ; it != exifTags.constEnd() ; ++it)
+        {
+            const QString key = it.key().toLower();
+
+            if      (key.contains(QLatin1String("exif.image.model")))
+            {
+                model = it.value();
+            }
+            else if (key.contains(QLatin1String("exif.image.make")))
+            {
+                make = it.value();
+            }
+        }
+
+        d->cameraName   = make + QLatin1Char(' ') + model;
+        d->cameraLoaded = true;
+    }
+}
+
+} // namespace Digikam
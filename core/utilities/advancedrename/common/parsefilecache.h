@@ -0,0 +1,97 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : a cache of the file information read by the parser options
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_PARSE_FILE_CACHE_H
+#define DIGIKAM_PARSE_FILE_CACHE_H
+
+// Qt includes
+
+#include <QDateTime>
+#include <QString>
+#include <QStringList>
+
+// Local includes
+
+#include "iteminfo.h"
+
+namespace Digikam
+{
+
+/**
+ * The information of a file used by the parser options. Each value is read once, from the
+ * database when the file is in the collection or from the metadata of the file otherwise,
+ * and is kept for the next parsings, while the user edits the parse string.
+ *
+ * An instance is used by one thread at a time, the instances of different files can be used
+ * by different threads.
+ */
+class ParseFileCache
+{
+public:
+
+    explicit ParseFileCache(const QString& filePath);
+    ~ParseFileCache();
+
+    QString   filePath() const;
+
+    /**
+     * The item of the file in the collection, or a null ItemInfo.
+     */
+    ItemInfo  itemInfo();
+
+    /**
+     * The creation date from the database, or from the file system.
+     */
+    QDateTime dateTime();
+
+    /**
+     * The make and model of the camera from the database, or from the Exif metadata.
+     */
+    QString   cameraName();
+
+    /**
+     * The value of the first Exif, IPTC or XMP tag which contains keyword, as "exif.image.model".
+     */
+    QString   metadataValue(const QString& keyword);
+
+    /**
+     * Read the values of the metadata keywords, and the camera name if camera is true,
+     * which are not cached yet, with a single read of the metadata of the file.
+     */
+    void      prefetch(const QStringList& keywords, bool camera);
+
+private:
+
+    // Disable
+    ParseFileCache(const ParseFileCache&);
+    ParseFileCache& operator=(const ParseFileCache&);
+
+private:
+
+    class Private;
+    Private* const d;
+};
+
+} // namespace Digikam
+
+#endif // DIGIKAM_PARSE_FILE_CACHE_H
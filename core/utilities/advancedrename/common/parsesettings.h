@@ -39,6 +39,8 @@
 namespace Digikam
 {
 
+class ParseFileCache;
+
 class ParseSettings
 {
 public:
@@ -89,6 +91,9 @@ public:
     bool                     useOriginalFileExtension;
     AdvancedRenameManager*   manager;
 
+    /// The information of the file read by the options, if it is cached.
+    ParseFileCache*          fileCache;
+
 private:
 
     void init()
@@ -96,6 +101,7 @@ private:
         startIndex               = 1;
         useOriginalFileExtension = true;
         manager                  = nullptr;
+        fileCache                = nullptr;
         str2Modify.clear();
     }
 
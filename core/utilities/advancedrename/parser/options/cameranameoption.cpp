@@ -30,7 +30,7 @@
 // Local includes
 
 #include "parser.h"
-#include "dmetadata.h"
+#include "parsefilecache.h"
 
 namespace Digikam
 {
@@ -50,44 +50,10 @@ CameraNameOption::CameraNameOption()
 
 QString CameraNameOption::parseOperation(ParseSettings& settings)
 {
-    QString result;
+    ParseFileCache localCache(settings.fileUrl.toLocalFile());
+    ParseFileCache* const cache = settings.fileCache ? settings.fileCache : &localCache;
 
-    ItemInfo info = ItemInfo::fromUrl(settings.fileUrl);
-
-    if (!info.isNull())
-    {
-        result = info.photoInfoContainer().make + QLatin1Char(' ') + info.photoInfoContainer().model;
-    }
-    else
-    {
-        // If ItemInfo is not available, read the information from the EXIF data
-        QString make;
-        QString model;
-
-        DMetadata meta(settings.fileUrl.toLocalFile());
-
-        if (!meta.isEmpty())
-        {
-            MetaEngine::MetaDataMap dataMap;
-            dataMap = meta.getExifTagsDataList(QStringList(), true);
-
-            foreach(const QString& key, dataMap.keys())
-            {
-                if (key.toLower().contains(QLatin1String("exif.image.model")))
-                {
-                    model = dataMap[key];
-                }
-                else if (key.toLower().contains(QLatin1String("exif.image.make")))
-                {
-                    make = dataMap[key];
-                }
-            }
-        }
-
-        result = make + QLatin1Char(' ') + model;
-    }
-
-    return result.simplified();
+    return cache->cameraName().simplified();
 }
 
 } // namespace Digikam
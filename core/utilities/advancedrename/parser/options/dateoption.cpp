@@ -37,6 +37,7 @@
 // Local includes
 
 #include "digikam_debug.h"
+#include "parsefilecache.h"
 #include "ui_dateoptiondialogwidget.h"
 
 namespace Digikam
@@ -280,22 +281,14 @@ QString DateOption::parseOperation(ParseSettings& settings)
     {
         dateTime = settings.creationTime;
     }
+    else if (settings.fileCache)
+    {
+        dateTime = settings.fileCache->dateTime();
+    }
     else
     {
         // lets try to re-read the file information
-        ItemInfo info = ItemInfo::fromUrl(settings.fileUrl);
-
-        if (!info.isNull())
-        {
-            dateTime = info.dateTime();
-        }
-
-        if (dateTime.isNull() || !dateTime.isValid())
-        {
-            // still no date info, use Qt file information
-            QFileInfo fileInfo(settings.fileUrl.toLocalFile());
-            dateTime = fileInfo.created();
-        }
+        dateTime = ParseFileCache(settings.fileUrl.toLocalFile()).dateTime();
     }
 
     // do we have a valid date?
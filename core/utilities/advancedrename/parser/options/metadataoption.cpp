@@ -38,13 +38,23 @@
 
 // Local includes
 
-#include "dmetadata.h"
 #include "metadatapanel.h"
 #include "metadataselector.h"
+#include "parsefilecache.h"
 
 namespace Digikam
 {
 
+static QRegExp metadataRegExp()
+{
+    QRegExp reg(QLatin1String("\\[meta(:(.*))\\]"));
+    reg.setMinimal(true);
+
+    return reg;
+}
+
+// --------------------------------------------------------
+
 MetadataOptionDialog::MetadataOptionDialog(Rule* const parent)
     : RuleDialog(parent),
       metadataPanel(nullptr),
@@ -111,9 +121,22 @@ MetadataOption::MetadataOption()
 
     addToken(QLatin1String("[meta:||key||]"), description());
 
-    QRegExp reg(QLatin1String("\\[meta(:(.*))\\]"));
-    reg.setMinimal(true);
-    setRegExp(reg);
+    setRegExp(metadataRegExp());
+}
+
+QStringList MetadataOption::keywords(const QString& parseString)
+{
+    QStringList list;
+    QRegExp reg = metadataRegExp();
+    int pos     = 0;
+
+    while ((pos = reg.indexIn(parseString, pos)) != -1)
+    {
+        list << reg.cap(2).toLower();
+        pos  += reg.matchedLength();
+    }
+
+    return list;
 }
 
 void MetadataOption::slotTokenTriggered(const QString& token)
@@ -167,33 +190,13 @@ QString MetadataOption::parseMetadata(const QString& token, ParseSettings& setti
         return result;
     }
 
-    DMetadata meta(settings.fileUrl.toLocalFile());
-
-    if (!meta.isEmpty())
+    if (settings.fileCache)
     {
-        MetaEngine::MetaDataMap dataMap;
-
-        if (keyword.startsWith(QLatin1String("exif.")))
-        {
-            dataMap = meta.getExifTagsDataList(QStringList(), true);
-        }
-        else if (keyword.startsWith(QLatin1String("iptc.")))
-        {
-            dataMap = meta.getIptcTagsDataList(QStringList(), true);
-        }
-        else if (keyword.startsWith(QLatin1String("xmp.")))
-        {
-            dataMap = meta.getXmpTagsDataList(QStringList(), true);
-        }
-
-        foreach(const QString& key, dataMap.keys())
-        {
-            if (key.toLower().contains(keyword))
-            {
-                result = dataMap[key];
-                break;
-            }
-        }
+        result = settings.fileCache->metadataValue(keyword);
+    }
+    else
+    {
+        result = ParseFileCache(settings.fileUrl.toLocalFile()).metadataValue(keyword);
     }
 
     result.replace(QLatin1Char('/'), QLatin1Char('|'));
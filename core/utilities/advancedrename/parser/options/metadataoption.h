@@ -27,6 +27,7 @@
 // Qt includes
 
 #include <QString>
+#include <QStringList>
 
 // Local includes
 
@@ -71,6 +72,11 @@ public:
     explicit MetadataOption();
     ~MetadataOption() {};
 
+    /**
+     * The metadata keywords used in a parse string, to read them at once for each file.
+     */
+    static QStringList keywords(const QString& parseString);
+
 protected:
 
     virtual QString parseOperation(ParseSettings& settings);
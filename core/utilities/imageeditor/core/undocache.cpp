@@ -28,14 +28,23 @@
 // Qt includes
 
 #include <QApplication>
-#include <QDataStream>
+#include <QCryptographicHash>
 #include <QDir>
 #include <QFile>
 #include <QFileInfo>
+#include <QFuture>
+#include <QHash>
+#include <QMap>
+#include <QRect>
+#include <QSharedPointer>
 #include <QStringList>
 #include <QStandardPaths>
 #include <QStorageInfo>
 #include <QMessageBox>
+#include <QThreadPool>
+#include <QVector>
+#include <QWeakPointer>
+#include <QtConcurrent>    // krazy:exclude=includes
 
 // KDE includes
 
@@ -48,25 +57,522 @@
 namespace Digikam
 {
 
+/**
+ * The size in pixels of the tiles, small enough for a local change to touch few tiles.
+ */
+static const int undoTileSize = 256;
+
 class Q_DECL_HIDDEN UndoCache::Private
 {
+public:
+
+    /**
+     * A compressed tile, in memory, or in the cache file at offset if data is empty.
+     */
+    class Tile
+    {
+    public:
+
+        explicit Tile()
+          : offset(-1),
+            size(0),
+            rawSize(0)
+        {
+        }
+
+        QByteArray data;
+        qint64     offset;
+        int        size;
+        int        rawSize;
+    };
+
+    typedef QSharedPointer<Tile> TilePtr;
+
+    class Level
+    {
+    public:
+
+        explicit Level()
+          : width(0),
+            height(0),
+            sixteenBit(false),
+            hasAlpha(false)
+        {
+        }
+
+        uint             width;
+        uint             height;
+        bool             sixteenBit;
+        bool             hasAlpha;
+        QVector<TilePtr> tiles;
+    };
+
+    /**
+     * A tile made while storing an image, with the key identifying its content.
+     * A tile found in the cache file is compared with the delta encoded data in raw
+     * by the main thread, which only reads the file.
+     */
+    class NewTile
+    {
+    public:
+
+        explicit NewTile()
+          : shared(false)
+        {
+        }
+
+        TilePtr    tile;
+        QByteArray key;
+        QByteArray raw;
+        bool       shared;
+    };
+
+    /**
+     * A tile moved to the cache file. Its size is kept to free its space when it is gone.
+     */
+    class DiskTile
+    {
+    public:
+
+        explicit DiskTile()
+          : size(0)
+        {
+        }
+
+        int                size;
+        QWeakPointer<Tile> tile;
+    };
+
 public:
 
     explicit Private()
+      : cacheError(false),
+        memoryLimit(512 * 1024 * 1024),
+        memoryUsed(0),
+        diskUsed(0)
+    {
+    }
+
+    int tileCount(const Level& level) const
+    {
+        return ((level.width + undoTileSize - 1) / undoTileSize) * ((level.height + undoTileSize - 1) / undoTileSize);
+    }
+
+    QRect tileRect(const Level& level, int index) const
+    {
+        const int columns = (level.width + undoTileSize - 1) / undoTileSize;
+        const int x       = (index % columns) * undoTileSize;
+        const int y       = (index / columns) * undoTileSize;
+
+        return QRect(x, y, qMin(undoTileSize, (int)level.width - x), qMin(undoTileSize, (int)level.height - y));
+    }
+
+    /**
+     * Copy the tile pixels of the image in a contiguous buffer, and compute the key of its content.
+     * Identical tiles of any level have the same key.
+     */
+    QByteArray extractTile(const DImg& img, const QRect& rect, QByteArray* const key) const
+    {
+        const int bytesDepth = img.bytesDepth();
+        const int rowBytes   = rect.width() * bytesDepth;
+        QByteArray raw(rowBytes * rect.height(), Qt::Uninitialized);
+        char* dst            = raw.data();
+
+        for (int y = rect.top() ; y <= rect.bottom() ; ++y)
+        {
+            memcpy(dst, img.scanLine(y) + rect.left() * bytesDepth, rowBytes);
+            dst += rowBytes;
+        }
+
+        *key  = QCryptographicHash::hash(raw, QCryptographicHash::Md5);
+        *key += QByteArray::number(rect.width())  + 'x' +
+                QByteArray::number(rect.height()) + 'x' +
+                QByteArray::number(bytesDepth);
+
+        return raw;
+    }
+
+    /**
+     * Replace each byte by its difference with the same byte of the previous pixel, which
+     * turns the smooth areas of photos in runs of small values compressing much better.
+     */
+    static void deltaEncode(QByteArray& raw, int rowBytes, int bytesDepth)
+    {
+        uchar* const data = reinterpret_cast<uchar*>(raw.data());
+
+        for (int row = 0 ; row < raw.size() ; row += rowBytes)
+        {
+            uchar* const line = data + row;
+
+            for (int i = rowBytes - 1 ; i >= bytesDepth ; --i)
+            {
+                line[i] -= line[i - bytesDepth];
+            }
+        }
+    }
+
+    static void deltaDecode(QByteArray& raw, int rowBytes, int bytesDepth)
     {
-        cacheError = false;
+        uchar* const data = reinterpret_cast<uchar*>(raw.data());
+
+        for (int row = 0 ; row < raw.size() ; row += rowBytes)
+        {
+            uchar* const line = data + row;
+
+            for (int i = bytesDepth ; i < rowBytes ; ++i)
+            {
+                line[i] += line[i - bytesDepth];
+            }
+        }
+    }
+
+    /**
+     * Return true if the compressed tile holds the delta encoded data raw.
+     */
+    static bool hasContent(const Tile& tile, const QByteArray& compressed, const QByteArray& raw)
+    {
+        return ((tile.rawSize == raw.size()) && (qUncompress(compressed) == raw));
+    }
+
+    /**
+     * Share the tiles from start to stop with identical tiles already cached, or compress them.
+     * The pool is only read here, and it is not changed while the threads run. The key is
+     * only a hint: the content of the tiles in memory is compared here, the one of the tiles
+     * in the cache file is compared by the main thread.
+     */
+    void putTilesMultithreaded(const DImg* const img, const Level* const level,
+                               QVector<NewTile>* const newTiles, int start, int stop) const
+    {
+        for (int i = start ; i < stop ; ++i)
+        {
+            const QRect rect = tileRect(*level, i);
+            NewTile& newTile = (*newTiles)[i];
+            QByteArray raw   = extractTile(*img, rect, &newTile.key);
+            TilePtr tile     = pool.value(newTile.key).toStrongRef();
+
+            deltaEncode(raw, rect.width() * img->bytesDepth(), img->bytesDepth());
+
+            if (!tile.isNull())
+            {
+                if (tile->offset >= 0)
+                {
+                    newTile.tile   = tile;
+                    newTile.raw    = raw;
+                    newTile.shared = true;
+
+                    continue;
+                }
+
+                if (hasContent(*tile, tile->data, raw))
+                {
+                    newTile.tile   = tile;
+                    newTile.shared = true;
+
+                    continue;
+                }
+            }
+
+            newTile.tile = compressTile(raw);
+        }
+    }
+
+    static TilePtr compressTile(const QByteArray& raw)
+    {
+        TilePtr tile(new Tile);
+        tile->rawSize = raw.size();
+        tile->data    = qCompress(raw, 1);
+        tile->size    = tile->data.size();
+
+        return tile;
+    }
+
+    /**
+     * Return the compressed data of the tile, read from the cache file if it was moved there.
+     */
+    bool readTile(const Tile& tile, QByteArray* const data)
+    {
+        if (tile.offset < 0)
+        {
+            *data = tile.data;
+
+            return true;
+        }
+
+        if (!cacheFile.seek(tile.offset) || ((*data = cacheFile.read(tile.size)).size() != tile.size))
+        {
+            qCWarning(DIGIKAM_GENERAL_LOG) << "Cannot read the undo cache file" << cacheFile.fileName();
+
+            return false;
+        }
+
+        return true;
     }
 
-    QString cacheFile(int level) const
+    /**
+     * Decompress the tiles from start to stop in the image. The tiles moved to disk
+     * have been read before in data.
+     */
+    void getTilesMultithreaded(DImg* const img, const Level* const level,
+                               const QVector<QByteArray>* const data, int start, int stop) const
     {
-        return QString::fromUtf8("%1-%2.bin").arg(cachePrefix).arg(level);
+        const int bytesDepth = img->bytesDepth();
+
+        for (int i = start ; i < stop ; ++i)
+        {
+            const QRect rect = tileRect(*level, i);
+            const int rowBytes = rect.width() * bytesDepth;
+            QByteArray raw     = qUncompress(data->at(i));
+
+            if (raw.size() != rowBytes * rect.height())
+            {
+                qCWarning(DIGIKAM_GENERAL_LOG) << "The undo cache tile" << i << "is corrupt";
+                continue;
+            }
+
+            deltaDecode(raw, rowBytes, bytesDepth);
+
+            const char* src = raw.constData();
+
+            for (int y = rect.top() ; y <= rect.bottom() ; ++y)
+            {
+                memcpy(img->scanLine(y) + rect.left() * bytesDepth, src, rowBytes);
+                src += rowBytes;
+            }
+        }
     }
 
-    QString   cacheDir;
-    QString   cachePrefix;
-    QSet<int> cachedLevels;
+    /**
+     * Forget the tiles which are not used anymore by any level, and update the memory usage.
+     */
+    void pruneTiles()
+    {
+        for (QHash<QByteArray, QWeakPointer<Tile> >::iterator it = pool.begin() ; it != pool.end() ; )
+        {
+            if (it.value().isNull())
+            {
+                it = pool.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        memoryUsed = 0;
 
-    bool      cacheError;
+        for (QList<QWeakPointer<Tile> >::iterator it = memoryTiles.begin() ; it != memoryTiles.end() ; )
+        {
+            TilePtr tile = it->toStrongRef();
+
+            if (tile.isNull())
+            {
+                it = memoryTiles.erase(it);
+            }
+            else
+            {
+                memoryUsed += tile->size;
+                ++it;
+            }
+        }
+
+        if (levels.isEmpty())
+        {
+            // All tiles are gone, the cache file can be removed.
+
+            cacheFile.close();
+            cacheFile.remove();
+            diskTiles.clear();
+            freeExtents.clear();
+            diskUsed = 0;
+
+            return;
+        }
+
+        for (QMap<qint64, DiskTile>::iterator it = diskTiles.begin() ; it != diskTiles.end() ; )
+        {
+            if (it.value().tile.isNull())
+            {
+                releaseExtent(it.key(), it.value().size);
+                diskUsed -= it.value().size;
+                it        = diskTiles.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    /**
+     * Make the space at offset in the cache file free, merged with the free space around.
+     * The free space at the end of the file is truncated.
+     */
+    void releaseExtent(qint64 offset, qint64 size)
+    {
+        QMap<qint64, qint64>::iterator next = freeExtents.lowerBound(offset);
+
+        if (next != freeExtents.begin())
+        {
+            QMap<qint64, qint64>::iterator previous = next;
+            --previous;
+
+            if ((previous.key() + previous.value()) == offset)
+            {
+                offset = previous.key();
+                size  += previous.value();
+                freeExtents.erase(previous);
+            }
+        }
+
+        if ((next != freeExtents.end()) && ((offset + size) == next.key()))
+        {
+            size += next.value();
+            freeExtents.erase(next);
+        }
+
+        if ((offset + size) >= cacheFile.size())
+        {
+            cacheFile.resize(offset);
+        }
+        else
+        {
+            freeExtents.insert(offset, size);
+        }
+    }
+
+    /**
+     * Return the offset where to write size bytes in the cache file: the first free
+     * space large enough, or the end of the file.
+     */
+    qint64 allocateExtent(qint64 size)
+    {
+        for (QMap<qint64, qint64>::iterator it = freeExtents.begin() ; it != freeExtents.end() ; ++it)
+        {
+            if (it.value() >= size)
+            {
+                const qint64 offset = it.key();
+                const qint64 rest   = it.value() - size;
+                freeExtents.erase(it);
+
+                if (rest > 0)
+                {
+                    freeExtents.insert(offset + size, rest);
+                }
+
+                return offset;
+            }
+        }
+
+        return cacheFile.size();
+    }
+
+    /**
+     * Move the oldest tiles to the cache file until the memory limit is respected.
+     */
+    bool spillTiles()
+    {
+        if ((memoryUsed <= memoryLimit) || cacheError)
+        {
+            return !cacheError;
+        }
+
+        QStorageInfo info(cacheDir);
+
+        qint64 fspace = (info.bytesAvailable() / 1024 / 1024);
+        qCDebug(DIGIKAM_GENERAL_LOG) << "Free space available in Editor cache [" << cacheDir << "] in Mbytes:" << fspace;
+
+        if (fspace < 2048) // Check if free space is over 2 GiB to put data in cache.
+        {
+            cacheError = true;
+
+            if (!qApp->activeWindow()) // Special case for the Jenkins build server.
+            {
+                return false;
+            }
+
+            QApplication::restoreOverrideCursor();
+
+            QMessageBox::critical(qApp->activeWindow(), qApp->applicationName(),
+                                  i18n("The free disk space in the path \"%1\" for the undo "
+                                       "cache file is < 2 GiB! Undo cache is now disabled!",
+                                       QDir::toNativeSeparators(cacheDir)));
+
+            return false;
+        }
+
+        if (!cacheFile.isOpen())
+        {
+            cacheFile.setFileName(QString::fromUtf8("%1.bin").arg(cachePrefix));
+
+            if (!cacheFile.open(QIODevice::ReadWrite | QIODevice::Truncate))
+            {
+                qCWarning(DIGIKAM_GENERAL_LOG) << "Cannot open the undo cache file" << cacheFile.fileName();
+                cacheError = true;
+
+                return false;
+            }
+        }
+
+        // The tiles are written in the space freed by the tiles removed, see pruneTiles().
+
+        while ((memoryUsed > memoryLimit) && !memoryTiles.isEmpty())
+        {
+            TilePtr tile = memoryTiles.takeFirst().toStrongRef();
+
+            if (tile.isNull())
+            {
+                continue;
+            }
+
+            const qint64 offset = allocateExtent(tile->size);
+
+            if (!cacheFile.seek(offset) || (cacheFile.write(tile->data) != tile->size))
+            {
+                qCWarning(DIGIKAM_GENERAL_LOG) << "Cannot write the undo cache file" << cacheFile.fileName();
+                memoryTiles.prepend(tile);
+                cacheError = true;
+
+                return false;
+            }
+
+            DiskTile diskTile;
+            diskTile.size = tile->size;
+            diskTile.tile = tile;
+            diskTiles.insert(offset, diskTile);
+
+            tile->offset  = offset;
+            tile->data.clear();
+            memoryUsed   -= tile->size;
+            diskUsed     += tile->size;
+        }
+
+        return true;
+    }
+
+public:
+
+    QString                                cacheDir;
+    QString                                cachePrefix;
+    QFile                                  cacheFile;
+
+    QMap<int, Level>                       levels;
+
+    /// All tiles cached, by content
+    QHash<QByteArray, QWeakPointer<Tile> > pool;
+
+    /// The tiles kept in memory, oldest first
+    QList<QWeakPointer<Tile> >             memoryTiles;
+
+    /// The tiles moved to the cache file, by offset
+    QMap<qint64, DiskTile>                 diskTiles;
+
+    /// The free space of the cache file: the size by offset
+    QMap<qint64, qint64>                   freeExtents;
+
+    bool                                   cacheError;
+    qint64                                 memoryLimit;
+    qint64                                 memoryUsed;
+    qint64                                 diskUsed;
 };
 
 UndoCache::UndoCache()
@@ -80,6 +586,7 @@ UndoCache::UndoCache()
 
     // remove any remnants
     QDir dir(d->cacheDir);
+    dir.mkpath(d->cacheDir);
 
     foreach(const QFileInfo& info, dir.entryInfoList(QStringList() << QLatin1String("undocache-*")))
     {
@@ -95,139 +602,182 @@ UndoCache::~UndoCache()
 
 void UndoCache::clear()
 {
-    foreach (int level, d->cachedLevels)
-    {
-        QFile(d->cacheFile(level)).remove();
-    }
-
-    d->cachedLevels.clear();
+    d->levels.clear();
+    d->pruneTiles();
 }
 
 void UndoCache::clearFrom(int fromLevel)
 {
-    foreach (int level, d->cachedLevels)
+    while (!d->levels.isEmpty() && (d->levels.lastKey() >= fromLevel))
     {
-        if (level >= fromLevel)
-        {
-            QFile(d->cacheFile(level)).remove();
-            d->cachedLevels.remove(level);
-        }
+        d->levels.remove(d->levels.lastKey());
     }
+
+    d->pruneTiles();
 }
 
 bool UndoCache::putData(int level, const DImg& img) const
 {
-    if (d->cacheError)
+    if (d->cacheError || img.isNull() || d->levels.contains(level))
     {
         return false;
     }
 
-    QStorageInfo info(d->cacheDir);
+    Private::Level data;
+    data.width      = img.width();
+    data.height     = img.height();
+    data.sixteenBit = img.sixteenBit();
+    data.hasAlpha   = img.hasAlpha();
 
-    qint64 fspace = (info.bytesAvailable() / 1024 / 1024);
-    qCDebug(DIGIKAM_GENERAL_LOG) << "Free space available in Editor cache [" << d->cacheDir << "] in Mbytes:" << fspace;
+    const int count = d->tileCount(data);
+    QVector<Private::NewTile> newTiles(count);
 
-    if (fspace < 2048) // Check if free space is over 2 GiB to put data in cache.
-    {
-        if (!qApp->activeWindow()) // Special case for the Jenkins build server.
-        {
-            return false;
-        }
+    const int nbCore = qBound(1, QThreadPool::globalInstance()->maxThreadCount(), count);
+    const int step   = count / nbCore;
+    QList <QFuture<void> > tasks;
 
-        QApplication::restoreOverrideCursor();
+    for (int j = 0 ; j < nbCore ; ++j)
+    {
+        tasks.append(QtConcurrent::run(d,
+                                       &UndoCache::Private::putTilesMultithreaded,
+                                       &img,
+                                       &data,
+                                       &newTiles,
+                                       j * step,
+                                       (j == nbCore - 1) ? count : (j + 1) * step
+                                      ));
+    }
 
-        QMessageBox::critical(qApp->activeWindow(), qApp->applicationName(),
-                              i18n("The free disk space in the path \"%1\" for the undo "
-                                   "cache file is < 2 GiB! Undo cache is now disabled!",
-                                   QDir::toNativeSeparators(d->cacheDir)));
-        d->cacheError = true;
+    foreach(QFuture<void> t, tasks)
+        t.waitForFinished();
 
-        return false;
-    }
+    // Register the new tiles. Identical tiles of the image compressed by different
+    // threads are shared with the first one. A tile with the key of another content
+    // is kept out of the pool.
 
-    QFile file(d->cacheFile(level));
+    qint64 stored = 0;
+    data.tiles.reserve(count);
 
-    if (file.exists() || !file.open(QIODevice::WriteOnly))
+    for (int i = 0 ; i < count ; ++i)
     {
-        return false;
-    }
+        Private::NewTile& newTile = newTiles[i];
 
-    QDataStream ds(&file);
-    ds << img.width();
-    ds << img.height();
-    ds << img.numBytes();
-    ds << img.hasAlpha();
-    ds << img.sixteenBit();
+        if (!newTile.raw.isNull())
+        {
+            QByteArray compressed;
 
-    file.write((const char*)img.bits(), img.numBytes());
+            if (!d->readTile(*newTile.tile, &compressed))
+            {
+                return false;
+            }
 
-    if (file.error() != QFileDevice::NoError)
-    {
-        file.close();
-        file.remove();
+            if (!Private::hasContent(*newTile.tile, compressed, newTile.raw))
+            {
+                newTile.tile   = Private::compressTile(newTile.raw);
+                newTile.shared = false;
+            }
 
-        return false;
+            newTile.raw.clear();
+        }
+
+        if (!newTile.shared)
+        {
+            Private::TilePtr tile = d->pool.value(newTile.key).toStrongRef();
+
+            if (!tile.isNull() && (tile->offset < 0) && (tile->data == newTile.tile->data))
+            {
+                newTile.tile = tile;
+            }
+            else
+            {
+                if (tile.isNull())
+                {
+                    d->pool.insert(newTile.key, newTile.tile);
+                }
+
+                d->memoryTiles << newTile.tile;
+                d->memoryUsed += newTile.tile->size;
+                stored        += newTile.tile->size;
+            }
+        }
+
+        data.tiles << newTile.tile;
     }
 
-    d->cachedLevels << level;
+    d->levels.insert(level, data);
 
-    file.close();
+    qCDebug(DIGIKAM_GENERAL_LOG) << "Undo level" << level << "stored with" << stored
+                                 << "new bytes for" << img.numBytes() << "bytes of image data";
+
+    d->spillTiles();
 
     return true;
 }
 
 DImg UndoCache::getData(int level) const
 {
-    uint w          = 0;
-    uint h          = 0;
-    uint numBytes   = 0;
-    bool hasAlpha   = false;
-    bool sixteenBit = false;
-
-    QFile file(d->cacheFile(level));
-
-    if (!file.open(QIODevice::ReadOnly))
+    if (!d->levels.contains(level))
     {
         return DImg();
     }
 
-    QDataStream ds(&file);
-    ds >> w;
-    ds >> h;
-    ds >> numBytes;
-    ds >> hasAlpha;
-    ds >> sixteenBit;
+    const Private::Level& data = d->levels[level];
+    const int count            = data.tiles.count();
+    DImg img(data.width, data.height, data.sixteenBit, data.hasAlpha);
 
-    if (ds.status() != QDataStream::Ok || ds.atEnd())
+    if (img.isNull() || (count != d->tileCount(data)))
     {
-        qCDebug(DIGIKAM_GENERAL_LOG) << "The undo cache file is corrupt";
-
-        file.close();
-
         return DImg();
     }
 
-    DImg img(w, h, sixteenBit, hasAlpha);
+    // Read the tiles moved to disk first, the decompression is done in parallel.
 
-    if (img.isNull() || numBytes != img.numBytes())
-    {
-        file.close();
+    QVector<QByteArray> compressed(count);
 
-        return DImg();
+    for (int i = 0 ; i < count ; ++i)
+    {
+        if (!d->readTile(*data.tiles.at(i), &compressed[i]))
+        {
+            return DImg();
+        }
     }
 
-    qint64 readBytes = file.read((char*)img.bits(), numBytes);
+    const int nbCore = qBound(1, QThreadPool::globalInstance()->maxThreadCount(), count);
+    const int step   = count / nbCore;
+    QList <QFuture<void> > tasks;
 
-    if (file.error() != QFileDevice::NoError || readBytes != numBytes)
+    for (int j = 0 ; j < nbCore ; ++j)
     {
-        file.close();
-
-        return DImg();
+        tasks.append(QtConcurrent::run(d,
+                                       &UndoCache::Private::getTilesMultithreaded,
+                                       &img,
+                                       &data,
+                                       &compressed,
+                                       j * step,
+                                       (j == nbCore - 1) ? count : (j + 1) * step
+                                      ));
     }
 
-    file.close();
+    foreach(QFuture<void> t, tasks)
+        t.waitForFinished();
 
     return img;
 }
 
+void UndoCache::setMemoryLimit(qint64 bytes)
+{
+    d->memoryLimit = bytes;
+    d->spillTiles();
+}
+
+qint64 UndoCache::memoryUsage() const
+{
+    return d->memoryUsed;
+}
+
+qint64 UndoCache::diskUsage() const
+{
+    return d->diskUsed;
+}
+
 } // namespace Digikam
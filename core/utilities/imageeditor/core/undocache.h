@@ -34,6 +34,14 @@
 namespace Digikam
 {
 
+/**
+ * Store the snapshots of the image editor undo levels.
+ *
+ * The images are split in tiles, which are compressed and shared between levels:
+ * a tile identical to a tile already cached costs nothing, so a level made after a local
+ * change only stores the changed tiles. The compressed tiles are kept in memory until the
+ * memory limit is reached, and the oldest ones are then moved to a file in the cache directory.
+ */
 class DIGIKAM_EXPORT UndoCache
 {
 
@@ -53,15 +61,27 @@ public:
     void clearFrom(int level);
 
     /**
-     * Write the image data into a cache file
+     * Store the image data of a level. Return false if the level is already stored,
+     * or if the cache is disabled.
      */
     bool putData(int level, const DImg& img) const;
 
     /**
-     * Get the image data from a cache file
+     * Get the image data of a level, or a null image if the level is not stored.
      */
     DImg getData(int level) const;
 
+    /**
+     * Set the size in bytes of the compressed tiles kept in memory before they are moved to disk.
+     */
+    void setMemoryLimit(qint64 bytes);
+
+    /**
+     * Return the size in bytes of the compressed tiles kept in memory, and moved to disk.
+     */
+    qint64 memoryUsage() const;
+    qint64 diskUsage()   const;
+
 private:
 
     UndoCache(const UndoCache&); // Disable
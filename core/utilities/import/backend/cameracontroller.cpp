@@ -39,6 +39,10 @@
 #include <QDir>
 #include <QMessageBox>
 #include <QProcess>
+#include <QThreadPool>
+#include <QSemaphore>
+#include <QAtomicInt>
+#include <QtConcurrent>
 
 // KDE includes
 
@@ -55,6 +59,7 @@
 #include "umscamera.h"
 #include "jpegutils.h"
 #include "dfileoperations.h"
+#include "collectionscanner.h"
 
 namespace Digikam
 {
@@ -87,6 +92,11 @@ public:
     QMap<QString, QVariant> map;
 };
 
+/**
+ * The number of files read at the same time from a camera supporting parallel downloads.
+ */
+static const int maxParallelReads = 4;
+
 class Q_DECL_HIDDEN CameraController::Private
 {
 public:
@@ -98,12 +108,17 @@ public:
         conflictRule(SetupCamera::DIFFNAME),
         parent(nullptr),
         timer(nullptr),
-        camera(nullptr)
+        camera(nullptr),
+        pipelineSize(qMax(2, QThread::idealThreadCount()) * 2),
+        readers(maxParallelReads),
+        pending(pipelineSize),
+        tempIndex(0)
     {
+        pipeline.setMaxThreadCount(qMax(qMax(2, QThread::idealThreadCount()), maxParallelReads));
     }
 
     bool                      close;
-    bool                      canceled;
+    QAtomicInt                canceled;
     bool                      running;
 
     SetupCamera::ConflictRule conflictRule;
@@ -121,6 +136,21 @@ public:
 
     QList<CameraCommand*>     cmdThumbs;
     QList<CameraCommand*>     commands;
+
+    /// The threads of the download pipeline.
+    QThreadPool               pipeline;
+
+    /// Limits the concurrent reads, and the items waiting in the pipeline as temporary files.
+    const int                 pipelineSize;
+    QSemaphore                readers;
+    QSemaphore                pending;
+
+    /// Keeps apart the temporary files of the items processed at the same time.
+    QAtomicInt                tempIndex;
+
+    /// The metadata parsed from the items handed to the main thread, by temporary file index.
+    QMap<int, DMetadata>      parsedMetadata;
+    QMutex                    metadataMutex;
 };
 
 CameraController::CameraController(QWidget* const parent,
@@ -177,10 +207,6 @@ CameraController::CameraController(QWidget* const parent,
     qRegisterMetaType<CamItemInfo>("CamItemInfo");
     qRegisterMetaType<CamItemInfoList>("CamItemInfoList");
 
-    connect(this, SIGNAL(signalInternalCheckRename(QString,QString,QString,QString,QString)),
-            this, SLOT(slotCheckRename(QString,QString,QString,QString,QString)),
-            Qt::BlockingQueuedConnection);
-
     connect(this, SIGNAL(signalInternalDownloadFailed(QString,QString)),
             this, SLOT(slotDownloadFailed(QString,QString)),
             Qt::BlockingQueuedConnection);
@@ -213,6 +239,12 @@ CameraController::~CameraController()
     }
     wait();
 
+    d->pipeline.waitForDone();
+
+    // The items handed to the main thread are canceled and remove their temporary file.
+
+    QCoreApplication::sendPostedEvents(this, QEvent::MetaCall);
+
     delete d->camera;
     delete d;
 }
@@ -371,6 +403,7 @@ void CameraController::run()
     while (d->running)
     {
         CameraCommand* command = nullptr;
+        bool idle              = false;
 
         {
             QMutexLocker lock(&d->mutex);
@@ -386,15 +419,37 @@ void CameraController::run()
                 emit signalBusy(false);
             }
             else
+            {
+                idle = true;
+            }
+        }
+
+        if (idle)
+        {
+            // The downloads still processed in the pipeline must be done before to be idle.
+            // Do not wait with the mutex locked, the main thread moves the downloaded items.
+
+            waitForPipeline();
+
+            QMutexLocker lock(&d->mutex);
+
+            if (d->running && d->commands.isEmpty() && d->cmdThumbs.isEmpty())
             {
                 emit signalBusy(false);
                 d->condVar.wait(&d->mutex);
-                continue;
             }
+
+            continue;
         }
 
         if (command)
         {
+            if (command->action != CameraCommand::cam_download)
+            {
+                // The other commands, as the deletion of a downloaded item, must see the downloads done.
+                waitForPipeline();
+            }
+
             executeCommand(command);
             delete command;
         }
@@ -588,185 +643,45 @@ void CameraController::executeCommand(CameraCommand* const cmd)
 
         case (CameraCommand::cam_download):
         {
-            QString   folder         = cmd->map[QLatin1String("folder")].toString();
-            QString   file           = cmd->map[QLatin1String("file")].toString();
-            QString   mime           = cmd->map[QLatin1String("mime")].toString();
-            QString   dest           = cmd->map[QLatin1String("dest")].toString();
-            bool      documentName   = cmd->map[QLatin1String("documentName")].toBool();
-            bool      fixDateTime    = cmd->map[QLatin1String("fixDateTime")].toBool();
-            QDateTime newDateTime    = cmd->map[QLatin1String("newDateTime")].toDateTime();
-            QString   templateTitle  = cmd->map[QLatin1String("template")].toString();
-            bool      convertJpeg    = cmd->map[QLatin1String("convertJpeg")].toBool();
-            QString   losslessFormat = cmd->map[QLatin1String("losslessFormat")].toString();
-            bool      backupRaw      = cmd->map[QLatin1String("backupRaw")].toBool();
-            bool      convertDng     = cmd->map[QLatin1String("convertDng")].toBool();
-            bool      compressDng    = cmd->map[QLatin1String("compressDng")].toBool();
-            int       previewMode    = cmd->map[QLatin1String("previewMode")].toInt();
-            QString   script         = cmd->map[QLatin1String("script")].toString();
-            int       pickLabel      = cmd->map[QLatin1String("pickLabel")].toInt();
-            int       colorLabel     = cmd->map[QLatin1String("colorLabel")].toInt();
-            int       rating         = cmd->map[QLatin1String("rating")].toInt();
-
-            // download to a temp file
-
-            emit signalDownloaded(folder, file, CamItemInfo::DownloadStarted);
-
-            QString tempFile = QLatin1String("/Camera-tmp%1-") +
-                               QString::number(QCoreApplication::applicationPid()) +
-                               QLatin1String(".digikamtempfile.");
-            QUrl tempURL     = QUrl::fromLocalFile(dest).adjusted(QUrl::RemoveFilename |
-                                                                  QUrl::StripTrailingSlash);
-            QString temp     = tempURL.toLocalFile() + tempFile.arg(1) + file;
-
-            qCDebug(DIGIKAM_IMPORTUI_LOG) << "Downloading: " << file << " using " << temp;
-
-            bool result  = d->camera->downloadItem(folder, file, temp);
-
-            if (!result)
-            {
-                QFile::remove(temp);
-                sendLogMsg(xi18n("Failed to download <filename>%1</filename>", file),
-                           DHistoryView::ErrorEntry, folder, file);
-                emit signalDownloaded(folder, file, CamItemInfo::DownloadFailed);
-                break;
-            }
-            else if (mime == QLatin1String("image/jpeg"))
-            {
-                // Possible modification operations. Only apply it to JPEG for the moment.
-                qCDebug(DIGIKAM_IMPORTUI_LOG) << "Set metadata from: " << file << " using " << temp;
-
-                DMetadata metadata(temp);
-                bool applyChanges = false;
+            QVariantMap map = cmd->map;
+            map.insert(QLatin1String("tempIndex"), d->tempIndex.fetchAndAddOrdered(1));
 
-                if (documentName)
-                {
-                    metadata.setExifTagString("Exif.Image.DocumentName", file);
-                    applyChanges = true;
-                }
-
-                if (fixDateTime)
-                {
-                    metadata.setImageDateTime(newDateTime, true);
-                    applyChanges = true;
-                }
-
-                // TODO: Set image tags using DMetadata.
-
-                if (colorLabel > NoColorLabel)
-                {
-                    metadata.setItemColorLabel(colorLabel);
-                    applyChanges = true;
-                }
-
-                if (pickLabel > NoPickLabel)
-                {
-                    metadata.setItemPickLabel(pickLabel);
-                    applyChanges = true;
-                }
-
-                if (rating > RatingMin)
-                {
-                    metadata.setItemRating(rating);
-                    applyChanges = true;
-                }
+            if (map[QLatin1String("newBatch")].toBool())
+            {
+                // The items of a previous batch, possibly canceled, must be done before the camera is reset.
 
-                if (!templateTitle.isNull() && !templateTitle.isEmpty())
-                {
-                    TemplateManager* const tm = TemplateManager::defaultManager();
-                    qCDebug(DIGIKAM_IMPORTUI_LOG) << "Metadata template title : " << templateTitle;
-
-                    if (tm && templateTitle == Template::removeTemplateTitle())
-                    {
-                        metadata.removeMetadataTemplate();
-                        applyChanges = true;
-                    }
-                    else if (tm)
-                    {
-                        metadata.removeMetadataTemplate();
-                        metadata.setMetadataTemplate(tm->findByTitle(templateTitle));
-                        applyChanges = true;
-                    }
-                }
+                waitForPipeline();
+                d->camera->prepareDownloads();
+            }
 
-                if (applyChanges)
-                {
-                    metadata.applyChanges();
-                }
+            // Wait for a place in the pipeline.
 
-                // Convert JPEG file to lossless format if wanted,
-                // and move converted image to destination.
+            if (!acquirePipeline(1))
+            {
+                emit signalDownloaded(map[QLatin1String("folder")].toString(),
+                                      map[QLatin1String("file")].toString(),
+                                      CamItemInfo::DownloadedNo);
+                break;
+            }
 
-                if (convertJpeg)
-                {
-                    QString temp2 = tempURL.toLocalFile() + tempFile.arg(2) + file;
-
-                    // When converting a file, we need to set the new format extension..
-                    // The new extension is already set in importui.cpp.
-
-                    qCDebug(DIGIKAM_IMPORTUI_LOG) << "Convert to LossLess: " << file;
-
-                    if (!JPEGUtils::jpegConvert(temp, temp2, file, losslessFormat))
-                    {
-                        qCDebug(DIGIKAM_IMPORTUI_LOG) << "Convert failed to JPEG!";
-                        // convert failed. delete the temp file
-                        QFile::remove(temp);
-                        QFile::remove(temp2);
-                        sendLogMsg(xi18n("Failed to convert file <filename>%1</filename> to JPEG", file),
-                                   DHistoryView::ErrorEntry, folder, file);
-                    }
-                    else
-                    {
-                        qCDebug(DIGIKAM_IMPORTUI_LOG) << "Done, removing the temp file: " << temp;
-                        // Else remove only the first temp file.
-                        QFile::remove(temp);
-                        temp = temp2;
-                    }
-                }
+            if (d->camera->parallelDownloadSupport())
+            {
+                QtConcurrent::run(&d->pipeline, this, &CameraController::pipelineDownload, map);
             }
-            else if (convertDng && mime == QLatin1String("image/x-raw"))
+            else
             {
-                qCDebug(DIGIKAM_IMPORTUI_LOG) << "Convert to DNG: " << file;
+                QString temp = downloadToTemp(map);
 
-                if  (QFileInfo(file).suffix().toUpper() != QLatin1String("DNG"))
+                if (temp.isNull())
                 {
-                    QString temp2 = tempURL.toLocalFile() + tempFile.arg(2) + file;
-
-                    DNGWriter dngWriter;
-
-                    dngWriter.setInputFile(temp);
-                    dngWriter.setOutputFile(temp2);
-                    dngWriter.setBackupOriginalRawFile(backupRaw);
-                    dngWriter.setCompressLossLess(compressDng);
-                    dngWriter.setPreviewMode(previewMode);
-
-                    if (dngWriter.convert() != DNGWriter::PROCESSCOMPLETE)
-                    {
-                        qCDebug(DIGIKAM_IMPORTUI_LOG) << "Convert failed to DNG!";
-                        // convert failed. delete the temp file
-                        QFile::remove(temp);
-                        QFile::remove(temp2);
-                        sendLogMsg(xi18n("Failed to convert file <filename>%1</filename> to DNG", file),
-                                   DHistoryView::ErrorEntry, folder, file);
-                    }
-                    else
-                    {
-                        qCDebug(DIGIKAM_IMPORTUI_LOG) << "Done, removing the temp file: " << temp;
-                        // Else remove only the first temp file.
-                        QFile::remove(temp);
-                        temp = temp2;
-                    }
+                    d->pending.release();
                 }
                 else
                 {
-                    qCDebug(DIGIKAM_IMPORTUI_LOG) << "Convert skipped to DNG";
-                    sendLogMsg(xi18n("Skipped to convert file <filename>%1</filename> to DNG", file),
-                               DHistoryView::WarningEntry, folder, file);
+                    QtConcurrent::run(&d->pipeline, this, &CameraController::pipelineProcess, map, temp);
                 }
             }
 
-            // Now we need to move from temp file to destination file.
-            // This possibly involves UI operation, do it from main thread
-            emit signalInternalCheckRename(folder, file, dest, temp, script);
             break;
         }
 
@@ -842,6 +757,324 @@ void CameraController::executeCommand(CameraCommand* const cmd)
     }
 }
 
+void CameraController::pipelineDownload(const QVariantMap& map)
+{
+    bool handed = false;
+
+    if (!d->canceled)
+    {
+        d->readers.acquire();
+        QString temp = downloadToTemp(map);
+        d->readers.release();
+
+        if (!temp.isNull())
+        {
+            handed = processDownloaded(map, temp);
+        }
+    }
+
+    if (!handed)
+    {
+        d->pending.release();
+    }
+}
+
+void CameraController::pipelineProcess(const QVariantMap& map, const QString& temp)
+{
+    if (!processDownloaded(map, temp))
+    {
+        d->pending.release();
+    }
+}
+
+void CameraController::pipelineRegister(const QString& destFile, const DMetadata& metadata, bool useMetadata)
+{
+    // Register the new file in the database now, instead of waiting for a scan of the
+    // destination folder. Files outside of the collections are ignored by the scanner.
+
+    CollectionScanner scanner;
+
+    if (useMetadata)
+    {
+        scanner.scanFile(destFile, metadata, CollectionScanner::NormalScan);
+    }
+    else
+    {
+        scanner.scanFile(destFile, CollectionScanner::NormalScan);
+    }
+
+    d->pending.release();
+}
+
+bool CameraController::acquirePipeline(int count)
+{
+    // The places of the items are released once they are moved to their destination and
+    // registered in the database: do not wait for them when the controller is destroyed
+    // or the downloads are canceled.
+
+    while (!d->pending.tryAcquire(count, 100))
+    {
+        if (!d->running || d->canceled)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void CameraController::waitForPipeline()
+{
+    // An item keeps its place until it is registered, so all the places are free when the pipeline is empty.
+
+    while (!d->pending.tryAcquire(d->pipelineSize, 100))
+    {
+        if (!d->running)
+        {
+            return;
+        }
+    }
+
+    d->pending.release(d->pipelineSize);
+    d->pipeline.waitForDone();
+}
+
+QString CameraController::tempFilePath(const QVariantMap& map, int stage) const
+{
+    QString tempFile = QLatin1String("/Camera-tmp%1-") +
+                       QString::number(QCoreApplication::applicationPid()) + QLatin1Char('-') +
+                       map[QLatin1String("tempIndex")].toString() +
+                       QLatin1String(".digikamtempfile.");
+    QUrl tempURL     = QUrl::fromLocalFile(map[QLatin1String("dest")].toString()).adjusted(QUrl::RemoveFilename |
+                                                                                         QUrl::StripTrailingSlash);
+
+    return (tempURL.toLocalFile() + tempFile.arg(stage) + map[QLatin1String("file")].toString());
+}
+
+QString CameraController::downloadToTemp(const QVariantMap& map)
+{
+    QString folder = map[QLatin1String("folder")].toString();
+    QString file   = map[QLatin1String("file")].toString();
+
+    // download to a temp file
+
+    emit signalDownloaded(folder, file, CamItemInfo::DownloadStarted);
+
+    QString temp   = tempFilePath(map, 1);
+
+    qCDebug(DIGIKAM_IMPORTUI_LOG) << "Downloading: " << file << " using " << temp;
+
+    bool result    = d->camera->downloadItem(folder, file, temp);
+
+    if (d->canceled)
+    {
+        // The copy can be interrupted before the end of the file.
+        QFile::remove(temp);
+        emit signalDownloaded(folder, file, CamItemInfo::DownloadedNo);
+        return QString();
+    }
+
+    if (!result)
+    {
+        QFile::remove(temp);
+        sendLogMsg(xi18n("Failed to download <filename>%1</filename>", file),
+                   DHistoryView::ErrorEntry, folder, file);
+        emit signalDownloaded(folder, file, CamItemInfo::DownloadFailed);
+        return QString();
+    }
+
+    return temp;
+}
+
+bool CameraController::processDownloaded(const QVariantMap& map, const QString& downloaded)
+{
+    QString   folder         = map[QLatin1String("folder")].toString();
+    QString   file           = map[QLatin1String("file")].toString();
+    QString   mime           = map[QLatin1String("mime")].toString();
+    QString   dest           = map[QLatin1String("dest")].toString();
+    bool      documentName   = map[QLatin1String("documentName")].toBool();
+    bool      fixDateTime    = map[QLatin1String("fixDateTime")].toBool();
+    QDateTime newDateTime    = map[QLatin1String("newDateTime")].toDateTime();
+    QString   templateTitle  = map[QLatin1String("template")].toString();
+    bool      convertJpeg    = map[QLatin1String("convertJpeg")].toBool();
+    QString   losslessFormat = map[QLatin1String("losslessFormat")].toString();
+    bool      backupRaw      = map[QLatin1String("backupRaw")].toBool();
+    bool      convertDng     = map[QLatin1String("convertDng")].toBool();
+    bool      compressDng    = map[QLatin1String("compressDng")].toBool();
+    int       previewMode    = map[QLatin1String("previewMode")].toInt();
+    QString   script         = map[QLatin1String("script")].toString();
+    int       pickLabel      = map[QLatin1String("pickLabel")].toInt();
+    int       colorLabel     = map[QLatin1String("colorLabel")].toInt();
+    int       rating         = map[QLatin1String("rating")].toInt();
+
+    QString   temp           = downloaded;
+
+    // The metadata parsed here, and the file they were parsed from.
+    DMetadata metadata;
+    QString   parsedFile;
+
+    if (mime == QLatin1String("image/jpeg"))
+    {
+        // Possible modification operations. Only apply it to JPEG for the moment.
+        qCDebug(DIGIKAM_IMPORTUI_LOG) << "Set metadata from: " << file << " using " << temp;
+
+        metadata.load(temp);
+        parsedFile        = temp;
+        bool applyChanges = false;
+
+        if (documentName)
+        {
+            metadata.setExifTagString("Exif.Image.DocumentName", file);
+            applyChanges = true;
+        }
+
+        if (fixDateTime)
+        {
+            metadata.setImageDateTime(newDateTime, true);
+            applyChanges = true;
+        }
+
+        // TODO: Set image tags using DMetadata.
+
+        if (colorLabel > NoColorLabel)
+        {
+            metadata.setItemColorLabel(colorLabel);
+            applyChanges = true;
+        }
+
+        if (pickLabel > NoPickLabel)
+        {
+            metadata.setItemPickLabel(pickLabel);
+            applyChanges = true;
+        }
+
+        if (rating > RatingMin)
+        {
+            metadata.setItemRating(rating);
+            applyChanges = true;
+        }
+
+        if (!templateTitle.isNull() && !templateTitle.isEmpty())
+        {
+            TemplateManager* const tm = TemplateManager::defaultManager();
+            qCDebug(DIGIKAM_IMPORTUI_LOG) << "Metadata template title : " << templateTitle;
+
+            if (tm && templateTitle == Template::removeTemplateTitle())
+            {
+                metadata.removeMetadataTemplate();
+                applyChanges = true;
+            }
+            else if (tm)
+            {
+                metadata.removeMetadataTemplate();
+                metadata.setMetadataTemplate(tm->findByTitle(templateTitle));
+                applyChanges = true;
+            }
+        }
+
+        if (applyChanges)
+        {
+            metadata.applyChanges();
+        }
+
+        // Convert JPEG file to lossless format if wanted,
+        // and move converted image to destination.
+
+        if (convertJpeg)
+        {
+            QString temp2 = tempFilePath(map, 2);
+
+            // When converting a file, we need to set the new format extension..
+            // The new extension is already set in importui.cpp.
+
+            qCDebug(DIGIKAM_IMPORTUI_LOG) << "Convert to LossLess: " << file;
+
+            if (!JPEGUtils::jpegConvert(temp, temp2, file, losslessFormat))
+            {
+                qCDebug(DIGIKAM_IMPORTUI_LOG) << "Convert failed to JPEG!";
+                // convert failed. delete the temp file
+                QFile::remove(temp);
+                QFile::remove(temp2);
+                sendLogMsg(xi18n("Failed to convert file <filename>%1</filename> to JPEG", file),
+                           DHistoryView::ErrorEntry, folder, file);
+            }
+            else
+            {
+                qCDebug(DIGIKAM_IMPORTUI_LOG) << "Done, removing the temp file: " << temp;
+                // Else remove only the first temp file.
+                QFile::remove(temp);
+                temp = temp2;
+            }
+        }
+    }
+    else if (convertDng && mime == QLatin1String("image/x-raw"))
+    {
+        qCDebug(DIGIKAM_IMPORTUI_LOG) << "Convert to DNG: " << file;
+
+        if  (QFileInfo(file).suffix().toUpper() != QLatin1String("DNG"))
+        {
+            QString temp2 = tempFilePath(map, 2);
+
+            DNGWriter dngWriter;
+
+            dngWriter.setInputFile(temp);
+            dngWriter.setOutputFile(temp2);
+            dngWriter.setBackupOriginalRawFile(backupRaw);
+            dngWriter.setCompressLossLess(compressDng);
+            dngWriter.setPreviewMode(previewMode);
+
+            if (dngWriter.convert() != DNGWriter::PROCESSCOMPLETE)
+            {
+                qCDebug(DIGIKAM_IMPORTUI_LOG) << "Convert failed to DNG!";
+                // convert failed. delete the temp file
+                QFile::remove(temp);
+                QFile::remove(temp2);
+                sendLogMsg(xi18n("Failed to convert file <filename>%1</filename> to DNG", file),
+                           DHistoryView::ErrorEntry, folder, file);
+            }
+            else
+            {
+                qCDebug(DIGIKAM_IMPORTUI_LOG) << "Done, removing the temp file: " << temp;
+                // Else remove only the first temp file.
+                QFile::remove(temp);
+                temp = temp2;
+            }
+        }
+        else
+        {
+            qCDebug(DIGIKAM_IMPORTUI_LOG) << "Convert skipped to DNG";
+            sendLogMsg(xi18n("Skipped to convert file <filename>%1</filename> to DNG", file),
+                       DHistoryView::WarningEntry, folder, file);
+        }
+    }
+
+    if (d->canceled)
+    {
+        QFile::remove(temp);
+        emit signalDownloaded(folder, file, CamItemInfo::DownloadedNo);
+        return false;
+    }
+
+    // The metadata are given to the scanner only if they were parsed from the final file,
+    // and if no script can change the file once it is moved.
+
+    if (!parsedFile.isNull() && (parsedFile == temp) && script.isEmpty())
+    {
+        QMutexLocker lock(&d->metadataMutex);
+        d->parsedMetadata.insert(map[QLatin1String("tempIndex")].toInt(), metadata);
+    }
+
+    // Now we need to move from temp file to destination file.
+    // This is done in the main thread, where the name conflicts are resolved one at a time.
+    // Do not wait for it: the main thread can wait for the controller.
+
+    QMetaObject::invokeMethod(this, "slotCheckRename", Qt::QueuedConnection,
+                              Q_ARG(QVariantMap, map),
+                              Q_ARG(QString, temp));
+
+    return true;
+}
+
 void CameraController::sendLogMsg(const QString& msg, DHistoryView::EntryType type,
                                   const QString& folder, const QString& file)
 {
@@ -853,11 +1086,54 @@ void CameraController::sendLogMsg(const QString& msg, DHistoryView::EntryType ty
     }
 }
 
-void CameraController::slotCheckRename(const QString& folder, const QString& file,
-                                       const QString& destination, const QString& temp,
-                                       const QString& script)
+void CameraController::slotCheckRename(const QVariantMap& map, const QString& temp)
+{
+    // this is the direct continuation of processDownloaded()
+    QString   folder = map[QLatin1String("folder")].toString();
+    QString   file   = map[QLatin1String("file")].toString();
+    QString   dest   = map[QLatin1String("dest")].toString();
+    QString   script = map[QLatin1String("script")].toString();
+    DMetadata metadata;
+    bool      parsed = false;
+
+    {
+        QMutexLocker lock(&d->metadataMutex);
+        QMap<int, DMetadata>::iterator it = d->parsedMetadata.find(map[QLatin1String("tempIndex")].toInt());
+
+        if (it != d->parsedMetadata.end())
+        {
+            metadata = it.value();
+            parsed   = true;
+            d->parsedMetadata.erase(it);
+        }
+    }
+
+    if (d->canceled)
+    {
+        QFile::remove(temp);
+        emit signalDownloaded(folder, file, CamItemInfo::DownloadedNo);
+    }
+    else
+    {
+        QString destFile = moveToDestination(folder, file, dest, temp, script);
+
+        if (!destFile.isNull())
+        {
+            // The database is updated from the pipeline, which releases the place of the item.
+
+            QtConcurrent::run(&d->pipeline, this, &CameraController::pipelineRegister,
+                              destFile, metadata, parsed);
+            return;
+        }
+    }
+
+    d->pending.release();
+}
+
+QString CameraController::moveToDestination(const QString& folder, const QString& file,
+                                            const QString& destination, const QString& temp,
+                                            const QString& script)
 {
-    // this is the direct continuation of executeCommand, case CameraCommand::cam_download
     QString dest = destination;
     QFileInfo info(dest);
 
@@ -867,7 +1143,7 @@ void CameraController::slotCheckRename(const QString& folder, const QString& fil
         sendLogMsg(xi18n("Skipped file <filename>%1</filename>", file),
                    DHistoryView::WarningEntry, folder, file);
         emit signalSkipped(folder, file);
-        return;
+        return QString();
     }
     else if (d->conflictRule != SetupCamera::OVERWRITE)
     {
@@ -917,6 +1193,8 @@ void CameraController::slotCheckRename(const QString& folder, const QString& fil
         emit signalDownloaded(folder, file, CamItemInfo::DownloadFailed);
         sendLogMsg(xi18n("Failed to download <filename>%1</filename>", file),
                    DHistoryView::ErrorEntry,  folder, file);
+
+        return QString();
     }
     else
     {
@@ -972,6 +1250,8 @@ void CameraController::slotCheckRename(const QString& folder, const QString& fil
             qCDebug(DIGIKAM_IMPORTUI_LOG) << "stderr" << process.readAllStandardError();
         }
     }
+
+    return dest;
 }
 
 void CameraController::slotDownloadFailed(const QString& folder, const QString& file)
@@ -1220,13 +1500,21 @@ void CameraController::downloadPrep(const SetupCamera::ConflictRule& rule)
 
 void CameraController::download(const DownloadSettingsList& list)
 {
+    bool newBatch = true;
+
     foreach(const DownloadSettings& downloadSettings, list)
     {
-        download(downloadSettings);
+        addDownloadCommand(downloadSettings, newBatch);
+        newBatch = false;
     }
 }
 
 void CameraController::download(const DownloadSettings& downloadSettings)
+{
+    addDownloadCommand(downloadSettings, true);
+}
+
+void CameraController::addDownloadCommand(const DownloadSettings& downloadSettings, bool newBatch)
 {
     d->canceled              = false;
     CameraCommand* const cmd = new CameraCommand;
@@ -1250,6 +1538,7 @@ void CameraController::download(const DownloadSettings& downloadSettings)
     cmd->map.insert(QLatin1String("colorLabel"),        QVariant(downloadSettings.colorLabel));
     cmd->map.insert(QLatin1String("rating"),            QVariant(downloadSettings.rating));
     //cmd->map.insert(QLatin1String("tagIds"),            QVariant(downloadSettings.tagIds));
+    cmd->map.insert(QLatin1String("newBatch"),          QVariant(newBatch));
     addCommand(cmd);
 }
 
@@ -31,6 +31,7 @@
 #include <QThread>
 #include <QString>
 #include <QFileInfo>
+#include <QVariant>
 
 // Local includes
 
@@ -118,9 +119,6 @@ Q_SIGNALS:
     void signalThumbInfoFailed(const QString& folder, const QString& file, const CamItemInfo& itemInfo);
     void signalMetadata(const QString& folder, const QString& file, const DMetadata& exifData);
 
-    void signalInternalCheckRename(const QString& folder, const QString& file,
-                                   const QString& destination, const QString& temp,
-                                   const QString& script);
     void signalInternalDownloadFailed(const QString& folder, const QString& file);
     void signalInternalUploadFailed(const QString& folder, const QString& file, const QString& src);
     void signalInternalDeleteFailed(const QString& folder, const QString& file);
@@ -138,8 +136,11 @@ protected:
 
 private Q_SLOTS:
 
-    void slotCheckRename(const QString& folder, const QString& file,
-                         const QString& destination, const QString& temp, const QString& script);
+    /** Move a downloaded and processed item from its temporary file to its destination.
+     *  The pipeline hands the items to the main thread without waiting, and this slot
+     *  releases the place of the item in the pipeline.
+     */
+    void slotCheckRename(const QVariantMap& map, const QString& temp);
     void slotDownloadFailed(const QString& folder, const QString& file);
     void slotUploadFailed(const QString& folder, const QString& file, const QString& src);
     void slotDeleteFailed(const QString& folder, const QString& file);
@@ -151,8 +152,37 @@ private:
                     const QString& folder=QString(), const QString& file=QString());
 
     void addCommand(CameraCommand* const cmd);
+    void addDownloadCommand(const DownloadSettings& downloadSettings, bool newBatch);
     bool queueIsEmpty() const;
 
+    /** The download pipeline: the items are downloaded to a temporary file, processed
+     *  (metadata changes, lossless or DNG conversion), moved to their destination and
+     *  registered in the database. With a camera supporting parallel downloads, all the
+     *  stages run in the pipeline threads, else the downloads are done in sequence by the
+     *  controller thread and the other stages overlap the next downloads.
+     */
+    void    pipelineDownload(const QVariantMap& map);
+    void    pipelineProcess(const QVariantMap& map, const QString& temp);
+    void    pipelineRegister(const QString& destFile, const DMetadata& metadata, bool useMetadata);
+
+    /** Take places in the pipeline. Return false if the controller is stopped or
+     *  the downloads are canceled before the places are free.
+     */
+    bool    acquirePipeline(int count);
+
+    /** Wait until the items in the pipeline are moved to their destination and registered.
+     */
+    void    waitForPipeline();
+
+    QString downloadToTemp(const QVariantMap& map);
+
+    /** Return true if the item was handed to the main thread to be moved to its destination.
+     */
+    bool    processDownloaded(const QVariantMap& map, const QString& downloaded);
+    QString moveToDestination(const QString& folder, const QString& file,
+                              const QString& destination, const QString& temp, const QString& script);
+    QString tempFilePath(const QVariantMap& map, int stage) const;
+
 private:
 
     class Private;
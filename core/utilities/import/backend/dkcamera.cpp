@@ -47,6 +47,7 @@ DKCamera::DKCamera(const QString& title, const QString& model, const QString& po
     m_delDirSupport               = false;
     m_captureImageSupport         = false;
     m_captureImagePreviewSupport  = false;
+    m_parallelDownloadSupport     = false;
 
     ApplicationSettings* const settings = ApplicationSettings::instance();
     m_imageFilter                       = settings->getImageFileFilter();
@@ -123,6 +124,15 @@ bool DKCamera::captureImagePreviewSupport() const
     return m_captureImagePreviewSupport;
 }
 
+bool DKCamera::parallelDownloadSupport() const
+{
+    return m_parallelDownloadSupport;
+}
+
+void DKCamera::prepareDownloads()
+{
+}
+
 QString DKCamera::mimeType(const QString& fileext) const
 {
     if (fileext.isEmpty())
@@ -189,6 +199,7 @@ void DKCamera::printSupportedFeatures()
     qCDebug(DIGIKAM_IMPORTUI_LOG) << "  Mkdir:" << mkDirSupport();
     qCDebug(DIGIKAM_IMPORTUI_LOG) << "  Image capture:" << captureImageSupport();
     qCDebug(DIGIKAM_IMPORTUI_LOG) << "  Image capture preview (liveview):" << captureImagePreviewSupport();
+    qCDebug(DIGIKAM_IMPORTUI_LOG) << "  Parallel downloads:" << parallelDownloadSupport();
 }
 
 } // namespace Digikam
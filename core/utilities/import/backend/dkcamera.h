@@ -64,6 +64,9 @@ public:
     virtual bool doConnect() = 0;
     virtual void cancel() = 0;
 
+    /// Called once before a batch of downloads, to reset the cancel state of a previous batch.
+    virtual void prepareDownloads();
+
     virtual bool getFolders(const QString& folder) = 0;
 
     /// If getImageDimensions is false, the camera shall set width and height to -1
@@ -105,6 +108,11 @@ public:
     bool    captureImageSupport()        const;
     bool    captureImagePreviewSupport() const;
 
+    /** Return true if items can be downloaded from several threads at the same time,
+     *  as with a mass storage, where the downloads are file copies.
+     */
+    bool    parallelDownloadSupport()    const;
+
     QString mimeType(const QString& fileext) const;
 
     void printSupportedFeatures();
@@ -122,6 +130,7 @@ protected:
     bool    m_delDirSupport;
     bool    m_captureImageSupport;
     bool    m_captureImagePreviewSupport;
+    bool    m_parallelDownloadSupport;
 
     QString m_imageFilter;
     QString m_movieFilter;
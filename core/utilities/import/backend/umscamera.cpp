@@ -140,8 +140,9 @@ bool UMSCamera::doConnect()
         m_delDirSupport = false;
     }
 
-    m_thumbnailSupport    = true;   // UMS camera always support thumbnails.
-    m_captureImageSupport = false;  // UMS camera never support capture mode.
+    m_thumbnailSupport        = true;   // UMS camera always support thumbnails.
+    m_captureImageSupport     = false;  // UMS camera never support capture mode.
+    m_parallelDownloadSupport = true;   // UMS camera downloads are independent file copies.
 
     return true;
 }
@@ -152,6 +153,13 @@ void UMSCamera::cancel()
     m_cancel = true;
 }
 
+void UMSCamera::prepareDownloads()
+{
+    // The downloads of a batch run at the same time: the cancel flag is reset
+    // once for the batch, and not by each download.
+    m_cancel = false;
+}
+
 bool UMSCamera::getFolders(const QString& folder)
 {
     if (m_cancel)
@@ -377,7 +385,6 @@ bool UMSCamera::getMetadata(const QString& folder, const QString& itemName, DMet
 
 bool UMSCamera::downloadItem(const QString& folder, const QString& itemName, const QString& saveFile)
 {
-    m_cancel     = false;
     QString src  = folder + QLatin1Char('/') + itemName;
     QString dest = saveFile;
 
@@ -414,6 +421,12 @@ bool UMSCamera::downloadItem(const QString& folder, const QString& itemName, con
     sFile.close();
     dFile.close();
 
+    if (m_cancel)
+    {
+        // The copy was interrupted before the end of the file.
+        return false;
+    }
+
     // Set the file modification time of the downloaded file to the original file.
     // NOTE: this behavior don't need to be managed through Setup/Metadata settings.
     QT_STATBUF st;
@@ -52,6 +52,7 @@ public:
 
     bool doConnect();
     void cancel();
+    void prepareDownloads();
 
     bool getFolders(const QString& folder);
     bool getItemsInfoList(const QString& folder, bool useMetadata, CamItemInfoList& infoList);
@@ -106,7 +106,6 @@
 #include "newitemsfinder.h"
 #include "parsesettings.h"
 #include "renamecustomizer.h"
-#include "scancontroller.h"
 #include "setup.h"
 #include "sidebar.h"
 #include "statusprogressbar.h"
@@ -1573,9 +1572,9 @@ void ImportUI::slotDownloaded(const QString& folder, const QString& file, int st
 }
 
 void ImportUI::slotDownloadComplete(const QString&, const QString&,
-                                    const QString& destFolder, const QString&)
+                                    const QString&, const QString&)
 {
-    ScanController::instance()->scheduleCollectionScanRelaxed(destFolder);
+    // The downloaded file is already registered in the database by the camera controller.
     autoRotateItems();
 }
 
@@ -164,6 +164,11 @@ void LightTableView::setPreviewSettings(const PreviewSettings& settings)
     d->rightPreview->previewItem()->setPreviewSettings(settings);
 }
 
+int LightTableView::previewSize() const
+{
+    return d->leftPreview->previewItem()->previewSize();
+}
+
 void LightTableView::setSyncPreview(bool sync)
 {
     d->syncPreview = sync;
@@ -58,6 +58,7 @@ public:
     ItemInfo rightItemInfo() const;
 
     void setPreviewSettings(const PreviewSettings& settings);
+    int  previewSize() const;
 
     void   checkForSelection(const ItemInfo& info);
     void   toggleFullScreen(bool set);
@@ -459,6 +459,22 @@ void LightTableWindow::slotSetItemOnLeftPanel(const ItemInfo& info)
     if (!info.isNull())
     {
         d->leftSideBar->itemChanged(info);
+
+        // Preload the items around, in the order of the thumbbar.
+
+        QStringList files;
+
+        foreach (const ItemInfo& item, d->thumbView->allItemInfos())
+        {
+            files << item.filePath();
+        }
+
+        if (files != d->preloader->files())
+        {
+            d->preloader->setFiles(files, false);
+        }
+
+        d->preloader->setCurrentFile(info.filePath());
     }
     else
     {
@@ -40,6 +40,9 @@ void LightTableWindow::slotColorManagementOptionsChanged()
     d->viewCMViewAction->setEnabled(settings.enableCM);
     d->viewCMViewAction->setChecked(settings.useManagedPreviews);
     d->viewCMViewAction->blockSignals(false);
+
+    d->preloader->setPreviewSettings(ApplicationSettings::instance()->getPreviewSettings(),
+                                     d->previewView->previewSize(), IccManager::displayProfile());
 }
 
 void LightTableWindow::slotThemeChanged()
@@ -57,6 +60,8 @@ void LightTableWindow::slotApplicationSettingsChanged()
     //     d->rightSideBar->applySettings();
 
     d->previewView->setPreviewSettings(ApplicationSettings::instance()->getPreviewSettings());
+    d->preloader->setPreviewSettings(ApplicationSettings::instance()->getPreviewSettings(),
+                                     d->previewView->previewSize(), IccManager::displayProfile());
 }
 
 void LightTableWindow::readSettings()
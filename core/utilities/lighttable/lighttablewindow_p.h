@@ -83,6 +83,8 @@
 #include "thumbnailloadthread.h"
 #include "dexpanderbox.h"
 #include "dbinfoiface.h"
+#include "iccmanager.h"
+#include "previewpreloader.h"
 
 namespace Digikam
 {
@@ -133,7 +135,8 @@ public:
         rightZoomBar(nullptr),
         statusProgressBar(nullptr),
         leftSideBar(nullptr),
-        rightSideBar(nullptr)
+        rightSideBar(nullptr),
+        preloader(nullptr)
     {
     }
 
@@ -196,6 +199,9 @@ public:
 
     ItemPropertiesSideBarDB* leftSideBar;
     ItemPropertiesSideBarDB* rightSideBar;
+
+    /// Preloads the previews of the items around the one of the left panel, with the settings of the panels.
+    PreviewPreloader*        preloader;
 };
 
 } // namespace Digikam
@@ -420,6 +420,7 @@ void LightTableWindow::setupUserArea()
     d->hSplitter->addWidget(viewContainer);
     d->previewView                   = new LightTableView(viewContainer);
     viewContainer->setCentralWidget(d->previewView);
+    d->preloader                     = new PreviewPreloader(this);
 
     // The right sidebar.
     d->rightSideBar = new ItemPropertiesSideBarDB(mainW, d->hSplitter, Qt::RightEdge, true);
@@ -0,0 +1,404 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : Combined maintenance processing of the images,
+ *               decoding each image once for several tools.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "combinedprocessor.h"
+
+// Qt includes
+
+#include <QApplication>
+#include <QHash>
+#include <QIcon>
+#include <QPixmap>
+#include <QSet>
+#include <QString>
+
+// KDE includes
+
+#include <kconfiggroup.h>
+#include <klocalizedstring.h>
+
+// Local includes
+
+#include "digikam_debug.h"
+#include "digikam_globals.h"
+#include "dimg.h"
+#include "coredb.h"
+#include "albummanager.h"
+#include "coredbaccess.h"
+#include "combinedtask.h"
+#include "facepipeline.h"
+#include "iteminfo.h"
+#include "maintenancethread.h"
+#include "tagscache.h"
+#include "thumbsdb.h"
+#include "thumbsdbaccess.h"
+
+namespace Digikam
+{
+
+class Q_DECL_HIDDEN CombinedProcessor::Private
+{
+public:
+
+    explicit Private()
+      : stages(0),
+        threadCompleted(false),
+        thread(nullptr)
+    {
+    }
+
+    /**
+     * The ids of the items of the albums and tags, or of all the albums if the list is empty.
+     */
+    static QSet<qlonglong> itemIds(const AlbumList& list);
+
+public:
+
+    int                 stages;
+    bool                threadCompleted;
+
+    MaintenanceSettings settings;
+
+    MaintenanceThread*  thread;
+    FacePipeline        pipeline;
+};
+
+QSet<qlonglong> CombinedProcessor::Private::itemIds(const AlbumList& list)
+{
+    AlbumList albums = list;
+
+    if (albums.isEmpty())
+    {
+        albums = AlbumManager::instance()->allPAlbums();
+    }
+
+    QSet<qlonglong> ids;
+
+    foreach (Album* const album, albums)
+    {
+        if (!album)
+        {
+            continue;
+        }
+
+        if      (album->type() == Album::PHYSICAL)
+        {
+            ids.unite(CoreDbAccess().db()->getItemIDsInAlbum(album->id()).toSet());
+        }
+        else if (album->type() == Album::TAG)
+        {
+            ids.unite(CoreDbAccess().db()->getItemIDsInTag(album->id()).toSet());
+        }
+    }
+
+    return ids;
+}
+
+CombinedProcessor::CombinedProcessor(const MaintenanceSettings& settings, int stages, ProgressItem* const parent)
+    : MaintenanceTool(QLatin1String("CombinedProcessor"), parent),
+      d(new Private)
+{
+    setLabel(i18n("Images Processing"));
+    ProgressManager::addProgressItem(this);
+
+    d->settings = settings;
+    d->stages   = stages;
+    d->thread   = new MaintenanceThread(this);
+
+    if (d->stages & CombinedTask::Faces)
+    {
+        // The images are given by the combined tasks, instead of a preview loader,
+        // and the already scanned images are skipped by the tasks.
+
+        const FaceScanSettings& faceSettings = d->settings.faceSettings;
+
+        d->pipeline.plugDatabaseFilter(FacePipeline::ScanAll);
+
+        if (faceSettings.useFullCpu)
+        {
+            d->pipeline.plugParallelFaceDetectors();
+        }
+        else
+        {
+            d->pipeline.plugFaceDetector();
+        }
+
+        if (faceSettings.task == FaceScanSettings::DetectAndRecognize)
+        {
+            d->pipeline.plugFaceRecognizer();
+            d->pipeline.activeFaceRecognizer(faceSettings.recognizeAlgorithm);
+        }
+
+        d->pipeline.plugDatabaseWriter((faceSettings.alreadyScannedHandling == FaceScanSettings::Rescan) ?
+                                       FacePipeline::OverwriteUnconfirmed : FacePipeline::NormalWrite);
+        d->pipeline.setDetectionAccuracy(faceSettings.accuracy);
+        d->pipeline.construct();
+
+        connect(&d->pipeline, SIGNAL(processed(FacePipelinePackage)),
+                this, SLOT(slotFaceProcessed(FacePipelinePackage)));
+
+        connect(&d->pipeline, SIGNAL(finished()),
+                this, SLOT(slotCheckCompleted()));
+
+        connect(d->thread, SIGNAL(signalFaceImage(ItemInfo,DImg)),
+                this, SLOT(slotFaceImage(ItemInfo,DImg)));
+    }
+
+    connect(d->thread, SIGNAL(signalCompleted()),
+            this, SLOT(slotThreadCompleted()));
+
+    connect(d->thread, SIGNAL(signalAdvance(QImage)),
+            this, SLOT(slotAdvance(QImage)));
+}
+
+CombinedProcessor::~CombinedProcessor()
+{
+    delete d;
+}
+
+int CombinedProcessor::combinedStages(const MaintenanceSettings& settings)
+{
+    int stages = 0;
+    int count  = 0;
+
+    if (settings.thumbnails)
+    {
+        stages |= CombinedTask::Thumbnails;
+        ++count;
+    }
+
+    if (settings.fingerPrints)
+    {
+        stages |= CombinedTask::FingerPrints;
+        ++count;
+    }
+
+    if (settings.qualitySort && settings.quality.enableSorter)
+    {
+        stages |= CombinedTask::ImageQuality;
+        ++count;
+    }
+
+    if (settings.faceManagement &&
+        ((settings.faceSettings.task == FaceScanSettings::Detect) ||
+         (settings.faceSettings.task == FaceScanSettings::DetectAndRecognize)))
+    {
+        stages |= CombinedTask::Faces;
+        ++count;
+    }
+
+    return ((count > 1) ? stages : 0);
+}
+
+int CombinedProcessor::itemStages(int stages, const MaintenanceSettings& settings,
+                                  DatabaseItem::Category category,
+                                  bool inItems, bool inFaceItems,
+                                  bool hasThumbnail, bool noPickLabel)
+{
+    int selected = 0;
+
+    if (inItems)
+    {
+        if ((stages & CombinedTask::Thumbnails)                                  &&
+            ((category == DatabaseItem::Image)                                   ||
+             (category == DatabaseItem::Video)                                   ||
+             (category == DatabaseItem::Audio))                                  &&
+            ((settings.scanThumbs == false) || !hasThumbnail))
+        {
+            selected |= CombinedTask::Thumbnails;
+        }
+
+        if (stages & CombinedTask::FingerPrints)
+        {
+            selected |= CombinedTask::FingerPrints;
+        }
+
+        if ((stages & CombinedTask::ImageQuality)                                &&
+            ((settings.qualityScanMode == ImageQualitySorter::AllItems) || noPickLabel))
+        {
+            selected |= CombinedTask::ImageQuality;
+        }
+    }
+
+    if ((stages & CombinedTask::Faces) && inFaceItems && (category == DatabaseItem::Image))
+    {
+        selected |= CombinedTask::Faces;
+    }
+
+    return selected;
+}
+
+void CombinedProcessor::setUseMultiCoreCPU(bool b)
+{
+    d->thread->setUseMultiCore(b);
+}
+
+void CombinedProcessor::slotCancel()
+{
+    d->thread->cancel();
+
+    if (d->stages & CombinedTask::Faces)
+    {
+        d->pipeline.shutDown();
+    }
+
+    MaintenanceTool::slotCancel();
+}
+
+void CombinedProcessor::slotStart()
+{
+    MaintenanceTool::slotStart();
+
+    QApplication::setOverrideCursor(Qt::WaitCursor);
+
+    // Select the items of each stage as the tools running the stage alone.
+
+    AlbumList list;
+    list << d->settings.albums;
+    list << d->settings.tags;
+
+    const QSet<qlonglong> ids = Private::itemIds(list);
+    QSet<qlonglong> faceIds;
+
+    if (d->stages & CombinedTask::Faces)
+    {
+        faceIds = Private::itemIds(d->settings.faceSettings.albums);
+    }
+
+    QSet<QString> thumbPaths;
+    const bool rebuildAllThumbs = (d->settings.scanThumbs == false);
+
+    if ((d->stages & CombinedTask::Thumbnails) && !rebuildAllThumbs)
+    {
+        thumbPaths = ThumbsDbAccess().db()->getFilePathsWithThumbnail().keys().toSet();
+    }
+
+    QSet<QString> dirtyPaths;
+    const bool allQualityItems = (d->settings.qualityScanMode == ImageQualitySorter::AllItems);
+
+    if ((d->stages & CombinedTask::ImageQuality) && !allQualityItems)
+    {
+        // Get all item in DB which do not have any Pick Label assigned.
+        dirtyPaths = CoreDbAccess().db()->getItemsURLsWithTag(TagsCache::instance()->tagForPickLabel(NoPickLabel)).toSet();
+    }
+
+    ItemInfoList infos(QSet<qlonglong>(ids).unite(faceIds).toList());
+    ItemInfoList items;
+    QHash<qlonglong, int> stagesById;
+
+    foreach (const ItemInfo& info, infos)
+    {
+        if (canceled())
+        {
+            break;
+        }
+
+        const int stages = itemStages(d->stages, d->settings, info.category(),
+                                      ids.contains(info.id()),
+                                      faceIds.contains(info.id()),
+                                      thumbPaths.contains(info.filePath()),
+                                      dirtyPaths.contains(info.filePath()));
+
+        if (stages)
+        {
+            items << info;
+            stagesById.insert(info.id(), stages);
+        }
+    }
+
+    QApplication::restoreOverrideCursor();
+
+    if (items.isEmpty() || canceled())
+    {
+        slotDone();
+        return;
+    }
+
+    qCDebug(DIGIKAM_GENERAL_LOG) << "Combined processing of" << items.count() << "items";
+
+    setTotalItems(items.count());
+
+    d->thread->processCombined(items, stagesById,
+                               (d->settings.scanFingerPrints == false),
+                               d->settings.quality,
+                               (d->settings.faceSettings.alreadyScannedHandling == FaceScanSettings::Skip));
+    d->thread->start();
+}
+
+void CombinedProcessor::slotAdvance(const QImage& img)
+{
+    setThumbnail(QIcon(QPixmap::fromImage(img)));
+    advance(1);
+}
+
+void CombinedProcessor::slotFaceImage(const ItemInfo& info, const DImg& image)
+{
+    if (canceled() || !d->pipeline.process(info, image))
+    {
+        d->thread->releaseFaceImage();
+    }
+}
+
+void CombinedProcessor::slotFaceProcessed(const FacePipelinePackage&)
+{
+    d->thread->releaseFaceImage();
+}
+
+void CombinedProcessor::slotThreadCompleted()
+{
+    d->threadCompleted = true;
+    slotCheckCompleted();
+}
+
+void CombinedProcessor::slotCheckCompleted()
+{
+    // The face pipeline can still process the last images when the tasks are done.
+
+    if (d->threadCompleted && d->pipeline.hasFinished())
+    {
+        d->threadCompleted = false;
+        slotDone();
+    }
+}
+
+void CombinedProcessor::slotDone()
+{
+    // Switch on the first run flags of the tools on digiKam config file.
+
+    KConfigGroup group = KSharedConfig::openConfig()->group(QLatin1String("General Settings"));
+
+    if (d->stages & CombinedTask::FingerPrints)
+    {
+        group.writeEntry(QLatin1String("Finger Prints Generator First Run"), true);
+    }
+
+    if (d->stages & CombinedTask::Faces)
+    {
+        group.writeEntry(QLatin1String("Face Scanner First Run"), true);
+    }
+
+    MaintenanceTool::slotDone();
+}
+
+} // namespace Digikam
@@ -0,0 +1,106 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : Combined maintenance processing of the images,
+ *               decoding each image once for several tools.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_COMBINED_PROCESSOR_H
+#define DIGIKAM_COMBINED_PROCESSOR_H
+
+// Qt includes
+
+#include <QObject>
+
+// Local includes
+
+#include "digikam_export.h"
+#include "coredbconstants.h"
+#include "maintenancetool.h"
+#include "maintenancesettings.h"
+
+class QImage;
+
+namespace Digikam
+{
+
+class DImg;
+class FacePipelinePackage;
+class ItemInfo;
+
+/**
+ * Run the thumbnails generation, the fingerprints generation, the image quality sorting and
+ * the face detection of the maintenance in a single pass over the items, where each image is
+ * decoded once and shared by the selected tools. See CombinedTask for the processing of an item.
+ */
+class DIGIKAM_EXPORT CombinedProcessor : public MaintenanceTool
+{
+    Q_OBJECT
+
+public:
+
+    /**
+     * The stages are a combination of CombinedTask::Stage flags.
+     */
+    explicit CombinedProcessor(const MaintenanceSettings& settings, int stages,
+                               ProgressItem* const parent = nullptr);
+    ~CombinedProcessor();
+
+    void setUseMultiCoreCPU(bool b);
+
+    /**
+     * Return the stages of the settings which can run in the combined processing,
+     * or 0 if less than two stages are selected, which run faster with their own tools.
+     * The face detection is combined only to detect faces, with or without recognition.
+     */
+    static int combinedStages(const MaintenanceSettings& settings);
+
+    /**
+     * Return the stages among the combined ones which run on an item, selected as the tools
+     * running each stage alone select their items. inItems tells if the item is in the albums
+     * and tags of the settings, inFaceItems if it is in the albums of the face scan settings.
+     * hasThumbnail and noPickLabel are only used when the settings scan the missing thumbnails
+     * and the items without a pick label.
+     */
+    static int itemStages(int stages, const MaintenanceSettings& settings,
+                          DatabaseItem::Category category,
+                          bool inItems, bool inFaceItems,
+                          bool hasThumbnail, bool noPickLabel);
+
+private Q_SLOTS:
+
+    void slotStart();
+    void slotDone();
+    void slotCancel();
+    void slotAdvance(const QImage&);
+    void slotFaceImage(const ItemInfo&, const DImg&);
+    void slotFaceProcessed(const FacePipelinePackage&);
+    void slotThreadCompleted();
+    void slotCheckCompleted();
+
+private:
+
+    class Private;
+    Private* const d;
+};
+
+} // namespace Digikam
+
+#endif // DIGIKAM_COMBINED_PROCESSOR_H
@@ -0,0 +1,390 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : Thread actions task for the combined maintenance processing.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#include "combinedtask.h"
+
+// Qt includes
+
+#include <QIcon>
+#include <QPixmap>
+
+// Local includes
+
+#include "digikam_debug.h"
+#include "faceutils.h"
+#include "haariface.h"
+#include "imagequalitycontainer.h"
+#include "imagequalityparser.h"
+#include "loadsavethread.h"
+#include "maintenancedata.h"
+#include "previewloadthread.h"
+#include "similaritydb.h"
+#include "similaritydbaccess.h"
+#include "thumbnailloadthread.h"
+
+namespace Digikam
+{
+
+class Q_DECL_HIDDEN CombinedTask::Private
+{
+public:
+
+    explicit Private()
+        : skipScannedFaces(true),
+          imgqsort(nullptr),
+          catcher(nullptr),
+          data(nullptr)
+    {
+    }
+
+    /**
+     * The size of the preview decoded for the stages, without the face detection.
+     * The sizes are the ones used by the maintenance tools running each stage alone.
+     */
+    int  previewSize(int stages) const;
+
+    /**
+     * Take an unit of a budget, until the task is canceled.
+     */
+    bool acquire(MaintenanceData::Budget budget, const bool& cancel) const;
+
+    /**
+     * Store the thumbnail from the decoded image, unrotated as the thumbnail creator does.
+     */
+    void storeThumbnail(const QString& path, const DImg& image);
+
+    /**
+     * Create the thumbnail with the thumbnail creator, when there is no decoded image to share.
+     */
+    QImage createThumbnail(const QString& path);
+
+public:
+
+    /// The size of the face detection images, as loaded by the face pipeline.
+    static const int       facePreviewSize    = 1600;
+
+    /// The size of the image quality analysis, as in ImageQualityTask.
+    static const int       qualityPreviewSize = 1024;
+
+    bool                   skipScannedFaces;
+
+    ImageQualityContainer  quality;
+    ImageQualityParser*    imgqsort;
+
+    ThumbnailImageCatcher* catcher;
+
+    MaintenanceData*       data;
+    QImage                 okImage;
+};
+
+int CombinedTask::Private::previewSize(int stages) const
+{
+    int size = 0;
+
+    if (stages & Thumbnails)
+    {
+        size = qMax(size, ThumbnailLoadThread::maximumThumbnailSize());
+    }
+
+    if (stages & FingerPrints)
+    {
+        size = qMax(size, HaarIface::preferredSize());
+    }
+
+    if (stages & ImageQuality)
+    {
+        size = qMax(size, (int)qualityPreviewSize);
+    }
+
+    return size;
+}
+
+bool CombinedTask::Private::acquire(MaintenanceData::Budget budget, const bool& cancel) const
+{
+    while (!cancel)
+    {
+        if (data->acquireBudget(budget, 100))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void CombinedTask::Private::storeThumbnail(const QString& path, const DImg& image)
+{
+    const int size = ThumbnailLoadThread::maximumThumbnailSize();
+    DImg thumb;
+
+    if ((image.width() > size) || (image.height() > size))
+    {
+        thumb = image.smoothScale(size, size, Qt::KeepAspectRatio);
+    }
+    else
+    {
+        thumb = image.copy();
+    }
+
+    // The thumbnails are stored as in the file, and rotated when they are loaded.
+
+    if (LoadSaveThread::wasExifRotated(image))
+    {
+        thumb.reverseRotateAndFlip(LoadSaveThread::exifOrientation(image, path));
+    }
+
+    ThumbnailLoadThread::deleteThumbnail(path);
+    catcher->thread()->storeThumbnail(path, thumb.copyQImage());
+}
+
+QImage CombinedTask::Private::createThumbnail(const QString& path)
+{
+    catcher->thread()->deleteThumbnail(path);
+    catcher->thread()->find(ThumbnailIdentifier(path));
+    catcher->enqueue();
+    QList<QImage> images = catcher->waitForThumbnails();
+
+    return (images.isEmpty() ? QImage() : images.first());
+}
+
+// -------------------------------------------------------
+
+CombinedTask::CombinedTask()
+    : ActionJob(),
+      d(new Private)
+{
+    ThumbnailLoadThread* const thread = new ThumbnailLoadThread;
+    thread->setPixmapRequested(false);
+    thread->setThumbnailSize(ThumbnailLoadThread::maximumThumbnailSize());
+    d->catcher                        = new ThumbnailImageCatcher(thread, this);
+
+    QPixmap okPix                     = QIcon::fromTheme(QLatin1String("dialog-ok")).pixmap(22, 22);
+    d->okImage                        = okPix.toImage();
+}
+
+CombinedTask::~CombinedTask()
+{
+    slotCancel();
+    cancel();
+
+    d->catcher->setActive(false);
+    d->catcher->thread()->stopAllTasks();
+
+    delete d->catcher->thread();
+    delete d->catcher;
+    delete d;
+}
+
+void CombinedTask::setQuality(const ImageQualityContainer& quality)
+{
+    d->quality = quality;
+}
+
+void CombinedTask::setSkipScannedFaces(bool skip)
+{
+    d->skipScannedFaces = skip;
+}
+
+void CombinedTask::setMaintenanceData(MaintenanceData* const data)
+{
+    d->data = data;
+}
+
+void CombinedTask::slotCancel()
+{
+    if (d->imgqsort)
+    {
+        d->imgqsort->cancelAnalyse();
+    }
+}
+
+void CombinedTask::run()
+{
+    d->catcher->setActive(true);
+
+    // While we have data (using this as check for non-null)
+    while (d->data)
+    {
+        if (m_cancel)
+        {
+            break;
+        }
+
+        ItemInfo info = d->data->getItemInfo();
+
+        if (info.isNull())
+        {
+            break;
+        }
+
+        const QString path = info.filePath();
+        int stages         = d->data->getItemStages(info.id());
+
+        if ((stages & FingerPrints)                                         &&
+            (!info.isVisible()                                              ||
+             (info.category() != DatabaseItem::Category::Image)             ||
+             (!d->data->getRebuildAllFingerprints()                         &&
+              !SimilarityDbAccess().db()->hasDirtyOrMissingFingerprint(info))))
+        {
+            stages &= ~FingerPrints;
+        }
+
+        if ((stages & Faces) && d->skipScannedFaces && FaceUtils().hasBeenScanned(info))
+        {
+            stages &= ~Faces;
+        }
+
+        if (info.category() != DatabaseItem::Category::Image)
+        {
+            // Videos and audio files have no image to share, their thumbnail is created as usual.
+
+            if (stages & Thumbnails)
+            {
+                emit signalFinished(d->createThumbnail(path));
+            }
+            else
+            {
+                emit signalFinished(d->okImage);
+            }
+
+            continue;
+        }
+
+        if (!stages)
+        {
+            emit signalFinished(d->okImage);
+            continue;
+        }
+
+        // Decode the file once, at the largest size needed by the stages.
+
+        if (!d->acquire(MaintenanceData::IoBudget, m_cancel))
+        {
+            break;
+        }
+
+        DImg dimg;
+
+        if (stages & Faces)
+        {
+            dimg = PreviewLoadThread::loadFastButLargeSynchronously(path, Private::facePreviewSize);
+        }
+        else
+        {
+            dimg = PreviewLoadThread::loadFastSynchronously(path, d->previewSize(stages));
+        }
+
+        d->data->releaseBudget(MaintenanceData::IoBudget);
+
+        if (dimg.isNull())
+        {
+            qCDebug(DIGIKAM_GENERAL_LOG) << "Cannot decode" << path << "for the maintenance";
+
+            // The thumbnail creator has its own fallbacks, as the embedded thumbnails.
+
+            if (stages & Thumbnails)
+            {
+                emit signalFinished(d->createThumbnail(path));
+            }
+            else
+            {
+                emit signalFinished(QImage());
+            }
+
+            continue;
+        }
+
+        if (!d->acquire(MaintenanceData::CpuBudget, m_cancel))
+        {
+            break;
+        }
+
+        if (stages & Thumbnails)
+        {
+            d->storeThumbnail(path, dimg);
+        }
+
+        if ((stages & FingerPrints) && !m_cancel)
+        {
+            qCDebug(DIGIKAM_GENERAL_LOG) << "Updating fingerprints for file:" << path;
+
+            // compute Haar fingerprint and store it to DB
+            HaarIface haarIface;
+            haarIface.indexImage(info.id(), dimg);
+        }
+
+        if ((stages & ImageQuality) && !m_cancel)
+        {
+            // Analyze the image at the size used by the image quality sorter,
+            // the image decoded for the face detection is larger.
+
+            DImg qualityImg = dimg;
+
+            if ((stages & Faces) &&
+                ((dimg.width()  > Private::qualityPreviewSize) ||
+                 (dimg.height() > Private::qualityPreviewSize)))
+            {
+                qualityImg = dimg.smoothScale(Private::qualityPreviewSize, Private::qualityPreviewSize,
+                                              Qt::KeepAspectRatio);
+            }
+
+            PickLabel pick;
+            d->imgqsort = new ImageQualityParser(qualityImg, d->quality, &pick);
+            d->imgqsort->startAnalyse();
+
+            info.setPickLabel(pick);
+
+            delete d->imgqsort;
+            d->imgqsort = nullptr;
+        }
+
+        QImage qimg = dimg.smoothScale(22, 22, Qt::KeepAspectRatio).copyQImage();
+
+        d->data->releaseBudget(MaintenanceData::CpuBudget);
+
+        if (stages & Faces)
+        {
+            // The budget is released when the face pipeline has processed the image,
+            // to bound the count of decoded images kept in memory.
+
+            if (!d->acquire(MaintenanceData::FaceBudget, m_cancel))
+            {
+                break;
+            }
+
+            emit signalFaceImage(info, dimg);
+        }
+
+        // Dispatch progress to Progress Manager
+        emit signalFinished(qimg);
+    }
+
+    d->catcher->setActive(false);
+
+    if (!m_cancel)
+    {
+        emit signalDone();
+    }
+}
+
+} // namespace Digikam
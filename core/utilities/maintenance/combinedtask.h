@@ -0,0 +1,96 @@
+/* ============================================================
+ *
+ * This file is a part of digiKam project
+ * https://www.digikam.org
+ *
+ * Date        : 2026-10-19
+ * Description : Thread actions task for the combined maintenance processing.
+ *
+ * Copyright (C) 2026 by agent <agent at local>
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation;
+ * either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * ============================================================ */
+
+#ifndef DIGIKAM_COMBINED_TASK_H
+#define DIGIKAM_COMBINED_TASK_H
+
+// Qt includes
+
+#include <QImage>
+
+// Local includes
+
+#include "actionthreadbase.h"
+#include "dimg.h"
+#include "iteminfo.h"
+
+namespace Digikam
+{
+
+class ImageQualityContainer;
+class MaintenanceData;
+
+/**
+ * Run the maintenance stages which need the image of an item with a single decoding of the file,
+ * at the largest size needed by the stages to run on the item.
+ *
+ * The files are decoded within the I/O budget of the MaintenanceData, and the thumbnail,
+ * fingerprint and image quality stages are run within its CPU budget. The images for the face
+ * detection are passed with signalFaceImage(), within its face budget, which is released by
+ * the receiver when the face pipeline has processed the image.
+ */
+class CombinedTask : public ActionJob
+{
+    Q_OBJECT
+
+public:
+
+    enum Stage
+    {
+        Thumbnails   = 0x01,
+        FingerPrints = 0x02,
+        ImageQuality = 0x04,
+        Faces        = 0x08
+    };
+
+public:
+
+    explicit CombinedTask();
+    ~CombinedTask();
+
+    void setQuality(const ImageQualityContainer& quality);
+    void setSkipScannedFaces(bool skip);
+    void setMaintenanceData(MaintenanceData* const data=nullptr);
+
+Q_SIGNALS:
+
+    void signalFinished(const QImage&);
+    void signalFaceImage(const ItemInfo&, const DImg&);
+
+public Q_SLOTS:
+
+    void slotCancel();
+
+protected:
+
+    void run();
+
+private:
+
+    class Private;
+    Private* const d;
+};
+
+} // namespace Digikam
+
+#endif // DIGIKAM_COMBINED_TASK_H
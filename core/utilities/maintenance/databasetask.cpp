@@ -127,6 +127,7 @@ void DatabaseTask::run()
             else
             {
                 qCDebug(DIGIKAM_DATABASE_LOG) << "Finished vacuuming of core DB. Integrity check after vacuuming was positive.";
+                CoreDbAccess().db()->optimize();
                 emit signalFinished(true, true);
             }
         }
@@ -159,6 +160,7 @@ void DatabaseTask::run()
                 else
                 {
                     qCDebug(DIGIKAM_DATABASE_LOG) << "Finished vacuuming of thumbnails DB. Integrity check after vacuuming was positive.";
+                    ThumbsDbAccess().db()->optimize();
                     emit signalFinished(true, true);
                 }
             }
@@ -195,6 +197,7 @@ void DatabaseTask::run()
             else
             {
                 qCDebug(DIGIKAM_DATABASE_LOG) << "Finished vacuuming of recognition DB. Integrity check after vacuuming was positive.";
+                RecognitionDatabase().optimize();
                 emit signalFinished(true, true);
             }
         }
@@ -227,6 +230,7 @@ void DatabaseTask::run()
                 else
                 {
                     qCDebug(DIGIKAM_DATABASE_LOG) << "Finished vacuuming of similarity DB. Integrity check after vacuuming was positive.";
+                    SimilarityDbAccess().db()->optimize();
                     emit signalFinished(true, true);
                 }
             }
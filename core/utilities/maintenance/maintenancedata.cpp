@@ -26,6 +26,7 @@
 // Qt includes
 
 #include <QMutex>
+#include <QSemaphore>
 
 // Local includes
 
@@ -52,6 +53,9 @@ public:
 
     bool                          rebuildAllFingerprints;
 
+    QHash<qlonglong, int>         itemStages;
+    QSemaphore                    budgets[3];
+
     QMutex                        mutex;
 };
 
@@ -100,6 +104,19 @@ void MaintenanceData::setRebuildAllFingerprints(bool b)
     d->rebuildAllFingerprints = b;
 }
 
+void MaintenanceData::setItemStages(const QHash<qlonglong, int>& stages)
+{
+    d->itemStages = stages;
+}
+
+void MaintenanceData::setBudget(Budget budget, int count)
+{
+    QSemaphore& semaphore = d->budgets[budget];
+
+    semaphore.acquire(semaphore.available());
+    semaphore.release(qMax(count, 1));
+}
+
 qlonglong MaintenanceData::getImageId() const
 {
     d->mutex.lock();
@@ -189,4 +206,20 @@ bool MaintenanceData::getRebuildAllFingerprints() const
     return d->rebuildAllFingerprints;
 }
 
+int MaintenanceData::getItemStages(qlonglong id) const
+{
+    // Only read while the tasks are running.
+    return d->itemStages.value(id);
+}
+
+bool MaintenanceData::acquireBudget(Budget budget, int timeout) const
+{
+    return d->budgets[budget].tryAcquire(1, timeout);
+}
+
+void MaintenanceData::releaseBudget(Budget budget) const
+{
+    d->budgets[budget].release();
+}
+
 } // namespace Digikam
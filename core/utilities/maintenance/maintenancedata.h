@@ -24,6 +24,10 @@
 #ifndef DIGIKAM_MAINTENANCE_DATA_H
 #define DIGIKAM_MAINTENANCE_DATA_H
 
+// Qt includes
+
+#include <QHash>
+
 // Local includes
 
 #include "iteminfo.h"
@@ -36,6 +40,20 @@ class ImageQualitySettings;
 
 class MaintenanceData
 {
+public:
+
+    /**
+     * The resources shared by the tasks of a combined processing: the count of files read and decoded
+     * at the same time, of images analyzed at the same time, and of decoded images waiting for the
+     * face detection.
+     */
+    enum Budget
+    {
+        IoBudget = 0,
+        CpuBudget,
+        FaceBudget
+    };
+
 public:
 
     explicit MaintenanceData();
@@ -50,6 +68,23 @@ public:
 
     void      setRebuildAllFingerprints(bool b);
 
+    /**
+     * The stages of the combined processing to run on each item, by image id.
+     */
+    void      setItemStages(const QHash<qlonglong, int>& stages);
+    int       getItemStages(qlonglong id)  const;
+
+    /**
+     * Set the count of units of a budget, when no task is running.
+     */
+    void      setBudget(Budget budget, int count);
+
+    /**
+     * Take an unit of a budget, waiting at most timeout milliseconds. Return false on timeout.
+     */
+    bool      acquireBudget(Budget budget, int timeout) const;
+    void      releaseBudget(Budget budget)              const;
+
     qlonglong getImageId()                 const;
     int       getThumbnailId()             const;
     QString   getImagePath()               const;
@@ -49,6 +49,8 @@
 #include "progressmanager.h"
 #include "facesdetector.h"
 #include "dbcleaner.h"
+#include "combinedprocessor.h"
+#include "combinedtask.h"
 
 namespace Digikam
 {
@@ -60,6 +62,7 @@ public:
     explicit Private()
     {
         running               = false;
+        combinedStages        = 0;
         newItemsFinder        = nullptr;
         thumbsGenerator       = nullptr;
         fingerPrintsGenerator = nullptr;
@@ -68,10 +71,14 @@ public:
         imageQualitySorter    = nullptr;
         facesDetector         = nullptr;
         databaseCleaner       = nullptr;
+        combinedProcessor     = nullptr;
     }
 
     bool                   running;
 
+    /// The stages run by the combined processor, see CombinedTask::Stage.
+    int                    combinedStages;
+
     QTime                  duration;
 
     MaintenanceSettings    settings;
@@ -84,6 +91,7 @@ public:
     ImageQualitySorter*    imageQualitySorter;
     FacesDetector*         facesDetector;
     DbCleaner*             databaseCleaner;
+    CombinedProcessor*     combinedProcessor;
 };
 
 MaintenanceMngr::MaintenanceMngr(QObject* const parent)
@@ -132,6 +140,12 @@ void MaintenanceMngr::slotToolCompleted(ProgressItem* tool)
         d->databaseCleaner = nullptr;
         stage3();
     }
+    else if (tool == dynamic_cast<ProgressItem*>(d->combinedProcessor))
+    {
+        // The thumbnails and the fingerprints are done, the duplicates can be searched.
+        d->combinedProcessor = nullptr;
+        stage5();
+    }
     else if (tool == dynamic_cast<ProgressItem*>(d->thumbsGenerator))
     {
         d->thumbsGenerator = nullptr;
@@ -173,7 +187,8 @@ void MaintenanceMngr::slotToolCanceled(ProgressItem* tool)
         tool == dynamic_cast<ProgressItem*>(d->databaseCleaner)       ||
         tool == dynamic_cast<ProgressItem*>(d->facesDetector)         ||
         tool == dynamic_cast<ProgressItem*>(d->imageQualitySorter)    ||
-        tool == dynamic_cast<ProgressItem*>(d->metadataSynchronizer))
+        tool == dynamic_cast<ProgressItem*>(d->metadataSynchronizer)  ||
+        tool == dynamic_cast<ProgressItem*>(d->combinedProcessor))
     {
         cancel();
     }
@@ -236,7 +251,19 @@ void MaintenanceMngr::stage3()
 {
     qCDebug(DIGIKAM_GENERAL_LOG) << "stage3";
 
-    if (d->settings.thumbnails)
+    // When several tools decode the images, they are run together to decode each image once.
+
+    d->combinedStages = CombinedProcessor::combinedStages(d->settings);
+
+    if (d->combinedStages)
+    {
+        d->settings.faceSettings.useFullCpu = d->settings.useMutiCoreCPU;
+        d->combinedProcessor                = new CombinedProcessor(d->settings, d->combinedStages);
+        d->combinedProcessor->setNotificationEnabled(false);
+        d->combinedProcessor->setUseMultiCoreCPU(d->settings.useMutiCoreCPU);
+        d->combinedProcessor->start();
+    }
+    else if (d->settings.thumbnails)
     {
         bool rebuildAll = (d->settings.scanThumbs == false);
         AlbumList list;
@@ -297,7 +324,7 @@ void MaintenanceMngr::stage6()
 {
     qCDebug(DIGIKAM_GENERAL_LOG) << "stage6";
 
-    if (d->settings.faceManagement)
+    if (d->settings.faceManagement && !(d->combinedStages & CombinedTask::Faces))
     {
         // NOTE : Use multi-core CPU option is passed through FaceScanSettings
         d->settings.faceSettings.useFullCpu = d->settings.useMutiCoreCPU;
@@ -315,7 +342,8 @@ void MaintenanceMngr::stage7()
 {
     qCDebug(DIGIKAM_GENERAL_LOG) << "stage7";
 
-    if (d->settings.qualitySort && d->settings.quality.enableSorter)
+    if (d->settings.qualitySort && d->settings.quality.enableSorter &&
+        !(d->combinedStages & CombinedTask::ImageQuality))
     {
         AlbumList list;
         list << d->settings.albums;
@@ -31,6 +31,7 @@
 // Local includes
 
 #include "album.h"
+#include "digikam_export.h"
 #include "facescansettings.h"
 #include "haariface.h"
 #include "imagequalitycontainer.h"
@@ -40,7 +41,7 @@
 namespace Digikam
 {
 
-class MaintenanceSettings
+class DIGIKAM_EXPORT MaintenanceSettings
 {
 
 public:
@@ -106,7 +107,7 @@ public:
 };
 
 //! qDebug() stream operator. Writes property @a s to the debug output in a nicely formatted way.
-QDebug operator<<(QDebug dbg, const MaintenanceSettings& s);
+DIGIKAM_EXPORT QDebug operator<<(QDebug dbg, const MaintenanceSettings& s);
 
 } // namespace Digikam
 
@@ -36,6 +36,7 @@
 #include "thumbstask.h"
 #include "fingerprintstask.h"
 #include "imagequalitytask.h"
+#include "combinedtask.h"
 #include "imagequalitycontainer.h"
 #include "databasetask.h"
 #include "maintenancedata.h"
@@ -170,6 +171,57 @@ void MaintenanceThread::sortByImageQuality(const QStringList& paths, const Image
     appendJobs(collection);
 }
 
+void MaintenanceThread::processCombined(const ItemInfoList& items, const QHash<qlonglong, int>& stages,
+                                        bool rebuildAllFingerprints, const ImageQualityContainer& quality,
+                                        bool skipScannedFaces)
+{
+    ActionJobCollection collection;
+
+    data->setItemInfos(items);
+    data->setItemStages(stages);
+    data->setRebuildAllFingerprints(rebuildAllFingerprints);
+
+    // The files are read and decoded by a few tasks at a time, not to thrash the disks,
+    // while the other tasks analyze the images already decoded on all the cores.
+
+    const int cpuCount  = maximumNumberOfThreads();
+    const int ioCount   = (cpuCount > 1) ? 2 : 1;
+
+    data->setBudget(MaintenanceData::IoBudget,   ioCount);
+    data->setBudget(MaintenanceData::CpuBudget,  cpuCount);
+    data->setBudget(MaintenanceData::FaceBudget, 2 * cpuCount);
+
+    setMaximumNumberOfThreads(cpuCount + ioCount);
+
+    for (int i = 1 ; i <= maximumNumberOfThreads() ; ++i)
+    {
+        CombinedTask* const t = new CombinedTask();
+        t->setQuality(quality);
+        t->setSkipScannedFaces(skipScannedFaces);
+        t->setMaintenanceData(data);
+
+        connect(t, SIGNAL(signalFinished(QImage)),
+                this, SIGNAL(signalAdvance(QImage)));
+
+        connect(t, SIGNAL(signalFaceImage(ItemInfo,DImg)),
+                this, SIGNAL(signalFaceImage(ItemInfo,DImg)));
+
+        connect(this, SIGNAL(signalCanceled()),
+                t, SLOT(slotCancel()), Qt::QueuedConnection);
+
+        collection.insert(t, 0);
+
+        qCDebug(DIGIKAM_GENERAL_LOG) << "Creating a combined task for processing items.";
+    }
+
+    appendJobs(collection);
+}
+
+void MaintenanceThread::releaseFaceImage()
+{
+    data->releaseBudget(MaintenanceData::FaceBudget);
+}
+
 void MaintenanceThread::computeDatabaseJunk(bool thumbsDb, bool facesDb, bool similarityDb)
 {
     ActionJobCollection collection;
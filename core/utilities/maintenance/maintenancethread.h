@@ -25,12 +25,17 @@
 #ifndef DIGIKAM_MAINTENANCE_THREAD_H
 #define DIGIKAM_MAINTENANCE_THREAD_H
 
+// Qt includes
+
+#include <QHash>
+
 // Local includes
 
 #include "actionthreadbase.h"
 #include "metadatasynchronizer.h"
 #include "iteminfo.h"
 #include "identity.h"
+#include "dimg.h"
 
 class QImage;
 
@@ -56,6 +61,17 @@ public:
     void generateFingerprints(const QList<qlonglong>& itemIds, bool rebuildAll);
     void sortByImageQuality(const QStringList& paths, const ImageQualityContainer& quality);
 
+    /**
+     * Run the stages of the combined processing on the items, as given for each image id
+     * by stages with the flags of CombinedTask::Stage. The images for the face detection are
+     * emitted with signalFaceImage(), and releaseFaceImage() must be called when each one
+     * has been processed.
+     */
+    void processCombined(const ItemInfoList& items, const QHash<qlonglong, int>& stages,
+                         bool rebuildAllFingerprints, const ImageQualityContainer& quality,
+                         bool skipScannedFaces);
+    void releaseFaceImage();
+
     void computeDatabaseJunk(bool thumbsDb=false, bool facesDb=false, bool similarityDb=false);
     void cleanCoreDb(const QList<qlonglong>& imageIds);
     void cleanThumbsDb(const QList<int>& thumbnailIds);
@@ -81,6 +97,10 @@ Q_SIGNALS:
      */
     void signalAdvance();
 
+    /** Emit the decoded image of an item for the face detection of the combined processing.
+     */
+    void signalFaceImage(const ItemInfo&, const DImg&);
+
     /** Emit when a items list have been fully processed.
      */
     void signalCompleted();
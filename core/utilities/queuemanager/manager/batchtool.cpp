@@ -46,6 +46,7 @@
 #include "dimgloaderobserver.h"
 #include "dimgthreadedfilter.h"
 #include "filereadwritelock.h"
+#include "pointfilterchain.h"
 #include "batchtoolutils.h"
 #include "jpegsettings.h"
 #include "pngsettings.h"
@@ -71,7 +72,8 @@ public:
         observer(nullptr),
         toolGroup(BaseTool),
         rawLoadingRule(QueueSettings::DEMOSAICING),
-        plugin(nullptr)
+        plugin(nullptr),
+        pointFilterChain(nullptr)
     {
     }
 
@@ -107,6 +109,8 @@ public:
     QueueSettings::RawLoadingRule rawLoadingRule;
 
     DPluginBqm*                   plugin;
+
+    PointFilterChain*             pointFilterChain;
 };
 
 class Q_DECL_HIDDEN BatchToolObserver : public DImgLoaderObserver
@@ -459,6 +463,11 @@ bool BatchTool::savefromDImg() const
         return true;
     }
 
+    if (d->pointFilterChain)
+    {
+        d->pointFilterChain->apply(d->image);
+    }
+
     DImg::FORMAT detectedFormat = d->image.detectedFormat();
     QString frm                 = outputSuffix().toUpper();
     bool resetOrientation       = getResetExifOrientationAllowed() &&
@@ -553,8 +562,34 @@ bool BatchTool::apply()
     return toolOperations();
 }
 
+void BatchTool::setPointFilterChain(PointFilterChain* const chain)
+{
+    d->pointFilterChain = chain;
+}
+
 void BatchTool::applyFilter(DImgThreadedFilter* const filter)
 {
+    if (d->pointFilterChain)
+    {
+        if (d->pointFilterChain->addFilter(filter, d->image))
+        {
+            // Image data will be computed later with the other chained filters.
+            d->image.addFilterAction(filter->filterAction());
+            return;
+        }
+
+        // The filter cannot be chained: compute pending filters first.
+        d->pointFilterChain->apply(d->image);
+    }
+
+    // Filters which support it are processed by bands, in place, to reduce memory usage on large images.
+    filter->setTiledProcessing(true);
+
+    if (supportsPointFilterChain())
+    {
+        // The filter was configured without image, see supportsPointFilterChain().
+        filter->setupFilter(d->image.copyImageData());
+    }
     filter->startFilterDirectly();
 
     if (isCancelled())
@@ -46,6 +46,7 @@ namespace Digikam
 class DImgBuiltinFilter;
 class DImgThreadedFilter;
 class DPluginBqm;
+class PointFilterChain;
 
 /** A map of batch tool settings (setting key, setting value).
  */
@@ -210,6 +211,19 @@ public:
      */
     bool apply();
 
+    /** Set the chain used to defer the point filters run by applyFilter(). Chained filters
+     *  are applied to image data in one pass with the ones of adjacent tools, when image is saved
+     *  or when a tool which does not support chaining is processed. See PointFilterChain for details.
+     */
+    void setPointFilterChain(PointFilterChain* const chain);
+
+    /** Re-implement this method and return true if the tool only changes image data through applyFilter()
+     *  with filters supported by PointFilterChain (BCG, Curves, Color Balance, HSL, White Balance, etc...).
+     *  Such a tool constructs its filter without image, as the filter is only run on the image by applyFilter()
+     *  when it cannot be chained. This method return false by default.
+     */
+    virtual bool supportsPointFilterChain() const { return false; };
+
     /** Return version of tool. By default, ID is 1. Re-implement this method and increase this ID when tool settings change.
      */
     virtual int toolVersion() const { return 1; };
@@ -41,6 +41,7 @@
 #include "iteminfo.h"
 #include "batchtool.h"
 #include "batchtoolsfactory.h"
+#include "pointfilterchain.h"
 #include "dfileoperations.h"
 
 namespace Digikam
@@ -141,6 +142,9 @@ void Task::run()
     DImg        tmpImage;
     QString     errMsg;
 
+    // Per-channel point filters from adjacent color tools, applied together in one pass.
+    PointFilterChain pointFilters;
+
     // ItemInfo must be tread-safe.
     ItemInfo source = ItemInfo::fromUrl(d->tools.m_itemUrl);
     bool timeAdjust  = false;
@@ -157,6 +161,16 @@ void Task::run()
                  << " :: group= "    << set.group
                  << " :: wurl= "     << workUrl;
 
+        if (d->tool->supportsPointFilterChain())
+        {
+            d->tool->setPointFilterChain(&pointFilters);
+        }
+        else
+        {
+            // This tool works on image data: apply the filters pending from previous tools first.
+            pointFilters.apply(tmpImage);
+        }
+
         d->tool->setImageData(tmpImage);
         d->tool->setItemInfo(source);
         d->tool->setInputUrl(inUrl);
@@ -28,12 +28,14 @@
 #include <QPainter>
 #include <QApplication>
 #include <QDesktopWidget>
+#include <QMimeDatabase>
 
 // Local includes
 
 #include "digikam_debug.h"
 #include "dimg.h"
 #include "previewloadthread.h"
+#include "previewpreloader.h"
 
 namespace Digikam
 {
@@ -46,7 +48,7 @@ public:
     explicit Private()
       : deskSize(1024),
         previewThread(nullptr),
-        previewPreloadThread(nullptr)
+        preloader(nullptr)
     {
     }
 
@@ -59,7 +61,7 @@ public:
 
     DImg                preview;
     PreviewLoadThread*  previewThread;
-    PreviewLoadThread*  previewPreloadThread;
+    PreviewPreloader*   preloader;
 };
 
 SlideImage::SlideImage(QWidget* const parent)
@@ -71,8 +73,8 @@ SlideImage::SlideImage(QWidget* const parent)
     setWindowFlags(Qt::FramelessWindowHint);
     setMouseTracking(true);
 
-    d->previewThread        = new PreviewLoadThread();
-    d->previewPreloadThread = new PreviewLoadThread();
+    d->previewThread = new PreviewLoadThread();
+    d->preloader     = new PreviewPreloader(this);
 
     connect(d->previewThread, SIGNAL(signalImageLoaded(LoadingDescription,DImg)),
             this, SLOT(slotGotImagePreview(LoadingDescription,DImg)));
@@ -81,7 +83,7 @@ SlideImage::SlideImage(QWidget* const parent)
 SlideImage::~SlideImage()
 {
     delete d->previewThread;
-    delete d->previewPreloadThread;
+    delete d->preloader;
     delete d;
 }
 
@@ -91,6 +93,10 @@ void SlideImage::setPreviewSettings(const PreviewSettings& settings)
     // calculate preview size which is used for fast previews
     QSize desktopSize  = QApplication::desktop()->screenGeometry(parentWidget()).size();
     d->deskSize        = qMax(640, qMax(desktopSize.height(), desktopSize.width()));
+
+    // Same settings as the loading of the current image, to find the preloaded previews in the cache.
+
+    d->preloader->setPreviewSettings(d->previewSettings, d->deskSize);
 }
 
 void SlideImage::setLoadUrl(const QUrl& url)
@@ -99,9 +105,33 @@ void SlideImage::setLoadUrl(const QUrl& url)
     d->previewThread->load(url.toLocalFile(), d->previewSettings, d->deskSize);
 }
 
-void SlideImage::setPreloadUrl(const QUrl& url)
+void SlideImage::setPreloadUrls(const QList<QUrl>& urls, bool loop, int interval)
+{
+    QMimeDatabase mimeDB;
+    QStringList   files;
+
+    foreach (const QUrl& url, urls)
+    {
+        // The videos are not preloaded.
+
+        if (mimeDB.mimeTypeForFile(url.toLocalFile(), QMimeDatabase::MatchExtension)
+                                  .name().startsWith(QLatin1String("video/")))
+        {
+            files << QString();
+        }
+        else
+        {
+            files << url.toLocalFile();
+        }
+    }
+
+    d->preloader->setFiles(files, loop);
+    d->preloader->setInterval(interval);
+}
+
+void SlideImage::setPreloadIndex(int index)
 {
-    d->previewPreloadThread->load(url.toLocalFile(), d->previewSettings, d->deskSize);
+    d->preloader->setCurrentIndex(index);
 }
 
 void SlideImage::paintEvent(QPaintEvent*)
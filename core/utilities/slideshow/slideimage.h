@@ -50,7 +50,13 @@ public:
 
     void setPreviewSettings(const PreviewSettings& settings);
     void setLoadUrl(const QUrl& url);
-    void setPreloadUrl(const QUrl& url);
+
+    /**
+     * The items of the slideshow, and the interval between them in milliseconds,
+     * used to preload the previews around the current item.
+     */
+    void setPreloadUrls(const QList<QUrl>& urls, bool loop, int interval);
+    void setPreloadIndex(int index);
 
 Q_SIGNALS:
 
@@ -126,6 +126,7 @@ SlideShow::SlideShow(DInfoInterface* const iface, const SlideShowSettings& setti
 
     d->imageView = new SlideImage(this);
     d->imageView->setPreviewSettings(d->settings.previewSettings);
+    d->imageView->setPreloadUrls(d->settings.fileList, d->settings.loop, d->settings.delay * 1000);
     d->imageView->installEventFilter(this);
 
     connect(d->imageView, SIGNAL(signalImageLoaded(bool)),
@@ -372,7 +373,7 @@ void SlideShow::slotImageLoaded(bool loaded)
                 d->osd->pause(false);
             }
 
-            preloadNextItem();
+            preloadItems();
         }
     }
     else
@@ -387,7 +388,7 @@ void SlideShow::slotImageLoaded(bool loaded)
             d->videoView->setCurrentUrl(currentItem());
         }
 #else
-        preloadNextItem();
+        preloadItems();
 #endif
     }
 }
@@ -412,7 +413,7 @@ void SlideShow::slotVideoLoaded(bool loaded)
         }
     }
 
-    preloadNextItem();
+    preloadItems();
 }
 
 void SlideShow::slotVideoFinished()
@@ -433,34 +434,14 @@ void SlideShow::endOfSlide()
     d->osd->toolBar()->setEnabledPrev(false);
 }
 
-void SlideShow::preloadNextItem()
+void SlideShow::preloadItems()
 {
-    int index = d->fileIndex + 1;
-    int num   = d->settings.count();
+    // The items around the current one are preloaded when it is displayed,
+    // to not delay its loading.
 
-    if (index >= num)
+    if ((d->fileIndex >= 0) && (d->fileIndex < d->settings.count()))
     {
-        if (d->settings.loop)
-        {
-            index = 0;
-        }
-    }
-
-    if (index < num)
-    {
-        QUrl nextItem = d->settings.fileList.value(index);
-
-#ifdef HAVE_MEDIAPLAYER
-        QMimeDatabase mimeDB;
-
-        if (mimeDB.mimeTypeForFile(nextItem.toLocalFile())
-                                   .name().startsWith(QLatin1String("video/")))
-        {
-            return;
-        }
-#endif
-
-        d->imageView->setPreloadUrl(nextItem);
+        d->imageView->setPreloadIndex(d->fileIndex);
     }
 }
 
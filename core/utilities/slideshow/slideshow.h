@@ -106,7 +106,7 @@ private:
 
     void setCurrentView(SlideShowViewMode);
     bool eventFilter(QObject* obj, QEvent* ev) override;
-    void preloadNextItem();
+    void preloadItems();
     void endOfSlide();
     void inhibitScreenSaver();
     void allowScreenSaver();